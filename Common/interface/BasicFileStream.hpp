@@ -70,8 +70,16 @@ public:
 
     virtual bool DILIGENT_CALL_TYPE IsValid() override;
 
+    /// Returns a data blob with the next Size bytes of the stream and advances the stream position.
+
+    /// If the stream was opened for reading, the range is mapped into memory (see Diligent::FileMappedDataBlob).
+    /// Otherwise, or if the file cannot be mapped, the data is read into an uninitialized data blob.
+    /// Returns null if there is not enough data in the stream.
+    RefCntAutoPtr<IDataBlob> MapBlob(size_t Size);
+
 private:
-    FileWrapper m_FileWrpr;
+    FileWrapper           m_FileWrpr;
+    const EFileAccessMode m_Access;
 };
 
 } // namespace Diligent
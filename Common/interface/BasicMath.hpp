@@ -53,6 +53,7 @@
 #include <iostream>
 
 #include "HashUtils.hpp"
+#include "../../Platforms/interface/Intrinsics.hpp"
 
 #ifdef _MSC_VER
 #    pragma warning(push)
@@ -2006,6 +2007,79 @@ template <class T> struct Matrix4x4
     }
 };
 
+#if DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+#    define DILIGENT_MATH_SIMD_ENABLED 1
+#endif
+
+#if DILIGENT_MATH_SIMD_ENABLED
+// Four-wide float kernels used by the float specializations of matrix operations.
+// The implementation is selected at compile time: SSE2 on x86/x64, NEON on ARM.
+// Only matrix multiplication and the batched transforms use them; other operations
+// (e.g. inverse, transpose and vector arithmetic) remain scalar.
+namespace SIMD
+{
+
+#    if DILIGENT_SSE2_ENABLED
+using Float4Reg = __m128;
+
+inline Float4Reg Load4(const float* p) { return _mm_loadu_ps(p); }
+inline void      Store4(float* p, Float4Reg v) { _mm_storeu_ps(p, v); }
+inline Float4Reg Splat(float s) { return _mm_set1_ps(s); }
+inline Float4Reg MulAdd(Float4Reg a, Float4Reg b, Float4Reg c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+inline Float4Reg Mul(Float4Reg a, Float4Reg b) { return _mm_mul_ps(a, b); }
+#    elif DILIGENT_NEON_ENABLED
+using Float4Reg = float32x4_t;
+
+inline Float4Reg Load4(const float* p) { return vld1q_f32(p); }
+inline void      Store4(float* p, Float4Reg v) { vst1q_f32(p, v); }
+inline Float4Reg Splat(float s) { return vdupq_n_f32(s); }
+inline Float4Reg MulAdd(Float4Reg a, Float4Reg b, Float4Reg c) { return vmlaq_f32(c, a, b); }
+inline Float4Reg Mul(Float4Reg a, Float4Reg b) { return vmulq_f32(a, b); }
+#    endif
+
+// Computes the row vector {x, y, z, w} multiplied by the matrix given by its rows.
+inline Float4Reg MulVecMat(float x, float y, float z, float w, const Float4Reg (&Rows)[4])
+{
+    Float4Reg r = Mul(Splat(x), Rows[0]);
+    r           = MulAdd(Splat(y), Rows[1], r);
+    r           = MulAdd(Splat(z), Rows[2], r);
+    r           = MulAdd(Splat(w), Rows[3], r);
+    return r;
+}
+
+inline void LoadRows(const float* pMat, Float4Reg (&Rows)[4])
+{
+    Rows[0] = Load4(pMat + 0);
+    Rows[1] = Load4(pMat + 4);
+    Rows[2] = Load4(pMat + 8);
+    Rows[3] = Load4(pMat + 12);
+}
+
+// Multiplies row-major 4x4 matrix pSrc by the matrix given by its rows and writes the result to pDst.
+// pSrc and pDst may point to the same memory.
+inline void MulMatMat(const float* pSrc, const Float4Reg (&Rows)[4], float* pDst)
+{
+    Float4Reg r[4];
+    for (int i = 0; i < 4; ++i)
+        r[i] = MulVecMat(pSrc[i * 4 + 0], pSrc[i * 4 + 1], pSrc[i * 4 + 2], pSrc[i * 4 + 3], Rows);
+    for (int i = 0; i < 4; ++i)
+        Store4(pDst + i * 4, r[i]);
+}
+
+} // namespace SIMD
+
+template <>
+inline Matrix4x4<float> Matrix4x4<float>::Mul(const Matrix4x4<float>& m1, const Matrix4x4<float>& m2)
+{
+    SIMD::Float4Reg Rows[4];
+    SIMD::LoadRows(m2.Data(), Rows);
+
+    Matrix4x4<float> mOut;
+    SIMD::MulMatMat(m1.Data(), Rows, mOut.Data());
+    return mOut;
+}
+#endif
+
 template <typename T>
 inline constexpr Matrix4x4<T> operator*(const Matrix4x4<T>& Mat, T s)
 {
@@ -2317,6 +2391,66 @@ using int4x4 = Matrix4x4<Int32>;
 using int3x3 = Matrix3x3<Int32>;
 using int2x2 = Matrix2x2<Int32>;
 
+/// Transforms an array of points by a matrix: pDst[i] = pSrc[i] * m.
+
+/// Same as float3 * float4x4, the result is divided by the w component.
+/// pSrc and pDst may point to the same array.
+inline void TransformPoints(const float3* pSrc, float3* pDst, size_t Count, const float4x4& m)
+{
+#if DILIGENT_MATH_SIMD_ENABLED
+    SIMD::Float4Reg Rows[4];
+    SIMD::LoadRows(m.Data(), Rows);
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const SIMD::Float4Reg v = SIMD::MulVecMat(pSrc[i].x, pSrc[i].y, pSrc[i].z, 1.f, Rows);
+
+        // Perspective divide: one reciprocal and a vector multiply instead of three divisions
+        alignas(16) float r[4];
+        SIMD::Store4(r, v);
+        SIMD::Store4(r, SIMD::Mul(v, SIMD::Splat(1.f / r[3])));
+        pDst[i] = float3{r[0], r[1], r[2]};
+    }
+#else
+    for (size_t i = 0; i < Count; ++i)
+        pDst[i] = pSrc[i] * m;
+#endif
+}
+
+/// Transforms an array of vectors by a matrix: pDst[i] = pSrc[i] * m.
+
+/// pSrc and pDst may point to the same array.
+inline void TransformVectors(const float4* pSrc, float4* pDst, size_t Count, const float4x4& m)
+{
+#if DILIGENT_MATH_SIMD_ENABLED
+    SIMD::Float4Reg Rows[4];
+    SIMD::LoadRows(m.Data(), Rows);
+    for (size_t i = 0; i < Count; ++i)
+    {
+        const float4& v = pSrc[i];
+        SIMD::Store4(pDst[i].Data(), SIMD::MulVecMat(v.x, v.y, v.z, v.w, Rows));
+    }
+#else
+    for (size_t i = 0; i < Count; ++i)
+        pDst[i] = pSrc[i] * m;
+#endif
+}
+
+/// Multiplies an array of matrices by a matrix: pDst[i] = pSrc[i] * m.
+
+/// pSrc and pDst may point to the same array.
+inline void MultiplyMatrices(const float4x4* pSrc, float4x4* pDst, size_t Count, const float4x4& m)
+{
+#if DILIGENT_MATH_SIMD_ENABLED
+    SIMD::Float4Reg Rows[4];
+    SIMD::LoadRows(m.Data(), Rows);
+    for (size_t i = 0; i < Count; ++i)
+        SIMD::MulMatMat(pSrc[i].Data(), Rows, pDst[i].Data());
+#else
+    for (size_t i = 0; i < Count; ++i)
+        pDst[i] = pSrc[i] * m;
+#endif
+}
+
 template <typename T = float>
 struct Quaternion
 {
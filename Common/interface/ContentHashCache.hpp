@@ -0,0 +1,332 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Content-addressed cache of byte arrays.
+
+#include <mutex>
+#include <unordered_map>
+#include <deque>
+#include <vector>
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/DataBlob.h"
+#include "../../Platforms/Basic/interface/DebugUtilities.hpp"
+#include "DataBlobImpl.hpp"
+#include "Serializer.hpp"
+
+namespace Diligent
+{
+
+/// 128-bit content hash used as the ContentHashCache key.
+struct ContentHashKey
+{
+    Uint64 Low  = 0;
+    Uint64 High = 0;
+
+    constexpr bool operator==(const ContentHashKey& RHS) const noexcept
+    {
+        return Low == RHS.Low && High == RHS.High;
+    }
+
+    struct Hasher
+    {
+        size_t operator()(const ContentHashKey& K) const noexcept
+        {
+            return static_cast<size_t>(K.Low ^ (K.High * 0x9E3779B97F4A7C15ull));
+        }
+    };
+};
+
+/// Thread-safe content-addressed cache of contiguous arrays of trivially copyable
+/// elements (e.g. std::string or std::vector<uint32_t>).
+
+/// Values are keyed by a 128-bit content hash computed by the user.
+/// The total size of the values in the cache may be limited, in which case the
+/// oldest entries are evicted when the limit is exceeded. The cache contents can be
+/// stored to a data blob and loaded back to reuse the results across runs.
+template <typename ValueType>
+class ContentHashCache
+{
+public:
+    using Key      = ContentHashKey;
+    using ElemType = typename ValueType::value_type;
+    static_assert(std::is_trivially_copyable<ElemType>::value, "Cache values must be arrays of trivially copyable elements");
+
+    struct Statistics
+    {
+        /// The number of entries in the cache.
+        size_t NumEntries = 0;
+
+        /// The total size, in bytes, of the values in the cache.
+        size_t DataSize = 0;
+
+        /// The number of successful lookups.
+        Uint32 NumHits = 0;
+
+        /// The number of failed lookups.
+        Uint32 NumMisses = 0;
+
+        /// The number of entries evicted to keep the cache size within the limit.
+        Uint32 NumEvictions = 0;
+    };
+
+    /// \param [in] Name          - Cache name used in log messages.
+    /// \param [in] Magic         - Magic number that identifies the serialized cache data.
+    /// \param [in] FormatVersion - Version of the serialized data. Data with a different
+    ///                             version is ignored by Load().
+    /// \param [in] MaxDataSize   - Maximum total size, in bytes, of the values in the cache.
+    ///                             Zero means no limit.
+    ContentHashCache(const char* Name, Uint32 Magic, Uint32 FormatVersion, size_t MaxDataSize = 0) noexcept :
+        m_Name{Name},
+        m_Magic{Magic},
+        m_FormatVersion{FormatVersion},
+        m_MaxDataSize{MaxDataSize}
+    {}
+
+    // clang-format off
+    ContentHashCache           (const ContentHashCache&) = delete;
+    ContentHashCache& operator=(const ContentHashCache&) = delete;
+    // clang-format on
+
+    /// Looks up the value for the given key.
+
+    /// \param [in]  CacheKey - Cache key.
+    /// \param [out] Value    - The value, if the key was found.
+    /// \return     true if the key was found, and false otherwise.
+    bool Find(const Key& CacheKey, ValueType& Value) const
+    {
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+
+            auto it = m_Entries.find(CacheKey);
+            if (it != m_Entries.end())
+            {
+                Value = it->second;
+                m_NumHits.fetch_add(1);
+                return true;
+            }
+        }
+
+        m_NumMisses.fetch_add(1);
+        return false;
+    }
+
+    /// Adds the value to the cache. If the key is already present, or the value alone
+    /// exceeds the size limit, the method does nothing. Otherwise, the oldest entries are
+    /// evicted until the cache size is within the limit.
+    void Add(const Key& CacheKey, ValueType Value)
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        AddEntry(CacheKey, std::move(Value));
+    }
+
+    /// Removes all entries from the cache and resets the statistics.
+    void Clear()
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        m_Entries.clear();
+        m_InsertionOrder.clear();
+        m_DataSize     = 0;
+        m_NumEvictions = 0;
+        m_NumHits.store(0);
+        m_NumMisses.store(0);
+    }
+
+    /// Returns the cache statistics.
+    Statistics GetStatistics() const
+    {
+        Statistics Stats;
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+            Stats.NumEntries   = m_Entries.size();
+            Stats.DataSize     = m_DataSize;
+            Stats.NumEvictions = m_NumEvictions;
+        }
+        Stats.NumHits   = m_NumHits.load();
+        Stats.NumMisses = m_NumMisses.load();
+        return Stats;
+    }
+
+    /// Loads the cache entries from the data previously written by Store().
+
+    /// \param [in] pData - Data blob produced by Store().
+    /// \return     true if the data were loaded successfully, and false otherwise.
+    ///
+    /// \remarks    The data are fully validated before any entry is added. The entries are
+    ///             added to the existing ones, subject to the size limit. If the data were
+    ///             produced with a different format version, nothing is loaded.
+    bool Load(const IDataBlob* pData)
+    {
+        if (pData == nullptr || pData->GetSize() == 0)
+            return false;
+
+        // Serializer does not modify the data in read mode
+        SerializedData                   Data{const_cast<void*>(pData->GetConstDataPtr()), pData->GetSize()};
+        Serializer<SerializerMode::Read> Ser{Data};
+
+        Uint32 Magic      = 0;
+        Uint32 Version    = 0;
+        Uint32 NumEntries = 0;
+        if (!Ser(Magic, Version, NumEntries) || Magic != m_Magic)
+        {
+            LOG_ERROR_MESSAGE("Data blob does not contain a valid ", m_Name);
+            return false;
+        }
+
+        if (Version != m_FormatVersion)
+        {
+            LOG_INFO_MESSAGE(m_Name, " version (", Version, ") does not match the expected version (", m_FormatVersion, "). The cache will be ignored.");
+            return false;
+        }
+
+        // The entry count comes from untrusted data, so do not reserve more entries
+        // than the remaining data can possibly hold.
+        constexpr size_t MinEntrySize = sizeof(Key::Low) + sizeof(Key::High) + sizeof(Uint32);
+        if (NumEntries > Ser.GetRemainingSize() / MinEntrySize)
+        {
+            LOG_ERROR_MESSAGE(m_Name, " data is corrupted: ", NumEntries, " entries can't fit into ", Ser.GetRemainingSize(), " bytes");
+            return false;
+        }
+
+        std::vector<std::pair<Key, ValueType>> Entries;
+        Entries.reserve(NumEntries);
+        for (Uint32 i = 0; i < NumEntries; ++i)
+        {
+            Key         CacheKey;
+            const void* pBytes = nullptr;
+            size_t      Size   = 0;
+            if (!Ser(CacheKey.Low, CacheKey.High) || !Ser.SerializeBytes(pBytes, Size) || Size % sizeof(ElemType) != 0)
+            {
+                LOG_ERROR_MESSAGE(m_Name, " data is corrupted");
+                return false;
+            }
+
+            ValueType Value(Size / sizeof(ElemType), ElemType{});
+            if (Size > 0)
+                std::memcpy(&Value[0], pBytes, Size);
+            Entries.emplace_back(CacheKey, std::move(Value));
+        }
+
+        if (!Ser.IsEnded())
+        {
+            LOG_ERROR_MESSAGE(m_Name, " data is corrupted: ", Ser.GetRemainingSize(), " unexpected bytes at the end of the data");
+            return false;
+        }
+
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        for (auto& Entry : Entries)
+            AddEntry(Entry.first, std::move(Entry.second));
+
+        return true;
+    }
+
+    /// Stores all cache entries in a data blob.
+    void Store(IDataBlob** ppData) const
+    {
+        DEV_CHECK_ERR(ppData != nullptr, "ppData must not be null");
+        DEV_CHECK_ERR(*ppData == nullptr, "Data blob pointer must be null");
+
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        const Uint32 NumEntries = static_cast<Uint32>(m_Entries.size());
+
+        // Entries are stored from the oldest to the newest so that Load() preserves the eviction order
+        auto SerializeEntries = [&](auto& Ser) {
+            bool Res = Ser(m_Magic, m_FormatVersion, NumEntries);
+            for (const Key& CacheKey : m_InsertionOrder)
+            {
+                const ValueType& Value = m_Entries.at(CacheKey);
+
+                Res = Res && Ser(CacheKey.Low, CacheKey.High);
+                Res = Res && Ser.SerializeBytes(Value.data(), Value.size() * sizeof(ElemType));
+            }
+            VERIFY_EXPR(Res);
+        };
+
+        Serializer<SerializerMode::Measure> MeasureSer;
+        SerializeEntries(MeasureSer);
+
+        RefCntAutoPtr<DataBlobImpl> pDataBlob = DataBlobImpl::Create(MeasureSer.GetSize());
+
+        SerializedData                    Data{pDataBlob->GetDataPtr(), pDataBlob->GetSize()};
+        Serializer<SerializerMode::Write> WriteSer{Data};
+        SerializeEntries(WriteSer);
+        VERIFY_EXPR(WriteSer.IsEnded());
+
+        *ppData = pDataBlob.Detach();
+    }
+
+private:
+    // Must be called with m_Mtx locked
+    void AddEntry(const Key& CacheKey, ValueType&& Value)
+    {
+        const size_t EntrySize = Value.size() * sizeof(ElemType);
+        if (m_MaxDataSize != 0 && EntrySize > m_MaxDataSize)
+            return;
+
+        if (!m_Entries.emplace(CacheKey, std::move(Value)).second)
+            return;
+
+        m_InsertionOrder.push_back(CacheKey);
+        m_DataSize += EntrySize;
+
+        while (m_MaxDataSize != 0 && m_DataSize > m_MaxDataSize)
+        {
+            VERIFY_EXPR(!m_InsertionOrder.empty());
+
+            auto it = m_Entries.find(m_InsertionOrder.front());
+            VERIFY_EXPR(it != m_Entries.end());
+            m_DataSize -= it->second.size() * sizeof(ElemType);
+            m_Entries.erase(it);
+            m_InsertionOrder.pop_front();
+            ++m_NumEvictions;
+        }
+    }
+
+private:
+    const char* const m_Name;
+    const Uint32      m_Magic;
+    const Uint32      m_FormatVersion;
+    const size_t      m_MaxDataSize;
+
+    mutable std::mutex                              m_Mtx;
+    std::unordered_map<Key, ValueType, Key::Hasher> m_Entries;
+    // Keys in the order the entries were added, used to evict the oldest entries
+    std::deque<Key> m_InsertionOrder;
+    size_t          m_DataSize     = 0;
+    Uint32          m_NumEvictions = 0;
+
+    mutable std::atomic<Uint32> m_NumHits{0};
+    mutable std::atomic<Uint32> m_NumMisses{0};
+};
+
+} // namespace Diligent
@@ -41,18 +41,77 @@
 namespace Diligent
 {
 
+/// Raw memory allocator for the data blob buffer.
+
+/// Elements that are constructed without arguments (e.g. by std::vector::resize) are
+/// value-initialized (zeroed) when InitializeData is true, and default-initialized
+/// (i.e. left uninitialized) otherwise.
+template <typename T>
+struct DataBlobAllocator : STDAllocatorRawMem<T>
+{
+    using TBase = STDAllocatorRawMem<T>;
+
+    DataBlobAllocator(const TBase& Allocator, bool _InitializeData = true) noexcept :
+        TBase{Allocator},
+        InitializeData{_InitializeData}
+    {}
+
+    template <class U>
+    DataBlobAllocator(const DataBlobAllocator<U>& other) noexcept :
+        TBase{other},
+        InitializeData{other.InitializeData}
+    {}
+
+    template <class U>
+    DataBlobAllocator& operator=(DataBlobAllocator<U>&& other) noexcept
+    {
+        TBase::operator=(std::move(other));
+        InitializeData = other.InitializeData;
+        return *this;
+    }
+
+    template <class U> struct rebind
+    {
+        typedef DataBlobAllocator<U> other;
+    };
+
+    template <class U>
+    void construct(U* p)
+    {
+        if (InitializeData)
+            ::new (p) U();
+        else
+            ::new (p) U;
+    }
+
+    template <class U, class... Args>
+    void construct(U* p, Args&&... args)
+    {
+        ::new (p) U(std::forward<Args>(args)...);
+    }
+
+    bool InitializeData = true;
+};
+
 /// Base interface for a data blob
 class DataBlobImpl final : public Diligent::ObjectBase<IDataBlob>
 {
 public:
     using TBase          = ObjectBase<IDataBlob>;
-    using DataBufferType = std::vector<Uint8, STDAllocatorRawMem<Uint8>>;
+    using DataBufferType = std::vector<Uint8, DataBlobAllocator<Uint8>>;
 
     static RefCntAutoPtr<DataBlobImpl> Create(size_t InitialSize = 0, const void* pData = nullptr);
     static RefCntAutoPtr<DataBlobImpl> Create(IMemoryAllocator* pAllocator, size_t InitialSize = 0, const void* pData = nullptr);
     static RefCntAutoPtr<DataBlobImpl> Create(DataBufferType&& DataBuff) noexcept;
     static RefCntAutoPtr<DataBlobImpl> MakeCopy(const IDataBlob* pDataBlob);
 
+    /// Creates a data blob whose memory is not initialized.
+
+    /// The contents of the blob are undefined until written by the application.
+    /// Subsequent calls to Resize() do not initialize the new memory either.
+    /// This is useful when the blob will be entirely overwritten, e.g. by reading a file.
+    static RefCntAutoPtr<DataBlobImpl> CreateUninitialized(size_t Size, IMemoryAllocator* pAllocator = nullptr);
+
     ~DataBlobImpl() override;
 
     virtual void DILIGENT_CALL_TYPE QueryInterface(const INTERFACE_ID& IID, IObject** ppInterface) override;
@@ -87,8 +146,9 @@ private:
 
     DataBlobImpl(IReferenceCounters* pRefCounters,
                  IMemoryAllocator&   Allocator,
-                 size_t              InitialSize = 0,
-                 const void*         pData       = nullptr);
+                 size_t              InitialSize    = 0,
+                 const void*         pData          = nullptr,
+                 bool                InitializeData = true);
 
     DataBlobImpl(IReferenceCounters* pRefCounters,
                  DataBufferType&&    DataBuff) noexcept;
@@ -112,6 +112,16 @@ public:
         return Ptr;
     }
 
+    // Allocation interface compatible with STDAllocator, so that the
+    // allocator can back standard containers.
+    NODISCARD void* AllocateAligned(size_t Size, size_t Alignment, const Char* /*dbgDescription*/, const char* /*dbgFileName*/, const Int32 /*dbgLineNumber*/)
+    {
+        return Allocate(Size, Alignment);
+    }
+
+    // Memory is only released when the allocator is discarded or freed.
+    void FreeAligned(void* /*Ptr*/) {}
+
     template <typename T>
     NODISCARD T* Allocate(size_t count = 1)
     {
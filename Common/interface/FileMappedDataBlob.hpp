@@ -0,0 +1,131 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Implementation of the IDataBlob interface that maps a file into memory
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Primitives/interface/DataBlob.h"
+#include "ObjectBase.hpp"
+#include "RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Data blob that maps a file or a range of a file into memory.
+
+/// The file is mapped copy-on-write: pages are read from the file on first access and
+/// are never written back, so the blob data may be modified without affecting the file.
+/// Modified pages become private to the process.
+/// The blob cannot be resized.
+///
+/// Memory mapping is supported on Windows desktop, Linux, Android and Apple platforms.
+/// On other platforms, as well as for files that cannot be mapped (e.g. Android assets),
+/// Create() returns null and the application should fall back to reading the file.
+class FileMappedDataBlob final : public ObjectBase<IDataBlob>
+{
+public:
+    using TBase = ObjectBase<IDataBlob>;
+
+    /// Expected access pattern of the mapped data.
+    /// The hint is passed to the OS (madvise on POSIX systems) and is ignored on Windows.
+    enum class AccessHint : Uint8
+    {
+        /// No special treatment
+        Normal,
+
+        /// Pages will be accessed sequentially, so the OS may read ahead aggressively
+        Sequential,
+
+        /// Pages will be accessed in random order, so read-ahead is not useful
+        Random,
+
+        /// The whole range will be needed soon, so the OS may start reading it immediately
+        WillNeed
+    };
+
+    /// Special value that indicates that the range extends to the end of the file
+    static constexpr size_t WholeFile = ~size_t{0};
+
+    /// Maps the range [Offset, Offset + Size) of the file into memory.
+
+    /// \param [in] Path   - Path to the file.
+    /// \param [in] Offset - Offset of the range in the file. Does not need to be aligned.
+    /// \param [in] Size   - Size of the range, or FileMappedDataBlob::WholeFile to map everything
+    ///                      from Offset to the end of the file.
+    /// \param [in] Hint   - Expected access pattern.
+    /// \param [in] Silent - Whether to suppress error messages.
+    ///
+    /// \return The data blob, or null if the file could not be mapped.
+    static RefCntAutoPtr<FileMappedDataBlob> Create(const Char* Path,
+                                                    size_t      Offset = 0,
+                                                    size_t      Size   = WholeFile,
+                                                    AccessHint  Hint   = AccessHint::Normal,
+                                                    bool        Silent = false);
+
+    /// Returns true if memory-mapped files are supported on the current platform
+    static bool IsSupported();
+
+    ~FileMappedDataBlob() override;
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_DataBlob, TBase)
+
+    /// Resizing is not supported by the file-mapped data blob
+    virtual void DILIGENT_CALL_TYPE Resize(size_t NewSize) override;
+
+    /// Returns the size of the mapped range
+    virtual size_t DILIGENT_CALL_TYPE GetSize() const override;
+
+    /// Returns the pointer to the mapped data
+    virtual void* DILIGENT_CALL_TYPE GetDataPtr(size_t Offset = 0) override;
+
+    /// Returns const pointer to the mapped data
+    virtual const void* DILIGENT_CALL_TYPE GetConstDataPtr(size_t Offset = 0) const override;
+
+private:
+    template <typename AllocatorType, typename ObjectType>
+    friend class MakeNewRCObj;
+
+    FileMappedDataBlob(IReferenceCounters* pRefCounters,
+                       void*               pMapping,
+                       size_t              MappingSize,
+                       size_t              DataOffset,
+                       size_t              DataSize) noexcept;
+
+private:
+    // Start and size of the mapped view. The view starts at an offset
+    // aligned to the system allocation granularity.
+    void* const  m_pMapping    = nullptr;
+    const size_t m_MappingSize = 0;
+
+    // Requested range within the view
+    Uint8* const m_pData = nullptr;
+    const size_t m_Size  = 0;
+};
+
+} // namespace Diligent
@@ -92,6 +92,10 @@ public:
 
     static bool ReadWholeFile(const char* FilePath, std::vector<Uint8>& Data, bool Silent = false);
     static bool ReadWholeFile(const char* FilePath, IDataBlob** ppData, bool Silent = false);
+
+    /// Maps the whole file into memory, see Diligent::FileMappedDataBlob.
+    /// If the file cannot be mapped, reads it into a data blob instead.
+    static bool MapWholeFile(const char* FilePath, IDataBlob** ppData, bool Silent = false);
     static bool WriteFile(const char* FilePath, const void* Data, size_t Size, bool Silent = false);
 
 private:
@@ -0,0 +1,113 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Batched bounding box frustum culling.
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "AdvancedMath.hpp"
+#include "ThreadPool.h"
+
+namespace Diligent
+{
+
+/// Axis-aligned bounding boxes stored as a structure of arrays.
+
+/// Every array must contain at least NumBoxes elements.
+/// A box with center C and half extents E is equivalent to BoundBox{C - E, C + E}.
+struct BoundBoxesSoA
+{
+    const float* CenterX = nullptr;
+    const float* CenterY = nullptr;
+    const float* CenterZ = nullptr;
+
+    const float* HalfExtentX = nullptr;
+    const float* HalfExtentY = nullptr;
+    const float* HalfExtentZ = nullptr;
+
+    Uint32 NumBoxes = 0;
+};
+
+/// Returns the number of 32-bit words required to store the visibility mask for the given number of boxes.
+inline constexpr Uint32 GetBoxVisibilityMaskSize(Uint32 NumBoxes)
+{
+    return (NumBoxes + 31u) / 32u;
+}
+
+/// Tests an array of bounding boxes against the view frustum.
+
+/// \param[in]  Frustum         - View frustum.
+/// \param[in]  Boxes           - Bounding boxes to test.
+/// \param[out] pVisibilityMask - Visibility mask. Bit (i % 32) of element i / 32 is set if
+///                               box i is not invisible, i.e. its visibility as returned by
+///                               GetBoxVisibility(Frustum, Box, PlaneFlags) is Intersecting or FullyVisible.
+///                               The array must contain at least GetBoxVisibilityMaskSize(Boxes.NumBoxes) elements.
+///                               Unused bits of the last element are set to zero.
+/// \param[in]  PlaneFlags      - Frustum planes to test the boxes against.
+/// \param[in]  pThreadPool     - Optional thread pool. If not null, large arrays are split into
+///                               chunks that are processed by the worker threads in parallel.
+///                               The calling thread processes one of the chunks and waits for the
+///                               rest, so the pool must have at least one worker thread.
+void GetBoxesVisibility(const ViewFrustum&   Frustum,
+                        const BoundBoxesSoA& Boxes,
+                        Uint32*              pVisibilityMask,
+                        FRUSTUM_PLANE_FLAGS  PlaneFlags  = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                        IThreadPool*         pThreadPool = nullptr);
+
+/// Same as above, but additionally tests frustum corners against the box planes
+/// the same way as GetBoxVisibility(const ViewFrustumExt&, const BoundBox&, FRUSTUM_PLANE_FLAGS) does.
+void GetBoxesVisibility(const ViewFrustumExt& FrustumExt,
+                        const BoundBoxesSoA&  Boxes,
+                        Uint32*               pVisibilityMask,
+                        FRUSTUM_PLANE_FLAGS   PlaneFlags  = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                        IThreadPool*          pThreadPool = nullptr);
+
+/// Tests an array of bounding boxes against the view frustum and writes the indices of the visible boxes.
+
+/// \param[in]  Frustum            - View frustum.
+/// \param[in]  Boxes              - Bounding boxes to test.
+/// \param[out] pVisibleBoxIndices - Indices of the visible boxes in ascending order.
+///                                  The array must contain at least Boxes.NumBoxes elements.
+/// \param[in]  PlaneFlags         - Frustum planes to test the boxes against.
+/// \param[in]  pThreadPool        - Optional thread pool, see GetBoxesVisibility.
+///
+/// \return     The number of visible boxes.
+Uint32 GetVisibleBoxes(const ViewFrustum&   Frustum,
+                       const BoundBoxesSoA& Boxes,
+                       Uint32*              pVisibleBoxIndices,
+                       FRUSTUM_PLANE_FLAGS  PlaneFlags  = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                       IThreadPool*         pThreadPool = nullptr);
+
+/// Same as above, but additionally tests frustum corners against the box planes.
+Uint32 GetVisibleBoxes(const ViewFrustumExt& FrustumExt,
+                       const BoundBoxesSoA&  Boxes,
+                       Uint32*               pVisibleBoxIndices,
+                       FRUSTUM_PLANE_FLAGS   PlaneFlags  = FRUSTUM_PLANE_FLAG_FULL_FRUSTUM,
+                       IThreadPool*          pThreadPool = nullptr);
+
+} // namespace Diligent
@@ -980,6 +980,7 @@ struct HashCombiner<HasherType, GraphicsPipelineDesc> : HashCombinerBase<HasherT
         ASSERT_SIZEOF(Desc.NumRenderTargets, 1, "Hash logic below may be incorrect.");
         ASSERT_SIZEOF(Desc.SubpassIndex, 1, "Hash logic below may be incorrect.");
         ASSERT_SIZEOF(Desc.ShadingRateFlags, 1, "Hash logic below may be incorrect.");
+        ASSERT_SIZEOF(Desc.DynamicStates, 1, "Hash logic below may be incorrect.");
 
         this->m_Hasher(
             Desc.BlendDesc,
@@ -992,7 +993,8 @@ struct HashCombiner<HasherType, GraphicsPipelineDesc> : HashCombinerBase<HasherT
             ((static_cast<uint32_t>(Desc.NumViewports) << 0u) |
              (static_cast<uint32_t>(Desc.NumRenderTargets) << 8u) |
              (static_cast<uint32_t>(Desc.SubpassIndex) << 16u) |
-             (static_cast<uint32_t>(Desc.ShadingRateFlags) << 24u)));
+             (static_cast<uint32_t>(Desc.ShadingRateFlags) << 24u)),
+            Desc.DynamicStates);
 
         for (size_t i = 0; i < Desc.NumRenderTargets; ++i)
             this->m_Hasher(Desc.RTVFormats[i]);
@@ -0,0 +1,192 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::InstrumentedMemoryAllocator class
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../../Primitives/interface/MemoryAllocator.h"
+
+namespace Diligent
+{
+
+/// Memory allocator that forwards all requests to the raw allocator and aggregates
+/// allocation statistics per call site.
+
+/// A call site is identified by the description, file name and line number passed
+/// to Allocate/AllocateAligned. Every allocation is prefixed with a small header that records
+/// the site and the size, so that Free/FreeAligned can attribute the release to the right site.
+///
+/// Allocation and release counters are kept in per-thread storage and are only updated by the
+/// owning thread, so the hot path does not take locks or contend on shared cache lines. The
+/// counters are merged when a snapshot is requested. Every thread also records the peak of its own
+/// live bytes, which GetSnapshot() merges and resets, so transient peaks between snapshots are not
+/// missed. The merged peak is exact when a single thread allocates between two snapshots, and is
+/// an upper bound otherwise.
+///
+/// When SamplingInterval is greater than one, only every N-th allocation (on average) of each
+/// thread is tracked, and the reported values are scaled by N. The remaining allocations only pay
+/// for the header and a thread-local counter decrement, which makes this mode suitable for production builds.
+///
+/// The allocator can be installed as the engine raw allocator via EngineCreateInfo::pRawMemAllocator
+/// or SetRawAllocator(). It must outlive all allocations made through it.
+class InstrumentedMemoryAllocator final : public IMemoryAllocator
+{
+public:
+    explicit InstrumentedMemoryAllocator(IMemoryAllocator& RawAllocator, Uint32 SamplingInterval = 1);
+    ~InstrumentedMemoryAllocator();
+
+    /// Allocates block of memory
+    virtual void* Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final;
+
+    /// Releases memory
+    virtual void Free(void* Ptr) override final;
+
+    /// Allocates block of memory with specified alignment
+    virtual void* AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber) override final;
+
+    /// Releases memory allocated with AllocateAligned
+    virtual void FreeAligned(void* Ptr) override final;
+
+    /// Allocation statistics of a single call site
+    struct SiteStats
+    {
+        /// Site identifier. Identifiers are stable for the lifetime of the allocator
+        /// and can be used to match sites between snapshots.
+        Uint32 SiteId = 0;
+
+        /// Line number of the call site
+        Int32 LineNumber = 0;
+
+        /// Allocation description
+        std::string Description;
+
+        /// File name of the call site
+        std::string FileName;
+
+        /// The number of bytes currently allocated from this site
+        Int64 LiveBytes = 0;
+
+        /// The number of allocations from this site that have not been released yet
+        Int64 LiveAllocations = 0;
+
+        /// The maximum number of live bytes from this site (see the class description for accuracy)
+        Int64 PeakBytes = 0;
+
+        /// The total number of allocations made from this site
+        Uint64 TotalAllocations = 0;
+
+        /// The total number of bytes allocated from this site
+        Uint64 TotalBytes = 0;
+    };
+
+    /// Allocator statistics at a point in time
+    struct Snapshot
+    {
+        /// Per-site statistics, indexed by site identifier
+        std::vector<SiteStats> Sites;
+
+        /// The number of bytes currently allocated
+        Int64 LiveBytes = 0;
+
+        /// The number of allocations that have not been released yet
+        Int64 LiveAllocations = 0;
+
+        /// The maximum number of live bytes (see the class description for accuracy)
+        Int64 PeakBytes = 0;
+
+        /// The total number of allocations
+        Uint64 TotalAllocations = 0;
+
+        /// Sampling interval that was used to collect the statistics.
+        /// If it is greater than one, all values are estimates.
+        Uint32 SamplingInterval = 1;
+    };
+
+    /// Merges per-thread counters, updates the peak values and returns the current statistics.
+    Snapshot GetSnapshot() const;
+
+    /// Returns the sites whose live allocations changed between the two snapshots,
+    /// sorted by the live bytes difference in descending order.
+
+    /// LiveBytes, LiveAllocations, TotalAllocations and TotalBytes members of the returned
+    /// structures contain the differences, while PeakBytes is taken from the Current snapshot.
+    /// Sites that grew between two frames with the same workload are leak candidates.
+    static std::vector<SiteStats> GetDifference(const Snapshot& Previous, const Snapshot& Current);
+
+    Uint32 GetSamplingInterval() const { return m_SamplingInterval; }
+
+private:
+    // clang-format off
+    InstrumentedMemoryAllocator             (const InstrumentedMemoryAllocator&) = delete;
+    InstrumentedMemoryAllocator             (InstrumentedMemoryAllocator&&)      = delete;
+    InstrumentedMemoryAllocator& operator = (const InstrumentedMemoryAllocator&) = delete;
+    InstrumentedMemoryAllocator& operator = (InstrumentedMemoryAllocator&&)      = delete;
+    // clang-format on
+
+    struct SiteRecord;
+    struct ThreadState;
+
+    void* Track(void* pRawMem, size_t HeaderSize, size_t Size, const Char* dbgDescription, const char* dbgFileName, Int32 dbgLineNumber);
+    void* Untrack(void* Ptr);
+
+    ThreadState& GetThreadState();
+    Uint32       FindOrAddSite(ThreadState& State, const Char* dbgDescription, const char* dbgFileName, Int32 dbgLineNumber);
+    SiteRecord*  GetSite(Uint32 SiteId) const;
+
+    static constexpr Uint32 SitesPerChunk = 256;
+    static constexpr Uint32 MaxSiteChunks = 64;
+    static constexpr Uint32 MaxSites      = SitesPerChunk * MaxSiteChunks;
+
+    IMemoryAllocator& m_RawAllocator;
+    const Uint32      m_SamplingInterval;
+    const Uint64      m_AllocatorId;
+
+    // Site records are allocated in chunks that are never moved or released until the
+    // allocator is destroyed, so that they can be accessed without locking.
+    std::atomic<SiteRecord*> m_SiteChunks[MaxSiteChunks] = {};
+    std::atomic<Uint32>      m_NumSites{0};
+
+    mutable std::mutex                         m_SitesMtx;
+    std::unordered_map<std::string, Uint32>    m_SiteIds;
+    std::vector<std::unique_ptr<SiteRecord[]>> m_SiteChunkStorage;
+
+    // The peak live bytes, protected by m_SitesMtx
+    mutable Int64 m_PeakBytes = 0;
+
+    mutable std::mutex                        m_ThreadStatesMtx;
+    std::vector<std::unique_ptr<ThreadState>> m_ThreadStates;
+};
+
+} // namespace Diligent
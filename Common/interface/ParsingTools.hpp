@@ -39,6 +39,9 @@
 #include "../../Primitives/interface/FlagEnum.h"
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 #include "StringTools.h"
+#include "STDAllocator.hpp"
+#include "DynamicLinearAllocator.hpp"
+#include "StringScanTools.hpp"
 
 namespace Diligent
 {
@@ -76,6 +79,38 @@ inline bool IsDigit(Char Symbol) noexcept
     return Symbol >= '0' && Symbol <= '9';
 }
 
+/// Finds the first new line or null character in the range.
+template <typename InteratorType>
+InteratorType FindLineEnd(const InteratorType& Start, const InteratorType& End) noexcept
+{
+    auto Pos = Start;
+    while (Pos != End && *Pos != '\0' && !IsNewLine(*Pos))
+        ++Pos;
+    return Pos;
+}
+
+/// Vectorized version of FindLineEnd for character pointers.
+inline const char* FindLineEnd(const char* Start, const char* End) noexcept
+{
+    return FindFirstOf(Start, End, '\r', '\n', '\0');
+}
+
+/// Finds the first occurrence of the given character or the null character in the range.
+template <typename InteratorType>
+InteratorType FindCharOrNull(const InteratorType& Start, const InteratorType& End, char C) noexcept
+{
+    auto Pos = Start;
+    while (Pos != End && *Pos != '\0' && *Pos != C)
+        ++Pos;
+    return Pos;
+}
+
+/// Vectorized version of FindCharOrNull for character pointers.
+inline const char* FindCharOrNull(const char* Start, const char* End, char C) noexcept
+{
+    return FindFirstOf(Start, End, C, '\0');
+}
+
 /// Skips all characters until the end of the line.
 
 /// \param[in] Start        - starting position.
@@ -91,9 +126,7 @@ inline bool IsDigit(Char Symbol) noexcept
 template <typename InteratorType>
 InteratorType SkipLine(const InteratorType& Start, const InteratorType& End, bool GoToNextLine = false) noexcept
 {
-    auto Pos = Start;
-    while (Pos != End && *Pos != '\0' && !IsNewLine(*Pos))
-        ++Pos;
+    auto Pos = FindLineEnd(Start, End);
     if (GoToNextLine && Pos != End && IsNewLine(*Pos))
     {
         ++Pos;
@@ -203,7 +236,7 @@ InteratorType SkipComment(const InteratorType& Start, const InteratorType& End,
             }
             else
             {
-                ++Pos;
+                Pos = FindCharOrNull(Pos, End, '*');
             }
         }
 
@@ -236,6 +269,32 @@ InteratorType SkipDelimiters(const InteratorType& Start, const InteratorType& En
     return Pos;
 }
 
+/// Vectorized version of SkipDelimiters for character pointers.
+inline const char* SkipDelimiters(const char* Start, const char* End, const char* Delimiters = nullptr) noexcept
+{
+    if (Delimiters == nullptr)
+        return FindFirstNotOf(Start, End, ' ', '\t', '\r', '\n');
+
+    // Note that strchr() matches the terminating null character, so null
+    // characters are treated as delimiters when custom delimiters are given.
+    const size_t NumDelimiters = strlen(Delimiters);
+    switch (NumDelimiters)
+    {
+        case 0: return FindFirstNotOf(Start, End, '\0', '\0');
+        case 1: return FindFirstNotOf(Start, End, Delimiters[0], '\0');
+        case 2: return FindFirstNotOf(Start, End, Delimiters[0], Delimiters[1], '\0');
+        case 3: return FindFirstNotOf(Start, End, Delimiters[0], Delimiters[1], Delimiters[2], '\0');
+
+        default:
+        {
+            auto Pos = Start;
+            while (Pos != End && strchr(Delimiters, *Pos))
+                ++Pos;
+            return Pos;
+        }
+    }
+}
+
 
 /// Skips all comments and all delimiters starting from the given position.
 
@@ -565,6 +624,113 @@ std::string GetContext(const IteratorType& Start, const IteratorType& End, Itera
 }
 
 
+/// Token that references the source string instead of owning copies of its literal and delimiter.
+
+/// The token is trivially copyable and does not allocate memory. The source string
+/// must outlive the token. The token is intended to be used with Tokenize() for
+/// `const char*` source ranges:
+///
+///     std::vector<TokenView<MyTokenType>> Tokens;
+///     Tokenize<TokenView<MyTokenType>>(Source, Source + Len, TokenView<MyTokenType>::Create, GetTokenType, Tokens);
+template <typename TokenTypeEnum>
+struct TokenView
+{
+    using TokenType = TokenTypeEnum;
+
+    TokenType   Type         = TokenType::Undefined;
+    const char* DelimStart   = nullptr;
+    const char* DelimEnd     = nullptr;
+    const char* LiteralStart = nullptr;
+    const char* LiteralEnd   = nullptr;
+
+    constexpr TokenView() noexcept {}
+
+    constexpr TokenView(TokenType   _Type,
+                        const char* _DelimStart,
+                        const char* _DelimEnd,
+                        const char* _LiteralStart,
+                        const char* _LiteralEnd) noexcept :
+        Type{_Type},
+        DelimStart{_DelimStart},
+        DelimEnd{_DelimEnd},
+        LiteralStart{_LiteralStart},
+        LiteralEnd{_LiteralEnd}
+    {}
+
+    static TokenView Create(TokenType   _Type,
+                            const char* _DelimStart,
+                            const char* _DelimEnd,
+                            const char* _LiteralStart,
+                            const char* _LiteralEnd) noexcept
+    {
+        return TokenView{_Type, _DelimStart, _DelimEnd, _LiteralStart, _LiteralEnd};
+    }
+
+    void SetType(TokenType _Type) noexcept
+    {
+        Type = _Type;
+    }
+
+    TokenType GetType() const noexcept { return Type; }
+
+    bool CompareLiteral(const char* Start, const char* End) const noexcept
+    {
+        const size_t Len = End - Start;
+        return GetLiteralLen() == Len && (Len == 0 || memcmp(LiteralStart, Start, Len) == 0);
+    }
+
+    bool CompareLiteral(const char* Str) const noexcept
+    {
+        return CompareLiteral(Str, Str + strlen(Str));
+    }
+
+    void ExtendLiteral(const char* Start, const char* End) noexcept
+    {
+        VERIFY(Start == LiteralEnd, "The literal can only be extended by the range that immediately follows it");
+        LiteralEnd = End;
+    }
+
+    size_t GetDelimiterLen() const noexcept
+    {
+        return DelimEnd - DelimStart;
+    }
+    size_t GetLiteralLen() const noexcept
+    {
+        return LiteralEnd - LiteralStart;
+    }
+    const std::pair<const char*, const char*> GetDelimiter() const noexcept
+    {
+        return {DelimStart, DelimEnd};
+    }
+    const std::pair<const char*, const char*> GetLiteral() const noexcept
+    {
+        return {LiteralStart, LiteralEnd};
+    }
+
+    std::ostream& OutputDelimiter(std::ostream& os) const
+    {
+        os.write(DelimStart, GetDelimiterLen());
+        return os;
+    }
+    std::ostream& OutputLiteral(std::ostream& os) const
+    {
+        os.write(LiteralStart, GetLiteralLen());
+        return os;
+    }
+};
+
+/// Token container that allocates memory from a DynamicLinearAllocator.
+
+/// Memory released by the container is not reused until the allocator is discarded,
+/// so the container should be reserved up front (e.g. for one token per four source
+/// characters) to avoid wasting arena space on reallocation.
+///
+///     DynamicLinearAllocator      Arena{DefaultRawMemoryAllocator::GetAllocator()};
+///     ArenaTokenVector<TokenType> Tokens{STD_ALLOCATOR(TokenType, DynamicLinearAllocator, Arena, "Tokens")};
+template <typename TokenClass>
+using ArenaTokenVector = std::vector<TokenClass, STDAllocator<TokenClass, DynamicLinearAllocator>>;
+
+
 /// Tokenizes the given string using the C-language syntax
 
 /// \param [in] SourceStart  - start of the source string.
@@ -584,11 +750,39 @@ template <typename TokenClass,
 ContainerType Tokenize(const IteratorType&   SourceStart,
                        const IteratorType&   SourceEnd,
                        CreateTokenFuncType   CreateToken,
-                       GetTokenTypeFunctType GetTokenType) noexcept(false)
+                       GetTokenTypeFunctType GetTokenType) noexcept(false);
+
+/// Tokenizes the given string using the C-language syntax and writes tokens
+/// to the caller-provided container.
+
+/// \param [in]  SourceStart  - start of the source string.
+/// \param [in]  SourceEnd    - end of the source string.
+/// \param [in]  CreateToken  - a handler called every time a new token should
+///                             be created.
+/// \param [in]  GetTokenType - a function that should return the token type
+///                             for the given literal.
+/// \param [out] Tokens       - container to write tokens to. The container is
+///                             cleared first, but its memory is reused.
+///
+/// \remarks    Together with TokenView, and with a container that is reused between
+///             calls or that allocates from an arena (see ArenaTokenVector), this overload
+///             tokenizes the source without heap allocations.
+///
+///             In case of a parsing error, the function throws std::runtime_error.
+template <typename TokenClass,
+          typename ContainerType,
+          typename IteratorType,
+          typename CreateTokenFuncType,
+          typename GetTokenTypeFunctType>
+void Tokenize(const IteratorType&   SourceStart,
+              const IteratorType&   SourceEnd,
+              CreateTokenFuncType   CreateToken,
+              GetTokenTypeFunctType GetTokenType,
+              ContainerType&        Tokens) noexcept(false)
 {
     using TokenType = typename TokenClass::TokenType;
 
-    ContainerType Tokens;
+    Tokens.clear();
     // Push empty node in the beginning of the list to facilitate
     // backwards searching
     Tokens.emplace_back(TokenClass{});
@@ -807,7 +1001,20 @@ ContainerType Tokenize(const IteratorType&   SourceStart,
         LOG_ERROR_MESSAGE(ErrInfo.second, "\n", GetContext(SourceStart, SourceEnd, ErrInfo.first, NumContextLines));
         LOG_ERROR_AND_THROW("Unable to tokenize string.");
     }
+}
 
+template <typename TokenClass,
+          typename ContainerType,
+          typename IteratorType,
+          typename CreateTokenFuncType,
+          typename GetTokenTypeFunctType>
+ContainerType Tokenize(const IteratorType&   SourceStart,
+                       const IteratorType&   SourceEnd,
+                       CreateTokenFuncType   CreateToken,
+                       GetTokenTypeFunctType GetTokenType) noexcept(false)
+{
+    ContainerType Tokens;
+    Tokenize<TokenClass>(SourceStart, SourceEnd, CreateToken, GetTokenType, Tokens);
     return Tokens;
 }
 
@@ -827,16 +1034,46 @@ std::ostream& WriteToken(std::ostream& stream, const TokenClass& Token)
     return stream;
 }
 
-/// Builds source string from tokens
+/// Builds source string from tokens and writes it to the caller-provided buffer.
+
+/// The buffer is cleared first. Its capacity is reused, so no memory is
+/// allocated if the buffer is large enough to hold the source.
 template <typename ContainerType>
-std::string BuildSource(const ContainerType& Tokens) noexcept
+void BuildSource(const ContainerType& Tokens, std::string& Source) noexcept
 {
-    std::stringstream stream;
+    size_t SourceLen = 0;
+    for (const auto& Token : Tokens)
+    {
+        SourceLen += Token.GetDelimiterLen() + Token.GetLiteralLen();
+        if (Token.GetType() == decltype(Token.GetType())::StringConstant)
+            SourceLen += 2;
+    }
+
+    Source.clear();
+    Source.reserve(SourceLen);
     for (const auto& Token : Tokens)
     {
-        WriteToken(stream, Token);
+        const auto Delimiter = Token.GetDelimiter();
+        const auto Literal   = Token.GetLiteral();
+
+        const bool IsStringConstant = Token.GetType() == decltype(Token.GetType())::StringConstant;
+
+        Source.append(Delimiter.first, Delimiter.second);
+        if (IsStringConstant)
+            Source.push_back('"');
+        Source.append(Literal.first, Literal.second);
+        if (IsStringConstant)
+            Source.push_back('"');
     }
-    return stream.str();
+}
+
+/// Builds source string from tokens
+template <typename ContainerType>
+std::string BuildSource(const ContainerType& Tokens) noexcept
+{
+    std::string Source;
+    BuildSource(Tokens, Source);
+    return Source;
 }
 
 
@@ -1157,6 +1394,38 @@ std::string GetTokenContext(const TokenIterType& Start,
     return Ctx.str();
 }
 
+/// Finds the preprocessor directive in the given range without allocating memory.
+
+/// \param [in]  Start          - start of the range. Must point to the '#' symbol.
+/// \param [in]  End            - end of the range.
+/// \param [out] DirectiveStart - start of the directive name.
+/// \param [out] DirectiveEnd   - end of the directive name.
+/// \return     true if the directive has been found, and false otherwise.
+template <typename InteratorType>
+bool RefinePreprocessorDirective(const InteratorType& Start, const InteratorType& End, InteratorType& DirectiveStart, InteratorType& DirectiveEnd) noexcept
+{
+    DirectiveStart = End;
+    DirectiveEnd   = End;
+
+    // # /* Comment */ define
+    // ^
+    // Pos
+    if (Start == End || *Start != '#')
+        return false;
+
+    DirectiveStart = SkipDelimitersAndComments(Start + 1, End, " \t", SKIP_COMMENT_FLAG_MULTILINE);
+    // # /* Comment */ define
+    //                 ^
+    //          DirectiveStart
+
+    DirectiveEnd = SkipIdentifier(DirectiveStart, End);
+    // # /* Comment */ define
+    //                       ^
+    //                 DirectiveEnd
+
+    return DirectiveStart != DirectiveEnd;
+}
+
 /// Extracts the preprocessor directive from the given range
 template <typename InteratorType>
 std::string RefinePreprocessorDirective(const InteratorType& Start, const InteratorType& End) noexcept
@@ -1316,38 +1585,69 @@ inline InteratorType FindNextPreprocessorDirective(const InteratorType& Start, c
 }
 
 /// Strips all preprocessor directives from the source string.
+///
+/// The source is compacted in place in a single pass, and no memory is allocated.
 inline void StripPreprocessorDirectives(std::string& Source, const std::vector<std::string>& Directives)
 {
-    if (Directives.empty())
+    if (Directives.empty() || Source.empty())
         return;
 
-    auto Pos = Source.begin();
-    while (Pos != Source.end())
+    auto IsStrippedDirective = [&Directives](const char* NameStart, const char* NameEnd) {
+        const size_t NameLen = NameEnd - NameStart;
+        if (NameLen == 0)
+            return false;
+
+        for (const std::string& Directive : Directives)
+        {
+            if (Directive.length() == NameLen && Directive.compare(0, NameLen, NameStart, NameLen) == 0)
+                return true;
+        }
+        return false;
+    };
+
+    char* const       Data = &Source[0];
+    const char* const End  = Data + Source.length();
+
+    // [Data, Dst) is the output, Pos is the read position
+    char*       Dst = Data;
+    const char* Pos = Data;
+    while (Pos != End)
     {
-        std::string::iterator NameStart, NameEnd;
-        Pos = FindNextPreprocessorDirective(Pos, Source.end(), NameStart, NameEnd);
-        if (Pos == Source.end())
-            break;
+        const char* NameStart = nullptr;
+        const char* NameEnd   = nullptr;
 
+        const char* DirectivePos = FindNextPreprocessorDirective(Pos, End, NameStart, NameEnd);
         // # version 450
         // ^ ^      ^
         // | |      NameEnd
         // | NameStart
-        // Pos
+        // DirectivePos
 
-        const std::string DirectiveIdentifier{NameStart, NameEnd};
-        if (!DirectiveIdentifier.empty() && std::find(Directives.begin(), Directives.end(), DirectiveIdentifier) != Directives.end())
+        const char* CopyEnd = End;
+        const char* NextPos = End;
+        if (DirectivePos != End)
         {
-            // Keep the newline character
-            const auto LineEnd = SkipLine(NameEnd, Source.end(), /* GoToNextLine = */ false);
-
-            Pos = Source.erase(Pos, LineEnd);
-            if (Pos == Source.end())
-                break;
+            if (IsStrippedDirective(NameStart, NameEnd))
+            {
+                // Keep the newline character
+                CopyEnd = DirectivePos;
+                NextPos = SkipLine(NameEnd, End, /* GoToNextLine = */ false);
+            }
+            else
+            {
+                CopyEnd = SkipLine(DirectivePos, End, /* GoToNextLine = */ true);
+                NextPos = CopyEnd;
+            }
         }
 
-        Pos = SkipLine(Pos, Source.end(), /* GoToNextLine = */ true);
+        const size_t CopyLen = CopyEnd - Pos;
+        if (Dst != Pos)
+            memmove(Dst, Pos, CopyLen);
+        Dst += CopyLen;
+        Pos = NextPos;
     }
+
+    Source.resize(Dst - Data);
 }
 
 } // namespace Parsing
@@ -0,0 +1,163 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// SIMD-accelerated character scanning primitives.
+
+#include <cstring>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "../../Platforms/interface/Intrinsics.hpp"
+#include "../../Platforms/interface/PlatformMisc.hpp"
+
+namespace Diligent
+{
+
+namespace StringScanInternal
+{
+
+inline bool IsOneOf(char c, char C0, char C1, char C2, char C3) noexcept
+{
+    return c == C0 || c == C1 || c == C2 || c == C3;
+}
+
+/// Returns the first character in [Start, End) that is (if FindMatch is true)
+/// or is not (if FindMatch is false) equal to one of C0, C1, C2, C3.
+/// Processes 16 characters at a time when SSE2 or NEON is available.
+template <bool FindMatch>
+const char* ScanChars(const char* Start, const char* End, char C0, char C1, char C2, char C3) noexcept
+{
+    const char* Pos = Start;
+
+#if DILIGENT_SSE2_ENABLED
+    const __m128i vC0 = _mm_set1_epi8(C0);
+    const __m128i vC1 = _mm_set1_epi8(C1);
+    const __m128i vC2 = _mm_set1_epi8(C2);
+    const __m128i vC3 = _mm_set1_epi8(C3);
+    for (; End - Pos >= 16; Pos += 16)
+    {
+        const __m128i Chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Pos));
+        const __m128i Eq01  = _mm_or_si128(_mm_cmpeq_epi8(Chars, vC0), _mm_cmpeq_epi8(Chars, vC1));
+        const __m128i Eq23  = _mm_or_si128(_mm_cmpeq_epi8(Chars, vC2), _mm_cmpeq_epi8(Chars, vC3));
+
+        Uint32 Mask = static_cast<Uint32>(_mm_movemask_epi8(_mm_or_si128(Eq01, Eq23)));
+        if (!FindMatch)
+            Mask ^= 0xFFFFu;
+        if (Mask != 0)
+            return Pos + PlatformMisc::GetLSB(Mask);
+    }
+#elif DILIGENT_NEON_ENABLED
+    const uint8x16_t vC0 = vdupq_n_u8(static_cast<uint8_t>(C0));
+    const uint8x16_t vC1 = vdupq_n_u8(static_cast<uint8_t>(C1));
+    const uint8x16_t vC2 = vdupq_n_u8(static_cast<uint8_t>(C2));
+    const uint8x16_t vC3 = vdupq_n_u8(static_cast<uint8_t>(C3));
+    for (; End - Pos >= 16; Pos += 16)
+    {
+        const uint8x16_t Chars = vld1q_u8(reinterpret_cast<const uint8_t*>(Pos));
+        const uint8x16_t Eq01  = vorrq_u8(vceqq_u8(Chars, vC0), vceqq_u8(Chars, vC1));
+        const uint8x16_t Eq23  = vorrq_u8(vceqq_u8(Chars, vC2), vceqq_u8(Chars, vC3));
+
+        uint8x16_t Eq = vorrq_u8(Eq01, Eq23);
+        if (!FindMatch)
+            Eq = vmvnq_u8(Eq);
+
+        // Narrow each 8-bit lane to 4 bits to get a 64-bit mask with 4 bits per character
+        const Uint64 Mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(Eq), 4)), 0);
+        if (Mask != 0)
+            return Pos + (PlatformMisc::GetLSB(Mask) >> 2);
+    }
+#endif
+
+    for (; Pos != End; ++Pos)
+    {
+        if (IsOneOf(*Pos, C0, C1, C2, C3) == FindMatch)
+            return Pos;
+    }
+    return End;
+}
+
+} // namespace StringScanInternal
+
+
+/// Finds the first occurrence of the character in the range.
+
+/// \param[in] Start - starting position.
+/// \param[in] End   - end of the input string.
+/// \param[in] C     - character to find.
+///
+/// \return     position of the first occurrence of the character, or End if not found.
+inline const char* FindChar(const char* Start, const char* End, char C) noexcept
+{
+    if (Start >= End)
+        return End;
+    const void* Pos = memchr(Start, C, static_cast<size_t>(End - Start));
+    return Pos != nullptr ? static_cast<const char*>(Pos) : End;
+}
+
+/// Finds the first character in the range that is equal to any of the given characters.
+
+/// \return     position of the first matching character, or End if not found.
+///
+/// \remarks    The function processes 16 characters at a time when SSE2 or NEON is enabled.
+///             Unused characters may be duplicates of the used ones.
+inline const char* FindFirstOf(const char* Start, const char* End, char C0, char C1, char C2, char C3) noexcept
+{
+    return StringScanInternal::ScanChars<true>(Start, End, C0, C1, C2, C3);
+}
+
+inline const char* FindFirstOf(const char* Start, const char* End, char C0, char C1, char C2) noexcept
+{
+    return StringScanInternal::ScanChars<true>(Start, End, C0, C1, C2, C2);
+}
+
+inline const char* FindFirstOf(const char* Start, const char* End, char C0, char C1) noexcept
+{
+    return StringScanInternal::ScanChars<true>(Start, End, C0, C1, C1, C1);
+}
+
+/// Finds the first character in the range that is not equal to any of the given characters.
+
+/// \return     position of the first non-matching character, or End if all characters match.
+///
+/// \remarks    The function processes 16 characters at a time when SSE2 or NEON is enabled.
+inline const char* FindFirstNotOf(const char* Start, const char* End, char C0, char C1, char C2, char C3) noexcept
+{
+    return StringScanInternal::ScanChars<false>(Start, End, C0, C1, C2, C3);
+}
+
+inline const char* FindFirstNotOf(const char* Start, const char* End, char C0, char C1, char C2) noexcept
+{
+    return StringScanInternal::ScanChars<false>(Start, End, C0, C1, C2, C2);
+}
+
+inline const char* FindFirstNotOf(const char* Start, const char* End, char C0, char C1) noexcept
+{
+    return StringScanInternal::ScanChars<false>(Start, End, C0, C1, C1, C1);
+}
+
+} // namespace Diligent
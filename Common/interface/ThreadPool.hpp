@@ -34,6 +34,7 @@
 #include <atomic>
 #include <functional>
 #include <thread>
+#include <vector>
 
 #include "../../Platforms/Basic/interface/DebugUtilities.hpp"
 
@@ -226,4 +227,35 @@ RefCntAutoPtr<IAsyncTask> EnqueueAsyncWork(IThreadPool* pThreadPool,
     return EnqueueAsyncWork(pThreadPool, nullptr, 0, std::move(Handler), fPriority);
 }
 
+/// Calls Handler(i) for every i in [0, NumItems), distributing the calls across the
+/// thread pool. The calling thread processes the first item and then waits for the
+/// remaining ones to complete. If pThreadPool is null or there is only one item, all
+/// items are processed sequentially in the calling thread.
+template <typename HandlerType>
+void ProcessInParallel(IThreadPool* pThreadPool, size_t NumItems, const HandlerType& Handler)
+{
+    if (pThreadPool == nullptr || NumItems <= 1)
+    {
+        for (size_t i = 0; i < NumItems; ++i)
+            Handler(i);
+        return;
+    }
+
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks;
+    Tasks.reserve(NumItems - 1);
+    for (size_t i = 1; i < NumItems; ++i)
+    {
+        Tasks.emplace_back(EnqueueAsyncWork(pThreadPool,
+                                            [&Handler, i](Uint32 ThreadId) {
+                                                Handler(i);
+                                                return ASYNC_TASK_STATUS_COMPLETE;
+                                            }));
+    }
+
+    Handler(0);
+
+    for (RefCntAutoPtr<IAsyncTask>& pTask : Tasks)
+        pTask->WaitForCompletion();
+}
+
 } // namespace Diligent
@@ -0,0 +1,196 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Bounding volume hierarchy for CPU ray queries against triangle meshes.
+
+#include <vector>
+
+#include "../../Primitives/interface/BasicTypes.h"
+#include "AdvancedMath.hpp"
+#include "ThreadPool.h"
+
+namespace Diligent
+{
+
+/// Triangle BVH create information.
+struct TriangleBVHCreateInfo
+{
+    /// A pointer to the first vertex position.
+    const void* pVertices = nullptr;
+
+    /// The number of vertices.
+    Uint32 NumVertices = 0;
+
+    /// Vertex stride in bytes. Each vertex must start with three floats defining its position.
+    Uint32 VertexStride = sizeof(float3);
+
+    /// A pointer to the triangle list indices. Must contain NumTriangles * 3 elements.
+    /// If null, the vertices define a non-indexed triangle list.
+    const Uint32* pIndices = nullptr;
+
+    /// The number of triangles.
+    Uint32 NumTriangles = 0;
+
+    /// The maximum number of triangles in a leaf node.
+    Uint32 MaxTrianglesPerLeaf = 4;
+
+    /// The number of bins used to evaluate the surface area heuristic.
+    Uint32 NumSAHBins = 16;
+
+    /// An optional thread pool to build subtrees in parallel.
+
+    /// The calling thread waits for the subtree tasks to complete,
+    /// so the pool must have at least one worker thread.
+    IThreadPool* pThreadPool = nullptr;
+};
+
+/// Bounding volume hierarchy over a triangle mesh.
+
+/// The hierarchy is built with the binned surface area heuristic and is then collapsed
+/// into a four-wide tree, so that a ray is tested against all four child boxes of a node
+/// at once (using SSE2 or NEON where available).
+///
+/// The BVH keeps its own copy of the vertex positions and indices, so the source
+/// data may be released after the BVH has been created.
+class TriangleBVH
+{
+public:
+    /// Ray description.
+    struct Ray
+    {
+        float3 Origin;
+
+        /// Ray direction. Does not have to be normalized, in which case
+        /// hit distances are measured in the units of the direction length.
+        float3 Direction;
+
+        /// The maximum hit distance.
+        float MaxDistance = FLT_MAX;
+    };
+
+    /// Ray hit information.
+    struct Hit
+    {
+        /// Distance from the ray origin to the hit point, or FLT_MAX if there is no hit.
+        float Distance = FLT_MAX;
+
+        /// Index of the triangle in the source mesh, or ~0u if there is no hit.
+        Uint32 TriangleIndex = ~0u;
+
+        /// Barycentric coordinates of the hit point relative to vertices 1 and 2 of the triangle.
+        /// The hit point is V0 * (1 - u - v) + V1 * u + V2 * v.
+        float2 Barycentrics;
+
+        explicit operator bool() const
+        {
+            return TriangleIndex != ~0u;
+        }
+    };
+
+    explicit TriangleBVH(const TriangleBVHCreateInfo& CI) noexcept(false);
+
+    // clang-format off
+    TriangleBVH           (const TriangleBVH&)  = delete;
+    TriangleBVH& operator=(const TriangleBVH&)  = delete;
+    TriangleBVH           (TriangleBVH&&)       = default;
+    TriangleBVH& operator=(TriangleBVH&&)       = default;
+    // clang-format on
+
+    /// Finds the closest intersection of the ray with the mesh in [0, MaxDistance] range.
+    Hit CastRay(const Ray& R, bool CullBackFace = false) const;
+
+    /// Returns true if the ray intersects any triangle in [0, MaxDistance] range.
+    /// This is typically faster than CastRay as the traversal stops at the first hit.
+    bool AnyHit(const Ray& R, bool CullBackFace = false) const;
+
+    /// Finds the closest intersections for an array of rays.
+
+    /// \param[in]  pRays        - Rays to cast.
+    /// \param[out] pHits        - Hit information, one for each ray.
+    /// \param[in]  NumRays      - The number of rays.
+    /// \param[in]  CullBackFace - Whether to ignore back-facing triangles.
+    /// \param[in]  pThreadPool  - Optional thread pool to process the rays in parallel.
+    ///                            The pool must have at least one worker thread.
+    void CastRays(const Ray*   pRays,
+                  Hit*         pHits,
+                  Uint32       NumRays,
+                  bool         CullBackFace = false,
+                  IThreadPool* pThreadPool  = nullptr) const;
+
+    /// Returns the bounding box of the whole mesh.
+    const BoundBox& GetBounds() const { return m_Bounds; }
+
+    /// Returns the number of four-wide nodes in the hierarchy.
+    size_t GetNumNodes() const { return m_Nodes.size(); }
+
+    Uint32 GetNumTriangles() const { return static_cast<Uint32>(m_TriangleIds.size()); }
+
+private:
+    // Four-wide node with child bounds stored as a structure of arrays
+    struct Node
+    {
+        float MinX[4];
+        float MinY[4];
+        float MinZ[4];
+        float MaxX[4];
+        float MaxY[4];
+        float MaxZ[4];
+
+        // Inner node index, or LeafBit | leaf index, or InvalidChild
+        Uint32 Children[4];
+    };
+
+    struct Leaf
+    {
+        Uint32 FirstTriangle;
+        Uint32 NumTriangles;
+    };
+
+    static constexpr Uint32 LeafBit      = 0x80000000u;
+    static constexpr Uint32 InvalidChild = ~0u;
+
+    template <bool AnyHitQuery>
+    Hit Traverse(const Ray& R, bool CullBackFace) const;
+
+    struct BinaryTree;
+    Uint32 CollapseNode(const BinaryTree& Tree, Uint32 BinaryNodeIdx);
+
+    BoundBox m_Bounds = BoundBox::Invalid();
+
+    std::vector<Node> m_Nodes;
+    std::vector<Leaf> m_Leaves;
+
+    std::vector<float3> m_Vertices;
+    // Triangle vertex indices in the leaf order
+    std::vector<uint3> m_Triangles;
+    // Source triangle index for every triangle in m_Triangles
+    std::vector<Uint32> m_TriangleIds;
+};
+
+} // namespace Diligent
@@ -27,6 +27,8 @@
 
 #include "pch.h"
 #include "BasicFileStream.hpp"
+#include "DataBlobImpl.hpp"
+#include "FileMappedDataBlob.hpp"
 
 namespace Diligent
 {
@@ -46,7 +48,8 @@ BasicFileStream::BasicFileStream(IReferenceCounters* pRefCounters,
                                  const Char*         Path,
                                  EFileAccessMode     Access /* = EFileAccessMode::Read*/) :
     TBase{pRefCounters},
-    m_FileWrpr{Path, Access}
+    m_FileWrpr{Path, Access},
+    m_Access{Access}
 {
 }
 
@@ -87,4 +90,32 @@ bool BasicFileStream::SetPos(size_t Offset, int Origin)
     return m_FileWrpr->SetPos(Offset, static_cast<FilePosOrigin>(Origin));
 }
 
+RefCntAutoPtr<IDataBlob> BasicFileStream::MapBlob(size_t Size)
+{
+    if (!m_FileWrpr)
+        return {};
+
+    const size_t Pos = m_FileWrpr->GetPos();
+    if (Size > m_FileWrpr->GetSize() - Pos)
+    {
+        LOG_ERROR_MESSAGE("Not enough data in file '", m_FileWrpr->GetPath(), "': requested ", Size, " bytes at offset ", Pos, ".");
+        return {};
+    }
+
+    if (m_Access == EFileAccessMode::Read && FileMappedDataBlob::IsSupported())
+    {
+        if (RefCntAutoPtr<FileMappedDataBlob> pMappedData = FileMappedDataBlob::Create(m_FileWrpr->GetPath().c_str(), Pos, Size, FileMappedDataBlob::AccessHint::Normal, /*Silent = */ true))
+        {
+            if (m_FileWrpr->SetPos(Pos + Size, FilePosOrigin::Start))
+                return pMappedData;
+        }
+    }
+
+    RefCntAutoPtr<DataBlobImpl> pData = DataBlobImpl::CreateUninitialized(Size);
+    if (Size > 0 && !m_FileWrpr->Read(pData->GetDataPtr(), Size))
+        return {};
+
+    return pData;
+}
+
 } // namespace Diligent
@@ -29,8 +29,6 @@
 #include "DataBlobImpl.hpp"
 #include "DefaultRawMemoryAllocator.hpp"
 
-#include <cstring>
-
 namespace Diligent
 {
 
@@ -51,6 +49,13 @@ RefCntAutoPtr<DataBlobImpl> DataBlobImpl::Create(DataBufferType&& DataBuff) noex
     return RefCntAutoPtr<DataBlobImpl>{MakeNewRCObj<DataBlobImpl>()(std::move(DataBuff))};
 }
 
+RefCntAutoPtr<DataBlobImpl> DataBlobImpl::CreateUninitialized(size_t Size, IMemoryAllocator* pAllocator)
+{
+    if (pAllocator == nullptr)
+        pAllocator = &DefaultRawMemoryAllocator::GetAllocator();
+    return RefCntAutoPtr<DataBlobImpl>{MakeNewRCObj<DataBlobImpl>()(*pAllocator, Size, nullptr, false)};
+}
+
 RefCntAutoPtr<DataBlobImpl> DataBlobImpl::MakeCopy(const IDataBlob* pDataBlob)
 {
     if (pDataBlob == nullptr)
@@ -62,13 +67,20 @@ RefCntAutoPtr<DataBlobImpl> DataBlobImpl::MakeCopy(const IDataBlob* pDataBlob)
 DataBlobImpl::DataBlobImpl(IReferenceCounters* pRefCounters,
                            IMemoryAllocator&   Allocator,
                            size_t              InitialSize,
-                           const void*         pData) :
+                           const void*         pData,
+                           bool                InitializeData) :
     TBase{pRefCounters},
-    m_DataBuff{InitialSize, Uint8{}, STD_ALLOCATOR_RAW_MEM(Uint8, Allocator, "Allocator for vector<Uint8>")}
+    m_DataBuff{DataBlobAllocator<Uint8>{STD_ALLOCATOR_RAW_MEM(Uint8, Allocator, "Allocator for vector<Uint8>"), InitializeData}}
 {
-    if (!m_DataBuff.empty() && pData != nullptr)
+    if (InitialSize > 0 && pData != nullptr)
+    {
+        // Copy the data directly to avoid zero-initializing the buffer first
+        const Uint8* pSrc = static_cast<const Uint8*>(pData);
+        m_DataBuff.assign(pSrc, pSrc + InitialSize);
+    }
+    else
     {
-        std::memcpy(m_DataBuff.data(), pData, InitialSize);
+        m_DataBuff.resize(InitialSize);
     }
 }
 
@@ -112,7 +124,8 @@ IMPLEMENT_QUERY_INTERFACE(DataBlobImpl, IID_DataBlob, TBase)
 void* DataBlobAllocatorAdapter::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
 {
     VERIFY(!m_pDataBlob, "The data blob has already been created. The allocator does not support more than one blob.");
-    m_pDataBlob = DataBlobImpl::Create(Size);
+    // The memory is written by the allocator client, so there is no need to initialize it
+    m_pDataBlob = DataBlobImpl::CreateUninitialized(Size);
     return m_pDataBlob->GetDataPtr();
 }
 
@@ -0,0 +1,298 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "FileMappedDataBlob.hpp"
+#include "Align.hpp"
+
+#if PLATFORM_WIN32
+#    include "WinHPreface.h"
+#    include <Windows.h>
+#    include "WinHPostface.h"
+#    include "StringTools.hpp"
+#    define DILIGENT_FILE_MAPPING_SUPPORTED 1
+#elif PLATFORM_LINUX || PLATFORM_ANDROID || PLATFORM_MACOS || PLATFORM_IOS || PLATFORM_TVOS
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <fcntl.h>
+#    include <unistd.h>
+#    define DILIGENT_FILE_MAPPING_SUPPORTED 1
+#else
+#    define DILIGENT_FILE_MAPPING_SUPPORTED 0
+#endif
+
+#include <limits>
+
+namespace Diligent
+{
+
+namespace
+{
+
+#if DILIGENT_FILE_MAPPING_SUPPORTED
+
+// Returns the alignment of the file offset passed to the mapping functions
+size_t GetMappingOffsetAlignment()
+{
+#    if PLATFORM_WIN32
+    SYSTEM_INFO SysInfo{};
+    GetSystemInfo(&SysInfo);
+    return static_cast<size_t>(SysInfo.dwAllocationGranularity);
+#    else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#    endif
+}
+
+struct MappingRange
+{
+    Uint64 AlignedOffset = 0; // Offset of the mapped view in the file
+    size_t MappingSize   = 0; // Size of the mapped view
+    size_t DataOffset    = 0; // Offset of the requested range within the view
+    size_t DataSize      = 0; // Size of the requested range
+};
+
+bool GetMappingRange(Uint64 FileSize, size_t Offset, size_t Size, MappingRange& Range)
+{
+    if (Offset > FileSize)
+        return false;
+
+    Uint64 RangeSize = Size;
+    if (Size == FileMappedDataBlob::WholeFile)
+        RangeSize = FileSize - Offset;
+    else if (RangeSize > FileSize - Offset)
+        return false;
+
+    const size_t Alignment = GetMappingOffsetAlignment();
+
+    Range.AlignedOffset = AlignDown(Uint64{Offset}, Uint64{Alignment});
+    Range.DataOffset    = static_cast<size_t>(Offset - Range.AlignedOffset);
+
+    // The view may not be addressable in 32-bit processes
+    if (RangeSize > std::numeric_limits<size_t>::max() - Range.DataOffset)
+        return false;
+
+    Range.DataSize    = static_cast<size_t>(RangeSize);
+    Range.MappingSize = Range.DataOffset + Range.DataSize;
+    return true;
+}
+
+#endif
+
+} // namespace
+
+bool FileMappedDataBlob::IsSupported()
+{
+    return DILIGENT_FILE_MAPPING_SUPPORTED != 0;
+}
+
+RefCntAutoPtr<FileMappedDataBlob> FileMappedDataBlob::Create(const Char* Path,
+                                                             size_t      Offset,
+                                                             size_t      Size,
+                                                             AccessHint  Hint,
+                                                             bool        Silent)
+{
+    if (Path == nullptr || Path[0] == '\0')
+    {
+        DEV_ERROR("Path must not be null or empty");
+        return {};
+    }
+
+#if DILIGENT_FILE_MAPPING_SUPPORTED
+    Uint64 FileSize = 0;
+    void*  pMapping = nullptr;
+
+    MappingRange Range;
+
+#    if PLATFORM_WIN32
+    // Memory-mapped file access hints are not supported on Windows
+    (void)Hint;
+
+    HANDLE hFile = CreateFileW(WidenString(Path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        if (!Silent)
+            LOG_ERROR_MESSAGE("Failed to open file '", Path, "'.");
+        return {};
+    }
+
+    LARGE_INTEGER FileSizeLI{};
+    if (!GetFileSizeEx(hFile, &FileSizeLI))
+    {
+        CloseHandle(hFile);
+        if (!Silent)
+            LOG_ERROR_MESSAGE("Failed to get the size of file '", Path, "'.");
+        return {};
+    }
+    FileSize = static_cast<Uint64>(FileSizeLI.QuadPart);
+
+    if (!GetMappingRange(FileSize, Offset, Size, Range))
+    {
+        CloseHandle(hFile);
+        if (!Silent)
+            LOG_ERROR_MESSAGE("Requested range (offset: ", Offset, ", size: ", Size, ") is out of bounds of file '", Path, "' (", FileSize, " bytes).");
+        return {};
+    }
+
+    if (Range.DataSize > 0)
+    {
+        // Copy-on-write mapping: modified pages are private to the process and are never written to the file
+        HANDLE hMapping = CreateFileMappingW(hFile, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (hMapping != nullptr)
+        {
+            pMapping = MapViewOfFile(hMapping, FILE_MAP_COPY,
+                                     static_cast<DWORD>(Range.AlignedOffset >> 32u),
+                                     static_cast<DWORD>(Range.AlignedOffset & 0xFFFFFFFFu),
+                                     Range.MappingSize);
+            // The view keeps the mapping object alive
+            CloseHandle(hMapping);
+        }
+    }
+    // The mapping keeps the file open
+    CloseHandle(hFile);
+#    else
+    int fd = open(Path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        if (!Silent)
+            LOG_ERROR_MESSAGE("Failed to open file '", Path, "'.");
+        return {};
+    }
+
+    struct stat FileStat = {};
+    if (fstat(fd, &FileStat) != 0)
+    {
+        close(fd);
+        if (!Silent)
+            LOG_ERROR_MESSAGE("Failed to get the size of file '", Path, "'.");
+        return {};
+    }
+    FileSize = static_cast<Uint64>(FileStat.st_size);
+
+    if (!GetMappingRange(FileSize, Offset, Size, Range))
+    {
+        close(fd);
+        if (!Silent)
+            LOG_ERROR_MESSAGE("Requested range (offset: ", Offset, ", size: ", Size, ") is out of bounds of file '", Path, "' (", FileSize, " bytes).");
+        return {};
+    }
+
+    if (Range.DataSize > 0)
+    {
+        // Copy-on-write mapping: modified pages are private to the process and are never written to the file
+        pMapping = mmap(nullptr, Range.MappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, static_cast<off_t>(Range.AlignedOffset));
+        if (pMapping == MAP_FAILED)
+        {
+            pMapping = nullptr;
+        }
+        else if (Hint != AccessHint::Normal)
+        {
+            int Advice = MADV_NORMAL;
+            switch (Hint)
+            {
+                // clang-format off
+                case AccessHint::Sequential: Advice = MADV_SEQUENTIAL; break;
+                case AccessHint::Random:     Advice = MADV_RANDOM;     break;
+                case AccessHint::WillNeed:   Advice = MADV_WILLNEED;   break;
+                // clang-format on
+                default:
+                    UNEXPECTED("Unexpected access hint");
+            }
+            // The hint is advisory, so errors are ignored
+            madvise(pMapping, Range.MappingSize, Advice);
+        }
+    }
+    // The mapping keeps a reference to the file
+    close(fd);
+#    endif
+
+    if (Range.DataSize > 0 && pMapping == nullptr)
+    {
+        if (!Silent)
+            LOG_ERROR_MESSAGE("Failed to map file '", Path, "' into memory.");
+        return {};
+    }
+
+    return RefCntAutoPtr<FileMappedDataBlob>{MakeNewRCObj<FileMappedDataBlob>()(pMapping, Range.MappingSize, Range.DataOffset, Range.DataSize)};
+#else
+    (void)Offset;
+    (void)Size;
+    (void)Hint;
+    if (!Silent)
+        LOG_WARNING_MESSAGE("Memory-mapped files are not supported on this platform.");
+    return {};
+#endif
+}
+
+FileMappedDataBlob::FileMappedDataBlob(IReferenceCounters* pRefCounters,
+                                       void*               pMapping,
+                                       size_t              MappingSize,
+                                       size_t              DataOffset,
+                                       size_t              DataSize) noexcept :
+    // clang-format off
+    TBase        {pRefCounters},
+    m_pMapping   {pMapping},
+    m_MappingSize{MappingSize},
+    m_pData      {pMapping != nullptr ? static_cast<Uint8*>(pMapping) + DataOffset : nullptr},
+    m_Size       {DataSize}
+// clang-format on
+{
+}
+
+FileMappedDataBlob::~FileMappedDataBlob()
+{
+    if (m_pMapping == nullptr)
+        return;
+
+#if PLATFORM_WIN32
+    UnmapViewOfFile(m_pMapping);
+#elif DILIGENT_FILE_MAPPING_SUPPORTED
+    munmap(m_pMapping, m_MappingSize);
+#endif
+}
+
+void FileMappedDataBlob::Resize(size_t NewSize)
+{
+    UNEXPECTED("Resize is not supported by file-mapped data blob.");
+}
+
+size_t FileMappedDataBlob::GetSize() const
+{
+    return m_Size;
+}
+
+void* FileMappedDataBlob::GetDataPtr(size_t Offset)
+{
+    VERIFY(Offset <= m_Size, "Offset (", Offset, ") exceeds the data size (", m_Size, ")");
+    return m_pData != nullptr ? m_pData + Offset : nullptr;
+}
+
+const void* FileMappedDataBlob::GetConstDataPtr(size_t Offset) const
+{
+    VERIFY(Offset <= m_Size, "Offset (", Offset, ") exceeds the data size (", m_Size, ")");
+    return m_pData != nullptr ? m_pData + Offset : nullptr;
+}
+
+} // namespace Diligent
@@ -26,6 +26,7 @@
 
 #include "FileWrapper.hpp"
 #include "DataBlobImpl.hpp"
+#include "FileMappedDataBlob.hpp"
 
 namespace Diligent
 {
@@ -85,7 +86,8 @@ bool FileWrapper::ReadWholeFile(const char* FilePath, IDataBlob** ppData, bool S
         return false;
     }
 
-    RefCntAutoPtr<DataBlobImpl> pData = DataBlobImpl::Create();
+    // The blob is entirely overwritten by the file contents
+    RefCntAutoPtr<DataBlobImpl> pData = DataBlobImpl::CreateUninitialized(0);
     if (!File->Read(pData))
     {
         if (!Silent)
@@ -99,6 +101,29 @@ bool FileWrapper::ReadWholeFile(const char* FilePath, IDataBlob** ppData, bool S
     return true;
 }
 
+bool FileWrapper::MapWholeFile(const char* FilePath, IDataBlob** ppData, bool Silent)
+{
+    if (ppData == nullptr)
+    {
+        DEV_ERROR("Data pointer must not be null");
+        return false;
+    }
+
+    DEV_CHECK_ERR(*ppData == nullptr, "Data pointer is not null. This may result in memory leak.");
+
+    if (FileMappedDataBlob::IsSupported())
+    {
+        // Mapping may fail for files that are not regular files (e.g. Android assets), which is not an error
+        if (RefCntAutoPtr<FileMappedDataBlob> pData = FileMappedDataBlob::Create(FilePath, 0, FileMappedDataBlob::WholeFile, FileMappedDataBlob::AccessHint::Normal, /*Silent = */ true))
+        {
+            *ppData = pData.Detach();
+            return true;
+        }
+    }
+
+    return ReadWholeFile(FilePath, ppData, Silent);
+}
+
 bool FileWrapper::WriteFile(const char* FilePath, const void* Data, size_t Size, bool Silent)
 {
     if (FilePath == nullptr || FilePath[0] == '\0')
@@ -0,0 +1,417 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrustumCulling.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "Intrinsics.hpp"
+#include "PlatformMisc.hpp"
+#include "DebugUtilities.hpp"
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Frustum data prepared for batched testing
+struct FrustumCullingData
+{
+    FrustumCullingData(const ViewFrustum&    Frustum,
+                       const ViewFrustumExt* pFrustumExt,
+                       FRUSTUM_PLANE_FLAGS   PlaneFlags)
+    {
+        for (Uint32 plane_idx = 0; plane_idx < ViewFrustum::NUM_PLANES; ++plane_idx)
+        {
+            if ((PlaneFlags & (1 << plane_idx)) == 0)
+                continue;
+
+            const Plane3D& Plane = Frustum.GetPlane(static_cast<ViewFrustum::PLANE_IDX>(plane_idx));
+
+            Planes[NumPlanes]     = Plane;
+            AbsNormals[NumPlanes] = abs(Plane.Normal);
+            ++NumPlanes;
+        }
+
+        // Same condition as in GetBoxVisibility(const ViewFrustumExt&, const BoundBox&, FRUSTUM_PLANE_FLAGS)
+        if (pFrustumExt != nullptr && (PlaneFlags & FRUSTUM_PLANE_FLAG_FULL_FRUSTUM) == FRUSTUM_PLANE_FLAG_FULL_FRUSTUM)
+        {
+            TestCorners = true;
+
+            CornersMin = pFrustumExt->FrustumCorners[0];
+            CornersMax = pFrustumExt->FrustumCorners[0];
+            for (size_t i = 1; i < _countof(pFrustumExt->FrustumCorners); ++i)
+            {
+                CornersMin = (std::min)(CornersMin, pFrustumExt->FrustumCorners[i]);
+                CornersMax = (std::max)(CornersMax, pFrustumExt->FrustumCorners[i]);
+            }
+        }
+    }
+
+    Uint32  NumPlanes = 0;
+    Plane3D Planes[ViewFrustum::NUM_PLANES];
+    float3  AbsNormals[ViewFrustum::NUM_PLANES];
+
+    // All frustum corners are outside of the box plane if and only if
+    // the bounding box of the corners does not overlap the box along the plane axis.
+    bool   TestCorners = false;
+    float3 CornersMin;
+    float3 CornersMax;
+};
+
+struct ScalarOps
+{
+    static constexpr Uint32 Width = 1;
+
+    using Reg  = float;
+    using Mask = bool;
+
+    static Reg Load(const float* p) { return *p; }
+    static Reg Splat(float f) { return f; }
+    static Reg Add(Reg a, Reg b) { return a + b; }
+    static Reg Sub(Reg a, Reg b) { return a - b; }
+    static Reg Mul(Reg a, Reg b) { return a * b; }
+    static Reg Neg(Reg a) { return -a; }
+
+    static Mask CmpLT(Reg a, Reg b) { return a < b; }
+    static Mask CmpGT(Reg a, Reg b) { return a > b; }
+    static Mask CmpLE(Reg a, Reg b) { return a <= b; }
+    static Mask CmpGE(Reg a, Reg b) { return a >= b; }
+
+    static Mask True() { return true; }
+    static Mask False() { return false; }
+    static Mask And(Mask a, Mask b) { return a && b; }
+    static Mask Or(Mask a, Mask b) { return a || b; }
+    static Mask AndNot(Mask a, Mask b) { return a && !b; }
+
+    static Uint32 MoveMask(Mask m) { return m ? 1u : 0u; }
+};
+
+#if DILIGENT_AVX2_ENABLED
+struct SIMDOps
+{
+    static constexpr Uint32 Width = 8;
+
+    using Reg  = __m256;
+    using Mask = __m256;
+
+    static Reg Load(const float* p) { return _mm256_loadu_ps(p); }
+    static Reg Splat(float f) { return _mm256_set1_ps(f); }
+    static Reg Add(Reg a, Reg b) { return _mm256_add_ps(a, b); }
+    static Reg Sub(Reg a, Reg b) { return _mm256_sub_ps(a, b); }
+    static Reg Mul(Reg a, Reg b) { return _mm256_mul_ps(a, b); }
+    static Reg Neg(Reg a) { return _mm256_xor_ps(a, _mm256_set1_ps(-0.f)); }
+
+    static Mask CmpLT(Reg a, Reg b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static Mask CmpGT(Reg a, Reg b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static Mask CmpLE(Reg a, Reg b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static Mask CmpGE(Reg a, Reg b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+
+    static Mask True() { return _mm256_castsi256_ps(_mm256_set1_epi32(-1)); }
+    static Mask False() { return _mm256_setzero_ps(); }
+    static Mask And(Mask a, Mask b) { return _mm256_and_ps(a, b); }
+    static Mask Or(Mask a, Mask b) { return _mm256_or_ps(a, b); }
+    static Mask AndNot(Mask a, Mask b) { return _mm256_andnot_ps(b, a); }
+
+    static Uint32 MoveMask(Mask m) { return static_cast<Uint32>(_mm256_movemask_ps(m)); }
+};
+#elif DILIGENT_SSE2_ENABLED
+struct SIMDOps
+{
+    static constexpr Uint32 Width = 4;
+
+    using Reg  = __m128;
+    using Mask = __m128;
+
+    static Reg Load(const float* p) { return _mm_loadu_ps(p); }
+    static Reg Splat(float f) { return _mm_set1_ps(f); }
+    static Reg Add(Reg a, Reg b) { return _mm_add_ps(a, b); }
+    static Reg Sub(Reg a, Reg b) { return _mm_sub_ps(a, b); }
+    static Reg Mul(Reg a, Reg b) { return _mm_mul_ps(a, b); }
+    static Reg Neg(Reg a) { return _mm_xor_ps(a, _mm_set1_ps(-0.f)); }
+
+    static Mask CmpLT(Reg a, Reg b) { return _mm_cmplt_ps(a, b); }
+    static Mask CmpGT(Reg a, Reg b) { return _mm_cmpgt_ps(a, b); }
+    static Mask CmpLE(Reg a, Reg b) { return _mm_cmple_ps(a, b); }
+    static Mask CmpGE(Reg a, Reg b) { return _mm_cmpge_ps(a, b); }
+
+    static Mask True() { return _mm_castsi128_ps(_mm_set1_epi32(-1)); }
+    static Mask False() { return _mm_setzero_ps(); }
+    static Mask And(Mask a, Mask b) { return _mm_and_ps(a, b); }
+    static Mask Or(Mask a, Mask b) { return _mm_or_ps(a, b); }
+    static Mask AndNot(Mask a, Mask b) { return _mm_andnot_ps(b, a); }
+
+    static Uint32 MoveMask(Mask m) { return static_cast<Uint32>(_mm_movemask_ps(m)); }
+};
+#elif DILIGENT_NEON_ENABLED
+struct SIMDOps
+{
+    static constexpr Uint32 Width = 4;
+
+    using Reg  = float32x4_t;
+    using Mask = uint32x4_t;
+
+    static Reg Load(const float* p) { return vld1q_f32(p); }
+    static Reg Splat(float f) { return vdupq_n_f32(f); }
+    static Reg Add(Reg a, Reg b) { return vaddq_f32(a, b); }
+    static Reg Sub(Reg a, Reg b) { return vsubq_f32(a, b); }
+    static Reg Mul(Reg a, Reg b) { return vmulq_f32(a, b); }
+    static Reg Neg(Reg a) { return vnegq_f32(a); }
+
+    static Mask CmpLT(Reg a, Reg b) { return vcltq_f32(a, b); }
+    static Mask CmpGT(Reg a, Reg b) { return vcgtq_f32(a, b); }
+    static Mask CmpLE(Reg a, Reg b) { return vcleq_f32(a, b); }
+    static Mask CmpGE(Reg a, Reg b) { return vcgeq_f32(a, b); }
+
+    static Mask True() { return vdupq_n_u32(~0u); }
+    static Mask False() { return vdupq_n_u32(0); }
+    static Mask And(Mask a, Mask b) { return vandq_u32(a, b); }
+    static Mask Or(Mask a, Mask b) { return vorrq_u32(a, b); }
+    static Mask AndNot(Mask a, Mask b) { return vbicq_u32(a, b); }
+
+    static Uint32 MoveMask(Mask m)
+    {
+        static constexpr Uint32 LaneBits[] = {1, 2, 4, 8};
+
+        const uint32x4_t Bits = vandq_u32(m, vld1q_u32(LaneBits));
+        const uint32x2_t Sum  = vorr_u32(vget_low_u32(Bits), vget_high_u32(Bits));
+        return vget_lane_u32(Sum, 0) | vget_lane_u32(Sum, 1);
+    }
+};
+#endif
+
+// Returns the bit mask of boxes [FirstBox, FirstBox + Ops::Width) that are guaranteed to be invisible.
+// The arithmetic follows GetBoxVisibilityAgainstPlane so that the results are consistent with GetBoxVisibility.
+template <typename Ops>
+Uint32 GetInvisibleBoxesMask(const FrustumCullingData& Data, const BoundBoxesSoA& Boxes, Uint32 FirstBox)
+{
+    constexpr Uint32 AllLanes = (1u << Ops::Width) - 1u;
+
+    const typename Ops::Reg CX = Ops::Load(Boxes.CenterX + FirstBox);
+    const typename Ops::Reg CY = Ops::Load(Boxes.CenterY + FirstBox);
+    const typename Ops::Reg CZ = Ops::Load(Boxes.CenterZ + FirstBox);
+    const typename Ops::Reg EX = Ops::Load(Boxes.HalfExtentX + FirstBox);
+    const typename Ops::Reg EY = Ops::Load(Boxes.HalfExtentY + FirstBox);
+    const typename Ops::Reg EZ = Ops::Load(Boxes.HalfExtentZ + FirstBox);
+
+    typename Ops::Mask Invisible = Ops::False();
+    typename Ops::Mask Inside    = Ops::True();
+    for (Uint32 i = 0; i < Data.NumPlanes; ++i)
+    {
+        const Plane3D& Plane     = Data.Planes[i];
+        const float3&  AbsNormal = Data.AbsNormals[i];
+
+        // Distance from the box center to the plane
+        typename Ops::Reg Distance = Ops::Mul(CX, Ops::Splat(Plane.Normal.x));
+        Distance                   = Ops::Add(Distance, Ops::Mul(CY, Ops::Splat(Plane.Normal.y)));
+        Distance                   = Ops::Add(Distance, Ops::Mul(CZ, Ops::Splat(Plane.Normal.z)));
+        Distance                   = Ops::Add(Distance, Ops::Splat(Plane.Distance));
+
+        // Projected half extents of the box onto the plane normal
+        typename Ops::Reg ProjHalfLen = Ops::Mul(EX, Ops::Splat(AbsNormal.x));
+        ProjHalfLen                   = Ops::Add(ProjHalfLen, Ops::Mul(EY, Ops::Splat(AbsNormal.y)));
+        ProjHalfLen                   = Ops::Add(ProjHalfLen, Ops::Mul(EZ, Ops::Splat(AbsNormal.z)));
+
+        Invisible = Ops::Or(Invisible, Ops::CmpLT(Distance, Ops::Neg(ProjHalfLen)));
+        Inside    = Ops::And(Inside, Ops::CmpGT(Distance, ProjHalfLen));
+
+        if (Ops::MoveMask(Invisible) == AllLanes)
+            return AllLanes;
+    }
+
+    if (Data.TestCorners)
+    {
+        // The test is only performed for the boxes that are not fully inside the frustum
+        typename Ops::Mask Separated = Ops::CmpLE(Ops::Splat(Data.CornersMax.x), Ops::Sub(CX, EX));
+        Separated                    = Ops::Or(Separated, Ops::CmpLE(Ops::Splat(Data.CornersMax.y), Ops::Sub(CY, EY)));
+        Separated                    = Ops::Or(Separated, Ops::CmpLE(Ops::Splat(Data.CornersMax.z), Ops::Sub(CZ, EZ)));
+        Separated                    = Ops::Or(Separated, Ops::CmpGE(Ops::Splat(Data.CornersMin.x), Ops::Add(CX, EX)));
+        Separated                    = Ops::Or(Separated, Ops::CmpGE(Ops::Splat(Data.CornersMin.y), Ops::Add(CY, EY)));
+        Separated                    = Ops::Or(Separated, Ops::CmpGE(Ops::Splat(Data.CornersMin.z), Ops::Add(CZ, EZ)));
+
+        Invisible = Ops::Or(Invisible, Ops::AndNot(Separated, Inside));
+    }
+
+    return Ops::MoveMask(Invisible);
+}
+
+// Computes the visibility mask of boxes [32 * WordIdx, 32 * WordIdx + 32)
+Uint32 ComputeVisibilityMaskWord(const FrustumCullingData& Data, const BoundBoxesSoA& Boxes, Uint32 WordIdx)
+{
+    const Uint32 FirstBox = WordIdx * 32u;
+    const Uint32 EndBox   = (std::min)(FirstBox + 32u, Boxes.NumBoxes);
+
+    Uint32 InvisibleMask = 0;
+    Uint32 BoxIdx        = FirstBox;
+#if DILIGENT_AVX2_ENABLED || DILIGENT_SSE2_ENABLED || DILIGENT_NEON_ENABLED
+    for (; BoxIdx + SIMDOps::Width <= EndBox; BoxIdx += SIMDOps::Width)
+        InvisibleMask |= GetInvisibleBoxesMask<SIMDOps>(Data, Boxes, BoxIdx) << (BoxIdx - FirstBox);
+#endif
+    for (; BoxIdx < EndBox; ++BoxIdx)
+        InvisibleMask |= GetInvisibleBoxesMask<ScalarOps>(Data, Boxes, BoxIdx) << (BoxIdx - FirstBox);
+
+    const Uint32 NumBoxesInWord = EndBox - FirstBox;
+    const Uint32 ValidBits      = NumBoxesInWord < 32u ? (1u << NumBoxesInWord) - 1u : ~0u;
+    return ~InvisibleMask & ValidBits;
+}
+
+// The number of boxes processed by a single thread pool task. Must be a multiple of 32.
+constexpr Uint32 BoxesPerTask = 16384;
+static_assert(BoxesPerTask % 32 == 0, "The number of boxes per task must be a multiple of 32");
+
+template <typename HandlerType>
+void ProcessMaskWords(const BoundBoxesSoA& Boxes, IThreadPool* pThreadPool, HandlerType&& Handler)
+{
+    constexpr Uint32 WordsPerTask = BoxesPerTask / 32u;
+
+    const Uint32 NumWords = GetBoxVisibilityMaskSize(Boxes.NumBoxes);
+    if (pThreadPool == nullptr || NumWords <= WordsPerTask)
+    {
+        Handler(0u, NumWords);
+        return;
+    }
+
+    // Different tasks write to different mask words, so no synchronization is required
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks;
+    Tasks.reserve((NumWords - 1) / WordsPerTask);
+    for (Uint32 FirstWord = WordsPerTask; FirstWord < NumWords; FirstWord += WordsPerTask)
+    {
+        const Uint32 EndWord = (std::min)(FirstWord + WordsPerTask, NumWords);
+        Tasks.emplace_back(EnqueueAsyncWork(pThreadPool,
+                                            [&Handler, FirstWord, EndWord](Uint32 ThreadId) {
+                                                Handler(FirstWord, EndWord);
+                                                return ASYNC_TASK_STATUS_COMPLETE;
+                                            }));
+    }
+
+    Handler(0u, WordsPerTask);
+
+    for (RefCntAutoPtr<IAsyncTask>& pTask : Tasks)
+        pTask->WaitForCompletion();
+}
+
+void VerifyBoxes(const BoundBoxesSoA& Boxes)
+{
+    DEV_CHECK_ERR(Boxes.NumBoxes == 0 ||
+                      (Boxes.CenterX != nullptr && Boxes.CenterY != nullptr && Boxes.CenterZ != nullptr &&
+                       Boxes.HalfExtentX != nullptr && Boxes.HalfExtentY != nullptr && Boxes.HalfExtentZ != nullptr),
+                  "Box data arrays must not be null");
+}
+
+void GetBoxesVisibilityImpl(const FrustumCullingData& Data,
+                            const BoundBoxesSoA&      Boxes,
+                            Uint32*                   pVisibilityMask,
+                            IThreadPool*              pThreadPool)
+{
+    VerifyBoxes(Boxes);
+    DEV_CHECK_ERR(Boxes.NumBoxes == 0 || pVisibilityMask != nullptr, "Visibility mask must not be null");
+
+    ProcessMaskWords(Boxes, pThreadPool,
+                     [&](Uint32 FirstWord, Uint32 EndWord) {
+                         for (Uint32 WordIdx = FirstWord; WordIdx < EndWord; ++WordIdx)
+                             pVisibilityMask[WordIdx] = ComputeVisibilityMaskWord(Data, Boxes, WordIdx);
+                     });
+}
+
+Uint32 GetVisibleBoxesImpl(const FrustumCullingData& Data,
+                           const BoundBoxesSoA&      Boxes,
+                           Uint32*                   pVisibleBoxIndices,
+                           IThreadPool*              pThreadPool)
+{
+    VerifyBoxes(Boxes);
+    DEV_CHECK_ERR(Boxes.NumBoxes == 0 || pVisibleBoxIndices != nullptr, "Visible box indices array must not be null");
+
+    auto WriteIndices = [pVisibleBoxIndices](Uint32 WordIdx, Uint32 Mask, Uint32 NumVisible) {
+        while (Mask != 0)
+        {
+            const Uint32 Bit                 = PlatformMisc::GetLSB(Mask);
+            pVisibleBoxIndices[NumVisible++] = WordIdx * 32u + Bit;
+            Mask &= Mask - 1u;
+        }
+        return NumVisible;
+    };
+
+    const Uint32 NumWords   = GetBoxVisibilityMaskSize(Boxes.NumBoxes);
+    Uint32       NumVisible = 0;
+    if (pThreadPool == nullptr || Boxes.NumBoxes <= BoxesPerTask)
+    {
+        // Write indices directly without the intermediate mask
+        for (Uint32 WordIdx = 0; WordIdx < NumWords; ++WordIdx)
+            NumVisible = WriteIndices(WordIdx, ComputeVisibilityMaskWord(Data, Boxes, WordIdx), NumVisible);
+    }
+    else
+    {
+        std::vector<Uint32> VisibilityMask(NumWords);
+        GetBoxesVisibilityImpl(Data, Boxes, VisibilityMask.data(), pThreadPool);
+        for (Uint32 WordIdx = 0; WordIdx < NumWords; ++WordIdx)
+            NumVisible = WriteIndices(WordIdx, VisibilityMask[WordIdx], NumVisible);
+    }
+
+    return NumVisible;
+}
+
+} // namespace
+
+void GetBoxesVisibility(const ViewFrustum&   Frustum,
+                        const BoundBoxesSoA& Boxes,
+                        Uint32*              pVisibilityMask,
+                        FRUSTUM_PLANE_FLAGS  PlaneFlags,
+                        IThreadPool*         pThreadPool)
+{
+    GetBoxesVisibilityImpl(FrustumCullingData{Frustum, nullptr, PlaneFlags}, Boxes, pVisibilityMask, pThreadPool);
+}
+
+void GetBoxesVisibility(const ViewFrustumExt& FrustumExt,
+                        const BoundBoxesSoA&  Boxes,
+                        Uint32*               pVisibilityMask,
+                        FRUSTUM_PLANE_FLAGS   PlaneFlags,
+                        IThreadPool*          pThreadPool)
+{
+    GetBoxesVisibilityImpl(FrustumCullingData{FrustumExt, &FrustumExt, PlaneFlags}, Boxes, pVisibilityMask, pThreadPool);
+}
+
+Uint32 GetVisibleBoxes(const ViewFrustum&   Frustum,
+                       const BoundBoxesSoA& Boxes,
+                       Uint32*              pVisibleBoxIndices,
+                       FRUSTUM_PLANE_FLAGS  PlaneFlags,
+                       IThreadPool*         pThreadPool)
+{
+    return GetVisibleBoxesImpl(FrustumCullingData{Frustum, nullptr, PlaneFlags}, Boxes, pVisibleBoxIndices, pThreadPool);
+}
+
+Uint32 GetVisibleBoxes(const ViewFrustumExt& FrustumExt,
+                       const BoundBoxesSoA&  Boxes,
+                       Uint32*               pVisibleBoxIndices,
+                       FRUSTUM_PLANE_FLAGS   PlaneFlags,
+                       IThreadPool*          pThreadPool)
+{
+    return GetVisibleBoxesImpl(FrustumCullingData{FrustumExt, &FrustumExt, PlaneFlags}, Boxes, pVisibleBoxIndices, pThreadPool);
+}
+
+} // namespace Diligent
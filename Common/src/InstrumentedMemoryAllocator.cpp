@@ -0,0 +1,479 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+#include "InstrumentedMemoryAllocator.hpp"
+
+#include <algorithm>
+#include <thread>
+
+#include "Align.hpp"
+#include "FastRand.hpp"
+#include "HashUtils.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// The header is placed immediately before the pointer returned to the caller
+struct AllocationHeader
+{
+    Uint32 SiteId;
+    Uint32 HeaderSize; // Distance from the raw allocation to the returned pointer
+    Uint64 Size;
+};
+static_assert(sizeof(AllocationHeader) == 16, "Allocation header size must not break default malloc alignment");
+
+constexpr Uint32 InvalidSiteId = ~Uint32{0};
+
+AllocationHeader& GetHeader(void* Ptr)
+{
+    return reinterpret_cast<AllocationHeader*>(Ptr)[-1];
+}
+
+// Site key that compares the strings by content, so that different pointers to identical
+// strings (e.g. dynamically formatted descriptions) map to the same site, while a buffer
+// that is reused for a different description does not alias the previous site.
+struct SiteKey
+{
+    HashMapStringKey Description;
+    HashMapStringKey FileName;
+    Int32            LineNumber = 0;
+
+    SiteKey(const Char* _Description, const char* _FileName, Int32 _LineNumber, bool bMakeCopy = false) :
+        Description{_Description, bMakeCopy},
+        FileName{_FileName, bMakeCopy},
+        LineNumber{_LineNumber}
+    {}
+
+    bool operator==(const SiteKey& rhs) const
+    {
+        return LineNumber == rhs.LineNumber && Description == rhs.Description && FileName == rhs.FileName;
+    }
+
+    struct Hasher
+    {
+        size_t operator()(const SiteKey& Key) const
+        {
+            return ComputeHash(Key.Description.GetHash(), Key.FileName.GetHash(), Key.LineNumber);
+        }
+    };
+};
+
+// Counters that are only written by a single thread, but may be read by any thread.
+// A relaxed load and store compile to plain moves, unlike read-modify-write operations.
+void AddRelaxed(std::atomic<Int64>& Counter, Int64 Value)
+{
+    Counter.store(Counter.load(std::memory_order_relaxed) + Value, std::memory_order_relaxed);
+}
+
+// Peak counters are written by the owning thread and reset by GetSnapshot(), so they require
+// a compare-exchange. The value only changes when a new maximum is reached, and the cache line
+// is not shared with other threads, so the exchange is uncontended.
+void UpdateMaxRelaxed(std::atomic<Int64>& Peak, Int64 Value)
+{
+    Int64 CurrPeak = Peak.load(std::memory_order_relaxed);
+    while (CurrPeak < Value && !Peak.compare_exchange_weak(CurrPeak, Value, std::memory_order_relaxed))
+    {
+    }
+}
+
+struct ThreadStateCache
+{
+    Uint64 AllocatorId = 0;
+    void*  pState      = nullptr;
+};
+thread_local ThreadStateCache t_ThreadStateCache;
+
+std::atomic<Uint64> g_NextAllocatorId{1};
+
+} // namespace
+
+struct InstrumentedMemoryAllocator::SiteRecord
+{
+    std::string Description;
+    std::string FileName;
+    Int32       LineNumber = 0;
+
+    // The peak live bytes, protected by m_SitesMtx
+    Int64 PeakBytes = 0;
+};
+
+struct InstrumentedMemoryAllocator::ThreadState
+{
+    struct SiteCounters
+    {
+        std::atomic<Int64> Allocations{0};
+        std::atomic<Int64> Frees{0};
+        std::atomic<Int64> AllocatedBytes{0};
+        std::atomic<Int64> FreedBytes{0};
+
+        // The maximum of AllocatedBytes - FreedBytes since the previous snapshot
+        std::atomic<Int64> WindowPeakBytes{0};
+    };
+
+    explicit ThreadState(Uint32 SamplingInterval) :
+        ThreadId{std::this_thread::get_id()},
+        Rand{FastRand::GenerateSeed() ^ static_cast<FastRand::StateType>(std::hash<std::thread::id>{}(ThreadId))}
+    {
+        SampleCountdown = GetNextSampleCountdown(SamplingInterval);
+    }
+
+    // Returns a random countdown in [1, 2 * SamplingInterval - 1] range, which is SamplingInterval on average.
+    // Randomization prevents aliasing with periodic allocation patterns.
+    Uint32 GetNextSampleCountdown(Uint32 SamplingInterval)
+    {
+        if (SamplingInterval <= 1)
+            return 1;
+
+        return 1 + static_cast<Uint32>((Uint64{Rand()} * (Uint64{SamplingInterval} * 2 - 1)) / (Uint64{FastRand::Max} + 1));
+    }
+
+    // Must only be called by the owning thread
+    SiteCounters& GetCounters(Uint32 SiteId)
+    {
+        const Uint32  ChunkIdx = SiteId / SitesPerChunk;
+        SiteCounters* pChunk   = CounterChunks[ChunkIdx].load(std::memory_order_relaxed);
+        if (pChunk == nullptr)
+        {
+            CounterChunkStorage[ChunkIdx] = std::make_unique<SiteCounters[]>(SitesPerChunk);
+            pChunk                        = CounterChunkStorage[ChunkIdx].get();
+            CounterChunks[ChunkIdx].store(pChunk, std::memory_order_release);
+        }
+        return pChunk[SiteId % SitesPerChunk];
+    }
+
+    const std::thread::id ThreadId;
+
+    Uint32   SampleCountdown = 1;
+    FastRand Rand;
+
+    // Tracked bytes allocated minus tracked bytes released by this thread, and
+    // the maximum of this value since the previous snapshot.
+    std::atomic<Int64> LiveBytes{0};
+    std::atomic<Int64> WindowPeakBytes{0};
+
+    // Thread-local cache that maps site keys to site identifiers. The keys are compared by content,
+    // so the cache can't hold more entries than there are distinct sites, and it stops growing once
+    // the site limit is reached.
+    std::unordered_map<SiteKey, Uint32, SiteKey::Hasher> SiteIds;
+
+    std::atomic<SiteCounters*>      CounterChunks[MaxSiteChunks] = {};
+    std::unique_ptr<SiteCounters[]> CounterChunkStorage[MaxSiteChunks];
+};
+
+InstrumentedMemoryAllocator::InstrumentedMemoryAllocator(IMemoryAllocator& RawAllocator, Uint32 SamplingInterval) :
+    m_RawAllocator{RawAllocator},
+    m_SamplingInterval{std::max(SamplingInterval, 1u)},
+    m_AllocatorId{g_NextAllocatorId.fetch_add(1)}
+{
+}
+
+InstrumentedMemoryAllocator::~InstrumentedMemoryAllocator()
+{
+}
+
+InstrumentedMemoryAllocator::ThreadState& InstrumentedMemoryAllocator::GetThreadState()
+{
+    ThreadStateCache& Cache = t_ThreadStateCache;
+    if (Cache.AllocatorId == m_AllocatorId)
+        return *static_cast<ThreadState*>(Cache.pState);
+
+    // The thread uses this allocator for the first time or alternates between several allocators
+    const std::thread::id ThreadId = std::this_thread::get_id();
+
+    std::lock_guard<std::mutex> Lock{m_ThreadStatesMtx};
+
+    auto it = std::find_if(m_ThreadStates.begin(), m_ThreadStates.end(),
+                           [ThreadId](const std::unique_ptr<ThreadState>& State) { return State->ThreadId == ThreadId; });
+    if (it == m_ThreadStates.end())
+    {
+        m_ThreadStates.emplace_back(std::make_unique<ThreadState>(m_SamplingInterval));
+        it = m_ThreadStates.end() - 1;
+    }
+
+    Cache.AllocatorId = m_AllocatorId;
+    Cache.pState      = it->get();
+    return **it;
+}
+
+InstrumentedMemoryAllocator::SiteRecord* InstrumentedMemoryAllocator::GetSite(Uint32 SiteId) const
+{
+    VERIFY_EXPR(SiteId < m_NumSites.load());
+    SiteRecord* pChunk = m_SiteChunks[SiteId / SitesPerChunk].load(std::memory_order_acquire);
+    VERIFY_EXPR(pChunk != nullptr);
+    return &pChunk[SiteId % SitesPerChunk];
+}
+
+Uint32 InstrumentedMemoryAllocator::FindOrAddSite(ThreadState& State, const Char* dbgDescription, const char* dbgFileName, Int32 dbgLineNumber)
+{
+    const char* Description = dbgDescription != nullptr ? dbgDescription : "<Unknown>";
+    const char* FileName    = dbgFileName != nullptr ? dbgFileName : "<Unknown>";
+
+    auto it = State.SiteIds.find(SiteKey{Description, FileName, dbgLineNumber});
+    if (it != State.SiteIds.end())
+        return it->second;
+
+    std::string Name{Description};
+    Name.push_back('\0');
+    Name.append(FileName);
+    Name.push_back('\0');
+    Name.append(std::to_string(dbgLineNumber));
+
+    Uint32 SiteId = InvalidSiteId;
+    {
+        std::lock_guard<std::mutex> Lock{m_SitesMtx};
+
+        auto site_it = m_SiteIds.find(Name);
+        if (site_it != m_SiteIds.end())
+        {
+            SiteId = site_it->second;
+        }
+        else
+        {
+            const Uint32 NumSites = m_NumSites.load(std::memory_order_relaxed);
+            if (NumSites < MaxSites)
+            {
+                const Uint32 ChunkIdx = NumSites / SitesPerChunk;
+                if (NumSites % SitesPerChunk == 0)
+                {
+                    m_SiteChunkStorage.emplace_back(std::make_unique<SiteRecord[]>(SitesPerChunk));
+                    m_SiteChunks[ChunkIdx].store(m_SiteChunkStorage.back().get(), std::memory_order_release);
+                }
+
+                SiteRecord& Site = m_SiteChunks[ChunkIdx].load(std::memory_order_relaxed)[NumSites % SitesPerChunk];
+                Site.Description = Description;
+                Site.FileName    = FileName;
+                Site.LineNumber  = dbgLineNumber;
+
+                SiteId = NumSites;
+                m_SiteIds.emplace(std::move(Name), SiteId);
+                m_NumSites.store(NumSites + 1, std::memory_order_release);
+            }
+            else
+            {
+                LOG_WARNING_MESSAGE_ONCE("The number of allocation sites exceeds the limit (", MaxSites, "). Allocations from new sites will not be tracked.");
+            }
+        }
+    }
+
+    if (State.SiteIds.size() < MaxSites)
+        State.SiteIds.emplace(SiteKey{Description, FileName, dbgLineNumber, /*bMakeCopy = */ true}, SiteId);
+
+    return SiteId;
+}
+
+void* InstrumentedMemoryAllocator::Track(void* pRawMem, size_t HeaderSize, size_t Size, const Char* dbgDescription, const char* dbgFileName, Int32 dbgLineNumber)
+{
+    if (pRawMem == nullptr)
+        return nullptr;
+
+    void*             Ptr    = static_cast<Uint8*>(pRawMem) + HeaderSize;
+    AllocationHeader& Header = GetHeader(Ptr);
+    Header.SiteId            = InvalidSiteId;
+    Header.HeaderSize        = static_cast<Uint32>(HeaderSize);
+    Header.Size              = Size;
+
+    ThreadState& State = GetThreadState();
+    if (--State.SampleCountdown != 0)
+        return Ptr;
+    State.SampleCountdown = State.GetNextSampleCountdown(m_SamplingInterval);
+
+    const Uint32 SiteId = FindOrAddSite(State, dbgDescription, dbgFileName, dbgLineNumber);
+    if (SiteId == InvalidSiteId)
+        return Ptr;
+
+    Header.SiteId = SiteId;
+
+    ThreadState::SiteCounters& Counters = State.GetCounters(SiteId);
+    AddRelaxed(Counters.Allocations, 1);
+    AddRelaxed(Counters.AllocatedBytes, static_cast<Int64>(Size));
+    UpdateMaxRelaxed(Counters.WindowPeakBytes, Counters.AllocatedBytes.load(std::memory_order_relaxed) - Counters.FreedBytes.load(std::memory_order_relaxed));
+
+    AddRelaxed(State.LiveBytes, static_cast<Int64>(Size));
+    UpdateMaxRelaxed(State.WindowPeakBytes, State.LiveBytes.load(std::memory_order_relaxed));
+
+    return Ptr;
+}
+
+void* InstrumentedMemoryAllocator::Untrack(void* Ptr)
+{
+    const AllocationHeader& Header = GetHeader(Ptr);
+    if (Header.SiteId != InvalidSiteId)
+    {
+        // The memory may be released by a different thread, so the counters
+        // of a single thread may go negative, but their sum is always correct.
+        ThreadState&               State    = GetThreadState();
+        ThreadState::SiteCounters& Counters = State.GetCounters(Header.SiteId);
+        AddRelaxed(Counters.Frees, 1);
+        AddRelaxed(Counters.FreedBytes, static_cast<Int64>(Header.Size));
+        AddRelaxed(State.LiveBytes, -static_cast<Int64>(Header.Size));
+    }
+
+    return static_cast<Uint8*>(Ptr) - Header.HeaderSize;
+}
+
+void* InstrumentedMemoryAllocator::Allocate(size_t Size, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY_EXPR(Size > 0);
+    // The raw allocator is expected to return memory aligned at least by 16 bytes (as malloc does),
+    // so the header does not change the alignment of the returned pointer.
+    constexpr size_t HeaderSize = sizeof(AllocationHeader);
+
+    void* pRawMem = m_RawAllocator.Allocate(Size + HeaderSize, dbgDescription, dbgFileName, dbgLineNumber);
+    return Track(pRawMem, HeaderSize, Size, dbgDescription, dbgFileName, dbgLineNumber);
+}
+
+void InstrumentedMemoryAllocator::Free(void* Ptr)
+{
+    if (Ptr != nullptr)
+        m_RawAllocator.Free(Untrack(Ptr));
+}
+
+void* InstrumentedMemoryAllocator::AllocateAligned(size_t Size, size_t Alignment, const Char* dbgDescription, const char* dbgFileName, const Int32 dbgLineNumber)
+{
+    VERIFY_EXPR(Size > 0 && IsPowerOfTwo(Alignment));
+    Alignment = std::max(Alignment, alignof(AllocationHeader));
+
+    const size_t HeaderSize = AlignUp(sizeof(AllocationHeader), Alignment);
+
+    void* pRawMem = m_RawAllocator.AllocateAligned(Size + HeaderSize, Alignment, dbgDescription, dbgFileName, dbgLineNumber);
+    return Track(pRawMem, HeaderSize, Size, dbgDescription, dbgFileName, dbgLineNumber);
+}
+
+void InstrumentedMemoryAllocator::FreeAligned(void* Ptr)
+{
+    if (Ptr != nullptr)
+        m_RawAllocator.FreeAligned(Untrack(Ptr));
+}
+
+InstrumentedMemoryAllocator::Snapshot InstrumentedMemoryAllocator::GetSnapshot() const
+{
+    Snapshot Snap;
+    Snap.SamplingInterval = m_SamplingInterval;
+
+    const Int64 Scale = static_cast<Int64>(m_SamplingInterval);
+
+    // Peak values are updated and per-thread windows are reset under the lock,
+    // so that concurrent snapshots do not race.
+    std::lock_guard<std::mutex> SitesLock{m_SitesMtx};
+
+    const Uint32 NumSites = m_NumSites.load(std::memory_order_acquire);
+
+    // Each thread records the peak of its own live bytes since the previous snapshot. At any moment
+    // in that window, the total live bytes are the sum of per-thread live bytes, so the sum of
+    // per-thread peaks bounds the peak from above. The bound is exact when a single thread allocates
+    // in the window, and the window reset keeps the error from accumulating across snapshots.
+    std::vector<Int64> Allocations(NumSites), Frees(NumSites), AllocatedBytes(NumSites), FreedBytes(NumSites), WindowPeakBytes(NumSites);
+    Int64              TotalWindowPeakBytes = 0;
+    {
+        std::lock_guard<std::mutex> Lock{m_ThreadStatesMtx};
+        for (const std::unique_ptr<ThreadState>& State : m_ThreadStates)
+        {
+            TotalWindowPeakBytes += State->WindowPeakBytes.exchange(State->LiveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+            for (Uint32 ChunkIdx = 0; ChunkIdx * SitesPerChunk < NumSites; ++ChunkIdx)
+            {
+                ThreadState::SiteCounters* pChunk = State->CounterChunks[ChunkIdx].load(std::memory_order_acquire);
+                if (pChunk == nullptr)
+                    continue;
+
+                const Uint32 FirstSite = ChunkIdx * SitesPerChunk;
+                const Uint32 EndSite   = std::min(FirstSite + SitesPerChunk, NumSites);
+                for (Uint32 SiteId = FirstSite; SiteId < EndSite; ++SiteId)
+                {
+                    ThreadState::SiteCounters& Counters = pChunk[SiteId - FirstSite];
+
+                    const Int64 ThreadAllocatedBytes = Counters.AllocatedBytes.load(std::memory_order_relaxed);
+                    const Int64 ThreadFreedBytes     = Counters.FreedBytes.load(std::memory_order_relaxed);
+                    Allocations[SiteId] += Counters.Allocations.load(std::memory_order_relaxed);
+                    Frees[SiteId] += Counters.Frees.load(std::memory_order_relaxed);
+                    AllocatedBytes[SiteId] += ThreadAllocatedBytes;
+                    FreedBytes[SiteId] += ThreadFreedBytes;
+                    WindowPeakBytes[SiteId] += Counters.WindowPeakBytes.exchange(ThreadAllocatedBytes - ThreadFreedBytes, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    Snap.Sites.resize(NumSites);
+    for (Uint32 SiteId = 0; SiteId < NumSites; ++SiteId)
+    {
+        SiteRecord& Site = *GetSite(SiteId);
+        SiteStats&  Stat = Snap.Sites[SiteId];
+
+        Stat.SiteId           = SiteId;
+        Stat.LineNumber       = Site.LineNumber;
+        Stat.Description      = Site.Description;
+        Stat.FileName         = Site.FileName;
+        Stat.LiveBytes        = (AllocatedBytes[SiteId] - FreedBytes[SiteId]) * Scale;
+        Stat.LiveAllocations  = (Allocations[SiteId] - Frees[SiteId]) * Scale;
+        Stat.TotalAllocations = static_cast<Uint64>(Allocations[SiteId] * Scale);
+        Stat.TotalBytes       = static_cast<Uint64>(AllocatedBytes[SiteId] * Scale);
+
+        Site.PeakBytes = std::max({Site.PeakBytes, Stat.LiveBytes, WindowPeakBytes[SiteId] * Scale});
+        Stat.PeakBytes = Site.PeakBytes;
+
+        Snap.LiveBytes += Stat.LiveBytes;
+        Snap.LiveAllocations += Stat.LiveAllocations;
+        Snap.TotalAllocations += Stat.TotalAllocations;
+    }
+
+    m_PeakBytes    = std::max({m_PeakBytes, Snap.LiveBytes, TotalWindowPeakBytes * Scale});
+    Snap.PeakBytes = m_PeakBytes;
+
+    return Snap;
+}
+
+std::vector<InstrumentedMemoryAllocator::SiteStats> InstrumentedMemoryAllocator::GetDifference(const Snapshot& Previous, const Snapshot& Current)
+{
+    std::vector<SiteStats> Diff;
+    for (const SiteStats& CurrStat : Current.Sites)
+    {
+        SiteStats Stat = CurrStat;
+        if (CurrStat.SiteId < Previous.Sites.size())
+        {
+            const SiteStats& PrevStat = Previous.Sites[CurrStat.SiteId];
+            Stat.LiveBytes -= PrevStat.LiveBytes;
+            Stat.LiveAllocations -= PrevStat.LiveAllocations;
+            Stat.TotalAllocations -= PrevStat.TotalAllocations;
+            Stat.TotalBytes -= PrevStat.TotalBytes;
+        }
+
+        if (Stat.LiveBytes != 0 || Stat.LiveAllocations != 0)
+            Diff.emplace_back(std::move(Stat));
+    }
+
+    std::sort(Diff.begin(), Diff.end(),
+              [](const SiteStats& lhs, const SiteStats& rhs) { return lhs.LiveBytes > rhs.LiveBytes; });
+
+    return Diff;
+}
+
+} // namespace Diligent
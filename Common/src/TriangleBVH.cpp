@@ -0,0 +1,703 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TriangleBVH.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+#include "Intrinsics.hpp"
+#include "PlatformMisc.hpp"
+#include "DebugUtilities.hpp"
+#include "ThreadPool.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr Uint32 MaxSAHBins = 64;
+
+// Beyond this depth, the builder uses median splits, which limits
+// the tree depth to MaxSAHDepth + log2(NumTriangles).
+constexpr Uint32 MaxSAHDepth = 64;
+
+// At most three entries are added to the stack per tree level
+constexpr Uint32 TraversalStackSize = 3 * (MaxSAHDepth + 32) + 1;
+
+// Subtrees smaller than this are never built by separate tasks
+constexpr Uint32 MinTrianglesPerBuildTask = 4096;
+
+constexpr Uint32 RaysPerTask = 1024;
+
+float GetSurfaceArea(const BoundBox& Box)
+{
+    const float3 Size = Box.Max - Box.Min;
+    return 2.f * (Size.x * Size.y + Size.y * Size.z + Size.z * Size.x);
+}
+
+// Returns the reciprocal of the direction component, avoiding infinities
+// that produce NaNs in the slab test when the ray origin lies on the slab plane.
+float GetSafeRcp(float d)
+{
+    static constexpr float Epsilon = 1e-20f;
+    return 1.f / (std::abs(d) > Epsilon ? d : (d >= 0 ? Epsilon : -Epsilon));
+}
+
+// Inflates the exit distance to make the slab test conservative with respect to rounding errors.
+// See Ize T., "Robust BVH Ray Traversal".
+constexpr float SlabTestExitScale = 1.f + 2.f * 3.6e-7f;
+
+} // namespace
+
+struct TriangleBVH::BinaryTree
+{
+    struct Node
+    {
+        BoundBox Bounds;
+        Uint32   Children[2];
+        Uint32   FirstTriangle;
+        Uint32   NumTriangles;
+
+        bool IsLeaf() const { return NumTriangles != 0; }
+    };
+
+    struct Subtree
+    {
+        Uint32 NodeIdx;
+        Uint32 Begin;
+        Uint32 End;
+        Uint32 Depth;
+    };
+
+    BinaryTree(const std::vector<float3>& Vertices,
+               const std::vector<uint3>&  Triangles,
+               Uint32                     _MaxTrianglesPerLeaf,
+               Uint32                     _NumBins) :
+        MaxTrianglesPerLeaf{_MaxTrianglesPerLeaf},
+        NumBins{_NumBins}
+    {
+        const Uint32 NumTriangles = static_cast<Uint32>(Triangles.size());
+
+        // A binary tree with at least one triangle per leaf has at most 2 * N - 1 nodes
+        Nodes.resize(size_t{NumTriangles} * 2 - 1);
+        TriBounds.resize(NumTriangles);
+        Centroids.resize(NumTriangles);
+        TriOrder.resize(NumTriangles);
+        for (Uint32 i = 0; i < NumTriangles; ++i)
+        {
+            const uint3&  Tri = Triangles[i];
+            const float3& V0  = Vertices[Tri.x];
+            const float3& V1  = Vertices[Tri.y];
+            const float3& V2  = Vertices[Tri.z];
+
+            BoundBox Bounds{(std::min)((std::min)(V0, V1), V2), (std::max)((std::max)(V0, V1), V2)};
+            Centroids[i] = (Bounds.Min + Bounds.Max) * 0.5f;
+
+            // Pad the bounds to account for rounding errors in the ray-triangle test, which
+            // may report hits slightly outside of the triangle, e.g. at shared vertices.
+            const float3 AbsMax  = (std::max)(abs(Bounds.Min), abs(Bounds.Max));
+            const float3 Extent  = Bounds.Max - Bounds.Min;
+            const float  Padding = ((max)(AbsMax.x, AbsMax.y, AbsMax.z) + (max)(Extent.x, Extent.y, Extent.z)) * 1e-6f;
+            Bounds.Min -= float3{Padding, Padding, Padding};
+            Bounds.Max += float3{Padding, Padding, Padding};
+            TriBounds[i] = Bounds;
+            TriOrder[i]  = i;
+        }
+    }
+
+    Uint32 AllocateNodes(Uint32 Count)
+    {
+        const Uint32 FirstNode = NumNodes.fetch_add(Count);
+        VERIFY_EXPR(FirstNode + Count <= Nodes.size());
+        return FirstNode;
+    }
+
+    // Builds the subtree of triangles [Begin, End) rooted at NodeIdx.
+    // If pDeferred is not null, subtrees smaller than DeferThreshold are not built,
+    // but are added to the list instead.
+    void Build(Uint32 NodeIdx, Uint32 Begin, Uint32 End, Uint32 Depth, std::vector<Subtree>* pDeferred, Uint32 DeferThreshold);
+
+    bool FindSAHSplit(const BoundBox& CentroidBounds, float ParentArea, Uint32 Begin, Uint32 End, Uint32& Axis, Uint32& SplitBin, float& Cost) const;
+
+    Uint32 GetBinIndex(float Centroid, float Min, float Scale) const
+    {
+        return (std::min)(static_cast<Uint32>((Centroid - Min) * Scale), NumBins - 1);
+    }
+
+    const Uint32 MaxTrianglesPerLeaf;
+    const Uint32 NumBins;
+
+    std::vector<Node>     Nodes;
+    std::atomic<Uint32>   NumNodes{0};
+    std::vector<BoundBox> TriBounds;
+    std::vector<float3>   Centroids;
+    std::vector<Uint32>   TriOrder;
+};
+
+bool TriangleBVH::BinaryTree::FindSAHSplit(const BoundBox& CentroidBounds,
+                                           float           ParentArea,
+                                           Uint32          Begin,
+                                           Uint32          End,
+                                           Uint32&         BestAxis,
+                                           Uint32&         BestSplitBin,
+                                           float&          BestCost) const
+{
+    bool Found = false;
+    BestCost   = FLT_MAX;
+    for (Uint32 Axis = 0; Axis < 3; ++Axis)
+    {
+        const float Extent = CentroidBounds.Max[Axis] - CentroidBounds.Min[Axis];
+        if (!(Extent > 0))
+            continue;
+
+        const float Scale = static_cast<float>(NumBins) / Extent;
+
+        BoundBox BinBounds[MaxSAHBins];
+        Uint32   BinCounts[MaxSAHBins] = {};
+        for (Uint32 bin = 0; bin < NumBins; ++bin)
+            BinBounds[bin] = BoundBox::Invalid();
+
+        for (Uint32 i = Begin; i < End; ++i)
+        {
+            const Uint32 TriIdx = TriOrder[i];
+            const Uint32 Bin    = GetBinIndex(Centroids[TriIdx][Axis], CentroidBounds.Min[Axis], Scale);
+            BinBounds[Bin]      = BinBounds[Bin].Combine(TriBounds[TriIdx]);
+            ++BinCounts[Bin];
+        }
+
+        // Sweep from the right to compute the cost of the right part of every split
+        float    RightCost[MaxSAHBins];
+        BoundBox RightBounds = BoundBox::Invalid();
+        Uint32   RightCount  = 0;
+        for (Uint32 bin = NumBins - 1; bin > 0; --bin)
+        {
+            if (BinCounts[bin] > 0)
+                RightBounds = RightBounds.Combine(BinBounds[bin]);
+            RightCount += BinCounts[bin];
+            RightCost[bin - 1] = RightCount > 0 ? GetSurfaceArea(RightBounds) * static_cast<float>(RightCount) : 0;
+        }
+
+        BoundBox LeftBounds = BoundBox::Invalid();
+        Uint32   LeftCount  = 0;
+        for (Uint32 bin = 0; bin + 1 < NumBins; ++bin)
+        {
+            if (BinCounts[bin] > 0)
+                LeftBounds = LeftBounds.Combine(BinBounds[bin]);
+            LeftCount += BinCounts[bin];
+            if (LeftCount == 0 || LeftCount == End - Begin)
+                continue;
+
+            // Traversal cost is assumed to be equal to the triangle intersection cost
+            const float Cost = ParentArea + GetSurfaceArea(LeftBounds) * static_cast<float>(LeftCount) + RightCost[bin];
+            if (Cost < BestCost)
+            {
+                BestCost     = Cost;
+                BestAxis     = Axis;
+                BestSplitBin = bin;
+                Found        = true;
+            }
+        }
+    }
+
+    return Found;
+}
+
+void TriangleBVH::BinaryTree::Build(Uint32                NodeIdx,
+                                    Uint32                Begin,
+                                    Uint32                End,
+                                    Uint32                Depth,
+                                    std::vector<Subtree>* pDeferred,
+                                    Uint32                DeferThreshold)
+{
+    Node& N = Nodes[NodeIdx];
+
+    const Uint32 Count = End - Begin;
+    VERIFY_EXPR(Count > 0);
+
+    if (pDeferred != nullptr && Count <= DeferThreshold)
+    {
+        pDeferred->push_back({NodeIdx, Begin, End, Depth});
+        return;
+    }
+
+    N.Bounds                = BoundBox::Invalid();
+    BoundBox CentroidBounds = BoundBox::Invalid();
+    for (Uint32 i = Begin; i < End; ++i)
+    {
+        const Uint32 TriIdx = TriOrder[i];
+        N.Bounds            = N.Bounds.Combine(TriBounds[TriIdx]);
+        CentroidBounds      = CentroidBounds.Enclose(Centroids[TriIdx]);
+    }
+
+    auto MakeLeaf = [&]() {
+        N.FirstTriangle = Begin;
+        N.NumTriangles  = Count;
+    };
+
+    if (Count == 1)
+    {
+        MakeLeaf();
+        return;
+    }
+
+    Uint32 Mid = Begin;
+    if (Depth < MaxSAHDepth)
+    {
+        const float ParentArea = GetSurfaceArea(N.Bounds);
+
+        Uint32 Axis     = 0;
+        Uint32 SplitBin = 0;
+        float  Cost     = 0;
+        if (FindSAHSplit(CentroidBounds, ParentArea, Begin, End, Axis, SplitBin, Cost))
+        {
+            if (Count <= MaxTrianglesPerLeaf && Cost >= ParentArea * static_cast<float>(Count))
+            {
+                MakeLeaf();
+                return;
+            }
+
+            const float MinCentroid = CentroidBounds.Min[Axis];
+            const float Scale       = static_cast<float>(NumBins) / (CentroidBounds.Max[Axis] - MinCentroid);
+
+            Mid = static_cast<Uint32>(std::partition(TriOrder.begin() + Begin, TriOrder.begin() + End,
+                                                     [&](Uint32 TriIdx) {
+                                                         return GetBinIndex(Centroids[TriIdx][Axis], MinCentroid, Scale) <= SplitBin;
+                                                     }) -
+                                      TriOrder.begin());
+        }
+    }
+
+    if (Mid == Begin || Mid == End)
+    {
+        // All centroids coincide or the depth limit has been reached
+        if (Count <= MaxTrianglesPerLeaf)
+        {
+            MakeLeaf();
+            return;
+        }
+
+        const float3 Extent = CentroidBounds.Max - CentroidBounds.Min;
+        const Uint32 Axis   = (Extent.x >= Extent.y && Extent.x >= Extent.z) ? 0 : (Extent.y >= Extent.z ? 1 : 2);
+
+        Mid = Begin + Count / 2;
+        std::nth_element(TriOrder.begin() + Begin, TriOrder.begin() + Mid, TriOrder.begin() + End,
+                         [&](Uint32 Tri0, Uint32 Tri1) {
+                             return Centroids[Tri0][Axis] < Centroids[Tri1][Axis];
+                         });
+    }
+
+    const Uint32 FirstChild = AllocateNodes(2);
+
+    N.NumTriangles = 0;
+    N.Children[0]  = FirstChild;
+    N.Children[1]  = FirstChild + 1;
+
+    Build(FirstChild, Begin, Mid, Depth + 1, pDeferred, DeferThreshold);
+    Build(FirstChild + 1, Mid, End, Depth + 1, pDeferred, DeferThreshold);
+}
+
+TriangleBVH::TriangleBVH(const TriangleBVHCreateInfo& CI) noexcept(false)
+{
+    if (CI.NumTriangles == 0)
+        return;
+
+    if (CI.pVertices == nullptr)
+        LOG_ERROR_AND_THROW("Vertex data must not be null");
+    if (CI.VertexStride < sizeof(float3))
+        LOG_ERROR_AND_THROW("Vertex stride (", CI.VertexStride, ") must be at least ", sizeof(float3));
+    if (CI.pIndices == nullptr && size_t{CI.NumTriangles} * 3 > CI.NumVertices)
+        LOG_ERROR_AND_THROW("Non-indexed triangle list requires at least ", size_t{CI.NumTriangles} * 3, " vertices, but only ", CI.NumVertices, " are provided");
+    if (CI.NumTriangles >= LeafBit)
+        LOG_ERROR_AND_THROW("Too many triangles");
+
+    const Uint32 MaxTrianglesPerLeaf = (std::max)(CI.MaxTrianglesPerLeaf, 1u);
+    const Uint32 NumBins             = (std::min)((std::max)(CI.NumSAHBins, 2u), MaxSAHBins);
+
+    m_Vertices.resize(CI.NumVertices);
+    for (Uint32 v = 0; v < CI.NumVertices; ++v)
+    {
+        const float* pPos = reinterpret_cast<const float*>(static_cast<const Uint8*>(CI.pVertices) + size_t{v} * CI.VertexStride);
+        m_Vertices[v]     = float3{pPos[0], pPos[1], pPos[2]};
+    }
+
+    std::vector<uint3> SrcTriangles(CI.NumTriangles);
+    for (Uint32 t = 0; t < CI.NumTriangles; ++t)
+    {
+        uint3& Tri = SrcTriangles[t];
+        if (CI.pIndices != nullptr)
+        {
+            Tri = uint3{CI.pIndices[t * 3 + 0], CI.pIndices[t * 3 + 1], CI.pIndices[t * 3 + 2]};
+            if (Tri.x >= CI.NumVertices || Tri.y >= CI.NumVertices || Tri.z >= CI.NumVertices)
+                LOG_ERROR_AND_THROW("Triangle ", t, " references a vertex that is out of range [0, ", CI.NumVertices, ")");
+        }
+        else
+        {
+            Tri = uint3{t * 3 + 0, t * 3 + 1, t * 3 + 2};
+        }
+    }
+
+    BinaryTree Tree{m_Vertices, SrcTriangles, MaxTrianglesPerLeaf, NumBins};
+    Tree.AllocateNodes(1);
+
+    // Split the top levels on the calling thread and build the remaining subtrees in parallel
+    const Uint32 DeferThreshold = (std::max)(CI.NumTriangles / 64u, MinTrianglesPerBuildTask);
+    if (CI.pThreadPool != nullptr && CI.NumTriangles > DeferThreshold)
+    {
+        std::vector<BinaryTree::Subtree> Subtrees;
+        Tree.Build(0, 0, CI.NumTriangles, 0, &Subtrees, DeferThreshold);
+
+        std::vector<RefCntAutoPtr<IAsyncTask>> Tasks;
+        Tasks.reserve(Subtrees.size());
+        for (const BinaryTree::Subtree& ST : Subtrees)
+        {
+            Tasks.emplace_back(EnqueueAsyncWork(CI.pThreadPool,
+                                                [&Tree, ST](Uint32 ThreadId) {
+                                                    Tree.Build(ST.NodeIdx, ST.Begin, ST.End, ST.Depth, nullptr, 0);
+                                                    return ASYNC_TASK_STATUS_COMPLETE;
+                                                }));
+        }
+        for (RefCntAutoPtr<IAsyncTask>& pTask : Tasks)
+            pTask->WaitForCompletion();
+    }
+    else
+    {
+        Tree.Build(0, 0, CI.NumTriangles, 0, nullptr, 0);
+    }
+
+    m_Bounds = Tree.Nodes[0].Bounds;
+
+    m_Triangles.resize(CI.NumTriangles);
+    m_TriangleIds = std::move(Tree.TriOrder);
+    for (Uint32 i = 0; i < CI.NumTriangles; ++i)
+        m_Triangles[i] = SrcTriangles[m_TriangleIds[i]];
+
+    m_Nodes.reserve(Tree.NumNodes.load() / 2 + 1);
+    CollapseNode(Tree, 0);
+}
+
+Uint32 TriangleBVH::CollapseNode(const BinaryTree& Tree, Uint32 BinaryNodeIdx)
+{
+    const BinaryTree::Node& BinaryNode = Tree.Nodes[BinaryNodeIdx];
+
+    Uint32 Children[4] = {};
+    Uint32 NumChildren = 0;
+    if (BinaryNode.IsLeaf())
+    {
+        // Single-leaf tree
+        Children[NumChildren++] = BinaryNodeIdx;
+    }
+    else
+    {
+        Children[NumChildren++] = BinaryNode.Children[0];
+        Children[NumChildren++] = BinaryNode.Children[1];
+
+        // Open the inner children with the largest surface area until there are four children
+        while (NumChildren < 4)
+        {
+            int   BestChild = -1;
+            float BestArea  = -1;
+            for (Uint32 i = 0; i < NumChildren; ++i)
+            {
+                const BinaryTree::Node& Child = Tree.Nodes[Children[i]];
+                if (Child.IsLeaf())
+                    continue;
+
+                const float Area = GetSurfaceArea(Child.Bounds);
+                if (Area > BestArea)
+                {
+                    BestArea  = Area;
+                    BestChild = static_cast<int>(i);
+                }
+            }
+            if (BestChild < 0)
+                break;
+
+            const BinaryTree::Node& Child = Tree.Nodes[Children[BestChild]];
+            Children[BestChild]           = Child.Children[0];
+            Children[NumChildren++]       = Child.Children[1];
+        }
+    }
+
+    const Uint32 NodeIdx = static_cast<Uint32>(m_Nodes.size());
+    m_Nodes.emplace_back();
+
+    for (Uint32 i = 0; i < 4; ++i)
+    {
+        BoundBox Bounds = BoundBox::Invalid();
+        Uint32   Ref    = InvalidChild;
+        if (i < NumChildren)
+        {
+            const BinaryTree::Node& Child = Tree.Nodes[Children[i]];
+
+            Bounds = Child.Bounds;
+            if (Child.IsLeaf())
+            {
+                Ref = LeafBit | static_cast<Uint32>(m_Leaves.size());
+                m_Leaves.push_back({Child.FirstTriangle, Child.NumTriangles});
+            }
+            else
+            {
+                // Note that the recursion may reallocate m_Nodes
+                Ref = CollapseNode(Tree, Children[i]);
+            }
+        }
+
+        Node& N       = m_Nodes[NodeIdx];
+        N.MinX[i]     = Bounds.Min.x;
+        N.MinY[i]     = Bounds.Min.y;
+        N.MinZ[i]     = Bounds.Min.z;
+        N.MaxX[i]     = Bounds.Max.x;
+        N.MaxY[i]     = Bounds.Max.y;
+        N.MaxZ[i]     = Bounds.Max.z;
+        N.Children[i] = Ref;
+    }
+
+    return NodeIdx;
+}
+
+namespace
+{
+
+// Intersects the ray with the four child boxes of the node and returns the mask of the boxes
+// that are hit in [0, MaxDist] range. Entry distances are written to EnterDist.
+template <typename NodeType>
+Uint32 IntersectChildBoxes(const NodeType& N, const float3& Origin, const float3& InvDir, float MaxDist, float (&EnterDist)[4])
+{
+#if DILIGENT_SSE2_ENABLED
+    const __m128 OX = _mm_set1_ps(Origin.x);
+    const __m128 OY = _mm_set1_ps(Origin.y);
+    const __m128 OZ = _mm_set1_ps(Origin.z);
+    const __m128 IX = _mm_set1_ps(InvDir.x);
+    const __m128 IY = _mm_set1_ps(InvDir.y);
+    const __m128 IZ = _mm_set1_ps(InvDir.z);
+
+    const __m128 TX0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(N.MinX), OX), IX);
+    const __m128 TX1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(N.MaxX), OX), IX);
+    const __m128 TY0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(N.MinY), OY), IY);
+    const __m128 TY1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(N.MaxY), OY), IY);
+    const __m128 TZ0 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(N.MinZ), OZ), IZ);
+    const __m128 TZ1 = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(N.MaxZ), OZ), IZ);
+
+    const __m128 TEnter = _mm_max_ps(_mm_max_ps(_mm_min_ps(TX0, TX1), _mm_min_ps(TY0, TY1)),
+                                     _mm_max_ps(_mm_min_ps(TZ0, TZ1), _mm_setzero_ps()));
+    __m128       TExit  = _mm_min_ps(_mm_max_ps(TX0, TX1), _mm_min_ps(_mm_max_ps(TY0, TY1), _mm_max_ps(TZ0, TZ1)));
+    TExit               = _mm_min_ps(_mm_mul_ps(TExit, _mm_set1_ps(SlabTestExitScale)), _mm_set1_ps(MaxDist));
+
+    _mm_storeu_ps(EnterDist, TEnter);
+    return static_cast<Uint32>(_mm_movemask_ps(_mm_cmple_ps(TEnter, TExit)));
+#elif DILIGENT_NEON_ENABLED
+    const float32x4_t OX = vdupq_n_f32(Origin.x);
+    const float32x4_t OY = vdupq_n_f32(Origin.y);
+    const float32x4_t OZ = vdupq_n_f32(Origin.z);
+    const float32x4_t IX = vdupq_n_f32(InvDir.x);
+    const float32x4_t IY = vdupq_n_f32(InvDir.y);
+    const float32x4_t IZ = vdupq_n_f32(InvDir.z);
+
+    const float32x4_t TX0 = vmulq_f32(vsubq_f32(vld1q_f32(N.MinX), OX), IX);
+    const float32x4_t TX1 = vmulq_f32(vsubq_f32(vld1q_f32(N.MaxX), OX), IX);
+    const float32x4_t TY0 = vmulq_f32(vsubq_f32(vld1q_f32(N.MinY), OY), IY);
+    const float32x4_t TY1 = vmulq_f32(vsubq_f32(vld1q_f32(N.MaxY), OY), IY);
+    const float32x4_t TZ0 = vmulq_f32(vsubq_f32(vld1q_f32(N.MinZ), OZ), IZ);
+    const float32x4_t TZ1 = vmulq_f32(vsubq_f32(vld1q_f32(N.MaxZ), OZ), IZ);
+
+    const float32x4_t TEnter = vmaxq_f32(vmaxq_f32(vminq_f32(TX0, TX1), vminq_f32(TY0, TY1)),
+                                         vmaxq_f32(vminq_f32(TZ0, TZ1), vdupq_n_f32(0)));
+    float32x4_t       TExit  = vminq_f32(vmaxq_f32(TX0, TX1), vminq_f32(vmaxq_f32(TY0, TY1), vmaxq_f32(TZ0, TZ1)));
+    TExit                    = vminq_f32(vmulq_f32(TExit, vdupq_n_f32(SlabTestExitScale)), vdupq_n_f32(MaxDist));
+
+    vst1q_f32(EnterDist, TEnter);
+
+    static constexpr Uint32 LaneBits[] = {1, 2, 4, 8};
+
+    const uint32x4_t Bits = vandq_u32(vcleq_f32(TEnter, TExit), vld1q_u32(LaneBits));
+    const uint32x2_t Sum  = vorr_u32(vget_low_u32(Bits), vget_high_u32(Bits));
+    return vget_lane_u32(Sum, 0) | vget_lane_u32(Sum, 1);
+#else
+    Uint32 HitMask = 0;
+    for (Uint32 i = 0; i < 4; ++i)
+    {
+        const float TX0 = (N.MinX[i] - Origin.x) * InvDir.x;
+        const float TX1 = (N.MaxX[i] - Origin.x) * InvDir.x;
+        const float TY0 = (N.MinY[i] - Origin.y) * InvDir.y;
+        const float TY1 = (N.MaxY[i] - Origin.y) * InvDir.y;
+        const float TZ0 = (N.MinZ[i] - Origin.z) * InvDir.z;
+        const float TZ1 = (N.MaxZ[i] - Origin.z) * InvDir.z;
+
+        const float TEnter = (std::max)((std::max)((std::min)(TX0, TX1), (std::min)(TY0, TY1)), (std::max)((std::min)(TZ0, TZ1), 0.f));
+        const float TExit  = (std::min)((min)((std::max)(TX0, TX1), (std::max)(TY0, TY1), (std::max)(TZ0, TZ1)) * SlabTestExitScale, MaxDist);
+
+        EnterDist[i] = TEnter;
+        if (TEnter <= TExit)
+            HitMask |= 1u << i;
+    }
+    return HitMask;
+#endif
+}
+
+} // namespace
+
+template <bool AnyHitQuery>
+TriangleBVH::Hit TriangleBVH::Traverse(const Ray& R, bool CullBackFace) const
+{
+    Hit BestHit;
+    if (m_Nodes.empty())
+        return BestHit;
+
+    const float3 InvDir{GetSafeRcp(R.Direction.x), GetSafeRcp(R.Direction.y), GetSafeRcp(R.Direction.z)};
+
+    float  MaxDist      = R.MaxDistance;
+    Uint32 BestTriangle = ~0u;
+
+    struct StackEntry
+    {
+        Uint32 Ref;
+        float  EnterDist;
+    };
+    StackEntry Stack[TraversalStackSize];
+    Uint32     StackSize = 0;
+
+    Stack[StackSize++] = {0, 0};
+    while (StackSize > 0)
+    {
+        const StackEntry Entry = Stack[--StackSize];
+        if (Entry.EnterDist > MaxDist)
+            continue;
+
+        if (Entry.Ref & LeafBit)
+        {
+            const Leaf& L = m_Leaves[Entry.Ref & ~LeafBit];
+            for (Uint32 i = L.FirstTriangle; i < L.FirstTriangle + L.NumTriangles; ++i)
+            {
+                const uint3& Tri  = m_Triangles[i];
+                const float  Dist = IntersectRayTriangle(m_Vertices[Tri.x], m_Vertices[Tri.y], m_Vertices[Tri.z], R.Origin, R.Direction, CullBackFace);
+                // IntersectRayTriangle returns FLT_MAX if there is no intersection
+                if (Dist >= 0 && Dist <= MaxDist && Dist != FLT_MAX)
+                {
+                    MaxDist      = Dist;
+                    BestTriangle = i;
+                    if (AnyHitQuery)
+                    {
+                        StackSize = 0;
+                        break;
+                    }
+                }
+            }
+            continue;
+        }
+
+        const Node& N = m_Nodes[Entry.Ref];
+
+        float  EnterDist[4];
+        Uint32 HitMask = IntersectChildBoxes(N, R.Origin, InvDir, MaxDist, EnterDist);
+
+        // Push the children so that the closest one is on top of the stack
+        const Uint32 FirstEntry = StackSize;
+        while (HitMask != 0)
+        {
+            const Uint32 i = PlatformMisc::GetLSB(HitMask);
+            HitMask &= HitMask - 1;
+            if (N.Children[i] == InvalidChild)
+                continue;
+
+            Uint32 Pos = StackSize++;
+            VERIFY_EXPR(StackSize <= TraversalStackSize);
+            for (; Pos > FirstEntry && Stack[Pos - 1].EnterDist < EnterDist[i]; --Pos)
+                Stack[Pos] = Stack[Pos - 1];
+            Stack[Pos] = {N.Children[i], EnterDist[i]};
+        }
+    }
+
+    if (BestTriangle != ~0u)
+    {
+        const uint3&  Tri = m_Triangles[BestTriangle];
+        const float3& V0  = m_Vertices[Tri.x];
+        const float3  E1  = m_Vertices[Tri.y] - V0;
+        const float3  E2  = m_Vertices[Tri.z] - V0;
+        const float3  P   = cross(R.Direction, E2);
+        const float3  S   = R.Origin - V0;
+        const float   Det = dot(E1, P);
+
+        BestHit.Distance      = MaxDist;
+        BestHit.TriangleIndex = m_TriangleIds[BestTriangle];
+        BestHit.Barycentrics  = float2{dot(S, P) / Det, dot(R.Direction, cross(S, E1)) / Det};
+    }
+
+    return BestHit;
+}
+
+TriangleBVH::Hit TriangleBVH::CastRay(const Ray& R, bool CullBackFace) const
+{
+    return Traverse<false>(R, CullBackFace);
+}
+
+bool TriangleBVH::AnyHit(const Ray& R, bool CullBackFace) const
+{
+    return static_cast<bool>(Traverse<true>(R, CullBackFace));
+}
+
+void TriangleBVH::CastRays(const Ray*   pRays,
+                           Hit*         pHits,
+                           Uint32       NumRays,
+                           bool         CullBackFace,
+                           IThreadPool* pThreadPool) const
+{
+    if (NumRays == 0)
+        return;
+
+    DEV_CHECK_ERR(pRays != nullptr && pHits != nullptr, "Ray and hit arrays must not be null");
+
+    auto CastRayRange = [&](Uint32 FirstRay, Uint32 EndRay) {
+        for (Uint32 i = FirstRay; i < EndRay; ++i)
+            pHits[i] = Traverse<false>(pRays[i], CullBackFace);
+    };
+
+    if (pThreadPool == nullptr || NumRays <= RaysPerTask)
+    {
+        CastRayRange(0, NumRays);
+        return;
+    }
+
+    std::vector<RefCntAutoPtr<IAsyncTask>> Tasks;
+    Tasks.reserve((NumRays - 1) / RaysPerTask);
+    for (Uint32 FirstRay = RaysPerTask; FirstRay < NumRays; FirstRay += RaysPerTask)
+    {
+        const Uint32 EndRay = (std::min)(FirstRay + RaysPerTask, NumRays);
+        Tasks.emplace_back(EnqueueAsyncWork(pThreadPool,
+                                            [&CastRayRange, FirstRay, EndRay](Uint32 ThreadId) {
+                                                CastRayRange(FirstRay, EndRay);
+                                                return ASYNC_TASK_STATUS_COMPLETE;
+                                            }));
+    }
+
+    CastRayRange(0, RaysPerTask);
+
+    for (RefCntAutoPtr<IAsyncTask>& pTask : Tasks)
+        pTask->WaitForCompletion();
+}
+
+} // namespace Diligent
@@ -165,7 +165,16 @@ public:
 private:
     template <typename PSOCreateInfoType>
     void Initialize(const PSOCreateInfoType&        CreateInfo,
-                    const PipelineStateArchiveInfo& ArchiveInfo);
+                    const PipelineStateArchiveInfo& ArchiveInfo,
+                    bool                            ShadersPatched = false);
+
+    // Returns the device flags for which shaders need to be patched.
+    static ARCHIVE_DEVICE_DATA_FLAGS GetPatchDeviceFlags(const PipelineStateArchiveInfo& ArchiveInfo);
+
+    // Patches shaders for a single device type. Only writes the device-specific
+    // data of that type, unless the PSO uses the default resource signature.
+    template <typename PSOCreateInfoType>
+    void PatchShaders(const PSOCreateInfoType& CreateInfo, ARCHIVE_DEVICE_DATA_FLAGS Flag) noexcept(false);
 
     template <typename CreateInfoType>
     void PatchShadersVk(const CreateInfoType& CreateInfo) noexcept(false);
@@ -323,6 +323,29 @@ DILIGENT_BEGIN_INTERFACE(IArchiverFactory, IObject)
                                        IDataBlob**      ppDstArchive) CONST PURE;
 
 
+    /// Updates resources in an existing archive without rebuilding it.
+
+    /// \param [in]  pSrcArchive         - Source archive to update.
+    /// \param [in]  pUpdateArchive      - Optional archive that contains new versions of the resources.
+    ///                                   Resources that have the same type and name as the resources in
+    ///                                   the source archive replace them, all other resources are added.
+    /// \param [in]  ppRemovedResources  - Optional array of names of the resources to remove from the source archive.
+    ///                                   All resources with the given name are removed regardless of their type.
+    /// \param [in]  NumRemovedResources - The number of elements in `ppRemovedResources` array.
+    /// \param [out] ppDstArchive        - Memory address where a pointer to the updated archive will be written.
+    /// \return     `true` if the archive was successfully updated, and `false` otherwise.
+    ///
+    /// \remarks    Serialized data of the resources that are not affected by the update is copied verbatim.
+    ///             Shaders that are byte-identical to the shaders in the source archive are shared, and shaders
+    ///             that are no longer referenced by any resource are removed.
+    VIRTUAL Bool METHOD(UpdateArchive)(THIS_
+                                       const IDataBlob*   pSrcArchive,
+                                       const IDataBlob*   pUpdateArchive,
+                                       const Char* const* ppRemovedResources,
+                                       Uint32             NumRemovedResources,
+                                       IDataBlob**        ppDstArchive) CONST PURE;
+
+
     /// Prints archive content for debugging and validation.
     VIRTUAL Bool METHOD(PrintArchiveContent)(THIS_
                                              const IDataBlob* pArchive) CONST PURE;
@@ -351,6 +374,7 @@ DILIGENT_END_INTERFACE
 #    define IArchiverFactory_RemoveDeviceData(This, ...)                        CALL_IFACE_METHOD(ArchiverFactory, RemoveDeviceData,                       This, __VA_ARGS__)
 #    define IArchiverFactory_AppendDeviceData(This, ...)                        CALL_IFACE_METHOD(ArchiverFactory, AppendDeviceData,                       This, __VA_ARGS__)
 #    define IArchiverFactory_MergeArchives(This, ...)                           CALL_IFACE_METHOD(ArchiverFactory, MergeArchives,                          This, __VA_ARGS__)
+#    define IArchiverFactory_UpdateArchive(This, ...)                           CALL_IFACE_METHOD(ArchiverFactory, UpdateArchive,                          This, __VA_ARGS__)
 #    define IArchiverFactory_PrintArchiveContent(This, ...)                     CALL_IFACE_METHOD(ArchiverFactory, PrintArchiveContent,                    This, __VA_ARGS__)
 #    define IArchiverFactory_SetMessageCallback(This, ...)                      CALL_IFACE_METHOD(ArchiverFactory, SetMessageCallback,                     This, __VA_ARGS__)
 #    define IEngineFactory_SetBreakOnError(This, ...)                           CALL_IFACE_METHOD(EngineFactory,   SetBreakOnError,                        This, __VA_ARGS__)
@@ -137,6 +137,13 @@ public:
         Uint32           NumSrcArchives,
         IDataBlob**      ppDstArchive) const override final;
 
+    virtual Bool DILIGENT_CALL_TYPE UpdateArchive(
+        const IDataBlob*   pSrcArchive,
+        const IDataBlob*   pUpdateArchive,
+        const Char* const* ppRemovedResources,
+        Uint32             NumRemovedResources,
+        IDataBlob**        ppDstArchive) const override final;
+
     virtual Bool DILIGENT_CALL_TYPE PrintArchiveContent(const IDataBlob* pArchive) const override final;
 
     virtual void DILIGENT_CALL_TYPE SetMessageCallback(DebugMessageCallbackType MessageCallback) const override final;
@@ -324,6 +331,57 @@ Bool ArchiverFactoryImpl::MergeArchives(
     }
 }
 
+Bool ArchiverFactoryImpl::UpdateArchive(
+    const IDataBlob*   pSrcArchive,
+    const IDataBlob*   pUpdateArchive,
+    const Char* const* ppRemovedResources,
+    Uint32             NumRemovedResources,
+    IDataBlob**        ppDstArchive) const
+{
+    if (pSrcArchive == nullptr)
+    {
+        DEV_ERROR("pSrcArchive must not be null");
+        return false;
+    }
+    if (ppDstArchive == nullptr)
+    {
+        DEV_ERROR("ppDstArchive must not be null");
+        return false;
+    }
+    DEV_CHECK_ERR(*ppDstArchive == nullptr, "*ppDstArchive must be null");
+    DEV_CHECK_ERR(NumRemovedResources == 0 || ppRemovedResources != nullptr, "ppRemovedResources must not be null when NumRemovedResources is not zero");
+
+    try
+    {
+        // Resource data references the source archive blob and is not copied unless modified
+        DeviceObjectArchive ObjectArchive{DeviceObjectArchive::CreateInfo{pSrcArchive}};
+
+        for (Uint32 i = 0; i < NumRemovedResources; ++i)
+        {
+            const Char* Name = ppRemovedResources[i];
+            if (Name == nullptr || ObjectArchive.RemoveResources(Name) == 0)
+                LOG_WARNING_MESSAGE("Resource '", (Name != nullptr ? Name : "<null>"), "' is not found in the source archive and can't be removed.");
+        }
+
+        if (pUpdateArchive != nullptr)
+        {
+            const DeviceObjectArchive NewResArchive{DeviceObjectArchive::CreateInfo{pUpdateArchive}};
+            ObjectArchive.Merge(NewResArchive, /*ReplaceExisting = */ true);
+        }
+        else
+        {
+            ObjectArchive.RemoveUnusedShaders();
+        }
+
+        ObjectArchive.Serialize(ppDstArchive);
+        return *ppDstArchive != nullptr;
+    }
+    catch (...)
+    {
+        return false;
+    }
+}
+
 Bool ArchiverFactoryImpl::PrintArchiveContent(const IDataBlob* pArchive) const
 {
     try
@@ -28,6 +28,7 @@
 #include "Archiver_Inc.hpp"
 
 #include <vector>
+#include <unordered_map>
 
 #include "PSOSerializer.hpp"
 
@@ -77,8 +78,26 @@ Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
 
     DeviceObjectArchive Archive{ContentVersion};
 
-    // A hash map that maps shader byte code to the index in the archive, for each device type
-    std::array<std::unordered_map<size_t, Uint32>, static_cast<size_t>(DeviceType::Count)> BytecodeHashToIdx;
+    // A hash map that maps shader byte code hash to the indices in the archive, for each device type
+    std::array<std::unordered_multimap<size_t, Uint32>, static_cast<size_t>(DeviceType::Count)> BytecodeHashToIdx;
+
+    // Returns the index of the byte code in the archive, adding the byte code if it is not present yet.
+    // Byte codes with equal hashes are compared to make sure that hash collisions do not merge different shaders.
+    auto AddDeviceShader = [&](size_t device_type, size_t Hash, SerializedData&& ByteCode) {
+        std::vector<SerializedData>& DstShaders = Archive.GetDeviceShaders(static_cast<DeviceType>(device_type));
+
+        auto range = BytecodeHashToIdx[device_type].equal_range(Hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            if (DstShaders[it->second] == ByteCode)
+                return it->second;
+        }
+
+        const Uint32 Index = StaticCast<Uint32>(DstShaders.size());
+        DstShaders.emplace_back(std::move(ByteCode));
+        BytecodeHashToIdx[device_type].emplace(Hash, Index);
+        return Index;
+    };
 
     // Add pipelines and patched shaders
     for (const auto& pso_it : m_Pipelines)
@@ -124,21 +143,13 @@ Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
             if (SrcShaders.empty())
                 continue; // No shaders for this device type
 
-            auto& DstShaders = Archive.GetDeviceShaders(static_cast<DeviceType>(device_type));
-
             std::vector<Uint32> ShaderIndices;
             ShaderIndices.reserve(SrcShaders.size());
             for (const SerializedPipelineStateImpl::Data::ShaderInfo& SrcShader : SrcShaders)
             {
                 VERIFY_EXPR(SrcShader.Data);
-
-                auto it_inserted = BytecodeHashToIdx[device_type].emplace(SrcShader.Hash, StaticCast<Uint32>(DstShaders.size()));
-                if (it_inserted.second)
-                {
-                    // New byte code - add it
-                    DstShaders.emplace_back(SrcShader.Data.Ptr(), SrcShader.Data.Size());
-                }
-                ShaderIndices.emplace_back(it_inserted.first->second);
+                // NB: since the Archive object is temporary, we do not need to copy the data
+                ShaderIndices.emplace_back(AddDeviceShader(device_type, SrcShader.Hash, SerializedData{SrcShader.Data.Ptr(), SrcShader.Data.Size()}));
             }
 
             DeviceObjectArchive::ShaderIndexArray Indices{ShaderIndices.data(), StaticCast<Uint32>(ShaderIndices.size())};
@@ -213,14 +224,8 @@ Bool ArchiverImpl::SerializeToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
             if (!DeviceData)
                 continue;
 
-            auto& DstShaders  = Archive.GetDeviceShaders(static_cast<DeviceType>(device_type));
-            auto  it_inserted = BytecodeHashToIdx[device_type].emplace(DeviceData.GetHash(), StaticCast<Uint32>(DstShaders.size()));
-            if (it_inserted.second)
-            {
-                // New byte code
-                DstShaders.emplace_back(std::move(DeviceData));
-            }
-            const Uint32 Index = it_inserted.first->second;
+            const size_t Hash  = DeviceData.GetHash();
+            const Uint32 Index = AddDeviceShader(device_type, Hash, std::move(DeviceData));
 
             // For shaders, device-specific data is the serialized shader bytecode index
             SerializedData& SerializedIndex = DstData.DeviceSpecific[device_type];
@@ -25,6 +25,8 @@
  */
 
 #include <bitset>
+#include <memory>
+#include <atomic>
 
 #include "SerializedPipelineStateImpl.hpp"
 #include "Constants.h"
@@ -34,6 +36,7 @@
 #include "PSOSerializer.hpp"
 #include "Align.hpp"
 #include "FileSystem.hpp"
+#include "ThreadPool.hpp"
 
 namespace Diligent
 {
@@ -179,9 +182,7 @@ std::string GetPSODumpFolder(const std::string& Root, const PipelineStateDesc& P
 
 } // namespace
 
-template <typename PSOCreateInfoType>
-void SerializedPipelineStateImpl::Initialize(const PSOCreateInfoType&        CreateInfo,
-                                             const PipelineStateArchiveInfo& ArchiveInfo)
+ARCHIVE_DEVICE_DATA_FLAGS SerializedPipelineStateImpl::GetPatchDeviceFlags(const PipelineStateArchiveInfo& ArchiveInfo)
 {
     ARCHIVE_DEVICE_DATA_FLAGS DeviceBits = ArchiveInfo.DeviceFlags;
     if ((DeviceBits & ARCHIVE_DEVICE_DATA_FLAG_GL) != 0 && (DeviceBits & ARCHIVE_DEVICE_DATA_FLAG_GLES) != 0)
@@ -189,55 +190,72 @@ void SerializedPipelineStateImpl::Initialize(const PSOCreateInfoType&        Cre
         // OpenGL and GLES use the same device data. Clear one flag to avoid shader duplication.
         DeviceBits &= ~ARCHIVE_DEVICE_DATA_FLAG_GLES;
     }
+    return DeviceBits;
+}
 
-    m_Data.Aux.NoShaderReflection = (ArchiveInfo.PSOFlags & PSO_ARCHIVE_FLAG_STRIP_REFLECTION) != 0;
-    while (DeviceBits != 0)
-    {
-        const ARCHIVE_DEVICE_DATA_FLAGS Flag = ExtractLSB(DeviceBits);
+template <typename PSOCreateInfoType>
+void SerializedPipelineStateImpl::PatchShaders(const PSOCreateInfoType& CreateInfo,
+                                               ARCHIVE_DEVICE_DATA_FLAGS Flag) noexcept(false)
+{
+    VERIFY(IsPowerOfTwo(Flag), "Only single device data flag is expected");
 
-        static_assert(ARCHIVE_DEVICE_DATA_FLAG_LAST == 1 << 7, "Please update the switch below to handle the new data type");
-        switch (Flag)
-        {
+    static_assert(ARCHIVE_DEVICE_DATA_FLAG_LAST == 1 << 7, "Please update the switch below to handle the new data type");
+    switch (Flag)
+    {
 #if D3D11_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_D3D11:
-                PatchShadersD3D11(CreateInfo);
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_D3D11:
+            PatchShadersD3D11(CreateInfo);
+            break;
 #endif
 #if D3D12_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_D3D12:
-                PatchShadersD3D12(CreateInfo);
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_D3D12:
+            PatchShadersD3D12(CreateInfo);
+            break;
 #endif
 #if GL_SUPPORTED || GLES_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_GL:
-            case ARCHIVE_DEVICE_DATA_FLAG_GLES:
-                PatchShadersGL(CreateInfo);
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_GL:
+        case ARCHIVE_DEVICE_DATA_FLAG_GLES:
+            PatchShadersGL(CreateInfo);
+            break;
 #endif
 #if VULKAN_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_VULKAN:
-                PatchShadersVk(CreateInfo);
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_VULKAN:
+            PatchShadersVk(CreateInfo);
+            break;
 #endif
 #if METAL_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS:
-            case ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS:
-                PatchShadersMtl(CreateInfo, ArchiveDeviceDataFlagToArchiveDeviceType(Flag),
-                                GetPSODumpFolder(m_pSerializationDevice->GetMtlProperties().DumpFolder, GetDesc(), Flag));
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_METAL_MACOS:
+        case ARCHIVE_DEVICE_DATA_FLAG_METAL_IOS:
+            PatchShadersMtl(CreateInfo, ArchiveDeviceDataFlagToArchiveDeviceType(Flag),
+                            GetPSODumpFolder(m_pSerializationDevice->GetMtlProperties().DumpFolder, GetDesc(), Flag));
+            break;
 #endif
 #if WEBGPU_SUPPORTED
-            case ARCHIVE_DEVICE_DATA_FLAG_WEBGPU:
-                PatchShadersWebGPU(CreateInfo);
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_WEBGPU:
+            PatchShadersWebGPU(CreateInfo);
+            break;
 #endif
-            case ARCHIVE_DEVICE_DATA_FLAG_NONE:
-                UNEXPECTED("ARCHIVE_DEVICE_DATA_FLAG_NONE (0) should never occur");
-                break;
+        case ARCHIVE_DEVICE_DATA_FLAG_NONE:
+            UNEXPECTED("ARCHIVE_DEVICE_DATA_FLAG_NONE (0) should never occur");
+            break;
+
+        default:
+            LOG_ERROR_MESSAGE("Unexpected render device type");
+            break;
+    }
+}
 
-            default:
-                LOG_ERROR_MESSAGE("Unexpected render device type");
-                break;
+template <typename PSOCreateInfoType>
+void SerializedPipelineStateImpl::Initialize(const PSOCreateInfoType&        CreateInfo,
+                                             const PipelineStateArchiveInfo& ArchiveInfo,
+                                             bool                            ShadersPatched)
+{
+    if (!ShadersPatched)
+    {
+        ARCHIVE_DEVICE_DATA_FLAGS DeviceBits = GetPatchDeviceFlags(ArchiveInfo);
+        while (DeviceBits != 0)
+        {
+            PatchShaders(CreateInfo, ExtractLSB(DeviceBits));
         }
     }
 
@@ -373,6 +391,8 @@ SerializedPipelineStateImpl::SerializedPipelineStateImpl(IReferenceCounters*
     ValidatePipelineStateArchiveInfo(CreateInfo, ArchiveInfo, pDevice->GetSupportedDeviceFlags());
     ValidatePSOCreateInfo(pDevice, CreateInfo);
 
+    m_Data.Aux.NoShaderReflection = (ArchiveInfo.PSOFlags & PSO_ARCHIVE_FLAG_STRIP_REFLECTION) != 0;
+
     m_Status.store(PIPELINE_STATE_STATUS_COMPILING);
     if ((CreateInfo.Flags & PSO_CREATE_FLAG_ASYNCHRONOUS) != 0 && pDevice->GetShaderCompilationThreadPool() != nullptr)
     {
@@ -395,15 +415,67 @@ SerializedPipelineStateImpl::SerializedPipelineStateImpl(IReferenceCounters*
                 ShaderCompileTasks.emplace_back(std::move(pCompileTask));
         }
 
+        IThreadPool* pThreadPool = pDevice->GetShaderCompilationThreadPool();
+
+        struct AsyncInitData
+        {
+            typename PipelineStateCreateInfoXTraits<PSOCreateInfoType>::CreateInfoXType CreateInfo;
+
+            std::atomic<bool> PatchFailed{false};
+
+            explicit AsyncInitData(const PSOCreateInfoType& CI) :
+                CreateInfo{CI}
+            {}
+        };
+        auto pInitData = std::make_shared<AsyncInitData>(CreateInfo);
+
+        // When explicit signatures are used, patching shaders for different devices only writes
+        // device-specific data, so each device can be processed by a separate task.
+        // Default signatures are shared between all devices and require serial initialization.
+        const ARCHIVE_DEVICE_DATA_FLAGS PatchDeviceFlags = GetPatchDeviceFlags(ArchiveInfo);
+        const bool                      PatchInParallel  = CreateInfo.ResourceSignaturesCount != 0 && !IsPowerOfTwo(PatchDeviceFlags);
+
+        std::vector<RefCntAutoPtr<IAsyncTask>> InitPrerequisites;
+        if (PatchInParallel)
+        {
+            std::vector<IAsyncTask*> ShaderCompileTaskPtrs{ShaderCompileTasks.begin(), ShaderCompileTasks.end()};
+
+            ARCHIVE_DEVICE_DATA_FLAGS DeviceBits = PatchDeviceFlags;
+            while (DeviceBits != 0)
+            {
+                const ARCHIVE_DEVICE_DATA_FLAGS Flag = ExtractLSB(DeviceBits);
+                InitPrerequisites.emplace_back(
+                    EnqueueAsyncWork(pThreadPool, ShaderCompileTaskPtrs.data(), StaticCast<Uint32>(ShaderCompileTaskPtrs.size()),
+                                     [this, pInitData, Flag](Uint32 ThreadId) //
+                                     {
+                                         try
+                                         {
+                                             PatchShaders(static_cast<const PSOCreateInfoType&>(pInitData->CreateInfo), Flag);
+                                         }
+                                         catch (...)
+                                         {
+                                             pInitData->PatchFailed.store(true);
+                                         }
+                                         return ASYNC_TASK_STATUS_COMPLETE;
+                                     }));
+            }
+        }
+        else
+        {
+            // Make sure that all asynchronous shader compile tasks are completed first
+            InitPrerequisites = std::move(ShaderCompileTasks);
+        }
+
         m_AsyncInitializer = AsyncInitializer::Start(
-            pDevice->GetShaderCompilationThreadPool(),
-            ShaderCompileTasks, // Make sure that all asynchronous shader compile tasks are completed first
+            pThreadPool,
+            InitPrerequisites,
             [this,
 #ifdef DILIGENT_DEBUG
              Shaders,
 #endif
-             CreateInfo = typename PipelineStateCreateInfoXTraits<PSOCreateInfoType>::CreateInfoXType{CreateInfo},
-             ArchiveInfo](Uint32 ThreadId) mutable //
+             pInitData,
+             ArchiveInfo,
+             PatchInParallel](Uint32 ThreadId) mutable //
             {
 #ifdef DILIGENT_DEBUG
                 for (const SerializedShaderImpl* pShader : Shaders)
@@ -414,7 +486,10 @@ SerializedPipelineStateImpl::SerializedPipelineStateImpl(IReferenceCounters*
 #endif
                 try
                 {
-                    Initialize(static_cast<const PSOCreateInfoType&>(CreateInfo), ArchiveInfo);
+                    if (pInitData->PatchFailed.load())
+                        LOG_ERROR_AND_THROW("Failed to patch shaders for pipeline state '", m_Name, "'.");
+
+                    Initialize(static_cast<const PSOCreateInfoType&>(pInitData->CreateInfo), ArchiveInfo, PatchInParallel);
                     m_Status.store(PIPELINE_STATE_STATUS_READY);
                 }
                 catch (...)
@@ -423,12 +498,47 @@ SerializedPipelineStateImpl::SerializedPipelineStateImpl(IReferenceCounters*
                 }
 
                 // Release create info objects
-                CreateInfo.Clear();
+                pInitData->CreateInfo.Clear();
             });
     }
     else
     {
-        Initialize(static_cast<const PSOCreateInfoType&>(CreateInfo), ArchiveInfo);
+        // Same as in the asynchronous path, shaders for different devices are patched in parallel
+        // when explicit signatures are used.
+        IThreadPool*                    pThreadPool      = pDevice->GetShaderCompilationThreadPool();
+        const ARCHIVE_DEVICE_DATA_FLAGS PatchDeviceFlags = GetPatchDeviceFlags(ArchiveInfo);
+        const bool                      PatchInParallel  = pThreadPool != nullptr && CreateInfo.ResourceSignaturesCount != 0 && !IsPowerOfTwo(PatchDeviceFlags);
+        if (PatchInParallel)
+        {
+            // Wait for the shaders on this thread so that the patch tasks never block the
+            // thread pool threads that may need to compile the shaders.
+            std::vector<SerializedShaderStageInfo> ShaderStages;
+            SHADER_TYPE                            ActiveShaderStages    = SHADER_TYPE_UNKNOWN;
+            constexpr bool                         WaitUntilShadersReady = true;
+            PipelineStateUtils::ExtractShaders<SerializedShaderImpl>(CreateInfo, ShaderStages, WaitUntilShadersReady, ActiveShaderStages);
+
+            std::vector<ARCHIVE_DEVICE_DATA_FLAGS> DeviceFlags;
+            for (ARCHIVE_DEVICE_DATA_FLAGS DeviceBits = PatchDeviceFlags; DeviceBits != 0;)
+                DeviceFlags.push_back(ExtractLSB(DeviceBits));
+
+            std::atomic<bool> PatchFailed{false};
+            ProcessInParallel(pThreadPool, DeviceFlags.size(),
+                              [&](size_t i) //
+                              {
+                                  try
+                                  {
+                                      PatchShaders(static_cast<const PSOCreateInfoType&>(CreateInfo), DeviceFlags[i]);
+                                  }
+                                  catch (...)
+                                  {
+                                      PatchFailed.store(true);
+                                  }
+                              });
+            if (PatchFailed.load())
+                LOG_ERROR_AND_THROW("Failed to patch shaders for pipeline state '", m_Name, "'.");
+        }
+
+        Initialize(static_cast<const PSOCreateInfoType&>(CreateInfo), ArchiveInfo, PatchInParallel);
         m_Status.store(PIPELINE_STATE_STATUS_READY);
     }
 }
@@ -861,6 +861,8 @@ bool IsSRGBFormat(TEXTURE_FORMAT Fmt);
 
 String GetPipelineShadingRateFlagsString(PIPELINE_SHADING_RATE_FLAGS Flags);
 
+String GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAGS Flags);
+
 /// Converts texture component mapping to a string
 
 /// For example:
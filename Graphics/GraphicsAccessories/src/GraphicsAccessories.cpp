@@ -2811,6 +2811,39 @@ String GetPipelineShadingRateFlagsString(PIPELINE_SHADING_RATE_FLAGS Flags)
     return Result;
 }
 
+String GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAGS Flags)
+{
+    if (Flags == PIPELINE_DYNAMIC_STATE_FLAG_NONE)
+        return "NONE";
+
+    String Result;
+    while (Flags != PIPELINE_DYNAMIC_STATE_FLAG_NONE)
+    {
+        PIPELINE_DYNAMIC_STATE_FLAGS Bit = ExtractLSB(Flags);
+
+        if (!Result.empty())
+            Result += " | ";
+
+        static_assert(PIPELINE_DYNAMIC_STATE_FLAG_LAST == 0x40, "Please update the switch below to handle the new pipeline dynamic state flag");
+        switch (Bit)
+        {
+            // clang-format off
+            case PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE:          Result += "CULL_MODE";          break;
+            case PIPELINE_DYNAMIC_STATE_FLAG_FRONT_FACE:         Result += "FRONT_FACE";         break;
+            case PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY: Result += "PRIMITIVE_TOPOLOGY"; break;
+            case PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_TEST:         Result += "DEPTH_TEST";         break;
+            case PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_WRITE:        Result += "DEPTH_WRITE";        break;
+            case PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_FUNC:         Result += "DEPTH_FUNC";         break;
+            case PIPELINE_DYNAMIC_STATE_FLAG_STENCIL_OP:         Result += "STENCIL_OP";         break;
+            // clang-format on
+            default:
+                UNEXPECTED("Unexpected pipeline dynamic state");
+                Result += "Unknown";
+        }
+    }
+    return Result;
+}
+
 String GetTextureComponentMappingString(const TextureComponentMapping& Mapping)
 {
     static_assert(TEXTURE_COMPONENT_SWIZZLE_IDENTITY == 0, "TEXTURE_COMPONENT_SWIZZLE_IDENTITY == 0 is assumed below");
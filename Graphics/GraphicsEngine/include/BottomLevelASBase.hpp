@@ -166,7 +166,11 @@ public:
     {
         DEV_CHECK_ERR(State == RESOURCE_STATE_UNKNOWN || State == RESOURCE_STATE_BUILD_AS_READ || State == RESOURCE_STATE_BUILD_AS_WRITE,
                       "Unsupported state for a bottom-level acceleration structure");
-        this->m_State = State;
+        if (this->m_State != State)
+        {
+            this->m_State = State;
+            ++this->m_StateRevision;
+        }
     }
 
     /// Implementation of IBottomLevelAS::GetState()
@@ -186,6 +190,12 @@ public:
         return this->m_State != RESOURCE_STATE_UNKNOWN;
     }
 
+    /// Returns the revision of the resource state that is incremented every time the state changes.
+    Uint32 GetStateRevision() const
+    {
+        return m_StateRevision;
+    }
+
     bool CheckState(RESOURCE_STATE State) const
     {
         DEV_CHECK_ERR((State & (State - 1)) == 0, "Single state is expected");
@@ -256,6 +266,7 @@ private:
 
 protected:
     RESOURCE_STATE     m_State = RESOURCE_STATE_UNKNOWN;
+    Uint32             m_StateRevision = 0;
     BLASNameToIndex    m_NameToIndex;
     void*              m_pRawPtr       = nullptr;
     Uint32             m_GeometryCount = 0;
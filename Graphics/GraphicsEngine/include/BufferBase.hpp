@@ -203,7 +203,13 @@ public:
 
     virtual void DILIGENT_CALL_TYPE SetState(RESOURCE_STATE State) override final
     {
-        this->m_State = State;
+        if (this->m_State != State)
+        {
+            this->m_State = State;
+            ++this->m_StateRevision;
+            if (this->HasDevice())
+                this->GetDevice()->OnResourceStateChanged();
+        }
     }
 
     virtual RESOURCE_STATE DILIGENT_CALL_TYPE GetState() const override final
@@ -234,6 +240,12 @@ public:
         return this->m_State != RESOURCE_STATE_UNKNOWN;
     }
 
+    /// Returns the revision of the resource state that is incremented every time the state changes.
+    Uint32 GetStateRevision() const
+    {
+        return m_StateRevision;
+    }
+
     bool CheckState(RESOURCE_STATE State) const
     {
         DEV_CHECK_ERR((State & (State - 1)) == 0, "Single state is expected");
@@ -275,7 +287,8 @@ protected:
     TBuffViewObjAllocator& m_dbgBuffViewAllocator;
 #endif
 
-    RESOURCE_STATE m_State = RESOURCE_STATE_UNKNOWN;
+    RESOURCE_STATE m_State         = RESOURCE_STATE_UNKNOWN;
+    Uint32         m_StateRevision = 0;
 
     MEMORY_PROPERTIES m_MemoryProperties = MEMORY_PROPERTY_UNKNOWN;
 
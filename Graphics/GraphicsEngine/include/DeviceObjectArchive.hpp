@@ -128,7 +128,7 @@ public:
     };
 
     static constexpr Uint32 HeaderMagicNumber = 0xDE00000A;
-    static constexpr Uint32 ArchiveVersion    = 8;
+    static constexpr Uint32 ArchiveVersion    = 9;
 
     struct ArchiveHeader
     {
@@ -240,7 +240,25 @@ public:
 
     void RemoveDeviceData(DeviceType Dev) noexcept(false);
     void AppendDeviceData(const DeviceObjectArchive& Src, DeviceType Dev) noexcept(false);
-    void Merge(const DeviceObjectArchive& Src) noexcept(false);
+
+    /// Merges resources from the source archive into this archive.
+
+    /// Shaders that are byte-identical to shaders already present in this archive are not copied.
+    /// If ReplaceExisting is true, resources with the same type and name are replaced with the
+    /// resources from the source archive and shaders that are no longer referenced are removed.
+    /// Otherwise, existing resources are kept.
+    void Merge(const DeviceObjectArchive& Src, bool ReplaceExisting = false) noexcept(false);
+
+    /// Removes the resource with the given type and name. Returns true if the resource was found.
+    /// Note that shaders referenced by the resource are only removed by RemoveUnusedShaders().
+    bool RemoveResource(ResourceType Type, const char* Name) noexcept;
+
+    /// Removes resources of all types with the given name and returns the number of removed resources.
+    Uint32 RemoveResources(const char* Name) noexcept;
+
+    /// Removes shaders that are not referenced by any resource and updates shader indices.
+    /// Throws if any resource references an out-of-range shader index, in which case the archive is not modified.
+    void RemoveUnusedShaders() noexcept(false);
 
     bool Deserialize(const CreateInfo& CI) noexcept;
     void Serialize(IFileStream* pStream) const;
@@ -353,6 +353,19 @@ public:
         return m_UniqueId.fetch_add(1) + 1;
     }
 
+    // The state epoch is incremented every time the state of any buffer, texture or top-level
+    // acceleration structure created by this device changes. Shader resource caches use it to
+    // skip checking the states of their resources when no resource has changed its state.
+    void OnResourceStateChanged()
+    {
+        m_ResourceStateEpoch.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    Uint64 GetResourceStateEpoch() const
+    {
+        return m_ResourceStateEpoch.load(std::memory_order_relaxed);
+    }
+
     virtual IThreadPool* DILIGENT_CALL_TYPE GetShaderCompilationThreadPool() const override final
     {
         return m_pShaderCompilationThreadPool;
@@ -725,6 +738,8 @@ protected:
 
     std::atomic<UniqueIdentifier> m_UniqueId{0};
 
+    std::atomic<Uint64> m_ResourceStateEpoch{0};
+
     // Dynamic buffer Ids are used by device contexts to index dynamic allocations
     std::atomic<Uint32> m_NextDynamicBufferId{0};
     Threading::SpinLock m_RecycledDynamicBufferIdsLock;
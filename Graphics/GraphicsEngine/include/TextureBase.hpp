@@ -293,7 +293,13 @@ public:
 
     virtual void DILIGENT_CALL_TYPE SetState(RESOURCE_STATE State) override final
     {
-        this->m_State = State;
+        if (this->m_State != State)
+        {
+            this->m_State = State;
+            ++this->m_StateRevision;
+            if (this->HasDevice())
+                this->GetDevice()->OnResourceStateChanged();
+        }
     }
 
     virtual RESOURCE_STATE DILIGENT_CALL_TYPE GetState() const override final
@@ -306,6 +312,12 @@ public:
         return this->m_State != RESOURCE_STATE_UNKNOWN;
     }
 
+    /// Returns the revision of the resource state that is incremented every time the state changes.
+    Uint32 GetStateRevision() const
+    {
+        return m_StateRevision;
+    }
+
     bool CheckState(RESOURCE_STATE State) const
     {
         VERIFY((State & (State - 1)) == 0, "Single state is expected");
@@ -408,7 +420,8 @@ protected:
     // YUV formats may have 3 planes (Y, U, V).
     Uint8 m_FormatPlaneCount = 1;
 
-    RESOURCE_STATE m_State = RESOURCE_STATE_UNKNOWN;
+    RESOURCE_STATE m_State         = RESOURCE_STATE_UNKNOWN;
+    Uint32         m_StateRevision = 0;
 
     std::unique_ptr<SparseTextureProperties> m_pSparseProps;
 };
@@ -276,7 +276,13 @@ public:
     {
         VERIFY(State == RESOURCE_STATE_UNKNOWN || State == RESOURCE_STATE_BUILD_AS_READ || State == RESOURCE_STATE_BUILD_AS_WRITE || State == RESOURCE_STATE_RAY_TRACING,
                "Unsupported state for top-level acceleration structure");
-        this->m_State = State;
+        if (this->m_State != State)
+        {
+            this->m_State = State;
+            ++this->m_StateRevision;
+            if (this->HasDevice())
+                this->GetDevice()->OnResourceStateChanged();
+        }
     }
 
     /// Implementation of ITopLevelAS::GetState().
@@ -296,6 +302,12 @@ public:
         return this->m_State != RESOURCE_STATE_UNKNOWN;
     }
 
+    /// Returns the revision of the resource state that is incremented every time the state changes.
+    Uint32 GetStateRevision() const
+    {
+        return m_StateRevision;
+    }
+
     bool CheckState(RESOURCE_STATE State) const
     {
         VERIFY((State & (State - 1)) == 0, "Single state is expected");
@@ -384,6 +396,7 @@ private:
 
 protected:
     RESOURCE_STATE     m_State = RESOURCE_STATE_UNKNOWN;
+    Uint32             m_StateRevision = 0;
     TLASBuildInfo      m_BuildInfo;
     ScratchBufferSizes m_ScratchSize;
 
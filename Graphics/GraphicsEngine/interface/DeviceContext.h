@@ -2486,6 +2486,18 @@ struct DeviceContextStats
     /// Command counters, see Diligent::DeviceContextCommandCounters.
     DeviceContextCommandCounters CommandCounters DEFAULT_INITIALIZER({});
 
+    /// The number of times the resources of a shader resource binding were transitioned
+    /// by CommitShaderResources() or TransitionShaderResources().
+    ///
+    /// \remarks Only the Vulkan backend currently tracks this counter.
+    Uint32 ShaderResourceTransitions DEFAULT_INITIALIZER(0);
+
+    /// The number of times the resource transitions of a shader resource binding were skipped
+    /// because neither the binding nor the state of any of its resources have changed since the last transition.
+    ///
+    /// \remarks Only the Vulkan backend currently tracks this counter.
+    Uint32 SkippedShaderResourceTransitions DEFAULT_INITIALIZER(0);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr Uint32 GetTotalTriangleCount() const noexcept
     {
@@ -3975,17 +3975,41 @@ struct DeviceFeaturesVk
     /// If the extension is not supported, the texture is initialized on the device.
     DEVICE_FEATURE_STATE HostImageCopy DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
 
+    /// Indicates whether the device supports VK_EXT_descriptor_buffer extension.
+
+    /// When enabled, no descriptor sets are allocated. Static and mutable shader resources are
+    /// written into descriptor buffer memory owned by the shader resource binding when they are bound,
+    /// while dynamic resources are written into memory suballocated from a ring buffer when committed.
+    /// If the extension is not supported, descriptor sets are allocated from descriptor pools.
+    DEVICE_FEATURE_STATE DescriptorBuffer DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
+    /// Indicates whether the device supports VK_EXT_graphics_pipeline_library extension.
+
+    /// When enabled, graphics pipelines are linked from vertex input, pre-rasterization,
+    /// fragment shader and fragment output libraries that are cached and shared between
+    /// pipelines. If the extension is not supported, pipelines are created monolithically.
+    DEVICE_FEATURE_STATE GraphicsPipelineLibrary DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
+    /// Indicates whether the device supports VK_EXT_extended_dynamic_state extension.
+
+    /// The extension is required to create pipelines with non-empty
+    /// GraphicsPipelineDesc::DynamicStates.
+    DEVICE_FEATURE_STATE ExtendedDynamicState DEFAULT_INITIALIZER(DEVICE_FEATURE_STATE_DISABLED);
+
 
 #if DILIGENT_CPP_INTERFACE
     constexpr DeviceFeaturesVk() noexcept {}
 
 #define ENUMERATE_VK_DEVICE_FEATURES(Handler) \
-    Handler(DynamicRendering) \
-    Handler(HostImageCopy)
+    Handler(DynamicRendering)                 \
+    Handler(HostImageCopy)                    \
+    Handler(DescriptorBuffer)                 \
+    Handler(GraphicsPipelineLibrary)          \
+    Handler(ExtendedDynamicState)
 
     explicit constexpr DeviceFeaturesVk(DEVICE_FEATURE_STATE State) noexcept
     {
-        static_assert(sizeof(*this) == 2, "Did you add a new feature to DeviceFeatures? Please add it to ENUMERATE_VK_DEVICE_FEATURES.");
+        static_assert(sizeof(*this) == 5, "Did you add a new feature to DeviceFeatures? Please add it to ENUMERATE_VK_DEVICE_FEATURES.");
     #define INIT_FEATURE(Feature) Feature = State;
         ENUMERATE_VK_DEVICE_FEATURES(INIT_FEATURE)
     #undef INIT_FEATURE
@@ -4189,6 +4213,31 @@ struct EngineVkCreateInfo DILIGENT_DERIVE(EngineCreateInfo)
 #endif
     ;
 
+    /// Whether to re-link graphics pipelines with link-time optimization in the background.
+
+    /// When GraphicsPipelineLibrary feature is enabled, graphics pipelines are fast-linked
+    /// from pipeline libraries, which may result in less efficient GPU code. If this member
+    /// is true and the shader compilation thread pool is available, the engine also links
+    /// an optimized pipeline in the background and uses it once it is ready.
+    Bool OptimizeLinkedPipelines DEFAULT_INITIALIZER(True);
+
+    /// Maximum total size, in bytes, of the SPIR-V optimization cache. Zero disables the cache.
+
+    /// When a pipeline is created, the engine strips the reflection information from the
+    /// SPIR-V byte code of its shaders, which gives identical results for all pipelines that
+    /// share the same shader and resource layout. If the cache is enabled, the results are
+    /// reused. When the cache size exceeds the limit, the oldest entries are evicted.
+    Uint32 SPIRVOptimizationCacheSize DEFAULT_INITIALIZER(0);
+
+    /// Size, in bytes, of the descriptor buffer memory reserved for static and mutable resources
+    /// of shader resource bindings when the DescriptorBuffer feature is enabled.
+
+    /// This memory is allocated separately from the descriptor memory that device contexts
+    /// recycle every frame (see DynamicHeapSize). If it is exhausted, static and mutable
+    /// resources of new shader resource bindings are written to the per-frame memory every
+    /// time the resources are committed.
+    Uint32 PersistentDescriptorBufferSize DEFAULT_INITIALIZER(1 << 20);
+
     /// Path to DirectX Shader Compiler, which is required to use Shader Model 6.0+
     /// features when compiling shaders from HLSL.
     const Char* pDxCompilerPath DEFAULT_INITIALIZER(nullptr);
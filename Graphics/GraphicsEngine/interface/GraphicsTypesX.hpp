@@ -1550,6 +1550,12 @@ struct GraphicsPipelineStateCreateInfoX : PipelineStateCreateInfoX<GraphicsPipel
         return *this;
     }
 
+    GraphicsPipelineStateCreateInfoX& SetDynamicStates(PIPELINE_DYNAMIC_STATE_FLAGS DynamicStates) noexcept
+    {
+        GraphicsPipeline.DynamicStates = DynamicStates;
+        return *this;
+    }
+
     GraphicsPipelineStateCreateInfoX& AddRenderTarget(TEXTURE_FORMAT RTVFormat) noexcept
     {
         VERIFY_EXPR(GraphicsPipeline.NumRenderTargets < MAX_RENDER_TARGETS);
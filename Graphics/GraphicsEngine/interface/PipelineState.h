@@ -198,6 +198,46 @@ DILIGENT_TYPED_ENUM(PIPELINE_SHADING_RATE_FLAGS, Uint8)
 };
 DEFINE_FLAG_ENUM_OPERATORS(PIPELINE_SHADING_RATE_FLAGS);
 
+/// Pipeline dynamic state flags.
+
+/// The flags indicate which parts of the fixed-function state are not baked into the
+/// pipeline and are instead set through the device context at draw time. When a state
+/// is dynamic and the application has not set it, the value from the pipeline description is used.
+/// Dynamic states are only supported in Vulkan and require DeviceFeaturesVk::ExtendedDynamicState.
+DILIGENT_TYPED_ENUM(PIPELINE_DYNAMIC_STATE_FLAGS, Uint8)
+{
+    /// No dynamic states.
+    PIPELINE_DYNAMIC_STATE_FLAG_NONE               = 0,
+
+    /// Cull mode is dynamic, see IDeviceContextVk::SetCullMode().
+    PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE          = 1u << 0u,
+
+    /// Front face orientation is dynamic, see IDeviceContextVk::SetFrontFace().
+    PIPELINE_DYNAMIC_STATE_FLAG_FRONT_FACE         = 1u << 1u,
+
+    /// Primitive topology is dynamic, see IDeviceContextVk::SetPrimitiveTopology().
+
+    /// The topology set at draw time must belong to the same topology class
+    /// (point, line, triangle or patch) as GraphicsPipelineDesc::PrimitiveTopology.
+    PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY = 1u << 2u,
+
+    /// Depth test enable is dynamic, see IDeviceContextVk::SetDepthTestEnable().
+    PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_TEST         = 1u << 3u,
+
+    /// Depth write enable is dynamic, see IDeviceContextVk::SetDepthWriteEnable().
+    PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_WRITE        = 1u << 4u,
+
+    /// Depth comparison function is dynamic, see IDeviceContextVk::SetDepthFunc().
+    PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_FUNC         = 1u << 5u,
+
+    /// Stencil operations are dynamic, see IDeviceContextVk::SetStencilOp().
+    PIPELINE_DYNAMIC_STATE_FLAG_STENCIL_OP         = 1u << 6u,
+
+    /// Special value that indicates the last flag in the enumeration.
+    PIPELINE_DYNAMIC_STATE_FLAG_LAST               = PIPELINE_DYNAMIC_STATE_FLAG_STENCIL_OP,
+};
+DEFINE_FLAG_ENUM_OPERATORS(PIPELINE_DYNAMIC_STATE_FLAGS);
+
 /// Pipeline layout description
 struct PipelineResourceLayoutDesc
 {
@@ -325,6 +365,9 @@ struct GraphicsPipelineDesc
     /// Shading rate flags that specify which type of the shading rate will be used with this pipeline.
     PIPELINE_SHADING_RATE_FLAGS ShadingRateFlags DEFAULT_INITIALIZER(PIPELINE_SHADING_RATE_FLAG_NONE);
 
+    /// Pipeline states that are set dynamically through the device context, see Diligent::PIPELINE_DYNAMIC_STATE_FLAGS.
+    PIPELINE_DYNAMIC_STATE_FLAGS DynamicStates DEFAULT_INITIALIZER(PIPELINE_DYNAMIC_STATE_FLAG_NONE);
+
     /// Render target formats.
 
     /// All formats must be Diligent::TEX_FORMAT_UNKNOWN when `pRenderPass` is not `null`.
@@ -365,6 +408,7 @@ struct GraphicsPipelineDesc
               NumRenderTargets  == Rhs.NumRenderTargets  &&
               SubpassIndex      == Rhs.SubpassIndex      &&
               ShadingRateFlags  == Rhs.ShadingRateFlags  &&
+              DynamicStates     == Rhs.DynamicStates     &&
               DSVFormat         == Rhs.DSVFormat         &&
               ReadOnlyDSV       == Rhs.ReadOnlyDSV    &&
               SmplDesc          == Rhs.SmplDesc          &&
@@ -408,7 +408,15 @@ DILIGENT_TYPED_ENUM(SHADER_COMPILE_FLAGS, Uint32)
     /// Since DXC does not support GLSL, this flag is ignored when SHADER_COMPILER_DXC is used.
     SHADER_COMPILE_FLAG_HLSL_TO_SPIRV_VIA_GLSL = 1u << 4u,
 
-    SHADER_COMPILE_FLAG_LAST = SHADER_COMPILE_FLAG_HLSL_TO_SPIRV_VIA_GLSL
+    /// When converting HLSL to GLSL, only emit the HLSL-compatibility definitions
+    /// (type aliases, intrinsic emulation functions, etc.) that the shader references.
+    ///
+    /// This reduces the size of the GLSL source and the time it takes to compile it.
+    /// The flag only takes effect when HLSL source is converted to GLSL, i.e. in the OpenGL
+    /// backend and when SHADER_COMPILE_FLAG_HLSL_TO_SPIRV_VIA_GLSL is used.
+    SHADER_COMPILE_FLAG_PRUNE_UNUSED_GLSL_DEFINITIONS = 1u << 5u,
+
+    SHADER_COMPILE_FLAG_LAST = SHADER_COMPILE_FLAG_PRUNE_UNUSED_GLSL_DEFINITIONS
 };
 DEFINE_FLAG_ENUM_OPERATORS(SHADER_COMPILE_FLAGS);
 
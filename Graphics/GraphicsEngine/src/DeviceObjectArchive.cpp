@@ -28,6 +28,7 @@
 
 #include <algorithm>
 #include <sstream>
+#include <unordered_map>
 
 #include "Shader.h"
 #include "EngineMemory.h"
@@ -557,7 +558,85 @@ void DeviceObjectArchive::AppendDeviceData(const DeviceObjectArchive& Src, Devic
         DstShaders.emplace_back(SrcShader.MakeCopy(Allocator));
 }
 
-void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
+namespace
+{
+
+bool IsPipelineResourceType(DeviceObjectArchive::ResourceType ResType)
+{
+    using ResourceType = DeviceObjectArchive::ResourceType;
+    return (ResType == ResourceType::GraphicsPipeline ||
+            ResType == ResourceType::ComputePipeline ||
+            ResType == ResourceType::RayTracingPipeline ||
+            ResType == ResourceType::TilePipeline);
+}
+
+bool ReferencesShaders(DeviceObjectArchive::ResourceType ResType)
+{
+    return ResType == DeviceObjectArchive::ResourceType::StandaloneShader || IsPipelineResourceType(ResType);
+}
+
+// Reads shader indices from the device-specific data of a standalone shader or a pipeline.
+void ReadShaderIndices(DeviceObjectArchive::ResourceType ResType,
+                       const SerializedData&             DeviceData,
+                       DynamicLinearAllocator&           DynAllocator,
+                       std::vector<Uint32>&              Indices) noexcept(false)
+{
+    VERIFY_EXPR(DeviceData);
+    Serializer<SerializerMode::Read> Ser{DeviceData};
+    if (ResType == DeviceObjectArchive::ResourceType::StandaloneShader)
+    {
+        // For shaders, device-specific data is the serialized shader bytecode index
+        Uint32 ShaderIndex = 0;
+        if (!Ser(ShaderIndex))
+            LOG_ERROR_AND_THROW("Failed to deserialize standalone shader index. Archive file may be corrupted or invalid.");
+        Indices.assign(1, ShaderIndex);
+    }
+    else
+    {
+        VERIFY_EXPR(IsPipelineResourceType(ResType));
+        // For pipelines, device-specific data is the shader index array
+        DeviceObjectArchive::ShaderIndexArray ShaderIndices;
+        if (!PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, ShaderIndices, &DynAllocator))
+            LOG_ERROR_AND_THROW("Failed to deserialize PSO shader indices. Archive file may be corrupted or invalid.");
+        Indices.assign(ShaderIndices.pIndices, ShaderIndices.pIndices + ShaderIndices.Count);
+    }
+    VERIFY(Ser.IsEnded(), "No other data besides shader indices is expected");
+}
+
+// Writes shader indices to new device-specific data of a standalone shader or a pipeline.
+// Note that the original data may reference the memory of the source archive blob and
+// must not be modified in place.
+SerializedData WriteShaderIndices(DeviceObjectArchive::ResourceType ResType,
+                                  const std::vector<Uint32>&        Indices,
+                                  IMemoryAllocator&                 Allocator)
+{
+    auto SerializeIndices = [&](auto& Ser) {
+        if (ResType == DeviceObjectArchive::ResourceType::StandaloneShader)
+        {
+            VERIFY_EXPR(Indices.size() == 1);
+            Ser(Indices[0]);
+        }
+        else
+        {
+            constexpr SerializerMode Mode = std::remove_reference<decltype(Ser)>::type::GetMode();
+            PSOSerializer<Mode>::SerializeShaderIndices(Ser, DeviceObjectArchive::ShaderIndexArray{Indices.data(), static_cast<Uint32>(Indices.size())}, nullptr);
+        }
+    };
+
+    Serializer<SerializerMode::Measure> MeasureSer;
+    SerializeIndices(MeasureSer);
+    SerializedData DeviceData = MeasureSer.AllocateData(Allocator);
+
+    Serializer<SerializerMode::Write> Ser{DeviceData};
+    SerializeIndices(Ser);
+    VERIFY_EXPR(Ser.IsEnded());
+
+    return DeviceData;
+}
+
+} // namespace
+
+void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src, bool ReplaceExisting) noexcept(false)
 {
     if (m_ContentVersion != Src.m_ContentVersion)
         LOG_WARNING_MESSAGE("Merging archives with different content versions (", m_ContentVersion, " and ", Src.m_ContentVersion, ").");
@@ -567,99 +646,206 @@ void DeviceObjectArchive::Merge(const DeviceObjectArchive& Src) noexcept(false)
     IMemoryAllocator&      Allocator = GetRawAllocator();
     DynamicLinearAllocator DynAllocator{Allocator, 512};
 
-    // Copy shaders
-    std::array<Uint32, static_cast<size_t>(DeviceType::Count)> ShaderBaseIndices{};
+    // Copy shaders that are not already present in this archive.
+    // For every source shader, the table contains its index in this archive.
+    std::array<std::vector<Uint32>, static_cast<size_t>(DeviceType::Count)> SrcToDstShaderIdx;
     for (size_t i = 0; i < m_DeviceShaders.size(); ++i)
     {
         const auto& SrcShaders = Src.m_DeviceShaders[i];
         auto&       DstShaders = m_DeviceShaders[i];
-        ShaderBaseIndices[i]   = static_cast<Uint32>(DstShaders.size());
         if (SrcShaders.empty())
             continue;
+
+        // Shader data hash -> indices of the shaders with this hash
+        std::unordered_multimap<size_t, Uint32> DstShaderHashToIdx;
+        DstShaderHashToIdx.reserve(DstShaders.size() + SrcShaders.size());
+        for (Uint32 dst_idx = 0; dst_idx < DstShaders.size(); ++dst_idx)
+            DstShaderHashToIdx.emplace(DstShaders[dst_idx].GetHash(), dst_idx);
+
+        std::vector<Uint32>& IdxMap = SrcToDstShaderIdx[i];
+        IdxMap.resize(SrcShaders.size());
         DstShaders.reserve(DstShaders.size() + SrcShaders.size());
-        for (const SerializedData& SrcShader : SrcShaders)
-            DstShaders.emplace_back(SrcShader.MakeCopy(Allocator));
+        for (size_t src_idx = 0; src_idx < SrcShaders.size(); ++src_idx)
+        {
+            const SerializedData& SrcShader = SrcShaders[src_idx];
+            const size_t          Hash      = SrcShader.GetHash();
+
+            Uint32 DstIdx = ~0u;
+            for (auto range = DstShaderHashToIdx.equal_range(Hash); range.first != range.second; ++range.first)
+            {
+                if (DstShaders[range.first->second] == SrcShader)
+                {
+                    DstIdx = range.first->second;
+                    break;
+                }
+            }
+
+            if (DstIdx == ~0u)
+            {
+                DstIdx = static_cast<Uint32>(DstShaders.size());
+                DstShaders.emplace_back(SrcShader.MakeCopy(Allocator));
+                DstShaderHashToIdx.emplace(Hash, DstIdx);
+            }
+            IdxMap[src_idx] = DstIdx;
+        }
     }
 
     // Copy named resources
+    std::vector<Uint32> Indices;
     for (auto& src_res_it : Src.m_NamedResources)
     {
         const ResourceType ResType = src_res_it.first.GetType();
         const char*        ResName = src_res_it.first.GetName();
 
-        auto it_inserted = m_NamedResources.emplace(NamedResourceKey{ResType, ResName, /*CopyName = */ true}, src_res_it.second.MakeCopy(Allocator));
-        if (!it_inserted.second)
+        auto dst_res_it = m_NamedResources.find(src_res_it.first);
+        if (dst_res_it != m_NamedResources.end())
         {
-            // Silently skip duplicate resources
-            if (it_inserted.first->second != src_res_it.second)
-                LOG_WARNING_MESSAGE("Failed to copy resource '", ResName, "': resource with the same name already exists.");
+            if (!ReplaceExisting)
+            {
+                // Silently skip duplicate resources
+                if (dst_res_it->second != src_res_it.second)
+                    LOG_WARNING_MESSAGE("Failed to copy resource '", ResName, "': resource with the same name already exists.");
 
-            continue;
+                continue;
+            }
+
+            m_NamedResources.erase(dst_res_it);
         }
 
-        const auto IsStandaloneShader = (ResType == ResourceType::StandaloneShader);
-        const bool IsPipeline =
-            (ResType == ResourceType::GraphicsPipeline ||
-             ResType == ResourceType::ComputePipeline ||
-             ResType == ResourceType::RayTracingPipeline ||
-             ResType == ResourceType::TilePipeline);
+        auto it_inserted = m_NamedResources.emplace(NamedResourceKey{ResType, ResName, /*CopyName = */ true}, src_res_it.second.MakeCopy(Allocator));
+        VERIFY_EXPR(it_inserted.second);
 
         // Update shader indices
-        if (IsStandaloneShader || IsPipeline)
+        if (ReferencesShaders(ResType))
         {
             for (size_t i = 0; i < static_cast<size_t>(DeviceType::Count); ++i)
             {
-                const Uint32 BaseIdx = ShaderBaseIndices[i];
-
                 SerializedData& DeviceData = it_inserted.first->second.DeviceSpecific[i];
                 if (!DeviceData)
                     continue;
 
-                if (IsStandaloneShader)
+                const std::vector<Uint32>& IdxMap = SrcToDstShaderIdx[i];
+                ReadShaderIndices(ResType, DeviceData, DynAllocator, Indices);
+                for (Uint32& Idx : Indices)
                 {
-                    // For shaders, device-specific data is the serialized shader bytecode index
-                    Uint32 ShaderIndex = 0;
-                    {
-                        Serializer<SerializerMode::Read> Ser{DeviceData};
-                        if (!Ser(ShaderIndex))
-                            LOG_ERROR_AND_THROW("Failed to deserialize standalone shader index. Archive file may be corrupted or invalid.");
-                        VERIFY(Ser.IsEnded(), "No other data besides the shader index is expected");
-                    }
+                    if (Idx >= IdxMap.size())
+                        LOG_ERROR_AND_THROW("Shader index ", Idx, " of resource '", ResName, "' is out of range. Archive file may be corrupted or invalid.");
+                    Idx = IdxMap[Idx];
+                }
+                DeviceData = WriteShaderIndices(ResType, Indices, Allocator);
+            }
+        }
+    }
+
+    if (ReplaceExisting)
+    {
+        // Replaced resources may have been the only users of some shaders
+        RemoveUnusedShaders();
+    }
+}
 
-                    ShaderIndex += BaseIdx;
+bool DeviceObjectArchive::RemoveResource(ResourceType Type, const char* Name) noexcept
+{
+    return m_NamedResources.erase(NamedResourceKey{Type, Name}) != 0;
+}
 
-                    {
-                        Serializer<SerializerMode::Write> Ser{DeviceData};
-                        Ser(ShaderIndex);
-                        VERIFY_EXPR(Ser.IsEnded());
-                    }
-                }
-                else if (IsPipeline)
-                {
-                    // For pipelines, device-specific data is the shader index array
-                    ShaderIndexArray ShaderIndices;
-                    {
-                        Serializer<SerializerMode::Read> Ser{DeviceData};
-                        if (!PSOSerializer<SerializerMode::Read>::SerializeShaderIndices(Ser, ShaderIndices, &DynAllocator))
-                            LOG_ERROR_AND_THROW("Failed to deserialize PSO shader indices. Archive file may be corrupted or invalid.");
-                        VERIFY(Ser.IsEnded(), "No other data besides shader indices is expected");
-                    }
+Uint32 DeviceObjectArchive::RemoveResources(const char* Name) noexcept
+{
+    Uint32 NumRemoved = 0;
+    for (Uint32 Type = static_cast<Uint32>(ResourceType::Undefined) + 1; Type < static_cast<Uint32>(ResourceType::Count); ++Type)
+    {
+        if (RemoveResource(static_cast<ResourceType>(Type), Name))
+            ++NumRemoved;
+    }
+    return NumRemoved;
+}
 
-                    std::vector<Uint32> NewIndices{ShaderIndices.pIndices, ShaderIndices.pIndices + ShaderIndices.Count};
-                    for (Uint32& Idx : NewIndices)
-                        Idx += BaseIdx;
+void DeviceObjectArchive::RemoveUnusedShaders() noexcept(false)
+{
+    IMemoryAllocator&      Allocator = GetRawAllocator();
+    DynamicLinearAllocator DynAllocator{Allocator, 512};
 
-                    {
-                        Serializer<SerializerMode::Write> Ser{DeviceData};
-                        PSOSerializer<SerializerMode::Write>::SerializeShaderIndices(Ser, ShaderIndexArray{NewIndices.data(), ShaderIndices.Count}, nullptr);
-                        VERIFY_EXPR(Ser.IsEnded());
-                    }
-                }
-                else
-                {
-                    UNEXPECTED("Unexpected resource type");
-                }
+    // Mark shaders referenced by any resource.
+    // Out-of-range indices are rejected here, before the archive is modified, so that
+    // the remap phase below never sees an index it can't translate.
+    std::array<std::vector<bool>, static_cast<size_t>(DeviceType::Count)> IsShaderUsed;
+    for (size_t i = 0; i < m_DeviceShaders.size(); ++i)
+        IsShaderUsed[i].resize(m_DeviceShaders[i].size(), false);
+
+    std::vector<Uint32> Indices;
+    for (auto& res_it : m_NamedResources)
+    {
+        const ResourceType ResType = res_it.first.GetType();
+        if (!ReferencesShaders(ResType))
+            continue;
+
+        for (size_t i = 0; i < static_cast<size_t>(DeviceType::Count); ++i)
+        {
+            const SerializedData& DeviceData = res_it.second.DeviceSpecific[i];
+            if (!DeviceData)
+                continue;
+
+            std::vector<bool>& Used = IsShaderUsed[i];
+            ReadShaderIndices(ResType, DeviceData, DynAllocator, Indices);
+            for (Uint32 Idx : Indices)
+            {
+                if (Idx >= Used.size())
+                    LOG_ERROR_AND_THROW("Shader index ", Idx, " of resource '", res_it.first.GetName(), "' is out of range. Archive file may be corrupted or invalid.");
+                Used[Idx] = true;
+            }
+        }
+    }
+
+    // Compact shader arrays and compute the index remapping
+    std::array<std::vector<Uint32>, static_cast<size_t>(DeviceType::Count)> OldToNewIdx;
+    bool                                                                   AnyRemoved = false;
+    for (size_t i = 0; i < m_DeviceShaders.size(); ++i)
+    {
+        std::vector<SerializedData>& Shaders = m_DeviceShaders[i];
+        const std::vector<bool>&     Used    = IsShaderUsed[i];
+        if (std::all_of(Used.begin(), Used.end(), [](bool b) { return b; }))
+            continue;
+
+        std::vector<Uint32>& IdxMap = OldToNewIdx[i];
+        IdxMap.resize(Shaders.size(), ~0u);
+
+        Uint32 NewIdx = 0;
+        for (Uint32 OldIdx = 0; OldIdx < Shaders.size(); ++OldIdx)
+        {
+            if (!Used[OldIdx])
+                continue;
+            if (NewIdx != OldIdx)
+                Shaders[NewIdx] = std::move(Shaders[OldIdx]);
+            IdxMap[OldIdx] = NewIdx++;
+        }
+        Shaders.resize(NewIdx);
+        AnyRemoved = true;
+    }
+
+    if (!AnyRemoved)
+        return;
+
+    for (auto& res_it : m_NamedResources)
+    {
+        const ResourceType ResType = res_it.first.GetType();
+        if (!ReferencesShaders(ResType))
+            continue;
+
+        for (size_t i = 0; i < static_cast<size_t>(DeviceType::Count); ++i)
+        {
+            const std::vector<Uint32>& IdxMap     = OldToNewIdx[i];
+            SerializedData&            DeviceData = res_it.second.DeviceSpecific[i];
+            if (IdxMap.empty() || !DeviceData)
+                continue;
+
+            ReadShaderIndices(ResType, DeviceData, DynAllocator, Indices);
+            for (Uint32& Idx : Indices)
+            {
+                // All indices have been validated by the mark phase
+                VERIFY_EXPR(Idx < IdxMap.size() && IdxMap[Idx] != ~0u);
+                Idx = IdxMap[Idx];
             }
+            DeviceData = WriteShaderIndices(ResType, Indices, Allocator);
         }
     }
 }
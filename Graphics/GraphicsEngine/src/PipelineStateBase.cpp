@@ -669,6 +669,20 @@ void ValidateGraphicsPipelineCreateInfo(const GraphicsPipelineStateCreateInfo& C
         if (!Features.VariableRateShading)
             LOG_PSO_ERROR_AND_THROW("ShadingRateFlags (", GetPipelineShadingRateFlagsString(CreateInfo.GraphicsPipeline.ShadingRateFlags), ") require VariableRateShading feature");
     }
+
+    if (CreateInfo.GraphicsPipeline.DynamicStates != PIPELINE_DYNAMIC_STATE_FLAG_NONE)
+    {
+        const RenderDeviceInfo& DeviceInfo = pDevice->GetDeviceInfo();
+        if (DeviceInfo.Type != RENDER_DEVICE_TYPE_UNDEFINED && // May be UNDEFINED for serialized pipeline
+            !DeviceInfo.IsVulkanDevice())
+            LOG_PSO_ERROR_AND_THROW("DynamicStates (", GetPipelineDynamicStateFlagsString(CreateInfo.GraphicsPipeline.DynamicStates), ") are only supported in Vulkan");
+
+        if (CreateInfo.GraphicsPipeline.DynamicStates >= (PIPELINE_DYNAMIC_STATE_FLAG_LAST << 1))
+            LOG_PSO_ERROR_AND_THROW("DynamicStates (", Uint32{CreateInfo.GraphicsPipeline.DynamicStates}, ") contain unknown flags");
+
+        if (PSODesc.PipelineType == PIPELINE_TYPE_MESH && (CreateInfo.GraphicsPipeline.DynamicStates & PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY) != 0)
+            LOG_PSO_ERROR_AND_THROW("PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY is not allowed in mesh pipelines");
+    }
 }
 
 void ValidateComputePipelineCreateInfo(const ComputePipelineStateCreateInfo& CreateInfo,
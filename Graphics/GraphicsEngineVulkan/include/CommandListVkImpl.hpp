@@ -43,14 +43,20 @@ class CommandListVkImpl final : public CommandListBase<EngineVkImplTraits>
 public:
     using TCommandListBase = CommandListBase<EngineVkImplTraits>;
 
+    // vkRenderPass and SubpassIndex identify the render pass subpass that a secondary command list
+    // continues. For primary command lists, vkRenderPass is VK_NULL_HANDLE.
     CommandListVkImpl(IReferenceCounters*  pRefCounters,
                       RenderDeviceVkImpl*  pDevice,
                       DeviceContextVkImpl* pDeferredCtx,
-                      VkCommandBuffer      vkCmdBuff) :
+                      VkCommandBuffer      vkCmdBuff,
+                      VkRenderPass         vkRenderPass = VK_NULL_HANDLE,
+                      Uint32               SubpassIndex = 0) :
         // clang-format off
         TCommandListBase {pRefCounters, pDevice, pDeferredCtx},
         m_pDeferredCtx   {pDeferredCtx},
-        m_vkCmdBuff      {vkCmdBuff   }
+        m_vkCmdBuff      {vkCmdBuff   },
+        m_vkRenderPass   {vkRenderPass},
+        m_SubpassIndex   {SubpassIndex}
     // clang-format on
     {
     }
@@ -67,9 +73,17 @@ public:
         m_vkCmdBuff    = VK_NULL_HANDLE;
     }
 
+    bool IsSecondary() const { return m_vkRenderPass != VK_NULL_HANDLE; }
+
+    VkRenderPass GetVkRenderPass() const { return m_vkRenderPass; }
+    Uint32       GetSubpassIndex() const { return m_SubpassIndex; }
+
 private:
     RefCntAutoPtr<IDeviceContext> m_pDeferredCtx;
     VkCommandBuffer               m_vkCmdBuff;
+
+    const VkRenderPass m_vkRenderPass;
+    const Uint32       m_SubpassIndex;
 };
 
 } // namespace Diligent
@@ -321,6 +321,33 @@ public:
     /// Implementation of IDeviceContextVk::GetVkCommandBuffer().
     virtual VkCommandBuffer DILIGENT_CALL_TYPE GetVkCommandBuffer() override final;
 
+    /// Implementation of IDeviceContextVk::SetCullMode().
+    virtual void DILIGENT_CALL_TYPE SetCullMode(CULL_MODE CullMode) override final;
+
+    /// Implementation of IDeviceContextVk::SetFrontFace().
+    virtual void DILIGENT_CALL_TYPE SetFrontFace(Bool FrontCounterClockwise) override final;
+
+    /// Implementation of IDeviceContextVk::SetPrimitiveTopology().
+    virtual void DILIGENT_CALL_TYPE SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology) override final;
+
+    /// Implementation of IDeviceContextVk::SetDepthTestEnable().
+    virtual void DILIGENT_CALL_TYPE SetDepthTestEnable(Bool DepthEnable) override final;
+
+    /// Implementation of IDeviceContextVk::SetDepthWriteEnable().
+    virtual void DILIGENT_CALL_TYPE SetDepthWriteEnable(Bool DepthWriteEnable) override final;
+
+    /// Implementation of IDeviceContextVk::SetDepthFunc().
+    virtual void DILIGENT_CALL_TYPE SetDepthFunc(COMPARISON_FUNCTION DepthFunc) override final;
+
+    /// Implementation of IDeviceContextVk::SetStencilOp().
+    virtual void DILIGENT_CALL_TYPE SetStencilOp(const StencilOpDesc& FrontFace, const StencilOpDesc& BackFace) override final;
+
+    /// Implementation of IDeviceContextVk::BeginSecondaryRenderPass().
+    virtual void DILIGENT_CALL_TYPE BeginSecondaryRenderPass(const BeginRenderPassAttribs& Attribs) override final;
+
+    /// Implementation of IDeviceContextVk::BeginSecondaryCommandList().
+    virtual void DILIGENT_CALL_TYPE BeginSecondaryCommandList(const BeginSecondaryCommandListAttribsVk& Attribs) override final;
+
     // Transitions BLAS state from OldState to NewState, and optionally updates internal state.
     // If OldState == RESOURCE_STATE_UNKNOWN, internal BLAS state is used as old state.
     void TransitionBLASState(BottomLevelASVkImpl& BLAS,
@@ -335,6 +362,12 @@ public:
                              RESOURCE_STATE    NewState,
                              bool              UpdateInternalState);
 
+    // Returns the epoch of the device resource states, see RenderDeviceBase::GetResourceStateEpoch().
+    Uint64 GetResourceStateEpoch() const
+    {
+        return m_pDevice->GetResourceStateEpoch();
+    }
+
     void AddWaitSemaphore(ManagedSemaphore* pWaitSemaphore, VkPipelineStageFlags WaitDstStageMask)
     {
         VERIFY_EXPR(pWaitSemaphore != nullptr);
@@ -374,6 +407,17 @@ public:
                              const Box&                     DstBox,
                              RESOURCE_STATE_TRANSITION_MODE TextureTransitionMode);
 
+    void CopyTextureRegion(IBuffer*                       pSrcBuffer,
+                           Uint64                         SrcOffset,
+                           Uint64                         SrcStride,
+                           Uint64                         SrcDepthStride,
+                           RESOURCE_STATE_TRANSITION_MODE BufferTransitionMode,
+                           TextureVkImpl&                 TextureVk,
+                           Uint32                         MipLevel,
+                           Uint32                         Slice,
+                           const Box&                     DstBox,
+                           RESOURCE_STATE_TRANSITION_MODE TextureTransitionMode);
+
     virtual void DILIGENT_CALL_TYPE GenerateMips(ITextureView* pTexView) override final;
 
     size_t GetNumCommandsInCtx() const { return m_State.NumCommands; }
@@ -419,10 +463,17 @@ private:
     void               CommitVkVertexBuffers();
     void               CommitViewports();
     void               CommitScissorRects();
+    void               CommitDynamicStates();
 
     void Flush(Uint32               NumCommandLists,
                ICommandList* const* ppCommandLists);
 
+    void BeginVkRenderPass(const BeginRenderPassAttribs& Attribs, VkSubpassContents vkContents);
+
+    // Records secondary command lists into the current command buffer inside the active render pass
+    void ExecuteSecondaryCommandLists(Uint32               NumCommandLists,
+                                      ICommandList* const* ppCommandLists);
+
     __forceinline void TransitionOrVerifyBufferState(BufferVkImpl&                  Buffer,
                                                      RESOURCE_STATE_TRANSITION_MODE TransitionMode,
                                                      RESOURCE_STATE                 RequiredState,
@@ -461,7 +512,10 @@ private:
         }
     }
 
-    inline void DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue);
+    inline void DisposeVkCmdBuffer(SoftwareQueueIndex   CmdQueue,
+                                   VkCommandBuffer      vkCmdBuff,
+                                   Uint64               FenceValue,
+                                   VkCommandBufferLevel Level = VK_COMMAND_BUFFER_LEVEL_PRIMARY);
     inline void DisposeCurrentCmdBuffer(SoftwareQueueIndex CmdQueue, Uint64 FenceValue);
 
     void CopyBufferToTexture(VkBuffer                       vkSrcBuffer,
@@ -482,11 +536,13 @@ private:
                              Uint64                         DstBufferOffset,
                              Uint32                         DstBufferRowStrideInTexels);
 
-    __forceinline void          PrepareForDraw(DRAW_FLAGS Flags);
-    __forceinline void          PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE IndexType);
+    // The Prepare* methods return false if shader resources could not be committed,
+    // in which case the command must be skipped.
+    __forceinline bool          PrepareForDraw(DRAW_FLAGS Flags);
+    __forceinline bool          PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE IndexType);
     __forceinline BufferVkImpl* PrepareIndirectAttribsBuffer(IBuffer* pAttribsBuffer, RESOURCE_STATE_TRANSITION_MODE TransitionMode, const char* OpName);
-    __forceinline void          PrepareForDispatchCompute();
-    __forceinline void          PrepareForRayTracing();
+    __forceinline bool          PrepareForDispatchCompute();
+    __forceinline bool          PrepareForRayTracing();
 
     void DvpLogRenderPass_PSOMismatch();
 
@@ -514,6 +570,16 @@ private:
         /// Current graphics PSO uses no depth/render targets.
         bool NullRenderTargets = false;
 
+        /// Flag indicating if the descriptor buffer has been bound to the current command buffer
+        bool DescriptorBufferBound = false;
+
+        /// Flag indicating if the dynamic states of the current PSO are up to date
+        bool DynamicStatesUpToDate = false;
+
+        /// Pipeline dynamic states whose values in m_CommittedDynamicState
+        /// have been set in the current command buffer.
+        PIPELINE_DYNAMIC_STATE_FLAGS CommittedDynamicStates = PIPELINE_DYNAMIC_STATE_FLAG_NONE;
+
         Uint32 NumCommands = 0;
 
         VkPipelineBindPoint vkPipelineBindPoint = VK_PIPELINE_BIND_POINT_MAX_ENUM;
@@ -538,6 +604,11 @@ private:
             // Note that this is not the actual number of dynamic buffers in the resource cache.
             Uint32 DynamicOffsetCount = 0;
 
+            // Indicates that the dynamic descriptor set was not allocated by CommitShaderResources() as the
+            // signature supports push descriptors. The set is either pushed or allocated by CommitDescriptorSets(),
+            // depending on whether the current pipeline layout uses push descriptors for this signature.
+            bool DeferredDynamicSet = false;
+
 #ifdef DILIGENT_DEVELOPMENT
             // The descriptor set base index that was used in the last BindDescriptorSets() call
             Uint32 LastBoundBaseInd = ~0u;
@@ -548,13 +619,28 @@ private:
         // Pipeline layout of the currently bound pipeline
         VkPipelineLayout vkPipelineLayout = VK_NULL_HANDLE;
 
+        // Binding index of the signature whose dynamic descriptor set is pushed by the current pipeline layout
+        Uint32 PushDescrSetSignIndex = PipelineLayoutVk::InvalidPushDescrSetSignIndex;
+
         ResourceBindInfo()
         {}
     };
 
     __forceinline ResourceBindInfo& GetBindInfo(PIPELINE_TYPE Type);
 
-    __forceinline void CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
+    // Returns false if the descriptors could not be committed, see CommitDescriptorBufferSets().
+    __forceinline bool CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
+
+    // Transitions resources of the SRB cache and updates the transition statistics
+    void TransitionSRBResources(ShaderResourceCacheVk& ResourceCache);
+
+    // Writes descriptor sets of all SRBs in CommitSRBMask to the descriptor buffer and sets their offsets.
+    // Returns false if the descriptor heap is exhausted. In this case the SRBs remain stale, so that
+    // the sets are written again by the next command.
+    bool CommitDescriptorBufferSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask);
+
+    // Allocates a dynamic descriptor set and writes all dynamic resources from ResourceCache to it
+    VkDescriptorSet CommitDynamicDescriptorSet(const PipelineResourceSignatureVkImpl& Signature, const ShaderResourceCacheVk& ResourceCache);
 #ifdef DILIGENT_DEVELOPMENT
     void DvpValidateCommittedShaderResources(ResourceBindInfo& BindInfo);
 #endif
@@ -565,6 +651,30 @@ private:
     /// Memory to store dynamic buffer offsets for descriptor sets.
     std::vector<Uint32> m_DynamicBufferOffsets;
 
+    struct DynamicStateValues
+    {
+        CULL_MODE           CullMode              = CULL_MODE_BACK;
+        Bool                FrontCounterClockwise = False;
+        PRIMITIVE_TOPOLOGY  Topology              = PRIMITIVE_TOPOLOGY_UNDEFINED;
+        Bool                DepthEnable           = True;
+        Bool                DepthWriteEnable      = True;
+        COMPARISON_FUNCTION DepthFunc             = COMPARISON_FUNC_LESS;
+        StencilOpDesc       FrontStencilOp;
+        StencilOpDesc       BackStencilOp;
+    };
+
+    /// Dynamic state values set by the application through IDeviceContextVk.
+    /// For the states that are not in SetMask, the values from the pipeline description are used.
+    struct
+    {
+        DynamicStateValues           Values;
+        PIPELINE_DYNAMIC_STATE_FLAGS SetMask = PIPELINE_DYNAMIC_STATE_FLAG_NONE;
+    } m_DynamicState;
+
+    /// Dynamic state values last set in the command buffer.
+    /// Only the states in m_State.CommittedDynamicStates are valid.
+    DynamicStateValues m_CommittedDynamicState;
+
     /// Temporary array used by CommitDescriptorSets
     std::array<VkDescriptorSet, (MAX_RESOURCE_SIGNATURES * MAX_DESCR_SET_PER_SIGNATURE)> m_DescriptorSets = {};
 
@@ -579,6 +689,17 @@ private:
     /// Dynamic rendering info.
     std::unique_ptr<VulkanUtilities::RenderingInfoWrapper> m_DynamicRenderingInfo;
 
+    /// Contents of the subpasses of the active render pass. VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+    /// if the render pass was begun by BeginSecondaryRenderPass().
+    VkSubpassContents m_vkSubpassContents = VK_SUBPASS_CONTENTS_INLINE;
+
+    /// Indicates that the deferred context records a secondary command buffer started by BeginSecondaryCommandList().
+    bool m_IsRecordingSecondaryCmdBuffer = false;
+
+    /// Secondary command buffers executed in the current command buffer, and the deferred contexts
+    /// that recorded them. The buffers are disposed when the command buffer is submitted.
+    std::vector<std::pair<RefCntAutoPtr<IDeviceContext>, VkCommandBuffer>> m_ExecutedSecondaryCmdBuffers;
+
     FixedBlockMemoryAllocator m_CmdListAllocator;
 
     // Semaphores are not owned by the command context
@@ -644,6 +765,9 @@ private:
     VulkanDynamicHeap             m_DynamicHeap;
     DynamicDescriptorSetAllocator m_DynamicDescrSetAllocator;
 
+    // Ring of descriptor buffer memory used when the device uses descriptor buffers (VK_EXT_descriptor_buffer).
+    std::unique_ptr<VulkanDynamicHeap> m_DescriptorHeap;
+
     // In Vulkan we can't bind null vertex buffer, so we have to create a dummy VB
     RefCntAutoPtr<BufferVkImpl> m_DummyVB;
 
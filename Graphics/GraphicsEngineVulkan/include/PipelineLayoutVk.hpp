@@ -59,6 +59,12 @@ public:
         return m_FirstDescrSetIndex[Index];
     }
 
+    static constexpr Uint32 InvalidPushDescrSetSignIndex = 0xFF;
+
+    // Returns the binding index of the resource signature whose dynamic descriptor set
+    // is committed with push descriptors, or InvalidPushDescrSetSignIndex if there is none.
+    Uint32 GetPushDescrSetSignIndex() const { return m_PushDescrSetSignIndex; }
+
 private:
     VulkanUtilities::PipelineLayoutWrapper m_VkPipelineLayout;
 
@@ -70,6 +76,9 @@ private:
     // (Maximum is MAX_RESOURCE_SIGNATURES * 2)
     Uint8 m_DescrSetCount = 0;
 
+    // Binding index of the resource signature whose dynamic descriptor set uses push descriptors
+    Uint8 m_PushDescrSetSignIndex = InvalidPushDescrSetSignIndex;
+
 #ifdef DILIGENT_DEBUG
     Uint32 m_DbgMaxBindIndex = 0;
 #endif
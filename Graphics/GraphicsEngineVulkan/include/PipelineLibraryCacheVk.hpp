@@ -0,0 +1,216 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::PipelineLibraryCacheVk class
+
+#include <array>
+#include <unordered_map>
+#include <mutex>
+#include <vector>
+#include <string>
+
+#include "GraphicsTypesX.hpp"
+#include "PipelineResourceSignature.h"
+#include "RenderPass.h"
+#include "RefCntAutoPtr.hpp"
+#include "VulkanUtilities/ObjectWrappers.hpp"
+
+namespace Diligent
+{
+
+class RenderDeviceVkImpl;
+
+/// Cache of graphics pipeline libraries (VK_EXT_graphics_pipeline_library).
+
+/// A graphics pipeline is split into four libraries: vertex input, pre-rasterization shaders,
+/// fragment shader and fragment output. Every library is identified by the part of the pipeline
+/// state it depends on, so pipelines that e.g. share shaders but differ in blend state reuse the
+/// same pre-rasterization and fragment shader libraries and only need to create a new fragment
+/// output library, which is cheap. Complete pipelines are then linked from the libraries.
+///
+/// Libraries are reference-counted by the pipelines that use them and are destroyed when
+/// the last pipeline that uses the library releases it.
+class PipelineLibraryCacheVk
+{
+public:
+    PipelineLibraryCacheVk(RenderDeviceVkImpl& DeviceVk, bool OptimizeLinkedPipelines) noexcept;
+
+    // clang-format off
+    PipelineLibraryCacheVk             (const PipelineLibraryCacheVk&) = delete;
+    PipelineLibraryCacheVk             (PipelineLibraryCacheVk&&)      = delete;
+    PipelineLibraryCacheVk& operator = (const PipelineLibraryCacheVk&) = delete;
+    PipelineLibraryCacheVk& operator = (PipelineLibraryCacheVk&&)      = delete;
+    // clang-format on
+
+    ~PipelineLibraryCacheVk();
+
+    enum LIBRARY_TYPE : Uint32
+    {
+        LIBRARY_TYPE_VERTEX_INPUT = 0,
+        LIBRARY_TYPE_PRE_RASTERIZATION,
+        LIBRARY_TYPE_FRAGMENT_SHADER,
+        LIBRARY_TYPE_FRAGMENT_OUTPUT,
+        LIBRARY_TYPE_COUNT
+    };
+
+    // The part of the graphics pipeline state that defines a library.
+    // Only the members that are relevant to the library type are set,
+    // all other members keep their default values.
+    struct LibraryKey
+    {
+        // Library type, or LIBRARY_TYPE_COUNT if the library is not used by the pipeline
+        // (mesh pipelines do not have vertex input state).
+        LIBRARY_TYPE Type = LIBRARY_TYPE_COUNT;
+
+        // Pipeline creation flags (e.g. descriptor buffer usage) must match between all libraries
+        VkPipelineCreateFlags Flags = 0;
+
+        // Vertex input state
+        InputLayoutDescX   InputLayout;
+        PRIMITIVE_TOPOLOGY PrimitiveTopology = PRIMITIVE_TOPOLOGY_UNDEFINED;
+
+        // Shader byte code is compared by value since the same shader object produces different
+        // SPIR-V depending on the resource signatures and other pipeline state.
+        struct ShaderStage
+        {
+            SHADER_TYPE           Type = SHADER_TYPE_UNKNOWN;
+            std::vector<uint32_t> SPIRV;
+            std::string           EntryPoint;
+
+            bool operator==(const ShaderStage& rhs) const noexcept
+            {
+                return Type == rhs.Type && EntryPoint == rhs.EntryPoint && SPIRV == rhs.SPIRV;
+            }
+        };
+        std::vector<ShaderStage> Shaders;
+        PIPELINE_TYPE            PipelineType = PIPELINE_TYPE_GRAPHICS;
+
+        // Fixed-function state
+        RasterizerStateDesc   RasterizerDesc;
+        Uint8                 NumViewports = 0;
+        DepthStencilStateDesc DepthStencilDesc;
+        BlendStateDesc        BlendDesc;
+        SampleDesc            SmplDesc;
+        Uint32                SampleMask = 0;
+
+        // Pipeline layout. Layouts created from compatible resource signatures are identical.
+        std::vector<RefCntAutoPtr<IPipelineResourceSignature>> Signatures;
+        Uint32                                                 PushDescrSetSignIndex = ~0u;
+        size_t                                                 LayoutHash            = 0;
+
+        // Render pass and subpass, or attachment formats when dynamic rendering is used
+        RefCntAutoPtr<IRenderPass>   pRenderPass;
+        Uint8                        SubpassIndex     = 0;
+        Uint8                        NumRenderTargets = 0;
+        TEXTURE_FORMAT               RTVFormats[DILIGENT_MAX_RENDER_TARGETS]{};
+        TEXTURE_FORMAT               DSVFormat   = TEX_FORMAT_UNKNOWN;
+        bool                         ReadOnlyDSV = false;
+        PIPELINE_SHADING_RATE_FLAGS  ShadingRateFlags = PIPELINE_SHADING_RATE_FLAG_NONE;
+        PIPELINE_DYNAMIC_STATE_FLAGS DynamicStates    = PIPELINE_DYNAMIC_STATE_FLAG_NONE;
+
+        // Computes the key hash. Must be called after all members have been set.
+        void ComputeHash() noexcept;
+
+        bool operator==(const LibraryKey& rhs) const noexcept;
+
+        struct Hasher
+        {
+            size_t operator()(const LibraryKey& Key) const noexcept
+            {
+                return Key.Hash;
+            }
+        };
+
+    private:
+        size_t Hash = 0;
+    };
+
+    using LibraryKeys    = std::array<LibraryKey, LIBRARY_TYPE_COUNT>;
+    using LibraryHandles = std::array<VkPipeline, LIBRARY_TYPE_COUNT>;
+
+    // Finds the libraries that make up the pipeline described by PipelineCI in the cache,
+    // and creates the missing ones. PipelineCI must contain the complete pipeline state;
+    // every library only uses the part of the state that is relevant to it.
+    // The cache holds a reference to every returned library until ReleaseLibraries() is called.
+    LibraryHandles GetLibraries(const VkGraphicsPipelineCreateInfo& PipelineCI,
+                                LibraryKeys&&                       Keys,
+                                VkPipelineCache                     vkPSOCache,
+                                const char*                         PipelineName) noexcept(false);
+
+    // Releases the references to the libraries returned by GetLibraries().
+    // Libraries that are no longer used by any pipeline are destroyed.
+    void ReleaseLibraries(const LibraryHandles& Libraries);
+
+    // Links a complete pipeline from the libraries.
+    // If Optimize is true, the pipeline is linked with link-time optimization, which takes
+    // more time, but produces code that is as efficient as a monolithic pipeline.
+    // This method is thread-safe and may be called from a worker thread.
+    VulkanUtilities::PipelineWrapper LinkPipeline(const LibraryHandles& Libraries,
+                                                  VkPipelineLayout      vkLayout,
+                                                  VkPipelineCreateFlags Flags,
+                                                  bool                  Optimize,
+                                                  VkPipelineCache       vkPSOCache,
+                                                  const char*           PipelineName) const noexcept(false);
+
+    // Returns true if the implementation is able to quickly link pipelines without
+    // link-time optimization. If it is not, pipelines must be linked with optimization.
+    bool IsFastLinkingSupported() const { return m_FastLinkingSupported; }
+
+    // Returns true if fast-linked pipelines should be re-linked with optimization in the background.
+    bool OptimizeLinkedPipelines() const { return m_OptimizeLinkedPipelines; }
+
+private:
+    VulkanUtilities::PipelineWrapper CreateLibrary(const VkGraphicsPipelineCreateInfo& PipelineCI,
+                                                   LIBRARY_TYPE                        Type,
+                                                   VkPipelineCache                     vkPSOCache,
+                                                   const char*                         PipelineName) const noexcept(false);
+
+    RenderDeviceVkImpl& m_DeviceVkImpl;
+
+    const bool m_FastLinkingSupported;
+    const bool m_OptimizeLinkedPipelines;
+
+    std::mutex m_Mutex;
+
+    struct LibraryEntry
+    {
+        VulkanUtilities::PipelineWrapper Library;
+
+        // The number of pipelines that use the library
+        Uint32 RefCount = 0;
+    };
+    using LibraryMapType = std::unordered_map<LibraryKey, LibraryEntry, LibraryKey::Hasher>;
+    std::array<LibraryMapType, LIBRARY_TYPE_COUNT> m_Libraries;
+
+    // Library handle to its entry in m_Libraries. Unordered map iterators
+    // are only invalidated when the element is erased.
+    std::array<std::unordered_map<VkPipeline, LibraryMapType::iterator>, LIBRARY_TYPE_COUNT> m_HandleToLibrary;
+};
+
+} // namespace Diligent
@@ -199,5 +199,18 @@ inline VkDescriptorType DescriptorTypeToVkDescriptorType(DescriptorType Type)
     }
 }
 
+/// Returns the Vulkan descriptor type to use with descriptor buffers.
+/// Descriptor buffers do not support dynamic buffer descriptors, so dynamic offsets are
+/// baked into the buffer addresses and regular uniform/storage buffer descriptors are used instead.
+inline VkDescriptorType DescriptorTypeToVkDescriptorBufferType(DescriptorType Type)
+{
+    VkDescriptorType vkType = DescriptorTypeToVkDescriptorType(Type);
+    if (vkType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+        vkType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    else if (vkType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC)
+        vkType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+    return vkType;
+}
+
 
 } // namespace Diligent
@@ -51,6 +51,11 @@ namespace Diligent
 struct SPIRVShaderResourceAttribs;
 class DeviceContextVkImpl;
 
+namespace VulkanUtilities
+{
+class CommandBuffer;
+}
+
 struct ImmutableSamplerAttribsVk
 {
     Uint32 DescrSet     = ~0u;
@@ -96,6 +101,9 @@ public:
 
     static_assert(ResourceAttribs::MaxDescriptorSets >= MAX_DESCRIPTOR_SETS, "Not enough bits to store descriptor set index");
 
+    // The maximum number of descriptors in the dynamic set for it to be committed with push descriptors
+    static constexpr Uint32 MAX_PUSH_DESCRIPTOR_SET_SIZE = 32;
+
     PipelineResourceSignatureVkImpl(IReferenceCounters*                  pRefCounters,
                                     RenderDeviceVkImpl*                  pDevice,
                                     const PipelineResourceSignatureDesc& Desc,
@@ -121,8 +129,22 @@ public:
     VkDescriptorSetLayout GetVkDescriptorSetLayout(DESCRIPTOR_SET_ID SetId) const { return m_VkDescrSetLayouts[SetId]; }
 
     bool   HasDescriptorSet(DESCRIPTOR_SET_ID SetId) const { return m_VkDescrSetLayouts[SetId] != VK_NULL_HANDLE; }
+
+    // Returns the push descriptor variant of the dynamic descriptor set layout, or null if
+    // the dynamic set is not eligible for push descriptors (see CreateSetLayouts).
+    VkDescriptorSetLayout GetVkPushDescriptorSetLayout() const { return m_VkPushDescrSetLayout; }
+
+    bool SupportsPushDescriptors() const { return m_VkPushDescrSetLayout != VK_NULL_HANDLE; }
     Uint32 GetDescriptorSetSize(DESCRIPTOR_SET_ID SetId) const { return m_DescriptorSetSizes[SetId]; }
 
+    // Returns the layout of the descriptor set with the given index in the resource cache
+    // in the descriptor buffer. Only valid when the device uses descriptor buffers.
+    const ShaderResourceCacheVk::DescriptorBufferSetLayout& GetDescriptorBufferSetLayout(Uint32 SetIndex) const
+    {
+        VERIFY_EXPR(SetIndex < MAX_DESCRIPTOR_SETS);
+        return m_DescrBufferSetLayouts[SetIndex];
+    }
+
     void InitSRBResourceCache(ShaderResourceCacheVk& ResourceCache);
 
     // Copies static resources from the static resource cache to the destination cache
@@ -134,6 +156,15 @@ public:
     void CommitDynamicResources(const ShaderResourceCacheVk& ResourceCache,
                                 VkDescriptorSet              vkDynamicDescriptorSet) const;
 
+    // Pushes dynamic resources from ResourceCache into the command buffer as the descriptor set
+    // with index SetIndex in the pipeline layout. The layout must have been created with
+    // GetVkPushDescriptorSetLayout() at this index.
+    void PushDynamicResources(const ShaderResourceCacheVk&    ResourceCache,
+                              VulkanUtilities::CommandBuffer& CmdBuffer,
+                              VkPipelineBindPoint             vkBindPoint,
+                              VkPipelineLayout                vkPipelineLayout,
+                              Uint32                          SetIndex) const;
+
 #ifdef DILIGENT_DEVELOPMENT
     /// Verifies committed resource using the SPIRV resource attributes from the PSO.
     bool DvpValidateCommittedResource(const DeviceContextVkImpl*        pDeviceCtx,
@@ -178,12 +209,40 @@ private:
 
     void CreateSetLayouts(bool IsSerialized);
 
+    // Creates the descriptor update template that writes all dynamic resources
+    // from the contiguous array filled by ShaderResourceCacheVk::WriteDescriptorUpdateData().
+    void CreateDynamicSetUpdateTemplate();
+
+    // Queries the descriptor offsets in the descriptor buffer for all descriptor sets (VK_EXT_descriptor_buffer)
+    void InitDescriptorBufferSetLayouts(const std::vector<bool>& ImmutableSamplerWithResource);
+
+    // Writes dynamic resources from ResourceCache to vkDynamicDescriptorSet in batches and passes
+    // every batch to FlushWrites(Uint32 WriteCount, const VkWriteDescriptorSet* pWrites).
+    // If SingleBatch is true, all descriptors are written in one batch, which requires that
+    // the dynamic set contains at most MAX_PUSH_DESCRIPTOR_SET_SIZE descriptors.
+    template <bool SingleBatch, typename FlushWritesType>
+    void WriteDynamicResources(const ShaderResourceCacheVk& ResourceCache,
+                               VkDescriptorSet              vkDynamicDescriptorSet,
+                               FlushWritesType&&            FlushWrites) const;
+
     static inline CACHE_GROUP       GetResourceCacheGroup(const PipelineResourceDesc& Res);
     static inline DESCRIPTOR_SET_ID VarTypeToDescriptorSetId(SHADER_RESOURCE_VARIABLE_TYPE VarType);
 
 private:
     std::array<VulkanUtilities::DescriptorSetLayoutWrapper, DESCRIPTOR_SET_ID_NUM_SETS> m_VkDescrSetLayouts;
 
+    // Descriptor update template for the dynamic descriptor set.
+    // Null if the set is empty or VK_KHR_descriptor_update_template is not enabled.
+    VulkanUtilities::DescrUpdateTemplateWrapper m_VkDynamicSetUpdateTemplate;
+
+    // Push descriptor variant of the dynamic descriptor set layout.
+    // Null if the dynamic set is not eligible or VK_KHR_push_descriptor is not enabled.
+    VulkanUtilities::DescriptorSetLayoutWrapper m_VkPushDescrSetLayout;
+
+    // Descriptor buffer layouts indexed by the set index in the layout (not DESCRIPTOR_SET_ID!).
+    // Empty if the device does not use descriptor buffers.
+    std::array<ShaderResourceCacheVk::DescriptorBufferSetLayout, MAX_DESCRIPTOR_SETS> m_DescrBufferSetLayouts;
+
     // Descriptor set sizes indexed by the set index in the layout (not DESCRIPTOR_SET_ID!)
     std::array<Uint32, MAX_DESCRIPTOR_SETS> m_DescriptorSetSizes = {~0U, ~0U};
 
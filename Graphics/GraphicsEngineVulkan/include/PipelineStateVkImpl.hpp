@@ -32,6 +32,7 @@
 
 #include <array>
 #include <memory>
+#include <atomic>
 
 #include "EngineVkImplTraits.hpp"
 #include "PipelineStateBase.hpp"
@@ -41,6 +42,7 @@
 #include "FixedBlockMemoryAllocator.hpp"
 #include "SRBMemoryAllocator.hpp"
 #include "PipelineLayoutVk.hpp"
+#include "PipelineLibraryCacheVk.hpp"
 #include "VulkanUtilities/ObjectWrappers.hpp"
 #include "VulkanUtilities/CommandBuffer.hpp"
 
@@ -48,6 +50,7 @@ namespace Diligent
 {
 
 class DeviceContextVkImpl;
+class SPIRVOptimizationCache;
 
 /// Pipeline state object implementation in Vulkan backend.
 class PipelineStateVkImpl final : public PipelineStateBase<EngineVkImplTraits>
@@ -69,7 +72,13 @@ public:
     virtual IRenderPassVk* DILIGENT_CALL_TYPE GetRenderPass() const override final { return GetRenderPassPtr().RawPtr<IRenderPassVk>(); }
 
     /// Implementation of IPipelineStateVk::GetVkPipeline().
-    virtual VkPipeline DILIGENT_CALL_TYPE GetVkPipeline() const override final { return m_Pipeline; }
+
+    /// If the pipeline was fast-linked from pipeline libraries, returns the optimized
+    /// pipeline once it has been linked in the background.
+    virtual VkPipeline DILIGENT_CALL_TYPE GetVkPipeline() const override final
+    {
+        return m_OptimizedPipelineReady.load(std::memory_order_acquire) ? m_OptimizedPipeline : m_Pipeline;
+    }
 
     const PipelineLayoutVk& GetPipelineLayout() const { return m_PipelineLayout; }
 
@@ -112,7 +121,8 @@ public:
         bool                                                 bStripReflection,
         const char*                                          PipelineName,
         TShaderResources*                                    pShaderResources     = nullptr,
-        TResourceAttibutions*                                pResourceAttibutions = nullptr) noexcept(false);
+        TResourceAttibutions*                                pResourceAttibutions = nullptr,
+        SPIRVOptimizationCache*                              pOptimizationCache   = nullptr) noexcept(false);
 
     static PipelineResourceSignatureDescWrapper GetDefaultResourceSignatureDesc(
         const TShaderStages&              ShaderStages,
@@ -141,6 +151,15 @@ private:
     VulkanUtilities::PipelineWrapper m_Pipeline;
     PipelineLayoutVk                 m_PipelineLayout;
 
+    // Pipeline linked with link-time optimization in the background when m_Pipeline
+    // was fast-linked from graphics pipeline libraries.
+    VulkanUtilities::PipelineWrapper m_OptimizedPipeline;
+    std::atomic<bool>                m_OptimizedPipelineReady{false};
+    RefCntAutoPtr<IAsyncTask>        m_pOptimizeLinkTask;
+
+    // Graphics pipeline libraries that m_Pipeline was linked from
+    PipelineLibraryCacheVk::LibraryHandles m_Libraries{};
+
 #ifdef DILIGENT_DEVELOPMENT
     // Shader resources for all shaders in all shader stages
     TShaderResources m_ShaderResources;
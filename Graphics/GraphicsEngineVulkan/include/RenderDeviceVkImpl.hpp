@@ -51,6 +51,7 @@
 #include "VulkanUploadHeap.hpp"
 #include "FramebufferCache.hpp"
 #include "RenderPassCache.hpp"
+#include "PipelineLibraryCacheVk.hpp"
 #include "CommandPoolManager.hpp"
 #include "DXCompiler.hpp"
 
@@ -58,6 +59,7 @@ namespace Diligent
 {
 
 class QueryManagerVk;
+class SPIRVOptimizationCache;
 
 /// Render device implementation in Vulkan backend.
 class RenderDeviceVkImpl final : public RenderDeviceNextGenBase<RenderDeviceBase<EngineVkImplTraits>, ICommandQueueVk>
@@ -248,6 +250,9 @@ public:
     FramebufferCache* GetFramebufferCache() { return m_FramebufferCache.get(); }
     RenderPassCache*  GetImplicitRenderPassCache() { return m_ImplicitRenderPassCache.get(); }
 
+    // Returns the graphics pipeline library cache, or null if VK_EXT_graphics_pipeline_library is not enabled
+    PipelineLibraryCacheVk* GetPipelineLibraryCache() { return m_PipelineLibraryCache.get(); }
+
     VulkanUtilities::MemoryAllocation AllocateMemory(const VkMemoryRequirements& MemReqs, VkMemoryPropertyFlags MemoryProperties, VkMemoryAllocateFlags AllocateFlags = 0)
     {
         return m_MemoryMgr.Allocate(MemReqs, MemoryProperties, AllocateFlags);
@@ -263,10 +268,22 @@ public:
 
     VulkanDynamicMemoryManager& GetDynamicMemoryManager() { return m_DynamicMemoryManager; }
 
+    // Returns the memory manager for descriptor buffer data, or null if descriptor buffers are not used
+    VulkanDynamicMemoryManager* GetDescriptorMemoryManager() { return m_DescriptorMemoryManager.get(); }
+
+    // Returns true if shader resources are bound through descriptor buffers (VK_EXT_descriptor_buffer)
+    // rather than descriptor sets allocated from descriptor pools.
+    bool UseDescriptorBuffers() const { return m_LogicalDevice->GetEnabledExtFeatures().DescriptorBuffer.descriptorBuffer != VK_FALSE; }
+
     void FlushStaleResources(SoftwareQueueIndex CmdQueueIndex);
 
     IDXCompiler* GetDxCompiler() const { return m_pDxCompiler.get(); }
 
+    // Returns the cache of optimized SPIR-V byte code shared by all pipelines
+    // created by this device, or null if the cache is disabled (see EngineVkCreateInfo::SPIRVOptimizationCacheSize)
+    // or the engine was built without HLSL support.
+    SPIRVOptimizationCache* GetSPIRVOptimizationCache() const { return m_pSPIRVOptimizationCache.get(); }
+
     struct Properties
     {
         Uint32 UploadHeapPageSize  = 0;
@@ -311,6 +328,8 @@ private:
     std::unique_ptr<FramebufferCache> m_FramebufferCache;
     std::unique_ptr<RenderPassCache>  m_ImplicitRenderPassCache;
 
+    std::unique_ptr<PipelineLibraryCacheVk> m_PipelineLibraryCache;
+
     DescriptorSetAllocator m_DescriptorSetAllocator;
     DescriptorPoolManager  m_DynamicDescriptorPool;
 
@@ -326,7 +345,13 @@ private:
 
     VulkanDynamicMemoryManager m_DynamicMemoryManager;
 
+    // Ring buffer for descriptor buffer data (only when descriptor buffers are used)
+    std::unique_ptr<VulkanDynamicMemoryManager> m_DescriptorMemoryManager;
+
     std::unique_ptr<IDXCompiler> m_pDxCompiler;
+
+    // NB: shared_ptr is used so that the type may remain incomplete when the engine is built without HLSL support
+    std::shared_ptr<SPIRVOptimizationCache> m_pSPIRVOptimizationCache;
 };
 
 } // namespace Diligent
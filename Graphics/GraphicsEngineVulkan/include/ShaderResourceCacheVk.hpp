@@ -52,9 +52,13 @@
 //
 // Descriptor set for static and mutable resources is assigned during cache initialization
 // Descriptor set for dynamic resources is assigned at every draw call
+//
+// In descriptor buffer mode, persistent descriptor buffer memory for static and mutable resources is assigned
+// during cache initialization, while dynamic resources are written to the descriptor heap at every draw call
 
 #include <vector>
 #include <memory>
+#include <atomic>
 
 #include "DescriptorPoolManager.hpp"
 #include "SPIRVShaderResources.hpp"
@@ -62,13 +66,15 @@
 #include "ShaderResourceCacheCommon.hpp"
 #include "PipelineResourceAttribsVk.hpp"
 #include "VulkanUtilities/LogicalDevice.hpp"
+#include "VulkanDynamicHeap.hpp"
 
 namespace Diligent
 {
 
 class DeviceContextVkImpl;
+class RenderDeviceVkImpl;
 
-// sizeof(ShaderResourceCacheVk) == 24 (x64, msvc, Release)
+// sizeof(ShaderResourceCacheVk) == 64 (x64, msvc, Release)
 class ShaderResourceCacheVk : public ShaderResourceCacheBase
 {
 public:
@@ -90,7 +96,8 @@ public:
 
     static size_t GetRequiredMemorySize(Uint32 NumSets, const Uint32* SetSizes);
 
-    void InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, const Uint32* SetSizes);
+    // NumContexts is the total number of device contexts that may transition the resources in the cache.
+    void InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, const Uint32* SetSizes, Uint32 NumContexts = 0);
     void InitializeResources(Uint32 Set, Uint32 Offset, Uint32 ArraySize, DescriptorType Type, bool HasImmutableSampler);
 
     // sizeof(Resource) == 32 (x64, msvc, Release)
@@ -257,14 +264,94 @@ public:
     void DbgVerifyDynamicBuffersCounter() const;
 #endif
 
+    // Transitions all resources in the cache to the states required by their descriptor types,
+    // or only verifies the states if VerifyOnly is true.
+    // Returns false if the transitions were skipped because neither the cache contents nor the state
+    // of any resource have changed since the last time the transitions were performed.
     template <bool VerifyOnly>
-    void TransitionResources(DeviceContextVkImpl* pCtxVkImpl);
+    bool TransitionResources(DeviceContextVkImpl* pCtxVkImpl);
 
     Uint32 GetDynamicBufferOffsets(DeviceContextVkImpl*   pCtx,
                                    std::vector<uint32_t>& Offsets,
                                    Uint32                 StartInd) const;
 
+    // Descriptor data of a single resource in the format expected by vkUpdateDescriptorSetWithTemplate.
+    // Descriptor update templates created by the resource signature address this data by cache offset.
+    union DescriptorUpdateData
+    {
+        VkDescriptorImageInfo      ImageInfo;
+        VkDescriptorBufferInfo     BufferInfo;
+        VkBufferView               BufferView;
+        VkAccelerationStructureKHR AccelStruct;
+    };
+
+    // Writes descriptor data of all resources in the set to pData, which must have
+    // space for GetDescriptorSet(SetIndex).GetSize() elements.
+    // Returns false if any resource except for immutable samplers is null.
+    bool WriteDescriptorUpdateData(Uint32 SetIndex, DescriptorUpdateData* pData) const;
+
+    // Layout of a single descriptor set in the descriptor buffer (VK_EXT_descriptor_buffer),
+    // as reported by vkGetDescriptorSetLayoutSizeEXT and vkGetDescriptorSetLayoutBindingOffsetEXT.
+    struct DescriptorBufferSetLayout
+    {
+        struct Descriptor
+        {
+            Uint32 Offset = 0;
+            Uint32 Size   = 0;
+
+            // Immutable sampler that must be written to the descriptor buffer together with the resource
+            VkSampler ImmutableSampler = VK_NULL_HANDLE;
+        };
+
+        // The total size of the set in the descriptor buffer
+        VkDeviceSize Size = 0;
+
+        // Descriptor locations indexed by the cache offset, one element per array element
+        std::vector<Descriptor> Descriptors;
+
+        // Separate immutable samplers that are not present in the resource cache
+        std::vector<Descriptor> ImmutableSamplers;
+    };
+
+    // Writes descriptors of all resources in the set to the mapped descriptor buffer memory pointed to by pData,
+    // which must have space for Layout.Size bytes. Dynamic buffer offsets are baked into the buffer addresses.
+    void WriteDescriptorBufferData(Uint32                                SetIndex,
+                                   const DescriptorBufferSetLayout&      Layout,
+                                   const VulkanUtilities::LogicalDevice& LogicalDevice,
+                                   DeviceContextVkImpl*                  pCtx,
+                                   Uint8*                                pData) const;
+
+    static constexpr VkDeviceSize InvalidDescriptorBufferOffset = ~VkDeviceSize{0};
+
+    // Assigns the descriptor buffer memory that persistently holds the data of the set (descriptor buffer mode only).
+    // Similar to descriptor sets, descriptors are written to this memory when resources are bound rather than
+    // every time the resources are committed. Block is allocated from the persistent region of the device's
+    // descriptor memory manager, and Offset is the offset of the set data from the start of the descriptor buffer.
+    // The block is returned to the manager when the cache is destroyed.
+    void AssignPersistentDescriptorBufferSet(Uint32                                    SetIndex,
+                                             const DescriptorBufferSetLayout&          Layout,
+                                             RenderDeviceVkImpl&                       DeviceVk,
+                                             VulkanDynamicMemoryManager::MasterBlock&& Block,
+                                             VkDeviceSize                              Offset);
+
+    // Returns the offset of the persistent descriptor buffer data of the set, or InvalidDescriptorBufferOffset
+    // if the set data must be written to the descriptor heap every time the resources are committed, which
+    // is the case for sets without persistent memory and sets that contain dynamic buffers.
+    VkDeviceSize GetPersistentDescriptorBufferOffset(Uint32 SetIndex) const
+    {
+        return m_pPersistentDescrBufferSet && m_pPersistentDescrBufferSet->SetIndex == SetIndex && m_pPersistentDescrBufferSet->NumDynamicBuffers == 0 ?
+            m_pPersistentDescrBufferSet->Offset :
+            InvalidDescriptorBufferOffset;
+    }
+
 private:
+    // Writes the descriptor of a single resource to the set data in the descriptor buffer pointed to by pSetData
+    static void WriteDescriptorBufferResource(const Resource&                              Res,
+                                              const DescriptorBufferSetLayout::Descriptor& Descr,
+                                              const VulkanUtilities::LogicalDevice&        LogicalDevice,
+                                              DeviceContextVkImpl*                         pCtx,
+                                              Uint8*                                       pSetData);
+
     Resource* GetFirstResourcePtr()
     {
         return reinterpret_cast<Resource*>(reinterpret_cast<DescriptorSet*>(m_pMemory.get()) + m_NumSets);
@@ -292,6 +379,58 @@ private:
     // Indicates what types of resources are stored in the cache
     const Uint32 m_ContentType : 1;
 
+    struct TransitionedResource
+    {
+        // Index of the resource in the cache
+        Uint32 ResIdx : 31;
+
+        // Whether the resource requires an unordered access barrier every time the resources
+        // are transitioned, even if its state has not changed.
+        Uint32 RequiresUAVBarrier : 1;
+
+        // Revision of the resource state (see BufferBase::GetStateRevision) after the resource was transitioned
+        Uint32 StateRevision;
+    };
+
+    // Transition bookkeeping of a single device context. Every context only accesses its own
+    // state, so several contexts may transition the resources of the same cache in parallel.
+    struct ContextTransitionState
+    {
+        // Content revision of the cache when the resources were last transitioned by the context.
+        Uint32 ContentRevision = ~0u;
+
+        // Device resource state epoch (see RenderDeviceBase::GetResourceStateEpoch) after
+        // the resources were last transitioned or their states were last checked.
+        Uint64 StateEpoch = 0;
+
+        // Resources whose states were recorded when the resources were last transitioned.
+        std::vector<TransitionedResource> Resources;
+    };
+    // Transition states indexed by the device context id.
+    std::vector<ContextTransitionState> m_CtxTransitionStates;
+
+    // Content revision that is incremented every time a resource is bound to the cache.
+    std::atomic<Uint32> m_ContentRevision{0};
+
+    struct PersistentDescriptorBufferSet
+    {
+        VulkanDynamicMemoryManager::MasterBlock Block;
+
+        const DescriptorBufferSetLayout* pLayout   = nullptr;
+        RenderDeviceVkImpl*              pDeviceVk = nullptr;
+
+        Uint8*       pData  = nullptr;
+        VkDeviceSize Offset = 0;
+
+        Uint32 SetIndex = ~0u;
+
+        // The number of dynamic buffers in the set. Descriptors of dynamic buffers depend on the
+        // dynamic offsets, so the set must be written every time the resources are committed.
+        Uint32 NumDynamicBuffers = 0;
+    };
+    // Descriptor buffer memory of the static/mutable set (descriptor buffer mode only)
+    std::unique_ptr<PersistentDescriptorBufferSet> m_pPersistentDescrBufferSet;
+
 #ifdef DILIGENT_DEBUG
     // Debug array that stores flags indicating if resources in the cache have been initialized
     std::vector<std::vector<bool>> m_DbgInitializedResources;
@@ -28,6 +28,7 @@
 #pragma once
 
 #include <mutex>
+#include <memory>
 #include "VulkanUtilities/VulkanHeaders.h"
 #include "VulkanUtilities/MemoryManager.hpp"
 #include "VulkanUtilities/LogicalDevice.hpp"
@@ -123,6 +124,11 @@ struct VulkanDynamicAllocation
 //
 // We cannot use global memory manager for dynamic resources because they
 // need to use the same Vulkan buffer
+//
+// The buffer may optionally contain a persistent region that follows the master blocks.
+// This region is managed separately and is used for long-lived allocations that must
+// reside in the same buffer (e.g. descriptor buffer data of shader resource bindings),
+// so that they do not consume the memory that dynamic heaps recycle every frame.
 class VulkanDynamicMemoryManager : public DynamicHeap::MasterBlockListBasedManager
 {
 public:
@@ -130,10 +136,25 @@ public:
     using OffsetType  = TBase::OffsetType;
     using MasterBlock = TBase::MasterBlock;
 
+    // Usage flags of the dynamic heap buffer that is used to suballocate dynamic resources
+    static constexpr VkBufferUsageFlags DynamicHeapBufferUsage =
+        VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
+        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+        VK_BUFFER_USAGE_INDEX_BUFFER_BIT |
+        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
+        VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+
+    // If Usage contains VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT, the buffer memory is allocated
+    // with VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT and the address can be queried with GetVkDeviceAddress().
+    // PersistentSize is the size of the persistent region that is allocated in addition to Size.
     VulkanDynamicMemoryManager(IMemoryAllocator&         Allocator,
                                class RenderDeviceVkImpl& DeviceVk,
                                Uint32                    Size,
-                               Uint64                    CommandQueueMask);
+                               Uint64                    CommandQueueMask,
+                               VkBufferUsageFlags        Usage          = DynamicHeapBufferUsage,
+                               const char*               Name           = "Dynamic heap buffer",
+                               Uint32                    PersistentSize = 0);
     ~VulkanDynamicMemoryManager();
 
     // clang-format off
@@ -142,8 +163,10 @@ public:
     VulkanDynamicMemoryManager& operator= (const VulkanDynamicMemoryManager&)  = delete;
     VulkanDynamicMemoryManager& operator= (      VulkanDynamicMemoryManager&&) = delete;
 
-    VkBuffer GetVkBuffer()  const{return m_VkBuffer;}
-    Uint8*   GetCPUAddress()const{return m_CPUAddress;}
+    VkBuffer           GetVkBuffer()       const{return m_VkBuffer;}
+    Uint8*             GetCPUAddress()     const{return m_CPUAddress;}
+    VkDeviceAddress    GetVkDeviceAddress()const{return m_DeviceAddress;}
+    VkBufferUsageFlags GetUsage()          const{return m_Usage;}
     // clang-format on
 
     void Destroy();
@@ -151,14 +174,35 @@ public:
     static constexpr const Uint32 MasterBlockAlignment = 1024;
     MasterBlock                   AllocateMasterBlock(OffsetType SizeInBytes, OffsetType Alignment);
 
+    // Allocates a block in the persistent region. Unlike master blocks, the offset of the block is
+    // relative to the start of the region (see GetPersistentRegionOffset()). Returns an invalid
+    // block if there is not enough space.
+    MasterBlock AllocatePersistentBlock(OffsetType SizeInBytes, OffsetType Alignment);
+
+    // Returns the block to the persistent region once all command queues in CmdQueueMask are done with it.
+    void ReleasePersistentBlock(MasterBlock&& Block, Uint64 CmdQueueMask);
+
+    // Returns the offset of the persistent region from the start of the buffer
+    OffsetType GetPersistentRegionOffset() const { return GetSize(); }
+
 private:
     RenderDeviceVkImpl&                  m_DeviceVk;
     VulkanUtilities::BufferWrapper       m_VkBuffer;
     VulkanUtilities::DeviceMemoryWrapper m_BufferMemory;
     Uint8*                               m_CPUAddress;
+    VkDeviceAddress                      m_DeviceAddress = 0;
+    const VkBufferUsageFlags             m_Usage;
     const VkDeviceSize                   m_DefaultAlignment;
     const Uint64                         m_CommandQueueMask;
     OffsetType                           m_TotalPeakSize = 0;
+
+    struct PersistentBlockManager final : DynamicHeap::MasterBlockListBasedManager
+    {
+        using MasterBlockListBasedManager::AllocateMasterBlock;
+        using MasterBlockListBasedManager::MasterBlockListBasedManager;
+    };
+    // Manages the persistent region, or null if there is no persistent region
+    std::unique_ptr<PersistentBlockManager> m_PersistentBlockMgr;
 };
 
 
@@ -67,6 +67,8 @@ VkFilter             FilterTypeToVkFilter(FILTER_TYPE FilterType);
 VkSamplerMipmapMode  FilterTypeToVkMipmapMode(FILTER_TYPE FilterType);
 VkSamplerAddressMode AddressModeToVkAddressMode(TEXTURE_ADDRESS_MODE AddressMode);
 VkBorderColor        BorderColorToVkBorderColor(const Float32 BorderColor[]);
+VkCullModeFlagBits   CullModeToVkCullMode(CULL_MODE CullMode);
+VkStencilOp          StencilOpToVkStencilOp(STENCIL_OP StencilOp);
 
 VkPipelineStageFlags ResourceStateFlagsToVkPipelineStageFlags(RESOURCE_STATE StateFlags);
 VkAccessFlags        ResourceStateFlagsToVkAccessFlags(RESOURCE_STATE StateFlags);
@@ -291,7 +291,8 @@ public:
                                        uint32_t            FramebufferWidth,
                                        uint32_t            FramebufferHeight,
                                        uint32_t            ClearValueCount = 0,
-                                       const VkClearValue* pClearValues    = nullptr)
+                                       const VkClearValue* pClearValues    = nullptr,
+                                       VkSubpassContents   Contents        = VK_SUBPASS_CONTENTS_INLINE)
     {
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
         VERIFY(m_State.RenderPass == VK_NULL_HANDLE, "Current pass has not been ended");
@@ -317,9 +318,10 @@ public:
                                                       // ignored (7.4)
 
             vkCmdBeginRenderPass(m_VkCmdBuffer, &BeginInfo,
-                                 VK_SUBPASS_CONTENTS_INLINE // the contents of the subpass will be recorded inline in the
-                                                            // primary command buffer, and secondary command buffers must not
-                                                            // be executed within the subpass
+                                 Contents // VK_SUBPASS_CONTENTS_INLINE: the contents of the subpass will be recorded inline in the
+                                          // primary command buffer, and secondary command buffers must not be executed within the subpass.
+                                          // VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS: the contents are recorded in secondary
+                                          // command buffers, and the only valid command in the subpass is vkCmdExecuteCommands.
             );
             m_State.RenderPass        = RenderPass;
             m_State.Framebuffer       = Framebuffer;
@@ -347,11 +349,54 @@ public:
         }
     }
 
-    __forceinline void NextSubpass()
+    __forceinline void NextSubpass(VkSubpassContents Contents = VK_SUBPASS_CONTENTS_INLINE)
     {
         VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "Render pass has not been started");
         VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
-        vkCmdNextSubpass(m_VkCmdBuffer, VK_SUBPASS_CONTENTS_INLINE);
+        vkCmdNextSubpass(m_VkCmdBuffer, Contents);
+    }
+
+    // Marks the secondary command buffer as continuing the render pass that was begun in
+    // the primary command buffer. No commands are recorded.
+    __forceinline void BeginInheritedRenderPass(VkRenderPass  RenderPass,
+                                                VkFramebuffer Framebuffer,
+                                                uint32_t      FramebufferWidth,
+                                                uint32_t      FramebufferHeight)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY(!IsInRenderScope(), "Another render pass has already been started");
+        m_State.RenderPass        = RenderPass;
+        m_State.Framebuffer       = Framebuffer;
+        m_State.FramebufferWidth  = FramebufferWidth;
+        m_State.FramebufferHeight = FramebufferHeight;
+    }
+
+    // Ends the render pass scope of the secondary command buffer. The render pass itself
+    // is ended by the primary command buffer, so no commands are recorded.
+    __forceinline void EndInheritedRenderPass()
+    {
+        VERIFY(m_State.RenderPass != VK_NULL_HANDLE, "Render pass has not been started");
+        m_State.RenderPass        = VK_NULL_HANDLE;
+        m_State.Framebuffer       = VK_NULL_HANDLE;
+        m_State.FramebufferWidth  = 0;
+        m_State.FramebufferHeight = 0;
+    }
+
+    __forceinline void ExecuteCommands(uint32_t CommandBufferCount, const VkCommandBuffer* pCommandBuffers)
+    {
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        VERIFY_EXPR(CommandBufferCount > 0 && pCommandBuffers != nullptr);
+        FlushBarriers();
+        vkCmdExecuteCommands(m_VkCmdBuffer, CommandBufferCount, pCommandBuffers);
+
+        // After vkCmdExecuteCommands, the state of the primary command buffer that was set
+        // before the call becomes undefined (6.7)
+        m_State.GraphicsPipeline   = VK_NULL_HANDLE;
+        m_State.ComputePipeline    = VK_NULL_HANDLE;
+        m_State.RayTracingPipeline = VK_NULL_HANDLE;
+        m_State.IndexBuffer        = VK_NULL_HANDLE;
+        m_State.IndexBufferOffset  = 0;
+        m_State.IndexType          = VK_INDEX_TYPE_MAX_ENUM;
     }
 
     __forceinline void BeginRendering(const VkRenderingInfoKHR& RenderingInfo, size_t Hash)
@@ -504,6 +549,46 @@ public:
         vkCmdBindDescriptorSets(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
     }
 
+    __forceinline void PushDescriptorSet(VkPipelineBindPoint         pipelineBindPoint,
+                                         VkPipelineLayout            layout,
+                                         uint32_t                    set,
+                                         uint32_t                    descriptorWriteCount,
+                                         const VkWriteDescriptorSet* pDescriptorWrites)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdPushDescriptorSetKHR(m_VkCmdBuffer, pipelineBindPoint, layout, set, descriptorWriteCount, pDescriptorWrites);
+#else
+        UNSUPPORTED("PushDescriptorSet is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void BindDescriptorBuffers(uint32_t                                bufferCount,
+                                             const VkDescriptorBufferBindingInfoEXT* pBindingInfos)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdBindDescriptorBuffersEXT(m_VkCmdBuffer, bufferCount, pBindingInfos);
+#else
+        UNSUPPORTED("BindDescriptorBuffers is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDescriptorBufferOffsets(VkPipelineBindPoint pipelineBindPoint,
+                                                  VkPipelineLayout    layout,
+                                                  uint32_t            firstSet,
+                                                  uint32_t            setCount,
+                                                  const uint32_t*     pBufferIndices,
+                                                  const VkDeviceSize* pOffsets)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+        vkCmdSetDescriptorBufferOffsetsEXT(m_VkCmdBuffer, pipelineBindPoint, layout, firstSet, setCount, pBufferIndices, pOffsets);
+#else
+        UNSUPPORTED("SetDescriptorBufferOffsets is not supported when vulkan library is linked statically");
+#endif
+    }
+
     __forceinline void CopyBuffer(VkBuffer            srcBuffer,
                                   VkBuffer            dstBuffer,
                                   uint32_t            regionCount,
@@ -794,6 +879,87 @@ public:
 #endif
     }
 
+    __forceinline void SetCullMode(VkCullModeFlags CullMode)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+
+        vkCmdSetCullModeEXT(m_VkCmdBuffer, CullMode);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetFrontFace(VkFrontFace FrontFace)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+
+        vkCmdSetFrontFaceEXT(m_VkCmdBuffer, FrontFace);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetPrimitiveTopology(VkPrimitiveTopology Topology)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+
+        vkCmdSetPrimitiveTopologyEXT(m_VkCmdBuffer, Topology);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDepthTestEnable(VkBool32 DepthTestEnable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+
+        vkCmdSetDepthTestEnableEXT(m_VkCmdBuffer, DepthTestEnable);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDepthWriteEnable(VkBool32 DepthWriteEnable)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+
+        vkCmdSetDepthWriteEnableEXT(m_VkCmdBuffer, DepthWriteEnable);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetDepthCompareOp(VkCompareOp CompareOp)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+
+        vkCmdSetDepthCompareOpEXT(m_VkCmdBuffer, CompareOp);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
+    __forceinline void SetStencilOp(VkStencilFaceFlags FaceMask,
+                                    VkStencilOp        FailOp,
+                                    VkStencilOp        PassOp,
+                                    VkStencilOp        DepthFailOp,
+                                    VkCompareOp        CompareOp)
+    {
+#if DILIGENT_USE_VOLK
+        VERIFY_EXPR(m_VkCmdBuffer != VK_NULL_HANDLE);
+
+        vkCmdSetStencilOpEXT(m_VkCmdBuffer, FaceMask, FailOp, PassOp, DepthFailOp, CompareOp);
+#else
+        LOG_WARNING_MESSAGE_ONCE("Extended dynamic state is not supported when vulkan library is linked statically");
+#endif
+    }
+
     void FlushBarriers();
 
     __forceinline void SetVkCmdBuffer(VkCommandBuffer VkCmdBuffer, VkPipelineStageFlags StageMask, VkAccessFlags AccessMask)
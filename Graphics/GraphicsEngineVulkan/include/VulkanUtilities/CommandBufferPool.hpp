@@ -54,9 +54,11 @@ public:
 
     ~CommandBufferPool();
 
-    VkCommandBuffer GetCommandBuffer(const char* DebugName = "");
+    // Returns a command buffer in the recording state. If pInheritanceInfo is not null, returns a secondary
+    // command buffer that continues the render pass specified by the inheritance info.
+    VkCommandBuffer GetCommandBuffer(const char* DebugName = "", const VkCommandBufferInheritanceInfo* pInheritanceInfo = nullptr);
     // The GPU must have finished with the command buffer being returned to the pool
-    void RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer);
+    void RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer, VkCommandBufferLevel Level = VK_COMMAND_BUFFER_LEVEL_PRIMARY);
 
     VkPipelineStageFlags GetSupportedStagesMask() const { return m_SupportedStagesMask; }
     VkAccessFlags        GetSupportedAccessMask() const { return m_SupportedAccessMask; }
@@ -69,6 +71,7 @@ private:
 
     std::mutex                  m_Mutex;
     std::deque<VkCommandBuffer> m_CmdBuffers;
+    std::deque<VkCommandBuffer> m_SecondaryCmdBuffers;
     const VkPipelineStageFlags  m_SupportedStagesMask;
     const VkAccessFlags         m_SupportedAccessMask;
 
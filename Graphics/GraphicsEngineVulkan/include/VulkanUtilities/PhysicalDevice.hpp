@@ -48,27 +48,30 @@ public:
 
     struct ExtensionFeatures
     {
-        VkPhysicalDeviceMeshShaderFeaturesEXT             MeshShader             = {};
-        VkPhysicalDevice16BitStorageFeaturesKHR           Storage16Bit           = {};
-        VkPhysicalDevice8BitStorageFeaturesKHR            Storage8Bit            = {};
-        VkPhysicalDeviceShaderFloat16Int8FeaturesKHR      ShaderFloat16Int8      = {};
-        VkPhysicalDeviceAccelerationStructureFeaturesKHR  AccelStruct            = {};
-        VkPhysicalDeviceRayTracingPipelineFeaturesKHR     RayTracingPipeline     = {};
-        VkPhysicalDeviceRayQueryFeaturesKHR               RayQuery               = {};
-        VkPhysicalDeviceBufferDeviceAddressFeaturesKHR    BufferDeviceAddress    = {};
-        VkPhysicalDeviceDescriptorIndexingFeaturesEXT     DescriptorIndexing     = {};
-        VkPhysicalDevicePortabilitySubsetFeaturesKHR      PortabilitySubset      = {};
-        VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT VertexAttributeDivisor = {};
-        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR      TimelineSemaphore      = {};
-        VkPhysicalDeviceHostQueryResetFeatures            HostQueryReset         = {};
-        VkPhysicalDeviceFragmentShadingRateFeaturesKHR    ShadingRate            = {};
-        VkPhysicalDeviceFragmentDensityMapFeaturesEXT     FragmentDensityMap     = {}; // Only for desktop devices
-        VkPhysicalDeviceFragmentDensityMap2FeaturesEXT    FragmentDensityMap2    = {}; // Only for mobile devices
-        VkPhysicalDeviceMultiviewFeaturesKHR              Multiview              = {}; // Required for RenderPass2
-        VkPhysicalDeviceMultiDrawFeaturesEXT              MultiDraw              = {};
-        VkPhysicalDeviceShaderDrawParametersFeatures      ShaderDrawParameters   = {};
-        VkPhysicalDeviceDynamicRenderingFeaturesKHR       DynamicRendering       = {};
-        VkPhysicalDeviceHostImageCopyFeaturesEXT          HostImageCopy          = {};
+        VkPhysicalDeviceMeshShaderFeaturesEXT              MeshShader              = {};
+        VkPhysicalDevice16BitStorageFeaturesKHR            Storage16Bit            = {};
+        VkPhysicalDevice8BitStorageFeaturesKHR             Storage8Bit             = {};
+        VkPhysicalDeviceShaderFloat16Int8FeaturesKHR       ShaderFloat16Int8       = {};
+        VkPhysicalDeviceAccelerationStructureFeaturesKHR   AccelStruct             = {};
+        VkPhysicalDeviceRayTracingPipelineFeaturesKHR      RayTracingPipeline      = {};
+        VkPhysicalDeviceRayQueryFeaturesKHR                RayQuery                = {};
+        VkPhysicalDeviceBufferDeviceAddressFeaturesKHR     BufferDeviceAddress     = {};
+        VkPhysicalDeviceDescriptorIndexingFeaturesEXT      DescriptorIndexing      = {};
+        VkPhysicalDevicePortabilitySubsetFeaturesKHR       PortabilitySubset       = {};
+        VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT  VertexAttributeDivisor  = {};
+        VkPhysicalDeviceTimelineSemaphoreFeaturesKHR       TimelineSemaphore       = {};
+        VkPhysicalDeviceHostQueryResetFeatures             HostQueryReset          = {};
+        VkPhysicalDeviceFragmentShadingRateFeaturesKHR     ShadingRate             = {};
+        VkPhysicalDeviceFragmentDensityMapFeaturesEXT      FragmentDensityMap      = {}; // Only for desktop devices
+        VkPhysicalDeviceFragmentDensityMap2FeaturesEXT     FragmentDensityMap2     = {}; // Only for mobile devices
+        VkPhysicalDeviceMultiviewFeaturesKHR               Multiview               = {}; // Required for RenderPass2
+        VkPhysicalDeviceMultiDrawFeaturesEXT               MultiDraw               = {};
+        VkPhysicalDeviceShaderDrawParametersFeatures       ShaderDrawParameters    = {};
+        VkPhysicalDeviceDynamicRenderingFeaturesKHR        DynamicRendering        = {};
+        VkPhysicalDeviceHostImageCopyFeaturesEXT           HostImageCopy           = {};
+        VkPhysicalDeviceDescriptorBufferFeaturesEXT        DescriptorBuffer        = {};
+        VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT GraphicsPipelineLibrary = {};
+        VkPhysicalDeviceExtendedDynamicStateFeaturesEXT    ExtendedDynamicState    = {};
 
 
         bool Spirv14              = false; // Ray tracing requires Vulkan 1.2 or SPIRV 1.4 extension
@@ -77,25 +80,30 @@ public:
         bool HasPortabilitySubset = false;
         bool RenderPass2          = false;
         bool DrawIndirectCount    = false;
+        bool DescrUpdateTemplate  = false; // Used to update dynamic descriptor sets with a single call
+        bool PushDescriptor       = false; // Used to push small dynamic descriptor sets directly into the command buffer
     };
 
     struct ExtensionProperties
     {
-        VkPhysicalDeviceMeshShaderPropertiesEXT             MeshShader             = {};
-        VkPhysicalDeviceAccelerationStructurePropertiesKHR  AccelStruct            = {};
-        VkPhysicalDeviceRayTracingPipelinePropertiesKHR     RayTracingPipeline     = {};
-        VkPhysicalDeviceDescriptorIndexingPropertiesEXT     DescriptorIndexing     = {};
-        VkPhysicalDevicePortabilitySubsetPropertiesKHR      PortabilitySubset      = {};
-        VkPhysicalDeviceSubgroupProperties                  Subgroup               = {};
-        VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT VertexAttributeDivisor = {};
-        VkPhysicalDeviceTimelineSemaphorePropertiesKHR      TimelineSemaphore      = {};
-        VkPhysicalDeviceFragmentShadingRatePropertiesKHR    ShadingRate            = {};
-        VkPhysicalDeviceFragmentDensityMapPropertiesEXT     FragmentDensityMap     = {};
-        VkPhysicalDeviceMultiviewPropertiesKHR              Multiview              = {};
-        VkPhysicalDeviceMaintenance3Properties              Maintenance3           = {};
-        VkPhysicalDeviceFragmentDensityMap2PropertiesEXT    FragmentDensityMap2    = {};
-        VkPhysicalDeviceMultiDrawPropertiesEXT              MultiDraw              = {};
-        VkPhysicalDeviceHostImageCopyPropertiesEXT          HostImageCopy          = {};
+        VkPhysicalDeviceMeshShaderPropertiesEXT              MeshShader              = {};
+        VkPhysicalDeviceAccelerationStructurePropertiesKHR   AccelStruct             = {};
+        VkPhysicalDeviceRayTracingPipelinePropertiesKHR      RayTracingPipeline      = {};
+        VkPhysicalDeviceDescriptorIndexingPropertiesEXT      DescriptorIndexing      = {};
+        VkPhysicalDevicePortabilitySubsetPropertiesKHR       PortabilitySubset       = {};
+        VkPhysicalDeviceSubgroupProperties                   Subgroup                = {};
+        VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT  VertexAttributeDivisor  = {};
+        VkPhysicalDeviceTimelineSemaphorePropertiesKHR       TimelineSemaphore       = {};
+        VkPhysicalDeviceFragmentShadingRatePropertiesKHR     ShadingRate             = {};
+        VkPhysicalDeviceFragmentDensityMapPropertiesEXT      FragmentDensityMap      = {};
+        VkPhysicalDeviceMultiviewPropertiesKHR               Multiview               = {};
+        VkPhysicalDeviceMaintenance3Properties               Maintenance3            = {};
+        VkPhysicalDeviceFragmentDensityMap2PropertiesEXT     FragmentDensityMap2     = {};
+        VkPhysicalDeviceMultiDrawPropertiesEXT               MultiDraw               = {};
+        VkPhysicalDeviceHostImageCopyPropertiesEXT           HostImageCopy           = {};
+        VkPhysicalDevicePushDescriptorPropertiesKHR          PushDescriptor          = {};
+        VkPhysicalDeviceDescriptorBufferPropertiesEXT        DescriptorBuffer        = {};
+        VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT GraphicsPipelineLibrary = {};
 
         std::unique_ptr<VkImageLayout[]> HostImageCopyLayouts;
     };
@@ -48,6 +48,25 @@ static DILIGENT_CONSTEXPR INTERFACE_ID IID_DeviceContextVk =
 
 // clang-format off
 
+/// Attributes of the IDeviceContextVk::BeginSecondaryCommandList() command.
+struct BeginSecondaryCommandListAttribsVk
+{
+    /// Index of the immediate context that will execute the command list, see IDeviceContext::Begin().
+    Uint32 ImmediateContextId DEFAULT_INITIALIZER(0);
+
+    /// Render pass that the command list continues.
+    /// The command list must be executed inside an instance of this render pass
+    /// that was begun with IDeviceContextVk::BeginSecondaryRenderPass().
+    IRenderPass* pRenderPass DEFAULT_INITIALIZER(nullptr);
+
+    /// Index of the subpass that the command list will be executed in.
+    Uint32 SubpassIndex DEFAULT_INITIALIZER(0);
+
+    /// Framebuffer that the render pass instance uses.
+    IFramebuffer* pFramebuffer DEFAULT_INITIALIZER(nullptr);
+};
+typedef struct BeginSecondaryCommandListAttribsVk BeginSecondaryCommandListAttribsVk;
+
 /// Exposes Vulkan-specific functionality of a device context.
 DILIGENT_BEGIN_INTERFACE(IDeviceContextVk, IDeviceContext)
 {
@@ -84,6 +103,84 @@ DILIGENT_BEGIN_INTERFACE(IDeviceContextVk, IDeviceContext)
     /// calling IDeviceContext::InvalidateState() and then manually restore all required states via
     /// appropriate Diligent API calls.
     VIRTUAL VkCommandBuffer METHOD(GetVkCommandBuffer)(THIS) PURE;
+
+    /// Sets the cull mode for pipelines that were created with PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE
+
+    /// \param [in] CullMode - cull mode, see Diligent::CULL_MODE.
+    ///
+    /// \remarks Dynamic states are applied at draw time and only affect pipelines that
+    ///          declare the corresponding flag in GraphicsPipelineDesc::DynamicStates.
+    ///          Pipelines that do not declare the flag use the value baked into the pipeline.
+    ///          Until the state is set, the value from the pipeline description is used.
+    ///          The value persists until it is changed or IDeviceContext::InvalidateState() is called.
+    ///          All dynamic state setters require DeviceFeaturesVk::ExtendedDynamicState.
+    VIRTUAL void METHOD(SetCullMode)(THIS_
+                                     CULL_MODE CullMode) PURE;
+
+    /// Sets the front face orientation for pipelines that were created with PIPELINE_DYNAMIC_STATE_FLAG_FRONT_FACE
+
+    /// \param [in] FrontCounterClockwise - whether counter-clockwise triangles are front-facing,
+    ///                                     see RasterizerStateDesc::FrontCounterClockwise.
+    VIRTUAL void METHOD(SetFrontFace)(THIS_
+                                      Bool FrontCounterClockwise) PURE;
+
+    /// Sets the primitive topology for pipelines that were created with PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY
+
+    /// \param [in] Topology - primitive topology. The topology must belong to the same class
+    ///                        (point, line, triangle or patch) as the pipeline topology.
+    VIRTUAL void METHOD(SetPrimitiveTopology)(THIS_
+                                              PRIMITIVE_TOPOLOGY Topology) PURE;
+
+    /// Enables or disables the depth test for pipelines that were created with PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_TEST
+    VIRTUAL void METHOD(SetDepthTestEnable)(THIS_
+                                            Bool DepthEnable) PURE;
+
+    /// Enables or disables the depth writes for pipelines that were created with PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_WRITE
+    VIRTUAL void METHOD(SetDepthWriteEnable)(THIS_
+                                             Bool DepthWriteEnable) PURE;
+
+    /// Sets the depth comparison function for pipelines that were created with PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_FUNC
+    VIRTUAL void METHOD(SetDepthFunc)(THIS_
+                                      COMPARISON_FUNCTION DepthFunc) PURE;
+
+    /// Sets the stencil operations for pipelines that were created with PIPELINE_DYNAMIC_STATE_FLAG_STENCIL_OP
+
+    /// \param [in] FrontFace - stencil operations for front-facing triangles.
+    /// \param [in] BackFace  - stencil operations for back-facing triangles.
+    VIRTUAL void METHOD(SetStencilOp)(THIS_
+                                      const StencilOpDesc REF FrontFace,
+                                      const StencilOpDesc REF BackFace) PURE;
+
+    /// Begins a render pass whose subpasses are recorded in secondary command lists
+
+    /// \param [in] Attribs - The command attributes, see Diligent::BeginRenderPassAttribs.
+    ///
+    /// \remarks This method may only be called by immediate contexts.
+    ///          Inside the render pass, the only valid commands are IDeviceContext::ExecuteCommandLists(),
+    ///          IDeviceContext::NextSubpass() and IDeviceContext::EndRenderPass().
+    ///          ExecuteCommandLists() records the secondary command lists into the current command buffer
+    ///          in the order they are given, and the lists are submitted for execution together with it.
+    ///          Secondary command lists leave the pipeline state, shader resources and other context states
+    ///          undefined, so an application must set them again after the render pass, the same way as
+    ///          after IDeviceContext::Flush().
+    VIRTUAL void METHOD(BeginSecondaryRenderPass)(THIS_
+                                                  const BeginRenderPassAttribs REF Attribs) PURE;
+
+    /// Begins recording a secondary command list that continues a render pass subpass
+
+    /// \param [in] Attribs - The command attributes, see Diligent::BeginSecondaryCommandListAttribsVk.
+    ///
+    /// \remarks This method may only be called by deferred contexts, instead of IDeviceContext::Begin().
+    ///          The context records commands as if the render pass was active and the subpass was current,
+    ///          so draw commands may be issued right away. Resource state transitions are not allowed
+    ///          inside a render pass, so all resources must be transitioned before the render pass begins.
+    ///          Recording is finished by IDeviceContext::FinishCommandList(), and the resulting
+    ///          command list may only be executed inside the same render pass subpass of
+    ///          a render pass instance begun with IDeviceContextVk::BeginSecondaryRenderPass().
+    ///
+    ///          Several deferred contexts may record secondary command lists for the same subpass in parallel.
+    VIRTUAL void METHOD(BeginSecondaryCommandList)(THIS_
+                                                   const BeginSecondaryCommandListAttribsVk REF Attribs) PURE;
 };
 DILIGENT_END_INTERFACE
 
@@ -93,8 +190,17 @@ DILIGENT_END_INTERFACE
 
 // clang-format off
 
-#    define IDeviceContextVk_TransitionImageLayout(This, ...) CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout, This, __VA_ARGS__)
-#    define IDeviceContextVk_BufferMemoryBarrier(This, ...)   CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,   This, __VA_ARGS__)
+#    define IDeviceContextVk_TransitionImageLayout(This, ...)     CALL_IFACE_METHOD(DeviceContextVk, TransitionImageLayout,     This, __VA_ARGS__)
+#    define IDeviceContextVk_BufferMemoryBarrier(This, ...)       CALL_IFACE_METHOD(DeviceContextVk, BufferMemoryBarrier,       This, __VA_ARGS__)
+#    define IDeviceContextVk_SetCullMode(This, ...)               CALL_IFACE_METHOD(DeviceContextVk, SetCullMode,               This, __VA_ARGS__)
+#    define IDeviceContextVk_SetFrontFace(This, ...)              CALL_IFACE_METHOD(DeviceContextVk, SetFrontFace,              This, __VA_ARGS__)
+#    define IDeviceContextVk_SetPrimitiveTopology(This, ...)      CALL_IFACE_METHOD(DeviceContextVk, SetPrimitiveTopology,      This, __VA_ARGS__)
+#    define IDeviceContextVk_SetDepthTestEnable(This, ...)        CALL_IFACE_METHOD(DeviceContextVk, SetDepthTestEnable,        This, __VA_ARGS__)
+#    define IDeviceContextVk_SetDepthWriteEnable(This, ...)       CALL_IFACE_METHOD(DeviceContextVk, SetDepthWriteEnable,       This, __VA_ARGS__)
+#    define IDeviceContextVk_SetDepthFunc(This, ...)              CALL_IFACE_METHOD(DeviceContextVk, SetDepthFunc,              This, __VA_ARGS__)
+#    define IDeviceContextVk_SetStencilOp(This, ...)              CALL_IFACE_METHOD(DeviceContextVk, SetStencilOp,              This, __VA_ARGS__)
+#    define IDeviceContextVk_BeginSecondaryRenderPass(This, ...)  CALL_IFACE_METHOD(DeviceContextVk, BeginSecondaryRenderPass,  This, __VA_ARGS__)
+#    define IDeviceContextVk_BeginSecondaryCommandList(This, ...) CALL_IFACE_METHOD(DeviceContextVk, BeginSecondaryCommandList, This, __VA_ARGS__)
 
 // clang-format on
 
@@ -180,6 +180,20 @@ BufferVkImpl::BufferVkImpl(IReferenceCounters*        pRefCounters,
         // Read-only storage buffers (aka structured buffers) don't need a backing buffer.
         ((VkBuffCI.usage & VK_BUFFER_USAGE_STORAGE_BUFFER_BIT) != 0 && (m_Desc.BindFlags & BIND_UNORDERED_ACCESS) != 0);
 
+    if (pRenderDeviceVk->UseDescriptorBuffers())
+    {
+        constexpr VkBufferUsageFlags DescriptorUsage =
+            VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+            VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+            VK_BUFFER_USAGE_UNIFORM_TEXEL_BUFFER_BIT |
+            VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
+        // Descriptors in descriptor buffers reference buffers by device address.
+        // Note that this flag does not require a backing buffer for dynamic buffers as they
+        // are suballocated from the dynamic heap buffer, which has device address usage.
+        if ((VkBuffCI.usage & DescriptorUsage) != 0)
+            VkBuffCI.usage |= VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+    }
+
     if (m_Desc.Usage == USAGE_SPARSE)
     {
         VkBuffCI.flags =
@@ -555,22 +569,20 @@ VkAccessFlags BufferVkImpl::GetAccessFlags() const
 
 VkDeviceAddress BufferVkImpl::GetVkDeviceAddress() const
 {
-    constexpr BIND_FLAGS DeviceAddressFlags = BIND_RAY_TRACING;
+    BIND_FLAGS DeviceAddressFlags = BIND_RAY_TRACING;
+    if (m_pDevice->UseDescriptorBuffers())
+        DeviceAddressFlags |= BIND_UNIFORM_BUFFER | BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS;
 
     if (m_VulkanBuffer != VK_NULL_HANDLE && (m_Desc.BindFlags & DeviceAddressFlags) != 0)
     {
-#if DILIGENT_USE_VOLK
-        VkBufferDeviceAddressInfoKHR BufferInfo = {};
-
-        BufferInfo.sType       = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO_KHR;
-        BufferInfo.buffer      = m_VulkanBuffer;
-        VkDeviceAddress Result = vkGetBufferDeviceAddressKHR(m_pDevice->GetLogicalDevice().GetVkDevice(), &BufferInfo);
+        VkDeviceAddress Result = m_pDevice->GetLogicalDevice().GetBufferDeviceAddress(m_VulkanBuffer);
         VERIFY_EXPR(Result > 0);
         return Result;
-#else
-        UNSUPPORTED("vkGetBufferDeviceAddressKHR is only available through Volk");
-        return VkDeviceAddress{};
-#endif
+    }
+    else if (m_VulkanBuffer == VK_NULL_HANDLE && m_Desc.Usage == USAGE_DYNAMIC && m_pDevice->UseDescriptorBuffers())
+    {
+        // Dynamic buffers are suballocated from the dynamic heap buffer; the caller must add the dynamic offset
+        return m_pDevice->GetDynamicMemoryManager().GetVkDeviceAddress();
     }
     else
     {
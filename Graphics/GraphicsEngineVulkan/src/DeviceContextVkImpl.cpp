@@ -122,6 +122,14 @@ DeviceContextVkImpl::DeviceContextVkImpl(IReferenceCounters*      pRefCounters,
     m_DynamicBufferOffsets.reserve(64);
     m_MappedBuffers.reserve(32);
 
+    if (VulkanDynamicMemoryManager* pDescriptorMemMgr = pDeviceVkImpl->GetDescriptorMemoryManager())
+    {
+        m_DescriptorHeap = std::make_unique<VulkanDynamicHeap>(
+            *pDescriptorMemMgr,
+            GetContextObjectName("Descriptor heap", Desc.IsDeferred, Desc.ContextId),
+            pDeviceVkImpl->GetProperties().DynamicHeapPageSize);
+    }
+
     CreateASCompactedSizeQueryPool();
 }
 
@@ -156,6 +164,7 @@ DeviceContextVkImpl::~DeviceContextVkImpl()
     // clang-format off
     DEV_CHECK_ERR(m_UploadHeap.GetStalePagesCount()                  == 0, "All allocated upload heap pages must have been released at this point");
     DEV_CHECK_ERR(m_DynamicHeap.GetAllocatedMasterBlockCount()       == 0, "All allocated dynamic heap master blocks must have been released");
+    DEV_CHECK_ERR(!m_DescriptorHeap || m_DescriptorHeap->GetAllocatedMasterBlockCount() == 0, "All allocated descriptor heap master blocks must have been released");
     DEV_CHECK_ERR(m_DynamicDescrSetAllocator.GetAllocatedPoolCount() == 0, "All allocated dynamic descriptor set pools must have been released at this point");
     // clang-format on
 
@@ -212,7 +221,10 @@ void DeviceContextVkImpl::Begin(Uint32 ImmediateContextId)
     m_pQueryMgr = &m_pDevice->GetQueryMgr(CommandQueueId);
 }
 
-void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkCommandBuffer vkCmdBuff, Uint64 FenceValue)
+void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex   CmdQueue,
+                                             VkCommandBuffer      vkCmdBuff,
+                                             Uint64               FenceValue,
+                                             VkCommandBufferLevel Level)
 {
     VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
     VERIFY_EXPR(m_CmdPool != nullptr);
@@ -221,9 +233,11 @@ void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkComm
     public:
         // clang-format off
         CmdBufferRecycler(VkCommandBuffer                     _vkCmdBuff,
-                          VulkanUtilities::CommandBufferPool& _Pool) noexcept :
+                          VulkanUtilities::CommandBufferPool& _Pool,
+                          VkCommandBufferLevel                _Level) noexcept :
             vkCmdBuff {_vkCmdBuff},
-            Pool      {&_Pool    }
+            Pool      {&_Pool    },
+            Level     {_Level    }
         {
             VERIFY_EXPR(vkCmdBuff != VK_NULL_HANDLE);
         }
@@ -234,7 +248,8 @@ void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkComm
 
         CmdBufferRecycler(CmdBufferRecycler&& rhs) noexcept :
             vkCmdBuff {rhs.vkCmdBuff},
-            Pool      {rhs.Pool     }
+            Pool      {rhs.Pool     },
+            Level     {rhs.Level    }
         {
             rhs.vkCmdBuff = VK_NULL_HANDLE;
             rhs.Pool      = nullptr;
@@ -245,19 +260,20 @@ void DeviceContextVkImpl::DisposeVkCmdBuffer(SoftwareQueueIndex CmdQueue, VkComm
         {
             if (Pool != nullptr)
             {
-                Pool->RecycleCommandBuffer(std::move(vkCmdBuff));
+                Pool->RecycleCommandBuffer(std::move(vkCmdBuff), Level);
             }
         }
 
     private:
         VkCommandBuffer                     vkCmdBuff = VK_NULL_HANDLE;
         VulkanUtilities::CommandBufferPool* Pool      = nullptr;
+        VkCommandBufferLevel                Level     = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
     };
 
     // Discard command buffer directly to the release queue since we know exactly which queue it was submitted to
     // as well as the associated FenceValue.
     auto& ReleaseQueue = m_pDevice->GetReleaseQueue(CmdQueue);
-    ReleaseQueue.DiscardResource(CmdBufferRecycler{vkCmdBuff, *m_CmdPool}, FenceValue);
+    ReleaseQueue.DiscardResource(CmdBufferRecycler{vkCmdBuff, *m_CmdPool, Level}, FenceValue);
 }
 
 inline void DeviceContextVkImpl::DisposeCurrentCmdBuffer(SoftwareQueueIndex CmdQueue, Uint64 FenceValue)
@@ -328,6 +344,10 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
             }
             m_State.vkPipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
 
+            // Binding a pipeline overwrites the states that the pipeline does not declare as dynamic
+            m_State.CommittedDynamicStates &= GraphicsPipeline.DynamicStates;
+            m_State.DynamicStatesUpToDate = false;
+
             m_State.NullRenderTargets =
                 GraphicsPipeline.pRenderPass == nullptr &&
                 GraphicsPipeline.NumRenderTargets == 0 &&
@@ -364,10 +384,17 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
     {
         // Do not clear DescriptorSetBaseInd and DynamicOffsetCount!
         BindInfo.SetInfo[sign].vkSets.fill(VK_NULL_HANDLE);
+        BindInfo.SetInfo[sign].DeferredDynamicSet = false;
     }
 #endif
 
-    BindInfo.vkPipelineLayout = Layout.GetVkPipelineLayout();
+    // Whether the deferred dynamic set of a signature is pushed or bound depends on the pipeline layout.
+    // Push descriptors are also disturbed by binding an incompatible layout, so SRBs with deferred sets must
+    // be committed again when the layout changes, even if they are not stale.
+    const bool LayoutChanged = BindInfo.vkPipelineLayout != Layout.GetVkPipelineLayout();
+
+    BindInfo.vkPipelineLayout      = Layout.GetVkPipelineLayout();
+    BindInfo.PushDescrSetSignIndex = Layout.GetPushDescrSetSignIndex();
 
     Uint32 TotalDynamicOffsetCount = 0;
     for (Uint32 i = 0; i < SignCount; ++i)
@@ -386,6 +413,9 @@ void DeviceContextVkImpl::SetPipelineState(IPipelineState* pPipelineState)
         SetInfo.BaseInd            = Layout.GetFirstDescrSetIndex(pSignature->GetDesc().BindingIndex);
         SetInfo.DynamicOffsetCount = pSignature->GetDynamicOffsetCount();
         TotalDynamicOffsetCount += SetInfo.DynamicOffsetCount;
+
+        if (LayoutChanged && SetInfo.DeferredDynamicSet)
+            BindInfo.StaleSRBMask |= 1u << i;
     }
 
     // Reserve space to store all dynamic buffer offsets
@@ -415,41 +445,63 @@ DeviceContextVkImpl::ResourceBindInfo& DeviceContextVkImpl::GetBindInfo(PIPELINE
     return m_BindInfo[Indices[Uint32{Type}]];
 }
 
-void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask)
+bool DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask)
 {
     VERIFY(CommitSRBMask != 0, "This method should not be called when there is nothing to commit");
 
+    if (m_DescriptorHeap)
+        return CommitDescriptorBufferSets(BindInfo, CommitSRBMask);
+
     const Uint32 FirstSign = PlatformMisc::GetLSB(CommitSRBMask);
     const Uint32 LastSign  = PlatformMisc::GetMSB(CommitSRBMask);
     VERIFY_EXPR(LastSign < m_pPipelineState->GetResourceSignatureCount());
+    VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
 
-    // Bind all descriptor sets in a single BindDescriptorSets call
-    uint32_t     DynamicOffsetCount = 0;
-    uint32_t     TotalSetCount      = 0;
-    const Uint32 FirstSetToBind     = BindInfo.SetInfo[FirstSign].BaseInd;
+    // Bind all descriptor sets in a single BindDescriptorSets call.
+    // The only exception is the push descriptor set, which splits the range into two calls.
+    uint32_t DynamicOffsetCount = 0;
+    uint32_t FirstDynamicOffset = 0;
+    uint32_t TotalSetCount      = 0;
+    Uint32   FirstSetToBind     = BindInfo.SetInfo[FirstSign].BaseInd;
     for (Uint32 sign = FirstSign; sign <= LastSign; ++sign)
     {
         ResourceBindInfo::DescriptorSetInfo& SetInfo = BindInfo.SetInfo[sign];
-        VERIFY(SetInfo.vkSets[0] != VK_NULL_HANDLE || (CommitSRBMask & (1u << sign)) == 0,
+
+        const bool HasDescriptorSets = SetInfo.vkSets[0] != VK_NULL_HANDLE || SetInfo.DeferredDynamicSet;
+        VERIFY(HasDescriptorSets || (CommitSRBMask & (1u << sign)) == 0,
                "At least one descriptor set in the stale SRB must not be NULL. Empty SRBs should not be marked as stale by CommitShaderResources()");
 
-        VERIFY((BindInfo.ActiveSRBMask & (1u << sign)) != 0 || SetInfo.vkSets[0] == VK_NULL_HANDLE, "Descriptor sets must be null for inactive slots");
-        if (SetInfo.vkSets[0] == VK_NULL_HANDLE)
+        VERIFY((BindInfo.ActiveSRBMask & (1u << sign)) != 0 || !HasDescriptorSets, "Descriptor sets must be null for inactive slots");
+        if (!HasDescriptorSets)
         {
             VERIFY_EXPR(SetInfo.vkSets[1] == VK_NULL_HANDLE);
             continue;
         }
 
+        const ShaderResourceCacheVk* pResourceCache = BindInfo.ResourceCaches[sign];
+        DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at binding index ", sign, " is null, but corresponding descriptor set is not");
+
+        // The dynamic set is always the last one
+        const Uint32 NumSets        = pResourceCache->GetNumDescriptorSets();
+        const bool   PushDynamicSet = sign == BindInfo.PushDescrSetSignIndex;
+        VERIFY(!PushDynamicSet || SetInfo.DeferredDynamicSet, "The SRB must defer the dynamic descriptor set to be pushed");
+        if (SetInfo.DeferredDynamicSet && !PushDynamicSet && SetInfo.vkSets[NumSets - 1] == VK_NULL_HANDLE)
+        {
+            // The current pipeline layout does not push this set - allocate it now
+            const PipelineResourceSignatureVkImpl* pSignature = m_pPipelineState->GetResourceSignature(sign);
+            SetInfo.vkSets[NumSets - 1]                       = CommitDynamicDescriptorSet(*pSignature, *pResourceCache);
+        }
+
         VERIFY_EXPR(SetInfo.BaseInd >= FirstSetToBind + TotalSetCount);
         while (FirstSetToBind + TotalSetCount < SetInfo.BaseInd)
             m_DescriptorSets[TotalSetCount++] = VK_NULL_HANDLE;
 
-        const ShaderResourceCacheVk* pResourceCache = BindInfo.ResourceCaches[sign];
-        DEV_CHECK_ERR(pResourceCache != nullptr, "Resource cache at binding index ", sign, " is null, but corresponding descriptor set is not");
-
-        m_DescriptorSets[TotalSetCount++] = SetInfo.vkSets[0];
-        if (SetInfo.vkSets[1] != VK_NULL_HANDLE)
-            m_DescriptorSets[TotalSetCount++] = SetInfo.vkSets[1];
+        const Uint32 NumSetsToBind = PushDynamicSet ? NumSets - 1 : NumSets;
+        for (Uint32 s = 0; s < NumSetsToBind; ++s)
+        {
+            VERIFY_EXPR(SetInfo.vkSets[s] != VK_NULL_HANDLE);
+            m_DescriptorSets[TotalSetCount++] = SetInfo.vkSets[s];
+        }
 
         if (SetInfo.DynamicOffsetCount > 0)
         {
@@ -461,6 +513,30 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
             DynamicOffsetCount += SetInfo.DynamicOffsetCount;
         }
 
+        if (PushDynamicSet)
+        {
+            // Push descriptor sets can't be bound with vkCmdBindDescriptorSets, so bind the sets collected so far.
+            // Push descriptor sets do not have dynamic offsets, so all offsets belong to these sets.
+            if (TotalSetCount > 0)
+            {
+                m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, TotalSetCount,
+                                                   m_DescriptorSets.data(), DynamicOffsetCount - FirstDynamicOffset, m_DynamicBufferOffsets.data() + FirstDynamicOffset);
+            }
+
+            const Uint32 PushSetIndex = SetInfo.BaseInd + NumSetsToBind;
+            // Binding other descriptor sets with a compatible pipeline layout does not disturb the pushed descriptors,
+            // so they only need to be pushed again when the SRB is committed.
+            if ((BindInfo.StaleSRBMask & (1u << sign)) != 0)
+            {
+                const PipelineResourceSignatureVkImpl* pSignature = m_pPipelineState->GetResourceSignature(sign);
+                pSignature->PushDynamicResources(*pResourceCache, m_CommandBuffer, m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, PushSetIndex);
+            }
+
+            FirstSetToBind     = PushSetIndex + 1;
+            TotalSetCount      = 0;
+            FirstDynamicOffset = DynamicOffsetCount;
+        }
+
 #ifdef DILIGENT_DEVELOPMENT
         SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
 #endif
@@ -474,11 +550,114 @@ void DeviceContextVkImpl::CommitDescriptorSets(ResourceBindInfo& BindInfo, Uint3
     // (either compute or graphics, according to the pipelineBindPoint). Any bindings that were previously
     // applied via these sets are no longer valid.
     // https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdBindDescriptorSets.html
-    VERIFY_EXPR(m_State.vkPipelineBindPoint != VK_PIPELINE_BIND_POINT_MAX_ENUM);
-    m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, TotalSetCount,
-                                       m_DescriptorSets.data(), DynamicOffsetCount, m_DynamicBufferOffsets.data());
+    if (TotalSetCount > 0)
+    {
+        m_CommandBuffer.BindDescriptorSets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, FirstSetToBind, TotalSetCount,
+                                           m_DescriptorSets.data(), DynamicOffsetCount - FirstDynamicOffset, m_DynamicBufferOffsets.data() + FirstDynamicOffset);
+    }
 
     BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
+
+    return true;
+}
+
+bool DeviceContextVkImpl::CommitDescriptorBufferSets(ResourceBindInfo& BindInfo, Uint32 CommitSRBMask)
+{
+    const VulkanUtilities::LogicalDevice& LogicalDevice = m_pDevice->GetLogicalDevice();
+    VulkanDynamicMemoryManager*           pDescrMemMgr  = m_pDevice->GetDescriptorMemoryManager();
+    VERIFY_EXPR(pDescrMemMgr != nullptr);
+
+    if (!m_State.DescriptorBufferBound)
+    {
+        // There is a single descriptor buffer shared by all contexts, so it only needs
+        // to be bound once per command buffer.
+        VkDescriptorBufferBindingInfoEXT BindingInfo{};
+        BindingInfo.sType   = VK_STRUCTURE_TYPE_DESCRIPTOR_BUFFER_BINDING_INFO_EXT;
+        BindingInfo.address = pDescrMemMgr->GetVkDeviceAddress();
+        BindingInfo.usage   = pDescrMemMgr->GetUsage();
+        m_CommandBuffer.BindDescriptorBuffers(1, &BindingInfo);
+        m_State.DescriptorBufferBound = true;
+    }
+
+    const Uint32 DescrBufferOffsetAlignment = static_cast<Uint32>(m_pDevice->GetPhysicalDevice().GetExtProperties().DescriptorBuffer.descriptorBufferOffsetAlignment);
+
+    while (CommitSRBMask != 0)
+    {
+        const Uint32 sign = PlatformMisc::GetLSB(CommitSRBMask);
+        CommitSRBMask &= ~(1u << sign);
+        VERIFY_EXPR(sign < m_pPipelineState->GetResourceSignatureCount());
+
+        const ShaderResourceCacheVk* pResourceCache = BindInfo.ResourceCaches[sign];
+        if (pResourceCache == nullptr || pResourceCache->GetNumDescriptorSets() == 0)
+            continue;
+
+        const PipelineResourceSignatureVkImpl* pSignature = m_pPipelineState->GetResourceSignature(sign);
+        ResourceBindInfo::DescriptorSetInfo&   SetInfo    = BindInfo.SetInfo[sign];
+
+        const Uint32 NumSets = pResourceCache->GetNumDescriptorSets();
+        VERIFY_EXPR(NumSets <= MAX_DESCR_SET_PER_SIGNATURE);
+
+        std::array<uint32_t, MAX_DESCR_SET_PER_SIGNATURE>     BufferIndices = {};
+        std::array<VkDeviceSize, MAX_DESCR_SET_PER_SIGNATURE> Offsets       = {};
+        for (Uint32 s = 0; s < NumSets; ++s)
+        {
+            // Static and mutable resources are written to the persistent descriptor buffer memory when they are bound
+            const VkDeviceSize PersistentOffset = pResourceCache->GetPersistentDescriptorBufferOffset(s);
+            if (PersistentOffset != ShaderResourceCacheVk::InvalidDescriptorBufferOffset)
+            {
+                Offsets[s] = PersistentOffset;
+                continue;
+            }
+
+            const ShaderResourceCacheVk::DescriptorBufferSetLayout& SetLayout = pSignature->GetDescriptorBufferSetLayout(s);
+
+            VulkanDynamicAllocation Allocation = m_DescriptorHeap->Allocate(StaticCast<Uint32>(SetLayout.Size), DescrBufferOffsetAlignment);
+            if (!Allocation)
+            {
+                // Do not clear the stale SRB mask so that the sets are written again by the next command
+                LOG_ERROR_MESSAGE("Failed to allocate ", SetLayout.Size, " bytes in the descriptor buffer for resource signature '", pSignature->GetDesc().Name,
+                                  "'. The command will be skipped. Increase EngineVkCreateInfo::DynamicHeapSize.");
+                return false;
+            }
+            VERIFY_EXPR(Allocation.pDynamicMemMgr == pDescrMemMgr);
+
+            pResourceCache->WriteDescriptorBufferData(s, SetLayout, LogicalDevice, this, pDescrMemMgr->GetCPUAddress() + Allocation.AlignedOffset);
+            Offsets[s] = Allocation.AlignedOffset;
+        }
+
+        // Descriptor buffer offsets are not disturbed by binding a pipeline with a compatible layout,
+        // similar to descriptor sets.
+        m_CommandBuffer.SetDescriptorBufferOffsets(m_State.vkPipelineBindPoint, BindInfo.vkPipelineLayout, SetInfo.BaseInd, NumSets,
+                                                   BufferIndices.data(), Offsets.data());
+#ifdef DILIGENT_DEVELOPMENT
+        SetInfo.LastBoundBaseInd = SetInfo.BaseInd;
+#endif
+    }
+
+    BindInfo.StaleSRBMask &= ~BindInfo.ActiveSRBMask;
+
+    return true;
+}
+
+VkDescriptorSet DeviceContextVkImpl::CommitDynamicDescriptorSet(const PipelineResourceSignatureVkImpl& Signature, const ShaderResourceCacheVk& ResourceCache)
+{
+    const VkDescriptorSetLayout vkLayout = Signature.GetVkDescriptorSetLayout(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC);
+
+    const char* DynamicDescrSetName = "Dynamic Descriptor Set";
+#ifdef DILIGENT_DEVELOPMENT
+    String _DynamicDescrSetName{DynamicDescrSetName};
+    _DynamicDescrSetName.append(" (");
+    _DynamicDescrSetName.append(Signature.GetDesc().Name);
+    _DynamicDescrSetName += ')';
+    DynamicDescrSetName = _DynamicDescrSetName.c_str();
+#endif
+    // Allocate vulkan descriptor set for dynamic resources
+    VkDescriptorSet vkDynamicDescrSet = AllocateDynamicDescriptorSet(vkLayout, DynamicDescrSetName);
+
+    // Write all dynamic resource descriptors
+    Signature.CommitDynamicResources(ResourceCache, vkDynamicDescrSet);
+
+    return vkDynamicDescrSet;
 }
 
 #ifdef DILIGENT_DEVELOPMENT
@@ -500,8 +679,11 @@ void DeviceContextVkImpl::DvpValidateCommittedShaderResources(ResourceBindInfo&
 
         const ResourceBindInfo::DescriptorSetInfo& SetInfo = BindInfo.SetInfo[i];
         const Uint32                               DSCount = pSign->GetNumDescriptorSets();
-        for (Uint32 s = 0; s < DSCount; ++s)
+        for (Uint32 s = 0; s < DSCount && !m_DescriptorHeap; ++s)
         {
+            if (i == BindInfo.PushDescrSetSignIndex && s == DSCount - 1)
+                continue; // The dynamic set is pushed
+
             DEV_CHECK_ERR(SetInfo.vkSets[s] != VK_NULL_HANDLE,
                           "descriptor set with index ", s, " is not bound for resource signature '",
                           pSign->GetDesc().Name, "', binding index ", i, ".");
@@ -527,7 +709,15 @@ void DeviceContextVkImpl::TransitionShaderResources(IShaderResourceBinding* pSha
     ShaderResourceBindingVkImpl* pResBindingVkImpl = ClassPtrCast<ShaderResourceBindingVkImpl>(pShaderResourceBinding);
     ShaderResourceCacheVk&       ResourceCache     = pResBindingVkImpl->GetResourceCache();
 
-    ResourceCache.TransitionResources<false>(this);
+    TransitionSRBResources(ResourceCache);
+}
+
+void DeviceContextVkImpl::TransitionSRBResources(ShaderResourceCacheVk& ResourceCache)
+{
+    if (ResourceCache.TransitionResources<false>(this))
+        ++m_Stats.ShaderResourceTransitions;
+    else
+        ++m_Stats.SkippedShaderResourceTransitions;
 }
 
 void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderResourceBinding, RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
@@ -548,7 +738,7 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
 
     if (StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_TRANSITION)
     {
-        ResourceCache.TransitionResources<false>(this);
+        TransitionSRBResources(ResourceCache);
     }
 #ifdef DILIGENT_DEVELOPMENT
     else if (StateTransitionMode == RESOURCE_STATE_TRANSITION_MODE_VERIFY)
@@ -565,7 +755,14 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
     BindInfo.Set(SRBIndex, pResBindingVkImpl);
     // We must not clear entire ResInfo as DescriptorSetBaseInd and DynamicOffsetCount
     // are set by SetPipelineState().
-    SetInfo.vkSets = {};
+    SetInfo.vkSets             = {};
+    SetInfo.DeferredDynamicSet = false;
+
+    if (m_DescriptorHeap)
+    {
+        // Descriptor buffer offsets are set by CommitDescriptorSets()
+        return;
+    }
 
     Uint32 DSIndex = 0;
     if (pSignature->HasDescriptorSet(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE))
@@ -582,24 +779,16 @@ void DeviceContextVkImpl::CommitShaderResources(IShaderResourceBinding* pShaderR
         VERIFY_EXPR(DSIndex == pSignature->GetDescriptorSetIndex<PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC>());
         VERIFY_EXPR(const_cast<const ShaderResourceCacheVk&>(ResourceCache).GetDescriptorSet(DSIndex).GetVkDescriptorSet() == VK_NULL_HANDLE);
 
-        const VkDescriptorSetLayout vkLayout = pSignature->GetVkDescriptorSetLayout(PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC);
-
-        VkDescriptorSet vkDynamicDescrSet   = VK_NULL_HANDLE;
-        const char*     DynamicDescrSetName = "Dynamic Descriptor Set";
-#ifdef DILIGENT_DEVELOPMENT
-        String _DynamicDescrSetName{DynamicDescrSetName};
-        _DynamicDescrSetName.append(" (");
-        _DynamicDescrSetName.append(pSignature->GetDesc().Name);
-        _DynamicDescrSetName += ')';
-        DynamicDescrSetName = _DynamicDescrSetName.c_str();
-#endif
-        // Allocate vulkan descriptor set for dynamic resources
-        vkDynamicDescrSet = AllocateDynamicDescriptorSet(vkLayout, DynamicDescrSetName);
-
-        // Write all dynamic resource descriptors
-        pSignature->CommitDynamicResources(ResourceCache, vkDynamicDescrSet);
-
-        SetInfo.vkSets[DSIndex] = vkDynamicDescrSet;
+        if (pSignature->SupportsPushDescriptors())
+        {
+            // Whether the set is pushed depends on the pipeline layout, which may not be known yet.
+            // CommitDescriptorSets() will either push the set or allocate it.
+            SetInfo.DeferredDynamicSet = true;
+        }
+        else
+        {
+            SetInfo.vkSets[DSIndex] = CommitDynamicDescriptorSet(*pSignature, ResourceCache);
+        }
         ++DSIndex;
     }
 
@@ -723,7 +912,7 @@ void DeviceContextVkImpl::DvpLogRenderPass_PSOMismatch()
     LOG_ERROR_MESSAGE(ss.str());
 }
 
-void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
+bool DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
 {
     if (m_vkFramebuffer == VK_NULL_HANDLE && !m_DynamicRenderingInfo && m_State.NullRenderTargets)
     {
@@ -733,6 +922,9 @@ void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
     }
 
 #ifdef DILIGENT_DEVELOPMENT
+    DEV_CHECK_ERR(m_vkSubpassContents == VK_SUBPASS_CONTENTS_INLINE,
+                  "Draw commands can't be recorded inside a render pass begun with BeginSecondaryRenderPass(). "
+                  "Record them into secondary command lists and execute the lists with ExecuteCommandLists().");
     DvpVerifyRenderTargets();
     VERIFY((m_vkRenderPass != VK_NULL_HANDLE && m_vkFramebuffer != VK_NULL_HANDLE) || m_DynamicRenderingInfo, "No render pass is active while executing draw command");
 #endif
@@ -744,6 +936,11 @@ void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
         CommitVkVertexBuffers();
     }
 
+    if (!m_State.DynamicStatesUpToDate && m_pPipelineState->GetGraphicsPipelineDesc().DynamicStates != PIPELINE_DYNAMIC_STATE_FLAG_NONE)
+    {
+        CommitDynamicStates();
+    }
+
 #ifdef DILIGENT_DEVELOPMENT
     if ((Flags & DRAW_FLAG_VERIFY_STATES) != 0)
     {
@@ -763,7 +960,8 @@ void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
     // calls we do not need to bind the sets again.
     if (Uint32 CommitMask = BindInfo.GetCommitMask(Flags & DRAW_FLAG_DYNAMIC_RESOURCE_BUFFERS_INTACT))
     {
-        CommitDescriptorSets(BindInfo, CommitMask);
+        if (!CommitDescriptorSets(BindInfo, CommitMask))
+            return false;
     }
 #ifdef DILIGENT_DEVELOPMENT
     // Must be called after CommitDescriptorSets as it needs SetInfo.BaseInd
@@ -785,6 +983,8 @@ void DeviceContextVkImpl::PrepareForDraw(DRAW_FLAGS Flags)
 
         CommitRenderPassAndFramebuffer((Flags & DRAW_FLAG_VERIFY_STATES) != 0);
     }
+
+    return true;
 }
 
 BufferVkImpl* DeviceContextVkImpl::PrepareIndirectAttribsBuffer(IBuffer*                       pAttribsBuffer,
@@ -805,9 +1005,10 @@ BufferVkImpl* DeviceContextVkImpl::PrepareIndirectAttribsBuffer(IBuffer*
     return pIndirectDrawAttribsVk;
 }
 
-void DeviceContextVkImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE IndexType)
+bool DeviceContextVkImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE IndexType)
 {
-    PrepareForDraw(Flags);
+    if (!PrepareForDraw(Flags))
+        return false;
 
 #ifdef DILIGENT_DEVELOPMENT
     if ((Flags & DRAW_FLAG_VERIFY_STATES) != 0)
@@ -818,13 +1019,16 @@ void DeviceContextVkImpl::PrepareForIndexedDraw(DRAW_FLAGS Flags, VALUE_TYPE Ind
     DEV_CHECK_ERR(IndexType == VT_UINT16 || IndexType == VT_UINT32, "Unsupported index format. Only R16_UINT and R32_UINT are allowed.");
     VkIndexType vkIndexType = TypeToVkIndexType(IndexType);
     m_CommandBuffer.BindIndexBuffer(m_pIndexBuffer->GetVkBuffer(), m_IndexDataStartOffset + GetDynamicBufferOffset(m_pIndexBuffer), vkIndexType);
+
+    return true;
 }
 
 void DeviceContextVkImpl::Draw(const DrawAttribs& Attribs)
 {
     TDeviceContextBase::Draw(Attribs, 0);
 
-    PrepareForDraw(Attribs.Flags);
+    if (!PrepareForDraw(Attribs.Flags))
+        return;
 
     if (Attribs.NumVertices > 0 && Attribs.NumInstances > 0)
     {
@@ -837,7 +1041,8 @@ void DeviceContextVkImpl::MultiDraw(const MultiDrawAttribs& Attribs)
 {
     TDeviceContextBase::MultiDraw(Attribs, 0);
 
-    PrepareForDraw(Attribs.Flags);
+    if (!PrepareForDraw(Attribs.Flags))
+        return;
 
     if (Attribs.NumInstances == 0)
         return;
@@ -880,7 +1085,8 @@ void DeviceContextVkImpl::DrawIndexed(const DrawIndexedAttribs& Attribs)
 {
     TDeviceContextBase::DrawIndexed(Attribs, 0);
 
-    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+    if (!PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType))
+        return;
 
     if (Attribs.NumIndices > 0 && Attribs.NumInstances > 0)
     {
@@ -893,7 +1099,8 @@ void DeviceContextVkImpl::MultiDrawIndexed(const MultiDrawIndexedAttribs& Attrib
 {
     TDeviceContextBase::MultiDrawIndexed(Attribs, 0);
 
-    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+    if (!PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType))
+        return;
 
     if (Attribs.NumInstances == 0)
         return;
@@ -943,7 +1150,8 @@ void DeviceContextVkImpl::DrawIndirect(const DrawIndirectAttribs& Attribs)
         PrepareIndirectAttribsBuffer(Attribs.pCounterBuffer, Attribs.CounterBufferStateTransitionMode, "Count buffer (DeviceContextVkImpl::DrawIndirect)") :
         nullptr;
 
-    PrepareForDraw(Attribs.Flags);
+    if (!PrepareForDraw(Attribs.Flags))
+        return;
 
     if (Attribs.DrawCount > 0)
     {
@@ -978,7 +1186,8 @@ void DeviceContextVkImpl::DrawIndexedIndirect(const DrawIndexedIndirectAttribs&
         PrepareIndirectAttribsBuffer(Attribs.pCounterBuffer, Attribs.CounterBufferStateTransitionMode, "Count buffer (DeviceContextVkImpl::DrawIndexedIndirect)") :
         nullptr;
 
-    PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType);
+    if (!PrepareForIndexedDraw(Attribs.Flags, Attribs.IndexType))
+        return;
 
     if (Attribs.DrawCount > 0)
     {
@@ -1006,7 +1215,8 @@ void DeviceContextVkImpl::DrawMesh(const DrawMeshAttribs& Attribs)
 {
     TDeviceContextBase::DrawMesh(Attribs, 0);
 
-    PrepareForDraw(Attribs.Flags);
+    if (!PrepareForDraw(Attribs.Flags))
+        return;
 
     if (Attribs.ThreadGroupCountX > 0 && Attribs.ThreadGroupCountY > 0 && Attribs.ThreadGroupCountZ > 0)
     {
@@ -1026,7 +1236,8 @@ void DeviceContextVkImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attrib
         PrepareIndirectAttribsBuffer(Attribs.pCounterBuffer, Attribs.CounterBufferStateTransitionMode, "Counter buffer (DeviceContextVkImpl::DrawMeshIndirect)") :
         nullptr;
 
-    PrepareForDraw(Attribs.Flags);
+    if (!PrepareForDraw(Attribs.Flags))
+        return;
 
     if (Attribs.CommandCount > 0)
     {
@@ -1051,7 +1262,7 @@ void DeviceContextVkImpl::DrawMeshIndirect(const DrawMeshIndirectAttribs& Attrib
     ++m_State.NumCommands;
 }
 
-void DeviceContextVkImpl::PrepareForDispatchCompute()
+bool DeviceContextVkImpl::PrepareForDispatchCompute()
 {
     EnsureVkCmdBuffer();
 
@@ -1061,36 +1272,43 @@ void DeviceContextVkImpl::PrepareForDispatchCompute()
     ResourceBindInfo& BindInfo = GetBindInfo(PIPELINE_TYPE_COMPUTE);
     if (Uint32 CommitMask = BindInfo.GetCommitMask())
     {
-        CommitDescriptorSets(BindInfo, CommitMask);
+        if (!CommitDescriptorSets(BindInfo, CommitMask))
+            return false;
     }
 
 #ifdef DILIGENT_DEVELOPMENT
     // Must be called after CommitDescriptorSets as it needs SetInfo.BaseInd
     DvpValidateCommittedShaderResources(BindInfo);
 #endif
+
+    return true;
 }
 
-void DeviceContextVkImpl::PrepareForRayTracing()
+bool DeviceContextVkImpl::PrepareForRayTracing()
 {
     EnsureVkCmdBuffer();
 
     ResourceBindInfo& BindInfo = GetBindInfo(PIPELINE_TYPE_RAY_TRACING);
     if (Uint32 CommitMask = BindInfo.GetCommitMask())
     {
-        CommitDescriptorSets(BindInfo, CommitMask);
+        if (!CommitDescriptorSets(BindInfo, CommitMask))
+            return false;
     }
 
 #ifdef DILIGENT_DEVELOPMENT
     // Must be called after CommitDescriptorSets as it needs SetInfo.BaseInd
     DvpValidateCommittedShaderResources(BindInfo);
 #endif
+
+    return true;
 }
 
 void DeviceContextVkImpl::DispatchCompute(const DispatchComputeAttribs& Attribs)
 {
     TDeviceContextBase::DispatchCompute(Attribs, 0);
 
-    PrepareForDispatchCompute();
+    if (!PrepareForDispatchCompute())
+        return;
 
     if (Attribs.ThreadGroupCountX > 0 && Attribs.ThreadGroupCountY > 0 && Attribs.ThreadGroupCountZ > 0)
     {
@@ -1103,7 +1321,8 @@ void DeviceContextVkImpl::DispatchComputeIndirect(const DispatchComputeIndirectA
 {
     TDeviceContextBase::DispatchComputeIndirect(Attribs, 0);
 
-    PrepareForDispatchCompute();
+    if (!PrepareForDispatchCompute())
+        return;
 
     BufferVkImpl* pBufferVk = ClassPtrCast<BufferVkImpl>(Attribs.pAttribsBuffer);
 
@@ -1418,6 +1637,8 @@ void DeviceContextVkImpl::FinishFrame()
     // Note: as global dynamic memory manager is hosted by the render device, the dynamic heap can
     // be destroyed before the blocks are actually returned to the global dynamic memory manager.
     m_DynamicHeap.ReleaseMasterBlocks(*m_pDevice, QueueMask);
+    if (m_DescriptorHeap)
+        m_DescriptorHeap->ReleaseMasterBlocks(*m_pDevice, QueueMask);
 
     // Dynamic descriptor set allocator returns all allocated pools to the global dynamic descriptor pool manager.
     // Note: as global pool manager is hosted by the render device, the allocator can
@@ -1482,6 +1703,7 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
     {
         CommandListVkImpl* pCmdListVk = ClassPtrCast<CommandListVkImpl>(ppCommandLists[i]);
         DEV_CHECK_ERR(pCmdListVk != nullptr, "Command list must not be null");
+        DEV_CHECK_ERR(!pCmdListVk->IsSecondary(), "Secondary command lists can only be executed inside a render pass begun with BeginSecondaryRenderPass()");
         DEV_CHECK_ERR(pCmdListVk->GetQueueId() == GetDesc().QueueId, "Command list recorded for QueueId ", pCmdListVk->GetQueueId(), ", but executed on QueueId ", GetDesc().QueueId, ".");
         DeferredCtxs.emplace_back();
         vkCmdBuffs.emplace_back();
@@ -1612,6 +1834,15 @@ void DeviceContextVkImpl::Flush(Uint32               NumCommandLists,
     }
     VERIFY_EXPR(buff_idx == vkCmdBuffs.size());
 
+    // Secondary command buffers executed by the submitted command buffer.
+    // The deferred context cmd queue mask was updated by ExecuteSecondaryCommandLists().
+    for (auto& CtxBuff : m_ExecutedSecondaryCmdBuffers)
+    {
+        DeviceContextVkImpl* pDeferredCtxVkImpl = CtxBuff.first.RawPtr<DeviceContextVkImpl>();
+        pDeferredCtxVkImpl->DisposeVkCmdBuffer(GetCommandQueueId(), CtxBuff.second, SubmittedFenceValue, VK_COMMAND_BUFFER_LEVEL_SECONDARY);
+    }
+    m_ExecutedSecondaryCmdBuffers.clear();
+
     m_State    = {};
     m_BindInfo = {};
     m_CommandBuffer.Reset();
@@ -1651,6 +1882,7 @@ void DeviceContextVkImpl::InvalidateState()
     m_vkRenderPass  = VK_NULL_HANDLE;
     m_vkFramebuffer = VK_NULL_HANDLE;
     m_DynamicRenderingInfo.reset();
+    m_DynamicState.SetMask = PIPELINE_DYNAMIC_STATE_FLAG_NONE;
 
     VERIFY(!m_CommandBuffer.IsInRenderScope(), "Invalidating context with unfinished render pass");
     m_CommandBuffer.Reset();
@@ -1780,6 +2012,187 @@ void DeviceContextVkImpl::SetScissorRects(Uint32 NumRects, const Rect* pRects, U
     }
 }
 
+void DeviceContextVkImpl::SetCullMode(CULL_MODE CullMode)
+{
+    DEV_CHECK_ERR(CullMode > CULL_MODE_UNDEFINED && CullMode < CULL_MODE_NUM_MODES, "Invalid cull mode");
+    m_DynamicState.Values.CullMode = CullMode;
+    m_DynamicState.SetMask |= PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE;
+    m_State.DynamicStatesUpToDate = false;
+}
+
+void DeviceContextVkImpl::SetFrontFace(Bool FrontCounterClockwise)
+{
+    m_DynamicState.Values.FrontCounterClockwise = FrontCounterClockwise;
+    m_DynamicState.SetMask |= PIPELINE_DYNAMIC_STATE_FLAG_FRONT_FACE;
+    m_State.DynamicStatesUpToDate = false;
+}
+
+void DeviceContextVkImpl::SetPrimitiveTopology(PRIMITIVE_TOPOLOGY Topology)
+{
+    DEV_CHECK_ERR(Topology > PRIMITIVE_TOPOLOGY_UNDEFINED && Topology < PRIMITIVE_TOPOLOGY_NUM_TOPOLOGIES, "Invalid primitive topology");
+    m_DynamicState.Values.Topology = Topology;
+    m_DynamicState.SetMask |= PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY;
+    m_State.DynamicStatesUpToDate = false;
+}
+
+void DeviceContextVkImpl::SetDepthTestEnable(Bool DepthEnable)
+{
+    m_DynamicState.Values.DepthEnable = DepthEnable;
+    m_DynamicState.SetMask |= PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_TEST;
+    m_State.DynamicStatesUpToDate = false;
+}
+
+void DeviceContextVkImpl::SetDepthWriteEnable(Bool DepthWriteEnable)
+{
+    m_DynamicState.Values.DepthWriteEnable = DepthWriteEnable;
+    m_DynamicState.SetMask |= PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_WRITE;
+    m_State.DynamicStatesUpToDate = false;
+}
+
+void DeviceContextVkImpl::SetDepthFunc(COMPARISON_FUNCTION DepthFunc)
+{
+    DEV_CHECK_ERR(DepthFunc > COMPARISON_FUNC_UNKNOWN && DepthFunc < COMPARISON_FUNC_NUM_FUNCTIONS, "Invalid depth comparison function");
+    m_DynamicState.Values.DepthFunc = DepthFunc;
+    m_DynamicState.SetMask |= PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_FUNC;
+    m_State.DynamicStatesUpToDate = false;
+}
+
+void DeviceContextVkImpl::SetStencilOp(const StencilOpDesc& FrontFace, const StencilOpDesc& BackFace)
+{
+    m_DynamicState.Values.FrontStencilOp = FrontFace;
+    m_DynamicState.Values.BackStencilOp  = BackFace;
+    m_DynamicState.SetMask |= PIPELINE_DYNAMIC_STATE_FLAG_STENCIL_OP;
+    m_State.DynamicStatesUpToDate = false;
+}
+
+void DeviceContextVkImpl::CommitDynamicStates()
+{
+    VERIFY_EXPR(m_pPipelineState);
+    const GraphicsPipelineDesc& GrPipeline = m_pPipelineState->GetGraphicsPipelineDesc();
+
+    const DynamicStateValues& Requested = m_DynamicState.Values;
+    DynamicStateValues&       Committed = m_CommittedDynamicState;
+
+    for (PIPELINE_DYNAMIC_STATE_FLAGS Flags = GrPipeline.DynamicStates; Flags != PIPELINE_DYNAMIC_STATE_FLAG_NONE;)
+    {
+        const PIPELINE_DYNAMIC_STATE_FLAGS Flag = ExtractLSB(Flags);
+
+        // States that have not been set by the application use the values from the pipeline description.
+        // Commands are only recorded when the value differs from the one already set in the command buffer.
+        const bool UseRequested = (m_DynamicState.SetMask & Flag) != 0;
+        const bool IsCommitted  = (m_State.CommittedDynamicStates & Flag) != 0;
+
+        static_assert(PIPELINE_DYNAMIC_STATE_FLAG_LAST == 0x40, "Please handle the new dynamic state flag below");
+        switch (Flag)
+        {
+            case PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE:
+            {
+                const CULL_MODE CullMode = UseRequested ? Requested.CullMode : GrPipeline.RasterizerDesc.CullMode;
+                if (!IsCommitted || Committed.CullMode != CullMode)
+                {
+                    m_CommandBuffer.SetCullMode(CullModeToVkCullMode(CullMode));
+                    Committed.CullMode = CullMode;
+                }
+                break;
+            }
+
+            case PIPELINE_DYNAMIC_STATE_FLAG_FRONT_FACE:
+            {
+                const Bool FrontCCW = UseRequested ? Requested.FrontCounterClockwise : GrPipeline.RasterizerDesc.FrontCounterClockwise;
+                if (!IsCommitted || Committed.FrontCounterClockwise != FrontCCW)
+                {
+                    m_CommandBuffer.SetFrontFace(FrontCCW ? VK_FRONT_FACE_COUNTER_CLOCKWISE : VK_FRONT_FACE_CLOCKWISE);
+                    Committed.FrontCounterClockwise = FrontCCW;
+                }
+                break;
+            }
+
+            case PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY:
+            {
+                const PRIMITIVE_TOPOLOGY Topology = UseRequested ? Requested.Topology : GrPipeline.PrimitiveTopology;
+                if (!IsCommitted || Committed.Topology != Topology)
+                {
+                    VkPrimitiveTopology vkTopology         = VK_PRIMITIVE_TOPOLOGY_MAX_ENUM;
+                    uint32_t            PatchControlPoints = 0;
+                    PrimitiveTopology_To_VkPrimitiveTopologyAndPatchCPCount(Topology, vkTopology, PatchControlPoints);
+                    DEV_CHECK_ERR(PatchControlPoints == 0 || Topology == GrPipeline.PrimitiveTopology,
+                                  "The number of patch control points is not a dynamic state and must match the pipeline topology");
+                    m_CommandBuffer.SetPrimitiveTopology(vkTopology);
+                    Committed.Topology = Topology;
+                }
+                break;
+            }
+
+            case PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_TEST:
+            {
+                const Bool DepthEnable = UseRequested ? Requested.DepthEnable : GrPipeline.DepthStencilDesc.DepthEnable;
+                if (!IsCommitted || Committed.DepthEnable != DepthEnable)
+                {
+                    m_CommandBuffer.SetDepthTestEnable(DepthEnable ? VK_TRUE : VK_FALSE);
+                    Committed.DepthEnable = DepthEnable;
+                }
+                break;
+            }
+
+            case PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_WRITE:
+            {
+                const Bool DepthWriteEnable = UseRequested ? Requested.DepthWriteEnable : GrPipeline.DepthStencilDesc.DepthWriteEnable;
+                if (!IsCommitted || Committed.DepthWriteEnable != DepthWriteEnable)
+                {
+                    m_CommandBuffer.SetDepthWriteEnable(DepthWriteEnable ? VK_TRUE : VK_FALSE);
+                    Committed.DepthWriteEnable = DepthWriteEnable;
+                }
+                break;
+            }
+
+            case PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_FUNC:
+            {
+                const COMPARISON_FUNCTION DepthFunc = UseRequested ? Requested.DepthFunc : GrPipeline.DepthStencilDesc.DepthFunc;
+                if (!IsCommitted || Committed.DepthFunc != DepthFunc)
+                {
+                    m_CommandBuffer.SetDepthCompareOp(ComparisonFuncToVkCompareOp(DepthFunc));
+                    Committed.DepthFunc = DepthFunc;
+                }
+                break;
+            }
+
+            case PIPELINE_DYNAMIC_STATE_FLAG_STENCIL_OP:
+            {
+                const StencilOpDesc& FrontOp = UseRequested ? Requested.FrontStencilOp : GrPipeline.DepthStencilDesc.FrontFace;
+                const StencilOpDesc& BackOp  = UseRequested ? Requested.BackStencilOp : GrPipeline.DepthStencilDesc.BackFace;
+                if (!IsCommitted || Committed.FrontStencilOp != FrontOp || Committed.BackStencilOp != BackOp)
+                {
+                    auto SetStencilOp = [this](VkStencilFaceFlags FaceMask, const StencilOpDesc& Op) {
+                        m_CommandBuffer.SetStencilOp(FaceMask,
+                                                     StencilOpToVkStencilOp(Op.StencilFailOp),
+                                                     StencilOpToVkStencilOp(Op.StencilPassOp),
+                                                     StencilOpToVkStencilOp(Op.StencilDepthFailOp),
+                                                     ComparisonFuncToVkCompareOp(Op.StencilFunc));
+                    };
+                    if (FrontOp == BackOp)
+                    {
+                        SetStencilOp(VK_STENCIL_FACE_FRONT_AND_BACK, FrontOp);
+                    }
+                    else
+                    {
+                        SetStencilOp(VK_STENCIL_FACE_FRONT_BIT, FrontOp);
+                        SetStencilOp(VK_STENCIL_FACE_BACK_BIT, BackOp);
+                    }
+                    Committed.FrontStencilOp = FrontOp;
+                    Committed.BackStencilOp  = BackOp;
+                }
+                break;
+            }
+
+            default:
+                UNEXPECTED("Unexpected dynamic state flag");
+        }
+    }
+
+    m_State.CommittedDynamicStates |= GrPipeline.DynamicStates;
+    m_State.DynamicStatesUpToDate = true;
+}
+
 
 void DeviceContextVkImpl::TransitionRenderTargets(RESOURCE_STATE_TRANSITION_MODE StateTransitionMode)
 {
@@ -2017,6 +2430,19 @@ void DeviceContextVkImpl::ResetRenderTargets()
 
 void DeviceContextVkImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
 {
+    BeginVkRenderPass(Attribs, VK_SUBPASS_CONTENTS_INLINE);
+}
+
+void DeviceContextVkImpl::BeginSecondaryRenderPass(const BeginRenderPassAttribs& Attribs)
+{
+    DEV_CHECK_ERR(!IsDeferred(), "Render passes with secondary command lists can only be begun by immediate contexts");
+    BeginVkRenderPass(Attribs, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+}
+
+void DeviceContextVkImpl::BeginVkRenderPass(const BeginRenderPassAttribs& Attribs, VkSubpassContents vkContents)
+{
+    DEV_CHECK_ERR(!m_IsRecordingSecondaryCmdBuffer, "Render passes can't be begun while recording a secondary command list");
+
     TDeviceContextBase::BeginRenderPass(Attribs);
 
     VERIFY_EXPR(m_pActiveRenderPass != nullptr);
@@ -2057,26 +2483,83 @@ void DeviceContextVkImpl::BeginRenderPass(const BeginRenderPassAttribs& Attribs)
     }
 
     EnsureVkCmdBuffer();
-    m_CommandBuffer.BeginRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight, Attribs.ClearValueCount, pVkClearValues);
+    m_CommandBuffer.BeginRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight, Attribs.ClearValueCount, pVkClearValues, vkContents);
+    m_vkSubpassContents = vkContents;
 
-    // Set the viewport to match the framebuffer size
-    SetViewports(1, nullptr, 0, 0);
+    if (vkContents == VK_SUBPASS_CONTENTS_INLINE)
+    {
+        // Set the viewport to match the framebuffer size.
+        // Secondary command buffers set their own viewports, and no other commands
+        // may be recorded into the primary command buffer inside the render pass.
+        SetViewports(1, nullptr, 0, 0);
+    }
 
     m_State.ShadingRateIsSet = false;
 }
 
 void DeviceContextVkImpl::NextSubpass()
 {
+    DEV_CHECK_ERR(!m_IsRecordingSecondaryCmdBuffer, "NextSubpass() can't be called while recording a secondary command list");
+
     TDeviceContextBase::NextSubpass();
     VERIFY_EXPR(m_CommandBuffer.GetVkCmdBuffer() != VK_NULL_HANDLE && m_CommandBuffer.GetState().RenderPass != VK_NULL_HANDLE);
-    m_CommandBuffer.NextSubpass();
+    m_CommandBuffer.NextSubpass(m_vkSubpassContents);
 }
 
 void DeviceContextVkImpl::EndRenderPass()
 {
+    DEV_CHECK_ERR(!m_IsRecordingSecondaryCmdBuffer, "EndRenderPass() can't be called while recording a secondary command list. "
+                                                    "The render pass is ended by the immediate context that executes the command list.");
+
     TDeviceContextBase::EndRenderPass();
     // TDeviceContextBase::EndRenderPass calls ResetRenderTargets() that in turn
     // calls m_CommandBuffer.EndRenderPass()
+
+    m_vkSubpassContents = VK_SUBPASS_CONTENTS_INLINE;
+}
+
+void DeviceContextVkImpl::BeginSecondaryCommandList(const BeginSecondaryCommandListAttribsVk& Attribs)
+{
+    DEV_CHECK_ERR(IsDeferred(), "Secondary command lists can only be recorded by deferred contexts");
+    DEV_CHECK_ERR(Attribs.pRenderPass != nullptr, "Render pass must not be null");
+    DEV_CHECK_ERR(Attribs.pFramebuffer != nullptr, "Framebuffer must not be null");
+    DEV_CHECK_ERR(Attribs.SubpassIndex < Attribs.pRenderPass->GetDesc().SubpassCount,
+                  "Subpass index (", Attribs.SubpassIndex, ") exceeds the number of subpasses (",
+                  Attribs.pRenderPass->GetDesc().SubpassCount, ") in render pass '", Attribs.pRenderPass->GetDesc().Name, "'");
+
+    Begin(Attribs.ImmediateContextId);
+    VERIFY(m_CommandBuffer.GetVkCmdBuffer() == VK_NULL_HANDLE, "No commands are expected to be recorded before the recording begins");
+
+    // Set up the render pass state as if the pass was begun by this context, but leave
+    // attachment states to the immediate context that begins the actual render pass.
+    m_pActiveRenderPass                   = ClassPtrCast<RenderPassVkImpl>(Attribs.pRenderPass);
+    m_pBoundFramebuffer                   = ClassPtrCast<FramebufferVkImpl>(Attribs.pFramebuffer);
+    m_SubpassIndex                        = Attribs.SubpassIndex;
+    m_RenderPassAttachmentsTransitionMode = RESOURCE_STATE_TRANSITION_MODE_NONE;
+    SetSubpassRenderTargets();
+
+    m_vkRenderPass  = m_pActiveRenderPass->GetVkRenderPass();
+    m_vkFramebuffer = m_pBoundFramebuffer->GetVkFramebuffer();
+
+    VkCommandBufferInheritanceInfo InheritanceInfo{};
+    InheritanceInfo.sType                = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    InheritanceInfo.pNext                = nullptr;
+    InheritanceInfo.renderPass           = m_vkRenderPass;
+    InheritanceInfo.subpass              = m_SubpassIndex;
+    InheritanceInfo.framebuffer          = m_vkFramebuffer; // Specifying the framebuffer may result in better performance
+    InheritanceInfo.occlusionQueryEnable = VK_FALSE;
+
+    VERIFY_EXPR(m_CmdPool != nullptr);
+    VkCommandBuffer vkCmdBuff = m_CmdPool->GetCommandBuffer("", &InheritanceInfo);
+    m_CommandBuffer.SetVkCmdBuffer(vkCmdBuff, m_CmdPool->GetSupportedStagesMask(), m_CmdPool->GetSupportedAccessMask());
+    m_CommandBuffer.BeginInheritedRenderPass(m_vkRenderPass, m_vkFramebuffer, m_FramebufferWidth, m_FramebufferHeight);
+    m_IsRecordingSecondaryCmdBuffer = true;
+
+    // Secondary command buffers do not inherit any state from the primary command buffer,
+    // so set the viewport to match the framebuffer size
+    SetViewports(1, nullptr, 0, 0);
+
+    m_State.ShadingRateIsSet = false;
 }
 
 void DeviceContextVkImpl::UpdateBufferRegion(BufferVkImpl*                  pBuffVk,
@@ -2332,7 +2815,8 @@ void DeviceContextVkImpl::UpdateTexture(ITexture*                      pTexture,
 
     if (SubresData.pSrcBuffer != nullptr)
     {
-        UNSUPPORTED("Copying buffer to texture is not implemented");
+        CopyTextureRegion(SubresData.pSrcBuffer, SubresData.SrcOffset, SubresData.Stride, SubresData.DepthStride, SrcBufferStateTransitionMode,
+                          *pTexVk, MipLevel, Slice, DstBox, TextureStateTransitionMode);
     }
     else
     {
@@ -2552,6 +3036,62 @@ void DeviceContextVkImpl::UpdateTextureRegion(const void*                    pSr
                         TextureTransitionMode);
 }
 
+void DeviceContextVkImpl::CopyTextureRegion(IBuffer*                       pSrcBuffer,
+                                            Uint64                         SrcOffset,
+                                            Uint64                         SrcStride,
+                                            Uint64                         SrcDepthStride,
+                                            RESOURCE_STATE_TRANSITION_MODE BufferTransitionMode,
+                                            TextureVkImpl&                 TextureVk,
+                                            Uint32                         MipLevel,
+                                            Uint32                         Slice,
+                                            const Box&                     DstBox,
+                                            RESOURCE_STATE_TRANSITION_MODE TextureTransitionMode)
+{
+    const TextureDesc& TexDesc = TextureVk.GetDesc();
+    VERIFY(TexDesc.SampleCount == 1, "Only single-sample textures can be updated with vkCmdCopyBufferToImage()");
+
+    BufferVkImpl* pBufferVk = ClassPtrCast<BufferVkImpl>(pSrcBuffer);
+
+    const TextureFormatAttribs&   FmtAttribs = GetTextureFormatAttribs(TexDesc.Format);
+    const BufferToTextureCopyInfo CopyInfo   = GetBufferToTextureCopyInfo(TexDesc.Format, DstBox, 1);
+
+    // bufferRowLength is specified in texels, and bufferImageHeight is zero, so the
+    // planes of the source data must be tightly packed (18.4)
+    Uint32 BlockSize         = 0;
+    Uint32 RowStrideInTexels = 0;
+    if (FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED)
+    {
+        BlockSize         = FmtAttribs.ComponentSize;
+        RowStrideInTexels = StaticCast<Uint32>(SrcStride / BlockSize * FmtAttribs.BlockWidth);
+    }
+    else
+    {
+        BlockSize         = Uint32{FmtAttribs.ComponentSize} * Uint32{FmtAttribs.NumComponents};
+        RowStrideInTexels = StaticCast<Uint32>(SrcStride / BlockSize);
+    }
+    DEV_CHECK_ERR(SrcStride % BlockSize == 0, "Source data stride (", SrcStride, ") must be a multiple of the texel block size (", BlockSize, ").");
+    DEV_CHECK_ERR(CopyInfo.Region.Depth() == 1 || SrcDepthStride == SrcStride * CopyInfo.RowCount,
+                  "Source data depth stride (", SrcDepthStride, ") must be equal to the image plane size (", SrcStride * CopyInfo.RowCount, ").");
+
+    // Source buffer offset must be a multiple of 4 and of the texel block size (18.4)
+    const VkDeviceSize BufferOffset = SrcOffset + GetDynamicBufferOffset(pBufferVk);
+    DEV_CHECK_ERR(BufferOffset % 4 == 0 && BufferOffset % BlockSize == 0,
+                  "Source buffer offset (", BufferOffset, ") must be a multiple of 4 and the texel block size (", BlockSize, ").");
+
+    EnsureVkCmdBuffer();
+    TransitionOrVerifyBufferState(*pBufferVk, BufferTransitionMode, RESOURCE_STATE_COPY_SOURCE, VK_ACCESS_TRANSFER_READ_BIT,
+                                  "Using buffer as copy source (DeviceContextVkImpl::CopyTextureRegion)");
+    CopyBufferToTexture(pBufferVk->GetVkBuffer(),
+                        BufferOffset,
+                        RowStrideInTexels,
+                        TextureVk,
+                        CopyInfo.Region,
+                        MipLevel,
+                        Slice,
+                        TextureTransitionMode);
+    ++m_State.NumCommands;
+}
+
 void DeviceContextVkImpl::GenerateMips(ITextureView* pTexView)
 {
     TDeviceContextBase::GenerateMips(pTexView);
@@ -2825,7 +3365,23 @@ void DeviceContextVkImpl::UnmapTextureSubresource(ITexture* pTexture,
 void DeviceContextVkImpl::FinishCommandList(ICommandList** ppCommandList)
 {
     DEV_CHECK_ERR(IsDeferred(), "Only deferred context can record command list");
-    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr, "Finishing command list inside an active render pass.");
+    DEV_CHECK_ERR(m_pActiveRenderPass == nullptr || m_IsRecordingSecondaryCmdBuffer, "Finishing command list inside an active render pass.");
+
+    VkRenderPass vkSecondaryRenderPass = VK_NULL_HANDLE;
+    Uint32       SecondarySubpassIndex = 0;
+    if (m_IsRecordingSecondaryCmdBuffer)
+    {
+        vkSecondaryRenderPass = m_vkRenderPass;
+        SecondarySubpassIndex = m_SubpassIndex;
+
+        // The render pass is ended by the primary command buffer
+        m_CommandBuffer.EndInheritedRenderPass();
+        m_pActiveRenderPass.Release();
+        m_pBoundFramebuffer.Release();
+        m_SubpassIndex                  = 0;
+        m_IsRecordingSecondaryCmdBuffer = false;
+        ResetRenderTargets();
+    }
 
     EndRenderScope();
 
@@ -2834,7 +3390,7 @@ void DeviceContextVkImpl::FinishCommandList(ICommandList** ppCommandList)
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to end command buffer");
     (void)err;
 
-    CommandListVkImpl* pCmdListVk{NEW_RC_OBJ(m_CmdListAllocator, "CommandListVkImpl instance", CommandListVkImpl)(m_pDevice, this, vkCmdBuff)};
+    CommandListVkImpl* pCmdListVk{NEW_RC_OBJ(m_CmdListAllocator, "CommandListVkImpl instance", CommandListVkImpl)(m_pDevice, this, vkCmdBuff, vkSecondaryRenderPass, SecondarySubpassIndex)};
     pCmdListVk->QueryInterface(IID_CommandList, reinterpret_cast<IObject**>(ppCommandList));
 
     m_CommandBuffer.Reset();
@@ -2856,11 +3412,67 @@ void DeviceContextVkImpl::ExecuteCommandLists(Uint32               NumCommandLis
         return;
     DEV_CHECK_ERR(ppCommandLists != nullptr, "ppCommandLists must not be null when NumCommandLists is not zero");
 
+    if (m_vkSubpassContents == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS)
+    {
+        ExecuteSecondaryCommandLists(NumCommandLists, ppCommandLists);
+        return;
+    }
+
     Flush(NumCommandLists, ppCommandLists);
 
     InvalidateState();
 }
 
+void DeviceContextVkImpl::ExecuteSecondaryCommandLists(Uint32               NumCommandLists,
+                                                       ICommandList* const* ppCommandLists)
+{
+    VERIFY_EXPR(m_pActiveRenderPass != nullptr && m_vkSubpassContents == VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+
+    std::vector<VkCommandBuffer> vkCmdBuffs;
+    vkCmdBuffs.reserve(NumCommandLists);
+    for (Uint32 i = 0; i < NumCommandLists; ++i)
+    {
+        CommandListVkImpl* pCmdListVk = ClassPtrCast<CommandListVkImpl>(ppCommandLists[i]);
+        DEV_CHECK_ERR(pCmdListVk != nullptr, "Command list must not be null");
+        DEV_CHECK_ERR(pCmdListVk->IsSecondary(), "Only secondary command lists can be executed inside a render pass begun with BeginSecondaryRenderPass()");
+        DEV_CHECK_ERR(pCmdListVk->GetQueueId() == GetDesc().QueueId, "Command list recorded for QueueId ", pCmdListVk->GetQueueId(), ", but executed on QueueId ", GetDesc().QueueId, ".");
+        DEV_CHECK_ERR(pCmdListVk->GetVkRenderPass() == m_vkRenderPass, "Command list was recorded for a different render pass than the active render pass '", m_pActiveRenderPass->GetDesc().Name, "'.");
+        DEV_CHECK_ERR(pCmdListVk->GetSubpassIndex() == m_SubpassIndex, "Command list was recorded for subpass ", pCmdListVk->GetSubpassIndex(), ", but executed in subpass ", m_SubpassIndex, ".");
+
+        RefCntAutoPtr<IDeviceContext> pDeferredCtx;
+        VkCommandBuffer               vkCmdBuff = VK_NULL_HANDLE;
+        pCmdListVk->Close(pDeferredCtx, vkCmdBuff);
+        VERIFY(vkCmdBuff != VK_NULL_HANDLE, "Trying to execute empty command buffer");
+        VERIFY_EXPR(pDeferredCtx != nullptr);
+
+        // Set the bit in the deferred context cmd queue mask now rather than in Flush(), since the deferred
+        // context may finish the frame before this context is flushed. Resources released by FinishFrame()
+        // go to the stale queues of the masked command queues and are only released after the next
+        // submission to these queues, which is the submission of the current command buffer.
+        ClassPtrCast<DeviceContextVkImpl>(pDeferredCtx.RawPtr())->UpdateSubmittedBuffersCmdQueueMask(GetCommandQueueId());
+
+        vkCmdBuffs.push_back(vkCmdBuff);
+        // The command buffers will be disposed after the current command buffer is submitted in Flush()
+        m_ExecutedSecondaryCmdBuffers.emplace_back(std::move(pDeferredCtx), vkCmdBuff);
+    }
+
+    EnsureVkCmdBuffer();
+    m_CommandBuffer.ExecuteCommands(static_cast<uint32_t>(vkCmdBuffs.size()), vkCmdBuffs.data());
+    m_State.NumCommands += NumCommandLists;
+
+    // The state of the primary command buffer is undefined after secondary command buffers are executed.
+    // Similar to Flush(), require the pipeline state and shader resources to be set again.
+    m_State.CommittedVBsUpToDate   = false;
+    m_State.CommittedIBUpToDate    = false;
+    m_State.ShadingRateIsSet       = false;
+    m_State.DescriptorBufferBound  = false;
+    m_State.DynamicStatesUpToDate  = false;
+    m_State.CommittedDynamicStates = PIPELINE_DYNAMIC_STATE_FLAG_NONE;
+    m_State.vkPipelineBindPoint    = VK_PIPELINE_BIND_POINT_MAX_ENUM;
+    m_BindInfo                     = {};
+    m_pPipelineState               = nullptr;
+}
+
 void DeviceContextVkImpl::EnqueueSignal(IFence* pFence, Uint64 Value)
 {
     TDeviceContextBase::EnqueueSignal(pFence, Value, 0);
@@ -3902,7 +4514,8 @@ void DeviceContextVkImpl::TraceRays(const TraceRaysAttribs& Attribs)
     const ShaderBindingTableVkImpl* pSBTVk       = ClassPtrCast<const ShaderBindingTableVkImpl>(Attribs.pSBT);
     const BindingTableVk&           BindingTable = pSBTVk->GetVkBindingTable();
 
-    PrepareForRayTracing();
+    if (!PrepareForRayTracing())
+        return;
     m_CommandBuffer.TraceRays(BindingTable.RaygenShader, BindingTable.MissShader, BindingTable.HitShader, BindingTable.CallableShader,
                               Attribs.DimensionX, Attribs.DimensionY, Attribs.DimensionZ);
     ++m_State.NumCommands;
@@ -3918,7 +4531,8 @@ void DeviceContextVkImpl::TraceRaysIndirect(const TraceRaysIndirectAttribs& Attr
     BufferVkImpl* const pIndirectAttribsVk = PrepareIndirectAttribsBuffer(Attribs.pAttribsBuffer, Attribs.AttribsBufferStateTransitionMode, "Trace rays indirect (DeviceContextVkImpl::TraceRaysIndirect)");
     const Uint64        IndirectBuffOffset = Attribs.ArgsByteOffset + TraceRaysIndirectCommandSBTSize;
 
-    PrepareForRayTracing();
+    if (!PrepareForRayTracing())
+        return;
     m_CommandBuffer.TraceRaysIndirect(BindingTable.RaygenShader, BindingTable.MissShader, BindingTable.HitShader, BindingTable.CallableShader,
                                       pIndirectAttribsVk->GetVkDeviceAddress() + IndirectBuffOffset);
     ++m_State.NumCommands;
@@ -1226,6 +1226,24 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 }
             }
 
+            // Descriptor update templates are used internally to commit dynamic resources
+            if (DeviceExtFeatures.DescrUpdateTemplate)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME);
+
+                EnabledExtFeats.DescrUpdateTemplate = true;
+            }
+
+            // Push descriptors are used internally to commit small dynamic descriptor sets
+            if (DeviceExtFeatures.PushDescriptor)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_PUSH_DESCRIPTOR_EXTENSION_NAME);
+
+                EnabledExtFeats.PushDescriptor = true;
+            }
+
             if (EnabledFeatures.NativeMultiDraw != DEVICE_FEATURE_STATE_DISABLED)
             {
                 VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_MULTI_DRAW_EXTENSION_NAME));
@@ -1272,6 +1290,71 @@ void EngineFactoryVkImpl::CreateDeviceAndContextsVk(const EngineVkCreateInfo& En
                 NextExt  = &EnabledExtFeats.HostImageCopy.pNext;
             }
 
+            if (EnabledFeaturesVk.DescriptorBuffer)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+
+                const uint32_t vkDeviceVersion = PhysicalDevice->GetVkVersion();
+                if (Version{VK_VERSION_MAJOR(vkDeviceVersion), VK_VERSION_MINOR(vkDeviceVersion)} < Version{1, 3})
+                {
+                    DeviceExtensions.push_back(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
+                    // VK_EXT_descriptor_indexing may have already been enabled for runtime arrays or ray tracing
+                    if (EnabledFeatures.ShaderResourceRuntimeArrays == DEVICE_FEATURE_STATE_DISABLED &&
+                        EnabledFeatures.RayTracing == DEVICE_FEATURE_STATE_DISABLED)
+                    {
+                        DeviceExtensions.push_back(VK_KHR_MAINTENANCE3_EXTENSION_NAME);
+                        DeviceExtensions.push_back(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+                    }
+                }
+
+                // Descriptors reference buffers by device address.
+                // Buffer device address may have already been enabled for ray tracing.
+                if (EnabledExtFeats.BufferDeviceAddress.bufferDeviceAddress == VK_FALSE)
+                {
+                    VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME));
+                    DeviceExtensions.push_back(VK_KHR_BUFFER_DEVICE_ADDRESS_EXTENSION_NAME);
+
+                    EnabledExtFeats.BufferDeviceAddress = DeviceExtFeatures.BufferDeviceAddress;
+
+                    *NextExt = &EnabledExtFeats.BufferDeviceAddress;
+                    NextExt  = &EnabledExtFeats.BufferDeviceAddress.pNext;
+                }
+
+                EnabledExtFeats.DescriptorBuffer = DeviceExtFeatures.DescriptorBuffer;
+
+                // disable unused features
+                EnabledExtFeats.DescriptorBuffer.descriptorBufferCaptureReplay  = VK_FALSE;
+                EnabledExtFeats.DescriptorBuffer.descriptorBufferPushDescriptors = VK_FALSE;
+
+                *NextExt = &EnabledExtFeats.DescriptorBuffer;
+                NextExt  = &EnabledExtFeats.DescriptorBuffer.pNext;
+            }
+
+            if (EnabledFeaturesVk.GraphicsPipelineLibrary)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME));
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME);
+                DeviceExtensions.push_back(VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME);
+
+                EnabledExtFeats.GraphicsPipelineLibrary = DeviceExtFeatures.GraphicsPipelineLibrary;
+
+                *NextExt = &EnabledExtFeats.GraphicsPipelineLibrary;
+                NextExt  = &EnabledExtFeats.GraphicsPipelineLibrary.pNext;
+            }
+
+            if (EnabledFeaturesVk.ExtendedDynamicState)
+            {
+                VERIFY_EXPR(PhysicalDevice->IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME));
+                DeviceExtensions.push_back(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
+
+                EnabledExtFeats.ExtendedDynamicState = DeviceExtFeatures.ExtendedDynamicState;
+
+                *NextExt = &EnabledExtFeats.ExtendedDynamicState;
+                NextExt  = &EnabledExtFeats.ExtendedDynamicState.pNext;
+            }
+
             // Append user-defined features
             *NextExt = EngineCI.pDeviceExtensionFeatures;
         }
@@ -83,8 +83,25 @@ void PipelineLayoutVk::Create(RenderDeviceVkImpl* pDeviceVk, RefCntAutoPtr<Pipel
         for (PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID SetId : {PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_STATIC_MUTABLE,
                                                                          PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC})
         {
-            if (pSignature->HasDescriptorSet(SetId))
+            if (!pSignature->HasDescriptorSet(SetId))
+                continue;
+
+            // Only one descriptor set in the pipeline layout may use push descriptors
+            // (VUID-VkPipelineLayoutCreateInfo-pSetLayouts-00293).
+            // We always select the first eligible signature so that the choice for every signature only
+            // depends on the signatures with lower binding indices. This preserves pipeline layout compatibility
+            // for the descriptor sets of compatible signatures (14.2.2. Pipeline Layouts, 'Pipeline Layout Compatibility').
+            if (SetId == PipelineResourceSignatureVkImpl::DESCRIPTOR_SET_ID_DYNAMIC &&
+                m_PushDescrSetSignIndex == InvalidPushDescrSetSignIndex &&
+                pSignature->SupportsPushDescriptors())
+            {
+                m_PushDescrSetSignIndex              = static_cast<Uint8>(BindInd);
+                DescSetLayouts[DescSetLayoutCount++] = pSignature->GetVkPushDescriptorSetLayout();
+            }
+            else
+            {
                 DescSetLayouts[DescSetLayoutCount++] = pSignature->GetVkDescriptorSetLayout(SetId);
+            }
         }
 
         DynamicUniformBufferCount += pSignature->GetDynamicUniformBufferCount();
@@ -0,0 +1,349 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "pch.h"
+
+#include "PipelineLibraryCacheVk.hpp"
+
+#include <vector>
+#include <string>
+
+#include "RenderDeviceVkImpl.hpp"
+#include "HashUtils.hpp"
+
+namespace Diligent
+{
+
+PipelineLibraryCacheVk::PipelineLibraryCacheVk(RenderDeviceVkImpl& DeviceVk, bool OptimizeLinkedPipelines) noexcept :
+    m_DeviceVkImpl{DeviceVk},
+    m_FastLinkingSupported{DeviceVk.GetPhysicalDevice().GetExtProperties().GraphicsPipelineLibrary.graphicsPipelineLibraryFastLinking != VK_FALSE},
+    m_OptimizeLinkedPipelines{OptimizeLinkedPipelines}
+{
+    if (!m_FastLinkingSupported)
+        LOG_INFO_MESSAGE("The device does not support fast linking of graphics pipeline libraries. Pipelines will be linked with optimization.");
+}
+
+PipelineLibraryCacheVk::~PipelineLibraryCacheVk()
+{
+    for (const LibraryMapType& Libraries : m_Libraries)
+    {
+        DEV_CHECK_ERR(Libraries.empty(), Libraries.size(), " pipeline libraries have not been released. This indicates that some pipelines have not been destroyed.");
+    }
+
+    // Libraries are never used by command buffers, so they can be destroyed immediately.
+    for (LibraryMapType& Libraries : m_Libraries)
+        Libraries.clear();
+}
+
+void PipelineLibraryCacheVk::LibraryKey::ComputeHash() noexcept
+{
+    Hash = Diligent::ComputeHash(Type, Flags, InputLayout.Get(), PrimitiveTopology, PipelineType,
+                                 RasterizerDesc, NumViewports, DepthStencilDesc, BlendDesc, SmplDesc, SampleMask,
+                                 PushDescrSetSignIndex, LayoutHash, SubpassIndex, NumRenderTargets, DSVFormat, ReadOnlyDSV,
+                                 ShadingRateFlags, DynamicStates);
+    for (const ShaderStage& Stage : Shaders)
+    {
+        HashCombine(Hash, Stage.Type, ComputeHashRaw(Stage.SPIRV.data(), Stage.SPIRV.size() * sizeof(uint32_t)), Stage.EntryPoint);
+    }
+    if (pRenderPass)
+        HashCombine(Hash, pRenderPass->GetDesc());
+    for (Uint32 rt = 0; rt < NumRenderTargets; ++rt)
+        HashCombine(Hash, RTVFormats[rt]);
+}
+
+bool PipelineLibraryCacheVk::LibraryKey::operator==(const LibraryKey& rhs) const noexcept
+{
+    // clang-format off
+    if (Hash                  != rhs.Hash                  ||
+        Type                  != rhs.Type                  ||
+        Flags                 != rhs.Flags                 ||
+        PrimitiveTopology     != rhs.PrimitiveTopology     ||
+        PipelineType          != rhs.PipelineType          ||
+        NumViewports          != rhs.NumViewports          ||
+        SampleMask            != rhs.SampleMask            ||
+        PushDescrSetSignIndex != rhs.PushDescrSetSignIndex ||
+        SubpassIndex          != rhs.SubpassIndex          ||
+        NumRenderTargets      != rhs.NumRenderTargets      ||
+        DSVFormat             != rhs.DSVFormat             ||
+        ReadOnlyDSV           != rhs.ReadOnlyDSV           ||
+        ShadingRateFlags      != rhs.ShadingRateFlags      ||
+        DynamicStates         != rhs.DynamicStates         ||
+        !(RasterizerDesc      == rhs.RasterizerDesc)       ||
+        !(DepthStencilDesc    == rhs.DepthStencilDesc)     ||
+        !(BlendDesc           == rhs.BlendDesc)            ||
+        !(SmplDesc            == rhs.SmplDesc)             ||
+        InputLayout           != rhs.InputLayout           ||
+        Shaders               != rhs.Shaders)
+        return false;
+    // clang-format on
+
+    for (Uint32 rt = 0; rt < NumRenderTargets; ++rt)
+    {
+        if (RTVFormats[rt] != rhs.RTVFormats[rt])
+            return false;
+    }
+
+    if (pRenderPass != rhs.pRenderPass)
+    {
+        if (!pRenderPass || !rhs.pRenderPass || !(pRenderPass->GetDesc() == rhs.pRenderPass->GetDesc()))
+            return false;
+    }
+
+    if (Signatures.size() != rhs.Signatures.size())
+        return false;
+    for (size_t i = 0; i < Signatures.size(); ++i)
+    {
+        const IPipelineResourceSignature* pSign0 = Signatures[i];
+        const IPipelineResourceSignature* pSign1 = rhs.Signatures[i];
+        if (pSign0 == pSign1)
+            continue;
+        if (pSign0 == nullptr || pSign1 == nullptr || !pSign0->IsCompatibleWith(pSign1))
+            return false;
+    }
+
+    return true;
+}
+
+static const char* GetLibraryTypeName(PipelineLibraryCacheVk::LIBRARY_TYPE Type)
+{
+    static_assert(PipelineLibraryCacheVk::LIBRARY_TYPE_COUNT == 4, "Please handle the new library type below");
+    switch (Type)
+    {
+        // clang-format off
+        case PipelineLibraryCacheVk::LIBRARY_TYPE_VERTEX_INPUT:      return "vertex input";
+        case PipelineLibraryCacheVk::LIBRARY_TYPE_PRE_RASTERIZATION: return "pre-rasterization";
+        case PipelineLibraryCacheVk::LIBRARY_TYPE_FRAGMENT_SHADER:   return "fragment shader";
+        case PipelineLibraryCacheVk::LIBRARY_TYPE_FRAGMENT_OUTPUT:   return "fragment output";
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected library type");
+            return "unknown";
+    }
+}
+
+VulkanUtilities::PipelineWrapper PipelineLibraryCacheVk::CreateLibrary(const VkGraphicsPipelineCreateInfo& PipelineCI,
+                                                                       LIBRARY_TYPE                        Type,
+                                                                       VkPipelineCache                     vkPSOCache,
+                                                                       const char*                         PipelineName) const noexcept(false)
+{
+    VkGraphicsPipelineLibraryCreateInfoEXT LibraryCI{};
+    LibraryCI.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT;
+    LibraryCI.pNext = PipelineCI.pNext; // VkPipelineRenderingCreateInfoKHR if dynamic rendering is used
+
+    VkGraphicsPipelineCreateInfo LibCI{};
+    LibCI.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    LibCI.pNext = &LibraryCI;
+    // Link-time optimization information must be retained to be able to link optimized pipelines.
+    LibCI.flags              = PipelineCI.flags | VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+    LibCI.pDynamicState      = PipelineCI.pDynamicState; // Dynamic states that are not relevant to the library are ignored
+    LibCI.basePipelineHandle = VK_NULL_HANDLE;
+    LibCI.basePipelineIndex  = -1;
+
+    std::vector<VkPipelineShaderStageCreateInfo> Stages;
+    for (uint32_t i = 0; i < PipelineCI.stageCount; ++i)
+    {
+        const VkPipelineShaderStageCreateInfo& Stage = PipelineCI.pStages[i];
+
+        const bool IsFragmentStage = Stage.stage == VK_SHADER_STAGE_FRAGMENT_BIT;
+        if ((Type == LIBRARY_TYPE_PRE_RASTERIZATION && !IsFragmentStage) ||
+            (Type == LIBRARY_TYPE_FRAGMENT_SHADER && IsFragmentStage))
+        {
+            Stages.push_back(Stage);
+        }
+    }
+
+    switch (Type)
+    {
+        case LIBRARY_TYPE_VERTEX_INPUT:
+            LibraryCI.flags           = VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT;
+            LibCI.pVertexInputState   = PipelineCI.pVertexInputState;
+            LibCI.pInputAssemblyState = PipelineCI.pInputAssemblyState;
+            break;
+
+        case LIBRARY_TYPE_PRE_RASTERIZATION:
+            LibraryCI.flags           = VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT;
+            LibCI.pViewportState      = PipelineCI.pViewportState;
+            LibCI.pRasterizationState = PipelineCI.pRasterizationState;
+            LibCI.pTessellationState  = PipelineCI.pTessellationState;
+            LibCI.layout              = PipelineCI.layout;
+            LibCI.renderPass          = PipelineCI.renderPass;
+            LibCI.subpass             = PipelineCI.subpass;
+            break;
+
+        case LIBRARY_TYPE_FRAGMENT_SHADER:
+            LibraryCI.flags          = VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT;
+            LibCI.pMultisampleState  = PipelineCI.pMultisampleState;
+            LibCI.pDepthStencilState = PipelineCI.pDepthStencilState;
+            LibCI.layout             = PipelineCI.layout;
+            LibCI.renderPass         = PipelineCI.renderPass;
+            LibCI.subpass            = PipelineCI.subpass;
+            break;
+
+        case LIBRARY_TYPE_FRAGMENT_OUTPUT:
+            LibraryCI.flags         = VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT;
+            LibCI.pColorBlendState  = PipelineCI.pColorBlendState;
+            LibCI.pMultisampleState = PipelineCI.pMultisampleState;
+            LibCI.renderPass        = PipelineCI.renderPass;
+            LibCI.subpass           = PipelineCI.subpass;
+            break;
+
+        default:
+            UNEXPECTED("Unexpected library type");
+    }
+
+    LibCI.stageCount = static_cast<uint32_t>(Stages.size());
+    LibCI.pStages    = !Stages.empty() ? Stages.data() : nullptr;
+
+    const std::string LibraryName = std::string{PipelineName != nullptr ? PipelineName : ""} + " - " + GetLibraryTypeName(Type) + " library";
+    return m_DeviceVkImpl.GetLogicalDevice().CreateGraphicsPipeline(LibCI, vkPSOCache, LibraryName.c_str());
+}
+
+PipelineLibraryCacheVk::LibraryHandles PipelineLibraryCacheVk::GetLibraries(const VkGraphicsPipelineCreateInfo& PipelineCI,
+                                                                            LibraryKeys&&                       Keys,
+                                                                            VkPipelineCache                     vkPSOCache,
+                                                                            const char*                         PipelineName) noexcept(false)
+{
+    LibraryHandles Libraries{};
+    try
+    {
+        for (Uint32 Type = 0; Type < LIBRARY_TYPE_COUNT; ++Type)
+        {
+            Libraries[Type] = VK_NULL_HANDLE;
+
+            LibraryKey& Key = Keys[Type];
+            if (Key.Type == LIBRARY_TYPE_COUNT)
+                continue;
+            VERIFY_EXPR(Key.Type == Type);
+
+            Key.Flags = PipelineCI.flags;
+            Key.ComputeHash();
+
+            {
+                std::lock_guard<std::mutex> Lock{m_Mutex};
+
+                auto it = m_Libraries[Type].find(Key);
+                if (it != m_Libraries[Type].end())
+                {
+                    ++it->second.RefCount;
+                    Libraries[Type] = it->second.Library;
+                    continue;
+                }
+            }
+
+            // Create the library outside of the lock so that other threads are not blocked
+            // while the shaders are being compiled.
+            VulkanUtilities::PipelineWrapper Library = CreateLibrary(PipelineCI, static_cast<LIBRARY_TYPE>(Type), vkPSOCache, PipelineName);
+
+            std::lock_guard<std::mutex> Lock{m_Mutex};
+            // If another thread has created the same library in the meantime,
+            // the new one is discarded and the existing one is used.
+            auto it_inserted = m_Libraries[Type].emplace(std::move(Key), LibraryEntry{});
+            if (it_inserted.second)
+            {
+                it_inserted.first->second.Library = std::move(Library);
+                m_HandleToLibrary[Type].emplace(it_inserted.first->second.Library, it_inserted.first);
+            }
+            ++it_inserted.first->second.RefCount;
+            Libraries[Type] = it_inserted.first->second.Library;
+        }
+    }
+    catch (...)
+    {
+        ReleaseLibraries(Libraries);
+        throw;
+    }
+
+    return Libraries;
+}
+
+void PipelineLibraryCacheVk::ReleaseLibraries(const LibraryHandles& Libraries)
+{
+    std::array<VulkanUtilities::PipelineWrapper, LIBRARY_TYPE_COUNT> UnusedLibraries;
+    {
+        std::lock_guard<std::mutex> Lock{m_Mutex};
+        for (Uint32 Type = 0; Type < LIBRARY_TYPE_COUNT; ++Type)
+        {
+            if (Libraries[Type] == VK_NULL_HANDLE)
+                continue;
+
+            auto handle_it = m_HandleToLibrary[Type].find(Libraries[Type]);
+            if (handle_it == m_HandleToLibrary[Type].end())
+            {
+                UNEXPECTED("Library is not found in the cache");
+                continue;
+            }
+
+            LibraryMapType::iterator lib_it = handle_it->second;
+            VERIFY_EXPR(lib_it->second.RefCount > 0);
+            if (--lib_it->second.RefCount == 0)
+            {
+                UnusedLibraries[Type] = std::move(lib_it->second.Library);
+                m_HandleToLibrary[Type].erase(handle_it);
+                m_Libraries[Type].erase(lib_it);
+            }
+        }
+    }
+
+    // Libraries are never used by command buffers, and pipelines linked from them do not
+    // reference them, so the libraries are destroyed immediately outside of the lock.
+}
+
+VulkanUtilities::PipelineWrapper PipelineLibraryCacheVk::LinkPipeline(const LibraryHandles& Libraries,
+                                                                      VkPipelineLayout      vkLayout,
+                                                                      VkPipelineCreateFlags Flags,
+                                                                      bool                  Optimize,
+                                                                      VkPipelineCache       vkPSOCache,
+                                                                      const char*           PipelineName) const noexcept(false)
+{
+    std::array<VkPipeline, LIBRARY_TYPE_COUNT> vkLibraries{};
+    uint32_t                                   LibraryCount = 0;
+    for (VkPipeline vkLibrary : Libraries)
+    {
+        if (vkLibrary != VK_NULL_HANDLE)
+            vkLibraries[LibraryCount++] = vkLibrary;
+    }
+    VERIFY_EXPR(LibraryCount > 0);
+
+    VkPipelineLibraryCreateInfoKHR LibraryCI{};
+    LibraryCI.sType        = VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR;
+    LibraryCI.pNext        = nullptr;
+    LibraryCI.libraryCount = LibraryCount;
+    LibraryCI.pLibraries   = vkLibraries.data();
+
+    VkGraphicsPipelineCreateInfo PipelineCI{};
+    PipelineCI.sType = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    PipelineCI.pNext = &LibraryCI;
+    PipelineCI.flags = Flags;
+    if (Optimize)
+        PipelineCI.flags |= VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT;
+    PipelineCI.layout             = vkLayout;
+    PipelineCI.basePipelineHandle = VK_NULL_HANDLE;
+    PipelineCI.basePipelineIndex  = -1;
+
+    return m_DeviceVkImpl.GetLogicalDevice().CreateGraphicsPipeline(PipelineCI, vkPSOCache, PipelineName);
+}
+
+} // namespace Diligent
@@ -245,6 +245,9 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
     // Current offset in the static resource cache
     Uint32 StaticCacheOffset = 0;
 
+    // Descriptor buffers do not support descriptors with dynamic offsets
+    const bool UseDescriptorBuffers = HasDevice() && GetDevice()->UseDescriptorBuffers();
+
     std::array<std::vector<VkDescriptorSetLayoutBinding>, DESCRIPTOR_SET_ID_NUM_SETS> vkSetLayoutBindings;
 
     DynamicLinearAllocator TempAllocator{GetRawAllocator(), 256};
@@ -330,7 +333,9 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
         vkSetLayoutBinding.descriptorCount    = ResDesc.ArraySize;
         vkSetLayoutBinding.stageFlags         = ShaderTypesToVkShaderStageFlags(ResDesc.ShaderStages);
         vkSetLayoutBinding.pImmutableSamplers = pVkImmutableSamplers;
-        vkSetLayoutBinding.descriptorType     = DescriptorTypeToVkDescriptorType(pAttribs->GetDescriptorType());
+        vkSetLayoutBinding.descriptorType     = UseDescriptorBuffers ?
+            DescriptorTypeToVkDescriptorBufferType(pAttribs->GetDescriptorType()) :
+            DescriptorTypeToVkDescriptorType(pAttribs->GetDescriptorType());
         vkSetLayoutBindings[SetId].push_back(vkSetLayoutBinding);
 
         if (ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC)
@@ -456,7 +461,7 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
 
     SetLayoutCI.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
     SetLayoutCI.pNext = nullptr;
-    SetLayoutCI.flags = 0;
+    SetLayoutCI.flags = UseDescriptorBuffers ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_DESCRIPTOR_BUFFER_BIT_EXT : 0;
 
     if (HasDevice())
     {
@@ -473,6 +478,174 @@ void PipelineResourceSignatureVkImpl::CreateSetLayouts(const bool IsSerialized)
             m_VkDescrSetLayouts[i]   = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
         }
         VERIFY_EXPR(NumSets == GetNumDescriptorSets());
+
+        if (UseDescriptorBuffers)
+        {
+            // Descriptors are written directly to the descriptor buffer, so neither
+            // update templates nor push descriptors are needed.
+            InitDescriptorBufferSetLayouts(ImmutableSamplerWithResource);
+            return;
+        }
+
+        if (HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC) && LogicalDevice.GetEnabledExtFeatures().DescrUpdateTemplate)
+            CreateDynamicSetUpdateTemplate();
+
+        if (HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC) && LogicalDevice.GetEnabledExtFeatures().PushDescriptor)
+        {
+            // Small dynamic sets can be pushed directly into the command buffer instead of being allocated
+            // from the dynamic descriptor pool and written on every commit. Push descriptor set layouts must
+            // not contain descriptors with dynamic offsets (VUID-VkDescriptorSetLayoutCreateInfo-flags-00280),
+            // and the total descriptor count must not exceed maxPushDescriptors (VUID-VkDescriptorSetLayoutCreateInfo-flags-00281).
+            Uint32 DynamicSetDescriptorCount = 0;
+            for (const VkDescriptorSetLayoutBinding& vkBinding : vkSetLayoutBindings[DESCRIPTOR_SET_ID_DYNAMIC])
+                DynamicSetDescriptorCount += vkBinding.descriptorCount;
+
+            const Uint32 MaxPushDescriptors = GetDevice()->GetPhysicalDevice().GetExtProperties().PushDescriptor.maxPushDescriptors;
+            if (CacheGroupSizes[CACHE_GROUP_DYN_UB_DYN_VAR] == 0 &&
+                CacheGroupSizes[CACHE_GROUP_DYN_SB_DYN_VAR] == 0 &&
+                DynamicSetDescriptorCount <= std::min(MAX_PUSH_DESCRIPTOR_SET_SIZE, MaxPushDescriptors))
+            {
+                const std::vector<VkDescriptorSetLayoutBinding>& vkDynSetBindings = vkSetLayoutBindings[DESCRIPTOR_SET_ID_DYNAMIC];
+
+                SetLayoutCI.flags        = VK_DESCRIPTOR_SET_LAYOUT_CREATE_PUSH_DESCRIPTOR_BIT_KHR;
+                SetLayoutCI.bindingCount = StaticCast<uint32_t>(vkDynSetBindings.size());
+                SetLayoutCI.pBindings    = vkDynSetBindings.data();
+                m_VkPushDescrSetLayout   = LogicalDevice.CreateDescriptorSetLayout(SetLayoutCI);
+            }
+        }
+    }
+}
+
+void PipelineResourceSignatureVkImpl::CreateDynamicSetUpdateTemplate()
+{
+    using DescriptorUpdateData = ShaderResourceCacheVk::DescriptorUpdateData;
+
+    const std::pair<Uint32, Uint32> DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
+
+    std::vector<VkDescriptorUpdateTemplateEntry> vkEntries;
+    vkEntries.reserve(DynResIdxRange.second - DynResIdxRange.first);
+    for (Uint32 ResIdx = DynResIdxRange.first; ResIdx < DynResIdxRange.second; ++ResIdx)
+    {
+        const PipelineResourceAttribsType& Attr = GetResourceAttribs(ResIdx);
+
+        // Immutable samplers are permanently bound into the set layout and must not be updated (13.2.1)
+        if (Attr.GetDescriptorType() == DescriptorType::Sampler && Attr.IsImmutableSamplerAssigned())
+            continue;
+
+        // Descriptor data is laid out by the SRB cache offset, one element per array element
+        VkDescriptorUpdateTemplateEntry vkEntry;
+        vkEntry.dstBinding      = Attr.BindingIndex;
+        vkEntry.dstArrayElement = 0;
+        vkEntry.descriptorCount = Attr.ArraySize;
+        vkEntry.descriptorType  = DescriptorTypeToVkDescriptorType(Attr.GetDescriptorType());
+        vkEntry.offset          = size_t{Attr.CacheOffset(ResourceCacheContentType::SRB)} * sizeof(DescriptorUpdateData);
+        vkEntry.stride          = sizeof(DescriptorUpdateData);
+        vkEntries.push_back(vkEntry);
+    }
+
+    if (vkEntries.empty())
+        return;
+
+    VkDescriptorUpdateTemplateCreateInfo TemplateCI{};
+    TemplateCI.sType                      = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO;
+    TemplateCI.pNext                      = nullptr;
+    TemplateCI.flags                      = 0;
+    TemplateCI.descriptorUpdateEntryCount = StaticCast<uint32_t>(vkEntries.size());
+    TemplateCI.pDescriptorUpdateEntries   = vkEntries.data();
+    TemplateCI.templateType               = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET;
+    TemplateCI.descriptorSetLayout        = m_VkDescrSetLayouts[DESCRIPTOR_SET_ID_DYNAMIC];
+
+    m_VkDynamicSetUpdateTemplate = GetDevice()->GetLogicalDevice().CreateDescriptorUpdateTemplate(TemplateCI, m_Desc.Name);
+}
+
+static Uint32 GetDescriptorBufferDescriptorSize(VkDescriptorType                                    vkType,
+                                                const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props,
+                                                bool                                                RobustBufferAccess)
+{
+    switch (vkType)
+    {
+        // clang-format off
+        case VK_DESCRIPTOR_TYPE_SAMPLER:                    return static_cast<Uint32>(Props.samplerDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:     return static_cast<Uint32>(Props.combinedImageSamplerDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:              return static_cast<Uint32>(Props.sampledImageDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:              return static_cast<Uint32>(Props.storageImageDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:       return static_cast<Uint32>(RobustBufferAccess ? Props.robustUniformTexelBufferDescriptorSize : Props.uniformTexelBufferDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:       return static_cast<Uint32>(RobustBufferAccess ? Props.robustStorageTexelBufferDescriptorSize : Props.storageTexelBufferDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:             return static_cast<Uint32>(RobustBufferAccess ? Props.robustUniformBufferDescriptorSize : Props.uniformBufferDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:             return static_cast<Uint32>(RobustBufferAccess ? Props.robustStorageBufferDescriptorSize : Props.storageBufferDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:           return static_cast<Uint32>(Props.inputAttachmentDescriptorSize);
+        case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR: return static_cast<Uint32>(Props.accelerationStructureDescriptorSize);
+        // clang-format on
+        default:
+            UNEXPECTED("Unexpected descriptor type");
+            return 0;
+    }
+}
+
+void PipelineResourceSignatureVkImpl::InitDescriptorBufferSetLayouts(const std::vector<bool>& ImmutableSamplerWithResource)
+{
+    using DescriptorBufferSetLayout = ShaderResourceCacheVk::DescriptorBufferSetLayout;
+
+    const VulkanUtilities::LogicalDevice&                LogicalDevice = GetDevice()->GetLogicalDevice();
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT& Props         = GetDevice()->GetPhysicalDevice().GetExtProperties().DescriptorBuffer;
+    const bool                                           RobustAccess  = LogicalDevice.GetEnabledFeatures().robustBufferAccess != VK_FALSE;
+
+    Uint32 SetIndex = 0;
+    for (Uint32 SetId = 0; SetId < DESCRIPTOR_SET_ID_NUM_SETS; ++SetId)
+    {
+        const VkDescriptorSetLayout vkLayout = m_VkDescrSetLayouts[SetId];
+        if (vkLayout == VK_NULL_HANDLE)
+            continue;
+
+        DescriptorBufferSetLayout& Layout = m_DescrBufferSetLayouts[SetIndex];
+        Layout.Size                       = LogicalDevice.GetDescriptorSetLayoutSize(vkLayout);
+        Layout.Descriptors.resize(m_DescriptorSetSizes[SetIndex]);
+
+        for (Uint32 r = 0; r < m_Desc.NumResources; ++r)
+        {
+            const PipelineResourceDesc& ResDesc = m_Desc.Resources[r];
+            const ResourceAttribs&      Attr    = GetResourceAttribs(r);
+            if (Attr.DescrSet != SetIndex)
+                continue;
+
+            const DescriptorType DescrType = Attr.GetDescriptorType();
+
+            VkSampler vkImmutableSampler = VK_NULL_HANDLE;
+            if (Attr.IsImmutableSamplerAssigned())
+            {
+                const Uint32 SrcImmutableSamplerInd = FindImmutableSamplerVk(ResDesc, DescrType, m_Desc, GetCombinedSamplerSuffix());
+                VERIFY_EXPR(SrcImmutableSamplerInd != InvalidImmutableSamplerIndex);
+                if (const SamplerVkImpl* pSamplerVk = m_pImmutableSamplers[SrcImmutableSamplerInd])
+                    vkImmutableSampler = pSamplerVk->GetVkSampler();
+            }
+
+            const Uint32 Offset    = static_cast<Uint32>(LogicalDevice.GetDescriptorSetLayoutBindingOffset(vkLayout, Attr.BindingIndex));
+            const Uint32 Size      = GetDescriptorBufferDescriptorSize(DescriptorTypeToVkDescriptorBufferType(DescrType), Props, RobustAccess);
+            const Uint32 CacheOffs = Attr.CacheOffset(ResourceCacheContentType::SRB);
+            for (Uint32 ArrInd = 0; ArrInd < ResDesc.ArraySize; ++ArrInd)
+            {
+                DescriptorBufferSetLayout::Descriptor& Descr = Layout.Descriptors[CacheOffs + ArrInd];
+                Descr.Offset                                  = Offset + ArrInd * Size;
+                Descr.Size                                    = Size;
+                Descr.ImmutableSampler                        = vkImmutableSampler;
+            }
+        }
+
+        // Separate immutable samplers that are not assigned to any resource in m_Desc.Resources
+        for (Uint32 i = 0; i < m_Desc.NumImmutableSamplers; ++i)
+        {
+            const ImmutableSamplerAttribsVk& ImtblSampAttribs = m_pImmutableSamplerAttribs[i];
+            if (ImmutableSamplerWithResource[i] || ImtblSampAttribs.DescrSet != SetIndex)
+                continue;
+
+            DescriptorBufferSetLayout::Descriptor Descr;
+            Descr.Offset           = static_cast<Uint32>(LogicalDevice.GetDescriptorSetLayoutBindingOffset(vkLayout, ImtblSampAttribs.BindingIndex));
+            Descr.Size             = static_cast<Uint32>(Props.samplerDescriptorSize);
+            Descr.ImmutableSampler = m_pImmutableSamplers[i] ? m_pImmutableSamplers[i]->GetVkSampler() : VK_NULL_HANDLE;
+            Layout.ImmutableSamplers.push_back(Descr);
+        }
+
+        ++SetIndex;
     }
 }
 
@@ -489,6 +662,12 @@ void PipelineResourceSignatureVkImpl::Destruct()
             GetDevice()->SafeReleaseDeviceObject(std::move(Layout), ~0ull);
     }
 
+    if (m_VkDynamicSetUpdateTemplate)
+        GetDevice()->SafeReleaseDeviceObject(std::move(m_VkDynamicSetUpdateTemplate), ~0ull);
+
+    if (m_VkPushDescrSetLayout)
+        GetDevice()->SafeReleaseDeviceObject(std::move(m_VkPushDescrSetLayout), ~0ull);
+
     TPipelineResourceSignatureBase::Destruct();
 }
 
@@ -501,7 +680,8 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
 #endif
 
     IMemoryAllocator& CacheMemAllocator = m_SRBMemAllocator.GetResourceCacheDataAllocator(0);
-    ResourceCache.InitializeSets(CacheMemAllocator, NumSets, m_DescriptorSetSizes.data());
+    const Uint32      NumContexts       = static_cast<Uint32>(GetDevice()->GetNumImmediateContexts() + GetDevice()->GetNumDeferredContexts());
+    ResourceCache.InitializeSets(CacheMemAllocator, NumSets, m_DescriptorSetSizes.data(), NumContexts);
 
     const Uint32                   TotalResources = GetTotalResourceCount();
     const ResourceCacheContentType CacheType      = ResourceCache.GetContentType();
@@ -517,6 +697,41 @@ void PipelineResourceSignatureVkImpl::InitSRBResourceCache(ShaderResourceCacheVk
     ResourceCache.DbgVerifyResourceInitialization();
 #endif
 
+    if (GetDevice()->UseDescriptorBuffers())
+    {
+        // With descriptor buffers, static and mutable resources are written to the persistent descriptor buffer
+        // memory owned by the SRB when they are bound, while dynamic resources are written to the context's
+        // descriptor heap every time the SRB is committed.
+        if (HasDescriptorSet(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
+        {
+            RenderDeviceVkImpl*         pDeviceVk    = GetDevice();
+            VulkanDynamicMemoryManager* pDescrMemMgr = pDeviceVk->GetDescriptorMemoryManager();
+            VERIFY_EXPR(pDescrMemMgr != nullptr);
+
+            const Uint32                                            SetIndex  = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_STATIC_MUTABLE>();
+            const ShaderResourceCacheVk::DescriptorBufferSetLayout& SetLayout = GetDescriptorBufferSetLayout(SetIndex);
+            const VkDeviceSize                                      Alignment = pDeviceVk->GetPhysicalDevice().GetExtProperties().DescriptorBuffer.descriptorBufferOffsetAlignment;
+
+            // The set is allocated from the persistent region of the descriptor buffer rather than from
+            // the memory that device contexts recycle every frame.
+            VulkanDynamicMemoryManager::MasterBlock Block = pDescrMemMgr->AllocatePersistentBlock(SetLayout.Size, Alignment);
+            if (Block.IsValid())
+            {
+                const VkDeviceSize RegionOffset = AlignUp(VkDeviceSize{Block.UnalignedOffset}, Alignment);
+                VERIFY_EXPR(Block.Size >= SetLayout.Size + (RegionOffset - Block.UnalignedOffset));
+                ResourceCache.AssignPersistentDescriptorBufferSet(SetIndex, SetLayout, *pDeviceVk, std::move(Block),
+                                                                  pDescrMemMgr->GetPersistentRegionOffset() + RegionOffset);
+            }
+            else
+            {
+                // The set will be written to the descriptor heap every time the SRB is committed
+                LOG_WARNING_MESSAGE("Failed to allocate ", SetLayout.Size, " bytes in the persistent descriptor buffer memory for the static/mutable set of resource signature '",
+                                    m_Desc.Name, "'. Increase EngineVkCreateInfo::PersistentDescriptorBufferSize.");
+            }
+        }
+        return;
+    }
+
     if (VkDescriptorSetLayout vkLayout = GetVkDescriptorSetLayout(DESCRIPTOR_SET_ID_STATIC_MUTABLE))
     {
         const char* DescrSetName = "Static/Mutable Descriptor Set";
@@ -615,20 +830,88 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
     VERIFY_EXPR(vkDynamicDescriptorSet != VK_NULL_HANDLE);
     VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
 
+    const VulkanUtilities::LogicalDevice& LogicalDevice = GetDevice()->GetLogicalDevice();
+
+    if (m_VkDynamicSetUpdateTemplate)
+    {
+        // Write descriptor data for the entire set and update it with a single call
+        using DescriptorUpdateData = ShaderResourceCacheVk::DescriptorUpdateData;
+
+        static constexpr size_t LocalDataSize = 64;
+
+        const Uint32                                DynamicSetIdx = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
+        const ShaderResourceCacheVk::DescriptorSet& SetResources  = ResourceCache.GetDescriptorSet(DynamicSetIdx);
+
+        // Do not zero-initialize arrays!
+        std::array<DescriptorUpdateData, LocalDataSize> LocalData;
+        std::vector<DescriptorUpdateData>               HeapData;
+
+        DescriptorUpdateData* pData = LocalData.data();
+        if (SetResources.GetSize() > LocalDataSize)
+        {
+            HeapData.resize(SetResources.GetSize());
+            pData = HeapData.data();
+        }
+
+        if (ResourceCache.WriteDescriptorUpdateData(DynamicSetIdx, pData))
+        {
+            LogicalDevice.UpdateDescriptorSetWithTemplate(vkDynamicDescriptorSet, m_VkDynamicSetUpdateTemplate, pData);
+            return;
+        }
+        // Some resources are null - fall back to individual writes that skip them
+    }
+
+    WriteDynamicResources<false>(ResourceCache, vkDynamicDescriptorSet,
+                                 [&LogicalDevice](Uint32 WriteCount, const VkWriteDescriptorSet* pWrites) {
+                                     LogicalDevice.UpdateDescriptorSets(WriteCount, pWrites, 0, nullptr);
+                                 });
+}
+
+void PipelineResourceSignatureVkImpl::PushDynamicResources(const ShaderResourceCacheVk&    ResourceCache,
+                                                           VulkanUtilities::CommandBuffer& CmdBuffer,
+                                                           VkPipelineBindPoint             vkBindPoint,
+                                                           VkPipelineLayout                vkPipelineLayout,
+                                                           Uint32                          SetIndex) const
+{
+    VERIFY(SupportsPushDescriptors(), "The dynamic descriptor set of this signature can't be pushed");
+    VERIFY_EXPR(ResourceCache.GetContentType() == ResourceCacheContentType::SRB);
+
+    // dstSet is ignored by vkCmdPushDescriptorSetKHR
+    WriteDynamicResources<true>(ResourceCache, VK_NULL_HANDLE,
+                                [&](Uint32 WriteCount, const VkWriteDescriptorSet* pWrites) {
+                                    CmdBuffer.PushDescriptorSet(vkBindPoint, vkPipelineLayout, SetIndex, WriteCount, pWrites);
+                                });
+}
+
+template <bool SingleBatch, typename FlushWritesType>
+void PipelineResourceSignatureVkImpl::WriteDynamicResources(const ShaderResourceCacheVk& ResourceCache,
+                                                            VkDescriptorSet              vkDynamicDescriptorSet,
+                                                            FlushWritesType&&            FlushWrites) const
+{
+    VERIFY(HasDescriptorSet(DESCRIPTOR_SET_ID_DYNAMIC), "This signature does not contain dynamic resources");
+
 #ifdef DILIGENT_DEBUG
-    static constexpr size_t ImgUpdateBatchSize          = 4;
-    static constexpr size_t BuffUpdateBatchSize         = 2;
-    static constexpr size_t TexelBuffUpdateBatchSize    = 2;
-    static constexpr size_t AccelStructBatchSize        = 2;
-    static constexpr size_t WriteDescriptorSetBatchSize = 2;
+    static constexpr size_t DefaultImgUpdateBatchSize          = 4;
+    static constexpr size_t DefaultBuffUpdateBatchSize         = 2;
+    static constexpr size_t DefaultTexelBuffUpdateBatchSize    = 2;
+    static constexpr size_t DefaultAccelStructBatchSize        = 2;
+    static constexpr size_t DefaultWriteDescriptorSetBatchSize = 2;
 #else
-    static constexpr size_t ImgUpdateBatchSize          = 64;
-    static constexpr size_t BuffUpdateBatchSize         = 32;
-    static constexpr size_t TexelBuffUpdateBatchSize    = 16;
-    static constexpr size_t AccelStructBatchSize        = 16;
-    static constexpr size_t WriteDescriptorSetBatchSize = 32;
+    static constexpr size_t DefaultImgUpdateBatchSize          = 64;
+    static constexpr size_t DefaultBuffUpdateBatchSize         = 32;
+    static constexpr size_t DefaultTexelBuffUpdateBatchSize    = 16;
+    static constexpr size_t DefaultAccelStructBatchSize        = 16;
+    static constexpr size_t DefaultWriteDescriptorSetBatchSize = 32;
 #endif
 
+    // Push descriptors must be written in one batch as every push is recorded as a separate command.
+    // Every write covers at least one descriptor, so MAX_PUSH_DESCRIPTOR_SET_SIZE elements are always enough.
+    static constexpr size_t ImgUpdateBatchSize          = SingleBatch ? MAX_PUSH_DESCRIPTOR_SET_SIZE : DefaultImgUpdateBatchSize;
+    static constexpr size_t BuffUpdateBatchSize         = SingleBatch ? MAX_PUSH_DESCRIPTOR_SET_SIZE : DefaultBuffUpdateBatchSize;
+    static constexpr size_t TexelBuffUpdateBatchSize    = SingleBatch ? MAX_PUSH_DESCRIPTOR_SET_SIZE : DefaultTexelBuffUpdateBatchSize;
+    static constexpr size_t AccelStructBatchSize        = SingleBatch ? MAX_PUSH_DESCRIPTOR_SET_SIZE : DefaultAccelStructBatchSize;
+    static constexpr size_t WriteDescriptorSetBatchSize = SingleBatch ? MAX_PUSH_DESCRIPTOR_SET_SIZE : DefaultWriteDescriptorSetBatchSize;
+
     // Do not zero-initialize arrays!
     std::array<VkDescriptorImageInfo, ImgUpdateBatchSize>                          DescrImgInfoArr;
     std::array<VkDescriptorBufferInfo, BuffUpdateBatchSize>                        DescrBuffInfoArr;
@@ -642,9 +925,12 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
     auto AccelStructIt   = DescrAccelStructArr.begin();
     auto WriteDescrSetIt = WriteDescrSetArr.begin();
 
+#ifdef DILIGENT_DEBUG
+    Uint32 DbgFlushCount = 0;
+#endif
+
     const Uint32                                DynamicSetIdx  = GetDescriptorSetIndex<DESCRIPTOR_SET_ID_DYNAMIC>();
     const ShaderResourceCacheVk::DescriptorSet& SetResources   = ResourceCache.GetDescriptorSet(DynamicSetIdx);
-    const VulkanUtilities::LogicalDevice&       LogicalDevice  = GetDevice()->GetLogicalDevice();
     const std::pair<Uint32, Uint32>             DynResIdxRange = GetResourceIndexRange(SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC);
 
     constexpr ResourceCacheContentType CacheType = ResourceCacheContentType::SRB;
@@ -668,7 +954,7 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
         WriteDescrSetIt->pNext = nullptr;
         VERIFY(SetResources.GetVkDescriptorSet() == VK_NULL_HANDLE, "Dynamic descriptor set must not be assigned to the resource cache");
         WriteDescrSetIt->dstSet = vkDynamicDescriptorSet;
-        VERIFY(WriteDescrSetIt->dstSet != VK_NULL_HANDLE, "Vulkan descriptor set must not be null");
+        VERIFY(WriteDescrSetIt->dstSet != VK_NULL_HANDLE || SingleBatch, "Vulkan descriptor set must not be null");
         WriteDescrSetIt->dstBinding      = Attr.BindingIndex;
         WriteDescrSetIt->dstArrayElement = ArrElem;
         // descriptorType must be the same type as that specified in VkDescriptorSetLayoutBinding for dstSet at dstBinding.
@@ -784,7 +1070,12 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
         {
             Uint32 DescrWriteCount = static_cast<Uint32>(std::distance(WriteDescrSetArr.begin(), WriteDescrSetIt));
             if (DescrWriteCount > 0)
-                LogicalDevice.UpdateDescriptorSets(DescrWriteCount, WriteDescrSetArr.data(), 0, nullptr);
+            {
+                FlushWrites(DescrWriteCount, WriteDescrSetArr.data());
+#ifdef DILIGENT_DEBUG
+                ++DbgFlushCount;
+#endif
+            }
 
             DescrImgIt      = DescrImgInfoArr.begin();
             DescrBuffIt     = DescrBuffInfoArr.begin();
@@ -796,7 +1087,15 @@ void PipelineResourceSignatureVkImpl::CommitDynamicResources(const ShaderResourc
 
     Uint32 DescrWriteCount = static_cast<Uint32>(std::distance(WriteDescrSetArr.begin(), WriteDescrSetIt));
     if (DescrWriteCount > 0)
-        LogicalDevice.UpdateDescriptorSets(DescrWriteCount, WriteDescrSetArr.data(), 0, nullptr);
+    {
+        FlushWrites(DescrWriteCount, WriteDescrSetArr.data());
+#ifdef DILIGENT_DEBUG
+        ++DbgFlushCount;
+#endif
+    }
+#ifdef DILIGENT_DEBUG
+    VERIFY(!SingleBatch || DbgFlushCount <= 1, "All descriptors must be written in a single batch");
+#endif
 }
 
 
@@ -38,10 +38,12 @@
 #include "RenderPassVkImpl.hpp"
 #include "ShaderResourceBindingVkImpl.hpp"
 #include "PipelineStateCacheVkImpl.hpp"
+#include "PipelineLibraryCacheVk.hpp"
 
 #include "VulkanTypeConversions.hpp"
 #include "EngineMemory.h"
 #include "StringTools.hpp"
+#include "ThreadPool.hpp"
 
 #if !DILIGENT_NO_HLSL
 #    include "SPIRVTools.hpp"
@@ -119,6 +121,9 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+
     PipelineCI.stage  = Stages[0];
     PipelineCI.layout = Layout.GetVkPipelineLayout();
 
@@ -126,6 +131,132 @@ void CreateComputePipeline(RenderDeviceVkImpl*                           pDevice
 }
 
 
+// Initializes the keys of the pipeline sub-states that define every graphics pipeline library
+PipelineLibraryCacheVk::LibraryKeys GetGraphicsPipelineLibraryKeys(const PipelineStateVkImpl::TShaderStages&                    ShaderStages,
+                                                                   const PipelineStateDesc&                                     PSODesc,
+                                                                   const GraphicsPipelineDesc&                                  GraphicsPipeline,
+                                                                   IRenderPass*                                                 pRenderPass,
+                                                                   const std::vector<RefCntAutoPtr<IPipelineResourceSignature>>& Signatures,
+                                                                   Uint32                                                       PushDescrSetSignIndex,
+                                                                   size_t                                                       LayoutHash)
+{
+    using LibraryKey = PipelineLibraryCacheVk::LibraryKey;
+
+    // Render pass and subpass, or attachment formats when dynamic rendering is used.
+    // Shading rate affects the dynamic states and the pipeline flags.
+    // Dynamic states must be consistent across all libraries of a pipeline.
+    auto InitRenderTargets = [&](LibraryKey& Key) {
+        Key.pRenderPass = pRenderPass;
+        if (pRenderPass != nullptr)
+        {
+            Key.SubpassIndex = GraphicsPipeline.SubpassIndex;
+        }
+        else
+        {
+            Key.NumRenderTargets = GraphicsPipeline.NumRenderTargets;
+            for (Uint32 rt = 0; rt < GraphicsPipeline.NumRenderTargets; ++rt)
+                Key.RTVFormats[rt] = GraphicsPipeline.RTVFormats[rt];
+            Key.DSVFormat   = GraphicsPipeline.DSVFormat;
+            Key.ReadOnlyDSV = GraphicsPipeline.ReadOnlyDSV;
+        }
+        Key.ShadingRateFlags = GraphicsPipeline.ShadingRateFlags;
+        Key.DynamicStates    = GraphicsPipeline.DynamicStates;
+    };
+
+    auto InitLayout = [&](LibraryKey& Key) {
+        Key.Signatures            = Signatures;
+        Key.PushDescrSetSignIndex = PushDescrSetSignIndex;
+        Key.LayoutHash            = LayoutHash;
+    };
+
+    auto InitShaders = [&](LibraryKey& Key, bool FragmentShader) {
+        for (const PipelineStateVkImpl::ShaderStageInfo& Stage : ShaderStages)
+        {
+            if ((Stage.Type == SHADER_TYPE_PIXEL) != FragmentShader)
+                continue;
+            for (size_t i = 0; i < Stage.SPIRVs.size(); ++i)
+                Key.Shaders.push_back({Stage.Type, Stage.SPIRVs[i], Stage.Shaders[i]->GetEntryPoint()});
+        }
+    };
+
+    PipelineLibraryCacheVk::LibraryKeys Keys;
+
+    // Mesh pipelines do not use vertex input state
+    if (PSODesc.PipelineType != PIPELINE_TYPE_MESH)
+    {
+        LibraryKey& Key       = Keys[PipelineLibraryCacheVk::LIBRARY_TYPE_VERTEX_INPUT];
+        Key.Type              = PipelineLibraryCacheVk::LIBRARY_TYPE_VERTEX_INPUT;
+        Key.InputLayout       = GraphicsPipeline.InputLayout;
+        Key.PrimitiveTopology = GraphicsPipeline.PrimitiveTopology;
+        Key.DynamicStates     = GraphicsPipeline.DynamicStates;
+    }
+
+    {
+        LibraryKey& Key       = Keys[PipelineLibraryCacheVk::LIBRARY_TYPE_PRE_RASTERIZATION];
+        Key.Type              = PipelineLibraryCacheVk::LIBRARY_TYPE_PRE_RASTERIZATION;
+        Key.PipelineType      = PSODesc.PipelineType;
+        Key.RasterizerDesc    = GraphicsPipeline.RasterizerDesc;
+        Key.NumViewports      = GraphicsPipeline.NumViewports;
+        Key.PrimitiveTopology = GraphicsPipeline.PrimitiveTopology;
+        InitShaders(Key, /*FragmentShader = */ false);
+        InitLayout(Key);
+        InitRenderTargets(Key);
+    }
+
+    {
+        LibraryKey& Key      = Keys[PipelineLibraryCacheVk::LIBRARY_TYPE_FRAGMENT_SHADER];
+        Key.Type             = PipelineLibraryCacheVk::LIBRARY_TYPE_FRAGMENT_SHADER;
+        Key.DepthStencilDesc = GraphicsPipeline.DepthStencilDesc;
+        Key.SmplDesc         = GraphicsPipeline.SmplDesc;
+        Key.SampleMask       = GraphicsPipeline.SampleMask;
+        InitShaders(Key, /*FragmentShader = */ true);
+        InitLayout(Key);
+        InitRenderTargets(Key);
+    }
+
+    {
+        LibraryKey& Key = Keys[PipelineLibraryCacheVk::LIBRARY_TYPE_FRAGMENT_OUTPUT];
+        Key.Type        = PipelineLibraryCacheVk::LIBRARY_TYPE_FRAGMENT_OUTPUT;
+        Key.BlendDesc   = GraphicsPipeline.BlendDesc;
+        Key.SmplDesc    = GraphicsPipeline.SmplDesc;
+        Key.SampleMask  = GraphicsPipeline.SampleMask;
+        InitRenderTargets(Key);
+    }
+
+    return Keys;
+}
+
+
+// Libraries and flags of a graphics pipeline that was linked from pipeline libraries
+struct LinkedGraphicsPipelineInfo
+{
+    PipelineLibraryCacheVk::LibraryHandles Libraries{};
+    VkPipelineCreateFlags                  Flags = 0;
+};
+
+
+// Returns the implicit render pass that is compatible with the pipeline render targets,
+// or null if the device uses dynamic rendering.
+RefCntAutoPtr<IRenderPass> GetImplicitRenderPass(RenderDeviceVkImpl* pDeviceVk, const GraphicsPipelineDesc& GraphicsPipeline)
+{
+    RefCntAutoPtr<IRenderPass> pRenderPass;
+    if (RenderPassCache* RPCache = pDeviceVk->GetImplicitRenderPassCache())
+    {
+        RenderPassCache::RenderPassCacheKey Key{
+            GraphicsPipeline.NumRenderTargets,
+            GraphicsPipeline.SmplDesc.Count,
+            GraphicsPipeline.RTVFormats,
+            GraphicsPipeline.DSVFormat,
+            (GraphicsPipeline.ShadingRateFlags & PIPELINE_SHADING_RATE_FLAG_TEXTURE_BASED) != 0,
+            GraphicsPipeline.ReadOnlyDSV};
+        pRenderPass = RPCache->GetRenderPass(Key);
+        if (pRenderPass == nullptr)
+            LOG_ERROR_AND_THROW("Failed to create default render pass.");
+    }
+    return pRenderPass;
+}
+
+
 void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDeviceVk,
                             std::vector<VkPipelineShaderStageCreateInfo>& Stages,
                             const PipelineLayoutVk&                       Layout,
@@ -133,7 +264,9 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
                             const GraphicsPipelineDesc&                   GraphicsPipeline,
                             VulkanUtilities::PipelineWrapper&             Pipeline,
                             RefCntAutoPtr<IRenderPass>&                   pRenderPass,
-                            VkPipelineCache                               vkPSOCache)
+                            VkPipelineCache                               vkPSOCache,
+                            PipelineLibraryCacheVk::LibraryKeys*          pLibraryKeys   = nullptr,
+                            LinkedGraphicsPipelineInfo*                   pLinkedInfo    = nullptr)
 {
     const VulkanUtilities::LogicalDevice&  LogicalDevice  = pDeviceVk->GetLogicalDevice();
     const VulkanUtilities::PhysicalDevice& PhysicalDevice = pDeviceVk->GetPhysicalDevice();
@@ -147,32 +280,22 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
 
     VkPipelineRenderingCreateInfoKHR PipelineRenderingCI{};
     std::vector<VkFormat>            ColorAttachmentFormats;
+    if (pRenderPass == nullptr)
+        pRenderPass = GetImplicitRenderPass(pDeviceVk, GraphicsPipeline);
+
     if (pRenderPass == nullptr)
     {
-        if (RenderPassCache* RPCache = pDeviceVk->GetImplicitRenderPassCache())
-        {
-            RenderPassCache::RenderPassCacheKey Key{
-                GraphicsPipeline.NumRenderTargets,
-                GraphicsPipeline.SmplDesc.Count,
-                GraphicsPipeline.RTVFormats,
-                GraphicsPipeline.DSVFormat,
-                (GraphicsPipeline.ShadingRateFlags & PIPELINE_SHADING_RATE_FLAG_TEXTURE_BASED) != 0,
-                GraphicsPipeline.ReadOnlyDSV};
-            pRenderPass = RPCache->GetRenderPass(Key);
-            if (pRenderPass == nullptr)
-                LOG_ERROR_AND_THROW("Failed to create default render pass.");
-        }
-        else
+        // VK_KHR_dynamic_rendering
+        PipelineRenderingCI = GraphicsPipelineDesc_To_VkPipelineRenderingCreateInfo(GraphicsPipeline, ColorAttachmentFormats);
+        if ((GraphicsPipeline.ShadingRateFlags & PIPELINE_SHADING_RATE_FLAG_TEXTURE_BASED) != 0)
         {
-            // VK_KHR_dynamic_rendering
-            PipelineRenderingCI = GraphicsPipelineDesc_To_VkPipelineRenderingCreateInfo(GraphicsPipeline, ColorAttachmentFormats);
-            if ((GraphicsPipeline.ShadingRateFlags & PIPELINE_SHADING_RATE_FLAG_TEXTURE_BASED) != 0)
-            {
-                PipelineCI.flags |= VK_PIPELINE_CREATE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR;
-            }
+            PipelineCI.flags |= VK_PIPELINE_CREATE_RENDERING_FRAGMENT_SHADING_RATE_ATTACHMENT_BIT_KHR;
         }
     }
 
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
+
     PipelineCI.stageCount = static_cast<Uint32>(Stages.size());
     PipelineCI.pStages    = Stages.data();
     PipelineCI.layout     = Layout.GetVkPipelineLayout();
@@ -340,6 +463,37 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
         DynamicStates.push_back(VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR);
     }
 
+    if (GraphicsPipeline.DynamicStates != PIPELINE_DYNAMIC_STATE_FLAG_NONE)
+    {
+        if (pDeviceVk->GetLogicalDevice().GetEnabledExtFeatures().ExtendedDynamicState.extendedDynamicState == VK_FALSE)
+        {
+            LOG_ERROR_AND_THROW("Pipeline '", (PSODesc.Name != nullptr ? PSODesc.Name : ""), "' uses dynamic states (",
+                                GetPipelineDynamicStateFlagsString(GraphicsPipeline.DynamicStates), ") that require ExtendedDynamicState Vulkan feature");
+        }
+
+        // The corresponding states in the create info structures are ignored and
+        // must be set dynamically with vkCmdSet*EXT commands before any draw commands.
+        for (PIPELINE_DYNAMIC_STATE_FLAGS Flags = GraphicsPipeline.DynamicStates; Flags != PIPELINE_DYNAMIC_STATE_FLAG_NONE;)
+        {
+            const PIPELINE_DYNAMIC_STATE_FLAGS Flag = ExtractLSB(Flags);
+            static_assert(PIPELINE_DYNAMIC_STATE_FLAG_LAST == 0x40, "Please handle the new dynamic state flag below");
+            switch (Flag)
+            {
+                // clang-format off
+                case PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE:          DynamicStates.push_back(VK_DYNAMIC_STATE_CULL_MODE_EXT);          break;
+                case PIPELINE_DYNAMIC_STATE_FLAG_FRONT_FACE:         DynamicStates.push_back(VK_DYNAMIC_STATE_FRONT_FACE_EXT);         break;
+                case PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY: DynamicStates.push_back(VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT); break;
+                case PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_TEST:         DynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_TEST_ENABLE_EXT);  break;
+                case PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_WRITE:        DynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_WRITE_ENABLE_EXT); break;
+                case PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_FUNC:         DynamicStates.push_back(VK_DYNAMIC_STATE_DEPTH_COMPARE_OP_EXT);   break;
+                case PIPELINE_DYNAMIC_STATE_FLAG_STENCIL_OP:         DynamicStates.push_back(VK_DYNAMIC_STATE_STENCIL_OP_EXT);         break;
+                // clang-format on
+                default:
+                    UNEXPECTED("Unexpected dynamic state flag");
+            }
+        }
+    }
+
     DynamicStateCI.dynamicStateCount = static_cast<uint32_t>(DynamicStates.size());
     DynamicStateCI.pDynamicStates    = DynamicStates.data();
     PipelineCI.pDynamicState         = &DynamicStateCI;
@@ -357,7 +511,24 @@ void CreateGraphicsPipeline(RenderDeviceVkImpl*                           pDevic
     PipelineCI.basePipelineHandle = VK_NULL_HANDLE; // a pipeline to derive from
     PipelineCI.basePipelineIndex  = -1;             // an index into the pCreateInfos parameter to use as a pipeline to derive from
 
-    Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, PSODesc.Name);
+    if (pLibraryKeys != nullptr)
+    {
+        PipelineLibraryCacheVk* pLibraryCache = pDeviceVk->GetPipelineLibraryCache();
+        VERIFY_EXPR(pLibraryCache != nullptr && pLinkedInfo != nullptr);
+
+        // Libraries that have already been created by other pipelines are reused, and only the missing ones are compiled.
+        // The caller is responsible for releasing the libraries.
+        pLinkedInfo->Libraries = pLibraryCache->GetLibraries(PipelineCI, std::move(*pLibraryKeys), vkPSOCache, PSODesc.Name);
+        pLinkedInfo->Flags     = PipelineCI.flags;
+
+        // If the implementation can't link pipelines quickly, link the optimized pipeline right away.
+        const bool Optimize = !pLibraryCache->IsFastLinkingSupported();
+        Pipeline            = pLibraryCache->LinkPipeline(pLinkedInfo->Libraries, PipelineCI.layout, PipelineCI.flags, Optimize, vkPSOCache, PSODesc.Name);
+    }
+    else
+    {
+        Pipeline = LogicalDevice.CreateGraphicsPipeline(PipelineCI, vkPSOCache, PSODesc.Name);
+    }
 }
 
 
@@ -378,6 +549,8 @@ void CreateRayTracingPipeline(RenderDeviceVkImpl*
 #ifdef DILIGENT_DEBUG
     PipelineCI.flags = VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT;
 #endif
+    if (pDeviceVk->UseDescriptorBuffers())
+        PipelineCI.flags |= VK_PIPELINE_CREATE_DESCRIPTOR_BUFFER_BIT_EXT;
 
     PipelineCI.stageCount                   = static_cast<Uint32>(vkStages.size());
     PipelineCI.pStages                      = vkStages.data();
@@ -661,7 +834,8 @@ void PipelineStateVkImpl::RemapOrVerifyShaderResources(
     bool                                                 bStripReflection,
     const char*                                          PipelineName,
     TShaderResources*                                    pDvpShaderResources,
-    TResourceAttibutions*                                pDvpResourceAttibutions) noexcept(false)
+    TResourceAttibutions*                                pDvpResourceAttibutions,
+    SPIRVOptimizationCache*                              pOptimizationCache) noexcept(false)
 {
     if (PipelineName == nullptr)
         PipelineName = "<null>";
@@ -773,7 +947,7 @@ void PipelineStateVkImpl::RemapOrVerifyShaderResources(
                 {
                     OptimizationFlags |= SPIRV_OPTIMIZATION_FLAG_LEGALIZATION;
                 }
-                std::vector<uint32_t> StrippedSPIRV = OptimizeSPIRV(SPIRV, SPV_ENV_MAX, OptimizationFlags);
+                std::vector<uint32_t> StrippedSPIRV = OptimizeSPIRV(SPIRV, SPV_ENV_MAX, OptimizationFlags, pOptimizationCache);
                 if (!StrippedSPIRV.empty())
                     SPIRV = std::move(StrippedSPIRV);
                 else
@@ -818,11 +992,11 @@ void PipelineStateVkImpl::InitPipelineLayout(const PipelineStateCreateInfo& Crea
                                      true,           // bStripReflection
                                      m_Desc.Name,
 #ifdef DILIGENT_DEVELOPMENT
-                                     &m_ShaderResources, &m_ResourceAttibutions
+                                     &m_ShaderResources, &m_ResourceAttibutions,
 #else
-                                     nullptr, nullptr
+                                     nullptr, nullptr,
 #endif
-        );
+                                     GetDevice()->GetSPIRVOptimizationCache());
     }
 }
 
@@ -858,10 +1032,75 @@ void PipelineStateVkImpl::InitializePipeline(const GraphicsPipelineStateCreateIn
     std::vector<VkPipelineShaderStageCreateInfo>      vkShaderStages;
     std::vector<VulkanUtilities::ShaderModuleWrapper> ShaderModules;
 
-    InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
+    const TShaderStages ShaderStages = InitInternalObjects(CreateInfo, vkShaderStages, ShaderModules);
 
     const VkPipelineCache vkSPOCache = CreateInfo.pPSOCache != nullptr ? ClassPtrCast<PipelineStateCacheVkImpl>(CreateInfo.pPSOCache)->GetVkPipelineCache() : VK_NULL_HANDLE;
-    CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, m_Pipeline, GetRenderPassPtr(), vkSPOCache);
+
+    PipelineLibraryCacheVk* pLibraryCache = m_pDevice->GetPipelineLibraryCache();
+    if (pLibraryCache == nullptr)
+    {
+        CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, m_Pipeline, GetRenderPassPtr(), vkSPOCache);
+        return;
+    }
+
+    // Pipeline layouts created from compatible resource signatures are identically defined
+    std::vector<RefCntAutoPtr<IPipelineResourceSignature>> Signatures(m_SignatureCount);
+    size_t                                                 LayoutHash = 0;
+    for (Uint32 i = 0; i < m_SignatureCount; ++i)
+    {
+        if (PipelineResourceSignatureVkImpl* pSignature = m_Signatures[i])
+        {
+            Signatures[i] = pSignature;
+            HashCombine(LayoutHash, i, pSignature->GetHash());
+        }
+    }
+
+    // Resolve the implicit render pass first as it is a part of the library state
+    RefCntAutoPtr<IRenderPass>& pRenderPass = GetRenderPassPtr();
+    if (pRenderPass == nullptr)
+        pRenderPass = GetImplicitRenderPass(m_pDevice, m_pGraphicsPipelineData->Desc);
+
+    PipelineLibraryCacheVk::LibraryKeys LibraryKeys =
+        GetGraphicsPipelineLibraryKeys(ShaderStages, m_Desc, m_pGraphicsPipelineData->Desc, pRenderPass, Signatures,
+                                       m_PipelineLayout.GetPushDescrSetSignIndex(), LayoutHash);
+
+    LinkedGraphicsPipelineInfo LinkedInfo;
+    try
+    {
+        CreateGraphicsPipeline(m_pDevice, vkShaderStages, m_PipelineLayout, m_Desc, m_pGraphicsPipelineData->Desc, m_Pipeline, pRenderPass, vkSPOCache, &LibraryKeys, &LinkedInfo);
+    }
+    catch (...)
+    {
+        pLibraryCache->ReleaseLibraries(LinkedInfo.Libraries);
+        throw;
+    }
+    // The libraries are released when the pipeline is destroyed
+    m_Libraries = LinkedInfo.Libraries;
+
+    // The pipeline has been fast-linked without link-time optimization. Link the optimized pipeline
+    // in the background and use it instead once it is ready. Note that the pipeline cache is not used
+    // by the background task as the application may release it any time after the PSO is created.
+    IThreadPool* pThreadPool = m_pDevice->GetShaderCompilationThreadPool();
+    if (pLibraryCache->IsFastLinkingSupported() &&
+        pLibraryCache->OptimizeLinkedPipelines() &&
+        pThreadPool != nullptr &&
+        (LinkedInfo.Flags & VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT) == 0)
+    {
+        m_pOptimizeLinkTask = EnqueueAsyncWork(
+            pThreadPool,
+            [this, pLibraryCache, LinkedInfo, vkLayout = m_PipelineLayout.GetVkPipelineLayout()](Uint32 ThreadId) {
+                try
+                {
+                    m_OptimizedPipeline = pLibraryCache->LinkPipeline(LinkedInfo.Libraries, vkLayout, LinkedInfo.Flags, /*Optimize = */ true, VK_NULL_HANDLE, m_Desc.Name);
+                    m_OptimizedPipelineReady.store(true, std::memory_order_release);
+                }
+                catch (...)
+                {
+                    LOG_WARNING_MESSAGE("Failed to link optimized pipeline '", m_Desc.Name, "'. The fast-linked pipeline will be used.");
+                }
+                return ASYNC_TASK_STATUS_COMPLETE;
+            });
+    }
 }
 
 void PipelineStateVkImpl::InitializePipeline(const ComputePipelineStateCreateInfo& CreateInfo)
@@ -926,12 +1165,29 @@ PipelineStateVkImpl::~PipelineStateVkImpl()
     // This needs to be done in the final class before the destruction begins.
     GetStatus(/*WaitForCompletion =*/true);
 
+    // The optimized pipeline link task also references this object
+    if (m_pOptimizeLinkTask)
+    {
+        m_pOptimizeLinkTask->Cancel();
+        m_pOptimizeLinkTask->WaitForCompletion();
+        m_pOptimizeLinkTask.Release();
+    }
+
     Destruct();
 }
 
 void PipelineStateVkImpl::Destruct()
 {
+    if (PipelineLibraryCacheVk* pLibraryCache = m_pDevice->GetPipelineLibraryCache())
+    {
+        // Note that the optimized pipeline link task that uses the libraries is complete at this point
+        pLibraryCache->ReleaseLibraries(m_Libraries);
+        m_Libraries = {};
+    }
+
     m_pDevice->SafeReleaseDeviceObject(std::move(m_Pipeline), m_Desc.ImmediateContextMask);
+    if (m_OptimizedPipeline != VK_NULL_HANDLE)
+        m_pDevice->SafeReleaseDeviceObject(std::move(m_OptimizedPipeline), m_Desc.ImmediateContextMask);
     m_PipelineLayout.Release(m_pDevice, m_Desc.ImmediateContextMask);
 
     TPipelineStateBase::Destruct();
@@ -52,6 +52,9 @@
 #include "VulkanTypeConversions.hpp"
 #include "EngineMemory.h"
 #include "QueryManagerVk.hpp"
+#if !DILIGENT_NO_HLSL
+#    include "SPIRVTools.hpp"
+#endif
 
 namespace Diligent
 {
@@ -145,19 +148,63 @@ RenderDeviceVkImpl::RenderDeviceVkImpl(IReferenceCounters*
         GetRawAllocator(),
         *this,
         EngineCI.DynamicHeapSize,
-        ~Uint64{0}
+        ~Uint64{0},
+        // Descriptors in descriptor buffers reference dynamic buffers by device address
+        VulkanDynamicMemoryManager::DynamicHeapBufferUsage | (UseDescriptorBuffers() ? VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT : 0)
     },
     m_pDxCompiler{CreateDXCompiler(DXCompilerTarget::Vulkan, m_PhysicalDevice->GetVkVersion(), EngineCI.pDxCompilerPath)}
 // clang-format on
 {
+#if !DILIGENT_NO_HLSL
+    if (EngineCI.SPIRVOptimizationCacheSize != 0)
+        m_pSPIRVOptimizationCache = std::make_shared<SPIRVOptimizationCache>(EngineCI.SPIRVOptimizationCacheSize);
+#endif
+
     if (!m_LogicalDevice->GetEnabledExtFeatures().DynamicRendering.dynamicRendering)
     {
         m_FramebufferCache        = std::make_unique<FramebufferCache>(*this);
         m_ImplicitRenderPassCache = std::make_unique<RenderPassCache>(*this);
     }
 
+    if (m_LogicalDevice->GetEnabledExtFeatures().GraphicsPipelineLibrary.graphicsPipelineLibrary != VK_FALSE)
+    {
+        m_PipelineLibraryCache = std::make_unique<PipelineLibraryCacheVk>(*this, EngineCI.OptimizeLinkedPipelines);
+    }
+
     static_assert(sizeof(VulkanDescriptorPoolSize) == sizeof(Uint32) * 11, "Please add new descriptors to m_DescriptorSetAllocator and m_DynamicDescriptorPool constructors");
 
+    if (UseDescriptorBuffers())
+    {
+        // Descriptor data is suballocated by device contexts from the ring buffer the same way as dynamic resources.
+        // Static/mutable sets of SRBs are allocated from a separate persistent region of the same buffer, so that
+        // a single descriptor buffer binding is sufficient.
+        // The buffer contains both resource and sampler descriptors, so it must not exceed the address ranges of either type.
+        const VkPhysicalDeviceDescriptorBufferPropertiesEXT& DescrBuffProps = m_PhysicalDevice->GetExtProperties().DescriptorBuffer;
+
+        VkDeviceSize MaxBufferSize = DescrBuffProps.maxResourceDescriptorBufferRange;
+        MaxBufferSize              = std::min(MaxBufferSize, DescrBuffProps.maxSamplerDescriptorBufferRange);
+        MaxBufferSize              = std::min(MaxBufferSize, DescrBuffProps.resourceDescriptorBufferAddressSpaceSize);
+        MaxBufferSize              = std::min(MaxBufferSize, DescrBuffProps.samplerDescriptorBufferAddressSpaceSize);
+        MaxBufferSize              = std::min(MaxBufferSize, VkDeviceSize{~Uint32{0}});
+
+        constexpr VkDeviceSize MasterBlockAlignment = VulkanDynamicMemoryManager::MasterBlockAlignment;
+
+        VkDeviceSize PersistentSize = AlignUp(VkDeviceSize{EngineCI.PersistentDescriptorBufferSize}, MasterBlockAlignment);
+        PersistentSize              = std::min(PersistentSize, AlignDown(MaxBufferSize / 2, MasterBlockAlignment));
+
+        VkDeviceSize HeapSize = std::min(VkDeviceSize{EngineCI.DynamicHeapSize}, MaxBufferSize - PersistentSize);
+        HeapSize              = AlignDown(HeapSize, MasterBlockAlignment);
+
+        m_DescriptorMemoryManager = std::make_unique<VulkanDynamicMemoryManager>(
+            GetRawAllocator(),
+            *this,
+            StaticCast<Uint32>(HeapSize),
+            ~Uint64{0},
+            VK_BUFFER_USAGE_RESOURCE_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SAMPLER_DESCRIPTOR_BUFFER_BIT_EXT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT,
+            "Descriptor heap buffer",
+            StaticCast<Uint32>(PersistentSize));
+    }
+
     const uint32_t vkVersion = m_PhysicalDevice->GetVkVersion();
     m_DeviceInfo.Type        = RENDER_DEVICE_TYPE_VULKAN;
     m_DeviceInfo.APIVersion  = Version{VK_API_VERSION_MAJOR(vkVersion), VK_API_VERSION_MINOR(vkVersion)};
@@ -212,6 +259,8 @@ RenderDeviceVkImpl::~RenderDeviceVkImpl()
     // Explicitly destroy dynamic heap. This will move resources owned by
     // the heap into release queues
     m_DynamicMemoryManager.Destroy();
+    if (m_DescriptorMemoryManager)
+        m_DescriptorMemoryManager->Destroy();
 
     // Explicitly destroy render pass cache
     if (m_ImplicitRenderPassCache)
@@ -219,6 +268,9 @@ RenderDeviceVkImpl::~RenderDeviceVkImpl()
         m_ImplicitRenderPassCache->Destroy();
     }
 
+    // Pipeline libraries are not referenced by command buffers and can be destroyed right away
+    m_PipelineLibraryCache.reset();
+
     // Wait for the GPU to complete all its operations
     IdleGPU();
 
@@ -227,6 +279,7 @@ RenderDeviceVkImpl::~RenderDeviceVkImpl()
     DEV_CHECK_ERR(m_DescriptorSetAllocator.GetAllocatedDescriptorSetCounter() == 0, "All allocated descriptor sets must have been released now.");
     DEV_CHECK_ERR(m_DynamicDescriptorPool.GetAllocatedPoolCounter() == 0, "All allocated dynamic descriptor pools must have been released now.");
     DEV_CHECK_ERR(m_DynamicMemoryManager.GetMasterBlockCounter() == 0, "All allocated dynamic master blocks must have been returned to the pool.");
+    DEV_CHECK_ERR(!m_DescriptorMemoryManager || m_DescriptorMemoryManager->GetMasterBlockCounter() == 0, "All allocated descriptor heap master blocks must have been returned to the pool.");
 
     // Immediately destroys all command pools
     for (auto& CmdPool : m_TransientCmdPoolMgrs)
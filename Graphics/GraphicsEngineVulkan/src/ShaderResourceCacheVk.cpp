@@ -30,6 +30,7 @@
 #include "ShaderResourceCacheVk.hpp"
 
 #include "DeviceContextVkImpl.hpp"
+#include "RenderDeviceVkImpl.hpp"
 #include "BufferViewVkImpl.hpp"
 #include "TextureViewVkImpl.hpp"
 #include "TextureVkImpl.hpp"
@@ -50,7 +51,7 @@ size_t ShaderResourceCacheVk::GetRequiredMemorySize(Uint32 NumSets, const Uint32
     return MemorySize;
 }
 
-void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, const Uint32* SetSizes)
+void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint32 NumSets, const Uint32* SetSizes, Uint32 NumContexts)
 {
     VERIFY(!m_pMemory, "Memory has already been allocated");
 
@@ -67,6 +68,8 @@ void ShaderResourceCacheVk::InitializeSets(IMemoryAllocator& MemAllocator, Uint3
     m_NumSets = static_cast<Uint16>(NumSets);
     VERIFY(m_NumSets == NumSets, "NumSets (", NumSets, ") exceed maximum representable value");
 
+    m_CtxTransitionStates.resize(NumContexts);
+
     m_TotalResources = 0;
     for (Uint32 t = 0; t < NumSets; ++t)
     {
@@ -189,6 +192,16 @@ void ShaderResourceCacheVk::DbgVerifyDynamicBuffersCounter() const
 
 ShaderResourceCacheVk::~ShaderResourceCacheVk()
 {
+    if (m_pPersistentDescrBufferSet)
+    {
+        RenderDeviceVkImpl&         DeviceVk     = *m_pPersistentDescrBufferSet->pDeviceVk;
+        VulkanDynamicMemoryManager* pDescrMemMgr = DeviceVk.GetDescriptorMemoryManager();
+        VERIFY_EXPR(pDescrMemMgr != nullptr);
+
+        // The memory may still be in use by the GPU, so it is returned to the manager through the release queue
+        pDescrMemMgr->ReleasePersistentBlock(std::move(m_pPersistentDescrBufferSet->Block), ~Uint64{0});
+    }
+
     if (m_pMemory)
     {
         Resource* pResources = GetFirstResourcePtr();
@@ -297,10 +310,21 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     DescriptorSet& DescrSet = GetDescriptorSet(DescrSetIndex);
     Resource&      DstRes   = DescrSet.GetResource(CacheOffset);
 
+    // Resources must be transitioned again next time
+    m_ContentRevision.fetch_add(1, std::memory_order_relaxed);
+
+    PersistentDescriptorBufferSet* pPersistentSet =
+        (m_pPersistentDescrBufferSet && m_pPersistentDescrBufferSet->SetIndex == DescrSetIndex) ? m_pPersistentDescrBufferSet.get() : nullptr;
+
     if (IsDynamicBuffer(DstRes))
     {
         VERIFY(m_NumDynamicBuffers > 0, "Dynamic buffers counter must be greater than zero when there is at least one dynamic buffer bound in the resource cache");
         --m_NumDynamicBuffers;
+        if (pPersistentSet != nullptr)
+        {
+            VERIFY_EXPR(pPersistentSet->NumDynamicBuffers > 0);
+            --pPersistentSet->NumDynamicBuffers;
+        }
     }
 
     static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
@@ -326,6 +350,14 @@ const ShaderResourceCacheVk::Resource& ShaderResourceCacheVk::SetResource(
     if (IsDynamicBuffer(DstRes))
     {
         ++m_NumDynamicBuffers;
+        if (pPersistentSet != nullptr)
+            ++pPersistentSet->NumDynamicBuffers;
+    }
+    else if (pPersistentSet != nullptr && DstRes.pObject)
+    {
+        // Similar to descriptor sets, the descriptor is written to the persistent memory when the resource is bound.
+        // Descriptors of dynamic buffers are written to the descriptor heap when the resources are committed.
+        WriteDescriptorBufferResource(DstRes, pPersistentSet->pLayout->Descriptors[CacheOffset], pPersistentSet->pDeviceVk->GetLogicalDevice(), nullptr, pPersistentSet->pData);
     }
 
     VkDescriptorSet vkSet = DescrSet.GetVkDescriptorSet();
@@ -646,62 +678,192 @@ inline void TransitionAccelStruct(DeviceContextVkImpl* pCtxVkImpl,
 #endif
 }
 
+template <bool VerifyOnly>
+void TransitionResource(DeviceContextVkImpl* pCtxVkImpl, ShaderResourceCacheVk::Resource& Res)
+{
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Res.Type)
+    {
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+            TransitionUniformBuffer<VerifyOnly>(pCtxVkImpl, Res.pObject.RawPtr<BufferVkImpl>(), Res.Type);
+            break;
+
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            TransitionBufferView<VerifyOnly>(pCtxVkImpl, Res.pObject.RawPtr<BufferViewVkImpl>(), Res.Type);
+            break;
+
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+        case DescriptorType::StorageImage:
+            TransitionTextureView<VerifyOnly>(pCtxVkImpl, Res.pObject.RawPtr<TextureViewVkImpl>(), Res.Type);
+            break;
+
+        case DescriptorType::Sampler:
+            // Nothing to do with samplers
+            break;
+
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            // Nothing to do with input attachments - they are transitioned by the render pass.
+            // There is nothing we can validate here - a texture may be in different state at
+            // the beginning of the render pass before being transitioned to INPUT_ATTACHMENT state.
+            break;
+
+        case DescriptorType::AccelerationStructure:
+            TransitionAccelStruct<VerifyOnly>(pCtxVkImpl, Res.pObject.RawPtr<TopLevelASVkImpl>(), Res.Type);
+            break;
+
+        default: UNEXPECTED("Unexpected resource type");
+    }
+}
+
+// Returns true if the resource must be transitioned every time the resources are committed,
+// even if its state has not changed (unordered access resources require a UAV barrier).
+bool RequiresUAVBarrier(const ShaderResourceCacheVk::Resource& Res)
+{
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Res.Type)
+    {
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageImage:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+// Returns the state revision of the buffer, texture or TLAS referenced by the resource,
+// or false if the resource does not reference an object whose state is tracked.
+bool GetResourceStateRevision(const ShaderResourceCacheVk::Resource& Res, Uint32& StateRevision)
+{
+    if (!Res.pObject)
+        return false;
+
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Res.Type)
+    {
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+            StateRevision = Res.pObject.ConstPtr<BufferVkImpl>()->GetStateRevision();
+            return true;
+
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+            StateRevision = Res.pObject.ConstPtr<BufferViewVkImpl>()->GetBuffer<const BufferVkImpl>()->GetStateRevision();
+            return true;
+
+        case DescriptorType::CombinedImageSampler:
+        case DescriptorType::SeparateImage:
+        case DescriptorType::StorageImage:
+            StateRevision = Res.pObject.ConstPtr<TextureViewVkImpl>()->GetTexture<const TextureVkImpl>()->GetStateRevision();
+            return true;
+
+        case DescriptorType::AccelerationStructure:
+            StateRevision = Res.pObject.ConstPtr<TopLevelASVkImpl>()->GetStateRevision();
+            return true;
+
+        default:
+            // Samplers and input attachments are not transitioned
+            return false;
+    }
+}
+
 } // namespace
 
 template <bool VerifyOnly>
-void ShaderResourceCacheVk::TransitionResources(DeviceContextVkImpl* pCtxVkImpl)
+bool ShaderResourceCacheVk::TransitionResources(DeviceContextVkImpl* pCtxVkImpl)
 {
     Resource* pResources = GetFirstResourcePtr();
-    for (Uint32 res = 0; res < m_TotalResources; ++res)
-    {
-        Resource& Res = pResources[res];
 
-        static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
-        switch (Res.Type)
-        {
-            case DescriptorType::UniformBuffer:
-            case DescriptorType::UniformBufferDynamic:
-                TransitionUniformBuffer<VerifyOnly>(pCtxVkImpl, Res.pObject.RawPtr<BufferVkImpl>(), Res.Type);
-                break;
+    if (VerifyOnly)
+    {
+        for (Uint32 res = 0; res < m_TotalResources; ++res)
+            TransitionResource<true>(pCtxVkImpl, pResources[res]);
+        return true;
+    }
 
-            case DescriptorType::StorageBuffer:
-            case DescriptorType::StorageBufferDynamic:
-            case DescriptorType::StorageBuffer_ReadOnly:
-            case DescriptorType::StorageBufferDynamic_ReadOnly:
-            case DescriptorType::UniformTexelBuffer:
-            case DescriptorType::StorageTexelBuffer:
-            case DescriptorType::StorageTexelBuffer_ReadOnly:
-                TransitionBufferView<VerifyOnly>(pCtxVkImpl, Res.pObject.RawPtr<BufferViewVkImpl>(), Res.Type);
-                break;
+    const Uint32 CtxId = pCtxVkImpl->GetContextId();
+    VERIFY(CtxId < m_CtxTransitionStates.size(), "Context id ", CtxId, " is out of range. Was the cache initialized with the number of device contexts?");
+    ContextTransitionState& CtxState = m_CtxTransitionStates[CtxId];
 
-            case DescriptorType::CombinedImageSampler:
-            case DescriptorType::SeparateImage:
-            case DescriptorType::StorageImage:
-                TransitionTextureView<VerifyOnly>(pCtxVkImpl, Res.pObject.RawPtr<TextureViewVkImpl>(), Res.Type);
-                break;
-
-            case DescriptorType::Sampler:
-                // Nothing to do with samplers
-                break;
+    const Uint32 ContentRevision = m_ContentRevision.load(std::memory_order_relaxed);
+    const Uint64 StateEpoch      = pCtxVkImpl->GetResourceStateEpoch();
+    if (CtxState.ContentRevision == ContentRevision)
+    {
+        bool StatesChanged = false;
+        if (CtxState.StateEpoch != StateEpoch)
+        {
+            // Some resource has changed its state. Only the states of the resources in this cache
+            // are checked, so changes to any other resources do not invalidate the transitions.
+            for (const TransitionedResource& TrRes : CtxState.Resources)
+            {
+                VERIFY_EXPR(TrRes.ResIdx < m_TotalResources);
+                Uint32 StateRevision = 0;
+                if (!GetResourceStateRevision(pResources[TrRes.ResIdx], StateRevision) || StateRevision != TrRes.StateRevision)
+                {
+                    StatesChanged = true;
+                    break;
+                }
+            }
+            if (!StatesChanged)
+                CtxState.StateEpoch = StateEpoch;
+        }
 
-            case DescriptorType::InputAttachment:
-            case DescriptorType::InputAttachment_General:
-                // Nothing to do with input attachments - they are transitioned by the render pass.
-                // There is nothing we can validate here - a texture may be in different state at
-                // the beginning of the render pass before being transitioned to INPUT_ATTACHMENT state.
-                break;
+        if (!StatesChanged)
+        {
+            // Neither the cache contents nor the state of any resource have changed since the resources were
+            // last transitioned, so the only work left is to execute UAV barriers.
+            for (const TransitionedResource& TrRes : CtxState.Resources)
+            {
+                if (TrRes.RequiresUAVBarrier)
+                    TransitionResource<false>(pCtxVkImpl, pResources[TrRes.ResIdx]);
+            }
+            return false;
+        }
+    }
 
-            case DescriptorType::AccelerationStructure:
-                TransitionAccelStruct<VerifyOnly>(pCtxVkImpl, Res.pObject.RawPtr<TopLevelASVkImpl>(), Res.Type);
-                break;
+    CtxState.Resources.clear();
+    for (Uint32 res = 0; res < m_TotalResources; ++res)
+    {
+        Resource& Res = pResources[res];
+        TransitionResource<false>(pCtxVkImpl, Res);
 
-            default: UNEXPECTED("Unexpected resource type");
+        // Note that the revision must be read after the transition as it increments the revision
+        Uint32 StateRevision = 0;
+        if (GetResourceStateRevision(Res, StateRevision))
+        {
+            TransitionedResource TrRes;
+            TrRes.ResIdx             = res;
+            TrRes.RequiresUAVBarrier = RequiresUAVBarrier(Res) ? 1 : 0;
+            TrRes.StateRevision      = StateRevision;
+            CtxState.Resources.push_back(TrRes);
         }
     }
+
+    // The epoch must also be read after the transitions as they may change it
+    CtxState.ContentRevision = ContentRevision;
+    CtxState.StateEpoch      = pCtxVkImpl->GetResourceStateEpoch();
+
+    return true;
 }
 
-template void ShaderResourceCacheVk::TransitionResources<false>(DeviceContextVkImpl* pCtxVkImpl);
-template void ShaderResourceCacheVk::TransitionResources<true>(DeviceContextVkImpl* pCtxVkImpl);
+template bool ShaderResourceCacheVk::TransitionResources<false>(DeviceContextVkImpl* pCtxVkImpl);
+template bool ShaderResourceCacheVk::TransitionResources<true>(DeviceContextVkImpl* pCtxVkImpl);
 
 
 VkDescriptorBufferInfo ShaderResourceCacheVk::Resource::GetUniformBufferDescriptorWriteInfo() const
@@ -872,6 +1034,261 @@ VkWriteDescriptorSetAccelerationStructureKHR ShaderResourceCacheVk::Resource::Ge
 
 
 
+bool ShaderResourceCacheVk::WriteDescriptorUpdateData(Uint32 SetIndex, DescriptorUpdateData* pData) const
+{
+    const DescriptorSet& DescrSet = GetDescriptorSet(SetIndex);
+    for (Uint32 CacheOffset = 0; CacheOffset < DescrSet.GetSize(); ++CacheOffset)
+    {
+        const Resource& Res = DescrSet.GetResource(CacheOffset);
+
+        // Immutable samplers are not written by the update template
+        if (Res.Type == DescriptorType::Sampler && Res.HasImmutableSampler)
+            continue;
+
+        // The template writes every array element, so null resources can't be skipped
+        if (Res.IsNull())
+            return false;
+
+        DescriptorUpdateData& Data = pData[CacheOffset];
+
+        static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+        switch (Res.Type)
+        {
+            case DescriptorType::UniformBuffer:
+            case DescriptorType::UniformBufferDynamic:
+                Data.BufferInfo = Res.GetUniformBufferDescriptorWriteInfo();
+                break;
+
+            case DescriptorType::StorageBuffer:
+            case DescriptorType::StorageBufferDynamic:
+            case DescriptorType::StorageBuffer_ReadOnly:
+            case DescriptorType::StorageBufferDynamic_ReadOnly:
+                Data.BufferInfo = Res.GetStorageBufferDescriptorWriteInfo();
+                break;
+
+            case DescriptorType::UniformTexelBuffer:
+            case DescriptorType::StorageTexelBuffer:
+            case DescriptorType::StorageTexelBuffer_ReadOnly:
+                Data.BufferView = Res.GetBufferViewWriteInfo();
+                break;
+
+            case DescriptorType::CombinedImageSampler:
+            case DescriptorType::SeparateImage:
+            case DescriptorType::StorageImage:
+                Data.ImageInfo = Res.GetImageDescriptorWriteInfo();
+                break;
+
+            case DescriptorType::InputAttachment:
+            case DescriptorType::InputAttachment_General:
+                Data.ImageInfo = Res.GetInputAttachmentDescriptorWriteInfo();
+                break;
+
+            case DescriptorType::Sampler:
+                Data.ImageInfo = Res.GetSamplerDescriptorWriteInfo();
+                break;
+
+            case DescriptorType::AccelerationStructure:
+                Data.AccelStruct = *Res.GetAccelerationStructureWriteInfo().pAccelerationStructures;
+                break;
+
+            default:
+                UNEXPECTED("Unexpected resource type");
+        }
+    }
+
+    return true;
+}
+
+namespace
+{
+
+void WriteDescriptorBufferSampler(const ShaderResourceCacheVk::DescriptorBufferSetLayout::Descriptor& Descr,
+                                  VkSampler                                                           vkSampler,
+                                  const VulkanUtilities::LogicalDevice&                               LogicalDevice,
+                                  Uint8*                                                              pSetData)
+{
+    VkDescriptorGetInfoEXT GetInfo{};
+    GetInfo.sType         = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    GetInfo.type          = VK_DESCRIPTOR_TYPE_SAMPLER;
+    GetInfo.data.pSampler = &vkSampler;
+    LogicalDevice.GetDescriptor(GetInfo, Descr.Size, pSetData + Descr.Offset);
+}
+
+} // namespace
+
+void ShaderResourceCacheVk::WriteDescriptorBufferResource(const Resource&                              Res,
+                                                          const DescriptorBufferSetLayout::Descriptor& Descr,
+                                                          const VulkanUtilities::LogicalDevice&        LogicalDevice,
+                                                          DeviceContextVkImpl*                         pCtx,
+                                                          Uint8*                                       pSetData)
+{
+    VERIFY_EXPR(!Res.IsNull());
+
+    VkDescriptorGetInfoEXT GetInfo{};
+    GetInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_GET_INFO_EXT;
+    GetInfo.type  = DescriptorTypeToVkDescriptorBufferType(Res.Type);
+
+    VkDescriptorImageInfo      ImageInfo{};
+    VkDescriptorAddressInfoEXT AddressInfo{};
+    AddressInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_ADDRESS_INFO_EXT;
+
+    // Descriptor buffers do not support dynamic offsets, so the offset of a dynamic buffer is added to the address
+    auto GetDynamicOffset = [pCtx](const BufferVkImpl* pBuffVk) -> size_t {
+        if (pBuffVk->GetDesc().Usage != USAGE_DYNAMIC)
+            return 0;
+        VERIFY(pCtx != nullptr, "Device context is required to write descriptors of dynamic buffers");
+        return pCtx->GetDynamicBufferOffset(pBuffVk, /*VerifyAllocation = */ false);
+    };
+
+    static_assert(static_cast<Uint32>(DescriptorType::Count) == 16, "Please update the switch below to handle the new descriptor type");
+    switch (Res.Type)
+    {
+        case DescriptorType::UniformBuffer:
+        case DescriptorType::UniformBufferDynamic:
+        {
+            const BufferVkImpl* pBuffVk = Res.pObject.ConstPtr<BufferVkImpl>();
+
+            AddressInfo.address         = pBuffVk->GetVkDeviceAddress() + Res.BufferBaseOffset + Res.BufferDynamicOffset + GetDynamicOffset(pBuffVk);
+            AddressInfo.range           = Res.BufferRangeSize;
+            GetInfo.data.pUniformBuffer = &AddressInfo;
+            break;
+        }
+
+        case DescriptorType::StorageBuffer:
+        case DescriptorType::StorageBufferDynamic:
+        case DescriptorType::StorageBuffer_ReadOnly:
+        case DescriptorType::StorageBufferDynamic_ReadOnly:
+        {
+            const BufferVkImpl* pBuffVk = Res.pObject.ConstPtr<BufferViewVkImpl>()->GetBuffer<const BufferVkImpl>();
+
+            AddressInfo.address         = pBuffVk->GetVkDeviceAddress() + Res.BufferBaseOffset + Res.BufferDynamicOffset + GetDynamicOffset(pBuffVk);
+            AddressInfo.range           = Res.BufferRangeSize;
+            GetInfo.data.pStorageBuffer = &AddressInfo;
+            break;
+        }
+
+        case DescriptorType::UniformTexelBuffer:
+        case DescriptorType::StorageTexelBuffer:
+        case DescriptorType::StorageTexelBuffer_ReadOnly:
+        {
+            const BufferViewVkImpl* pBuffViewVk = Res.pObject.ConstPtr<BufferViewVkImpl>();
+            const BufferViewDesc&   ViewDesc    = pBuffViewVk->GetDesc();
+
+            AddressInfo.address = pBuffViewVk->GetBuffer<const BufferVkImpl>()->GetVkDeviceAddress() + ViewDesc.ByteOffset;
+            AddressInfo.range   = ViewDesc.ByteWidth;
+            AddressInfo.format  = TypeToVkFormat(ViewDesc.Format.ValueType, ViewDesc.Format.NumComponents, ViewDesc.Format.IsNormalized);
+            if (Res.Type == DescriptorType::UniformTexelBuffer)
+                GetInfo.data.pUniformTexelBuffer = &AddressInfo;
+            else
+                GetInfo.data.pStorageTexelBuffer = &AddressInfo;
+            break;
+        }
+
+        case DescriptorType::CombinedImageSampler:
+            ImageInfo = Res.GetImageDescriptorWriteInfo();
+            if (Res.HasImmutableSampler)
+                ImageInfo.sampler = Descr.ImmutableSampler;
+            GetInfo.data.pCombinedImageSampler = &ImageInfo;
+            break;
+
+        case DescriptorType::SeparateImage:
+            ImageInfo                  = Res.GetImageDescriptorWriteInfo();
+            GetInfo.data.pSampledImage = &ImageInfo;
+            break;
+
+        case DescriptorType::StorageImage:
+            ImageInfo                  = Res.GetImageDescriptorWriteInfo();
+            GetInfo.data.pStorageImage = &ImageInfo;
+            break;
+
+        case DescriptorType::InputAttachment:
+        case DescriptorType::InputAttachment_General:
+            ImageInfo                          = Res.GetInputAttachmentDescriptorWriteInfo();
+            GetInfo.data.pInputAttachmentImage = &ImageInfo;
+            break;
+
+        case DescriptorType::Sampler:
+            WriteDescriptorBufferSampler(Descr, Res.pObject.ConstPtr<SamplerVkImpl>()->GetVkSampler(), LogicalDevice, pSetData);
+            return;
+
+        case DescriptorType::AccelerationStructure:
+            GetInfo.data.accelerationStructure = Res.pObject.ConstPtr<TopLevelASVkImpl>()->GetVkDeviceAddress();
+            break;
+
+        default:
+            UNEXPECTED("Unexpected resource type");
+            return;
+    }
+
+    LogicalDevice.GetDescriptor(GetInfo, Descr.Size, pSetData + Descr.Offset);
+}
+
+void ShaderResourceCacheVk::WriteDescriptorBufferData(Uint32                                SetIndex,
+                                                      const DescriptorBufferSetLayout&      Layout,
+                                                      const VulkanUtilities::LogicalDevice& LogicalDevice,
+                                                      DeviceContextVkImpl*                  pCtx,
+                                                      Uint8*                                pData) const
+{
+    const DescriptorSet& DescrSet = GetDescriptorSet(SetIndex);
+    VERIFY_EXPR(Layout.Descriptors.size() == DescrSet.GetSize());
+    for (Uint32 CacheOffset = 0; CacheOffset < DescrSet.GetSize(); ++CacheOffset)
+    {
+        const Resource&                              Res   = DescrSet.GetResource(CacheOffset);
+        const DescriptorBufferSetLayout::Descriptor& Descr = Layout.Descriptors[CacheOffset];
+
+        // Unlike descriptor sets, descriptor buffers do not get immutable samplers from the set layout,
+        // so they must be written by the application.
+        if (Res.Type == DescriptorType::Sampler && Res.HasImmutableSampler)
+        {
+            VERIFY_EXPR(Descr.ImmutableSampler != VK_NULL_HANDLE);
+            WriteDescriptorBufferSampler(Descr, Descr.ImmutableSampler, LogicalDevice, pData);
+            continue;
+        }
+
+        // Unbound resources are not accessed by the pipeline
+        if (Res.IsNull())
+            continue;
+
+        WriteDescriptorBufferResource(Res, Descr, LogicalDevice, pCtx, pData);
+    }
+
+    for (const DescriptorBufferSetLayout::Descriptor& Sampler : Layout.ImmutableSamplers)
+        WriteDescriptorBufferSampler(Sampler, Sampler.ImmutableSampler, LogicalDevice, pData);
+}
+
+void ShaderResourceCacheVk::AssignPersistentDescriptorBufferSet(Uint32                                    SetIndex,
+                                                                const DescriptorBufferSetLayout&          Layout,
+                                                                RenderDeviceVkImpl&                       DeviceVk,
+                                                                VulkanDynamicMemoryManager::MasterBlock&& Block,
+                                                                VkDeviceSize                              Offset)
+{
+    VERIFY(!m_pPersistentDescrBufferSet, "Persistent descriptor buffer set has already been assigned");
+    VERIFY(Block.IsValid(), "Descriptor buffer memory block is not valid");
+
+    m_pPersistentDescrBufferSet = std::make_unique<PersistentDescriptorBufferSet>();
+
+    VulkanDynamicMemoryManager* pDescrMemMgr = DeviceVk.GetDescriptorMemoryManager();
+    VERIFY_EXPR(pDescrMemMgr != nullptr);
+
+    PersistentDescriptorBufferSet& PersistentSet = *m_pPersistentDescrBufferSet;
+    PersistentSet.Block     = std::move(Block);
+    PersistentSet.pLayout   = &Layout;
+    PersistentSet.pDeviceVk = &DeviceVk;
+    PersistentSet.pData     = pDescrMemMgr->GetCPUAddress() + Offset;
+    PersistentSet.Offset    = Offset;
+    PersistentSet.SetIndex  = SetIndex;
+
+    const DescriptorSet& DescrSet = GetDescriptorSet(SetIndex);
+    for (Uint32 CacheOffset = 0; CacheOffset < DescrSet.GetSize(); ++CacheOffset)
+    {
+        if (IsDynamicBuffer(DescrSet.GetResource(CacheOffset)))
+            ++PersistentSet.NumDynamicBuffers;
+    }
+
+    // Write immutable samplers and any resources that have already been bound
+    WriteDescriptorBufferData(SetIndex, Layout, DeviceVk.GetLogicalDevice(), nullptr, PersistentSet.pData);
+}
+
 Uint32 ShaderResourceCacheVk::GetDynamicBufferOffsets(DeviceContextVkImpl*   pCtx,
                                                       std::vector<uint32_t>& Offsets,
                                                       Uint32                 StartInd) const
@@ -297,7 +297,8 @@ BindResourceHelper::BindResourceHelper(const PipelineResourceSignatureVkImpl& Si
             if (m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_STATIC ||
                 m_ResDesc.VarType == SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE)
             {
-                VERIFY(vkDescrSet != VK_NULL_HANDLE, "Static and mutable variables must have a valid Vulkan descriptor set assigned");
+                VERIFY(vkDescrSet != VK_NULL_HANDLE || Signature.GetDevice()->UseDescriptorBuffers(),
+                       "Static and mutable variables must have a valid Vulkan descriptor set assigned");
             }
             else
             {
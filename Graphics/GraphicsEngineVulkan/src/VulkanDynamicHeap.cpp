@@ -47,34 +47,35 @@ static VkDeviceSize GetDefaultAlignment(const VulkanUtilities::PhysicalDevice& P
 VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Allocator,
                                                        RenderDeviceVkImpl& DeviceVk,
                                                        Uint32              Size,
-                                                       Uint64              CommandQueueMask) :
+                                                       Uint64              CommandQueueMask,
+                                                       VkBufferUsageFlags  Usage,
+                                                       const char*         Name,
+                                                       Uint32              PersistentSize) :
     // clang-format off
     TBase             {Allocator, Size},
     m_DeviceVk        {DeviceVk},
+    m_Usage           {Usage},
     m_DefaultAlignment{GetDefaultAlignment(DeviceVk.GetPhysicalDevice())},
     m_CommandQueueMask{CommandQueueMask}
 // clang-format on
 {
     VERIFY((Size & (MasterBlockAlignment - 1)) == 0, "Heap size (", Size, " is not aligned by the master block alignment (", Uint32{MasterBlockAlignment}, ")");
 
+    if (PersistentSize > 0)
+        m_PersistentBlockMgr = std::make_unique<PersistentBlockManager>(Allocator, PersistentSize);
+
     VkBufferCreateInfo VkBuffCI{};
     VkBuffCI.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
     VkBuffCI.pNext = nullptr;
     VkBuffCI.flags = 0; // VK_BUFFER_CREATE_SPARSE_BINDING_BIT, VK_BUFFER_CREATE_SPARSE_RESIDENCY_BIT, VK_BUFFER_CREATE_SPARSE_ALIASED_BIT
-    VkBuffCI.size  = Size;
-    VkBuffCI.usage =
-        VK_BUFFER_USAGE_TRANSFER_SRC_BIT |
-        VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
-        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
-        VK_BUFFER_USAGE_INDEX_BUFFER_BIT |
-        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT |
-        VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT;
+    VkBuffCI.size  = VkDeviceSize{Size} + PersistentSize;
+    VkBuffCI.usage = Usage;
     VkBuffCI.sharingMode           = VK_SHARING_MODE_EXCLUSIVE;
     VkBuffCI.queueFamilyIndexCount = 0;
     VkBuffCI.pQueueFamilyIndices   = nullptr;
 
     const VulkanUtilities::LogicalDevice& LogicalDevice = DeviceVk.GetLogicalDevice();
-    m_VkBuffer                                          = LogicalDevice.CreateBuffer(VkBuffCI, "Dynamic heap buffer");
+    m_VkBuffer                                          = LogicalDevice.CreateBuffer(VkBuffCI, Name);
     VkMemoryRequirements MemReqs                        = LogicalDevice.GetBufferMemoryRequirements(m_VkBuffer);
 
     const VulkanUtilities::PhysicalDevice& PhysicalDevice = DeviceVk.GetPhysicalDevice();
@@ -84,6 +85,14 @@ VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Alloc
     MemAlloc.sType          = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
     MemAlloc.allocationSize = MemReqs.size;
 
+    VkMemoryAllocateFlagsInfo FlagsInfo{};
+    if (Usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)
+    {
+        FlagsInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO;
+        FlagsInfo.flags = VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT;
+        MemAlloc.pNext  = &FlagsInfo;
+    }
+
     // VK_MEMORY_PROPERTY_HOST_COHERENT_BIT bit specifies that the host cache management commands vkFlushMappedMemoryRanges
     // and vkInvalidateMappedMemoryRanges are NOT needed to flush host writes to the device or make device writes visible
     // to the host (10.2)
@@ -111,7 +120,13 @@ VulkanDynamicMemoryManager::VulkanDynamicMemoryManager(IMemoryAllocator&   Alloc
     err = LogicalDevice.BindBufferMemory(m_VkBuffer, m_BufferMemory, 0 /*offset*/);
     CHECK_VK_ERROR_AND_THROW(err, "Failed to bind buffer memory");
 
-    LOG_INFO_MESSAGE("GPU dynamic heap created. Total buffer size: ", FormatMemorySize(Size, 2));
+    if (Usage & VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT)
+        m_DeviceAddress = LogicalDevice.GetBufferDeviceAddress(m_VkBuffer);
+
+    if (PersistentSize > 0)
+        LOG_INFO_MESSAGE(Name, " created. Total buffer size: ", FormatMemorySize(Size, 2), " + ", FormatMemorySize(PersistentSize, 2), " persistent");
+    else
+        LOG_INFO_MESSAGE(Name, " created. Total buffer size: ", FormatMemorySize(Size, 2));
 }
 
 void VulkanDynamicMemoryManager::Destroy()
@@ -219,6 +234,28 @@ VulkanDynamicMemoryManager::MasterBlock VulkanDynamicMemoryManager::AllocateMast
     return Block;
 }
 
+VulkanDynamicMemoryManager::MasterBlock VulkanDynamicMemoryManager::AllocatePersistentBlock(OffsetType SizeInBytes, OffsetType Alignment)
+{
+    if (!m_PersistentBlockMgr)
+        return MasterBlock{};
+
+    // The region starts at a master-block-aligned offset, so aligning the offset within the region
+    // aligns the offset in the buffer.
+    VERIFY(Alignment <= MasterBlockAlignment && (MasterBlockAlignment % Alignment) == 0,
+           "Alignment (", Alignment, ") must be a divisor of the master block alignment (", Uint32{MasterBlockAlignment}, ")");
+    VERIFY_EXPR((GetPersistentRegionOffset() % MasterBlockAlignment) == 0);
+
+    // Persistent blocks are not recycled every frame, so there is no point in waiting for the GPU
+    return m_PersistentBlockMgr->AllocateMasterBlock(SizeInBytes, Alignment);
+}
+
+void VulkanDynamicMemoryManager::ReleasePersistentBlock(MasterBlock&& Block, Uint64 CmdQueueMask)
+{
+    VERIFY_EXPR(m_PersistentBlockMgr);
+    std::vector<MasterBlock> Blocks{std::move(Block)};
+    m_PersistentBlockMgr->ReleaseMasterBlocks(Blocks, m_DeviceVk, CmdQueueMask);
+}
+
 
 VulkanDynamicAllocation VulkanDynamicHeap::Allocate(Uint32 SizeInBytes, Uint32 Alignment)
 {
@@ -63,19 +63,25 @@ CommandBufferPool::~CommandBufferPool()
     {
         m_Device->FreeCommandBuffer(m_CmdPool, CmdBuff);
     }
+    for (VkCommandBuffer CmdBuff : m_SecondaryCmdBuffers)
+    {
+        m_Device->FreeCommandBuffer(m_CmdPool, CmdBuff);
+    }
     m_CmdPool.Release();
 }
 
-VkCommandBuffer CommandBufferPool::GetCommandBuffer(const char* DebugName)
+VkCommandBuffer CommandBufferPool::GetCommandBuffer(const char* DebugName, const VkCommandBufferInheritanceInfo* pInheritanceInfo)
 {
     VkCommandBuffer CmdBuffer = VK_NULL_HANDLE;
 
+    const bool IsSecondary = pInheritanceInfo != nullptr;
     {
         std::lock_guard<std::mutex> Lock{m_Mutex};
 
-        if (!m_CmdBuffers.empty())
+        std::deque<VkCommandBuffer>& CmdBuffers = IsSecondary ? m_SecondaryCmdBuffers : m_CmdBuffers;
+        if (!CmdBuffers.empty())
         {
-            CmdBuffer    = m_CmdBuffers.front();
+            CmdBuffer    = CmdBuffers.front();
             VkResult err = vkResetCommandBuffer(
                 CmdBuffer,
                 0 // VK_COMMAND_BUFFER_RESET_RELEASE_RESOURCES_BIT -  specifies that most or all memory resources currently
@@ -83,7 +89,7 @@ VkCommandBuffer CommandBufferPool::GetCommandBuffer(const char* DebugName)
             );
             DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to reset command buffer");
             (void)err;
-            m_CmdBuffers.pop_front();
+            CmdBuffers.pop_front();
         }
     }
 
@@ -95,7 +101,7 @@ VkCommandBuffer CommandBufferPool::GetCommandBuffer(const char* DebugName)
         BuffAllocInfo.sType              = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         BuffAllocInfo.pNext              = nullptr;
         BuffAllocInfo.commandPool        = m_CmdPool;
-        BuffAllocInfo.level              = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        BuffAllocInfo.level              = IsSecondary ? VK_COMMAND_BUFFER_LEVEL_SECONDARY : VK_COMMAND_BUFFER_LEVEL_PRIMARY;
         BuffAllocInfo.commandBufferCount = 1;
 
         CmdBuffer = m_Device->AllocateVkCommandBuffer(BuffAllocInfo);
@@ -109,7 +115,12 @@ VkCommandBuffer CommandBufferPool::GetCommandBuffer(const char* DebugName)
     CmdBuffBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT; // Each recording of the command buffer will only be
                                                                           // submitted once, and the command buffer will be reset
                                                                           // and recorded again between each submission.
-    CmdBuffBeginInfo.pInheritanceInfo = nullptr;                          // Ignored for a primary command buffer
+    CmdBuffBeginInfo.pInheritanceInfo = pInheritanceInfo;                 // Ignored for a primary command buffer
+    if (IsSecondary)
+    {
+        // The secondary command buffer will be executed entirely inside a render pass
+        CmdBuffBeginInfo.flags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    }
 
     VkResult err = vkBeginCommandBuffer(CmdBuffer, &CmdBuffBeginInfo);
     DEV_CHECK_ERR(err == VK_SUCCESS, "Failed to begin command buffer");
@@ -120,10 +131,11 @@ VkCommandBuffer CommandBufferPool::GetCommandBuffer(const char* DebugName)
     return CmdBuffer;
 }
 
-void CommandBufferPool::RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer)
+void CommandBufferPool::RecycleCommandBuffer(VkCommandBuffer&& CmdBuffer, VkCommandBufferLevel Level)
 {
     std::lock_guard<std::mutex> Lock{m_Mutex};
-    m_CmdBuffers.emplace_back(CmdBuffer);
+    std::deque<VkCommandBuffer>& CmdBuffers = Level == VK_COMMAND_BUFFER_LEVEL_SECONDARY ? m_SecondaryCmdBuffers : m_CmdBuffers;
+    CmdBuffers.emplace_back(CmdBuffer);
     CmdBuffer = VK_NULL_HANDLE;
 #ifdef DILIGENT_DEVELOPMENT
     --m_BuffCounter;
@@ -438,6 +438,18 @@ PipelineCacheWrapper LogicalDevice::CreatePipelineCache(const VkPipelineCacheCre
     return CreateVulkanObject<VkPipelineCache, VulkanHandleTypeId::PipelineCache>(vkCreatePipelineCache, CI, DebugName, "pipeline cache");
 }
 
+DescrUpdateTemplateWrapper LogicalDevice::CreateDescriptorUpdateTemplate(const VkDescriptorUpdateTemplateCreateInfo& CI, const char* DebugName) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(CI.sType == VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO);
+    VERIFY(m_EnabledExtFeatures.DescrUpdateTemplate, "Descriptor update template extension is not enabled");
+    return CreateVulkanObject<VkDescriptorUpdateTemplate, VulkanHandleTypeId::DescriptorUpdateTemplate>(vkCreateDescriptorUpdateTemplateKHR, CI, DebugName, "descriptor update template");
+#else
+    UNSUPPORTED("vkCreateDescriptorUpdateTemplateKHR is only available through Volk");
+    return DescrUpdateTemplateWrapper{};
+#endif
+}
+
 void LogicalDevice::ReleaseVulkanObject(CommandPoolWrapper&& CmdPool) const
 {
     vkDestroyCommandPool(m_VkDevice, CmdPool.m_VkObject, m_VkAllocator);
@@ -556,6 +568,16 @@ void LogicalDevice::ReleaseVulkanObject(PipelineCacheWrapper&& PipeCache) const
     PipeCache.m_VkObject = VK_NULL_HANDLE;
 }
 
+void LogicalDevice::ReleaseVulkanObject(DescrUpdateTemplateWrapper&& DescrUpdateTemplate) const
+{
+#if DILIGENT_USE_VOLK
+    vkDestroyDescriptorUpdateTemplateKHR(m_VkDevice, DescrUpdateTemplate.m_VkObject, m_VkAllocator);
+    DescrUpdateTemplate.m_VkObject = VK_NULL_HANDLE;
+#else
+    UNSUPPORTED("vkDestroyDescriptorUpdateTemplateKHR is only available through Volk");
+#endif
+}
+
 void LogicalDevice::FreeDescriptorSet(VkDescriptorPool Pool, VkDescriptorSet Set) const
 {
     VERIFY_EXPR(Pool != VK_NULL_HANDLE && Set != VK_NULL_HANDLE);
@@ -609,6 +631,21 @@ VkDeviceAddress LogicalDevice::GetAccelerationStructureDeviceAddress(VkAccelerat
 #endif
 }
 
+VkDeviceAddress LogicalDevice::GetBufferDeviceAddress(VkBuffer vkBuffer) const
+{
+#if DILIGENT_USE_VOLK
+    VkBufferDeviceAddressInfoKHR Info = {};
+
+    Info.sType  = VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO_KHR;
+    Info.buffer = vkBuffer;
+
+    return vkGetBufferDeviceAddressKHR(m_VkDevice, &Info);
+#else
+    UNSUPPORTED("vkGetBufferDeviceAddressKHR is only available through Volk");
+    return 0;
+#endif
+}
+
 void LogicalDevice::GetAccelerationStructureBuildSizes(const VkAccelerationStructureBuildGeometryInfoKHR& BuildInfo, const uint32_t* pMaxPrimitiveCounts, VkAccelerationStructureBuildSizesInfoKHR& SizeInfo) const
 {
 #if DILIGENT_USE_VOLK
@@ -698,6 +735,52 @@ void LogicalDevice::UpdateDescriptorSets(uint32_t                    descriptorW
     vkUpdateDescriptorSets(m_VkDevice, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
 }
 
+void LogicalDevice::UpdateDescriptorSetWithTemplate(VkDescriptorSet            descriptorSet,
+                                                    VkDescriptorUpdateTemplate descriptorUpdateTemplate,
+                                                    const void*                pData) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(descriptorSet != VK_NULL_HANDLE && descriptorUpdateTemplate != VK_NULL_HANDLE);
+    vkUpdateDescriptorSetWithTemplateKHR(m_VkDevice, descriptorSet, descriptorUpdateTemplate, pData);
+#else
+    UNSUPPORTED("vkUpdateDescriptorSetWithTemplateKHR is only available through Volk");
+#endif
+}
+
+VkDeviceSize LogicalDevice::GetDescriptorSetLayoutSize(VkDescriptorSetLayout layout) const
+{
+#if DILIGENT_USE_VOLK
+    VkDeviceSize Size = 0;
+    vkGetDescriptorSetLayoutSizeEXT(m_VkDevice, layout, &Size);
+    return Size;
+#else
+    UNSUPPORTED("vkGetDescriptorSetLayoutSizeEXT is only available through Volk");
+    return 0;
+#endif
+}
+
+VkDeviceSize LogicalDevice::GetDescriptorSetLayoutBindingOffset(VkDescriptorSetLayout layout, uint32_t binding) const
+{
+#if DILIGENT_USE_VOLK
+    VkDeviceSize Offset = 0;
+    vkGetDescriptorSetLayoutBindingOffsetEXT(m_VkDevice, layout, binding, &Offset);
+    return Offset;
+#else
+    UNSUPPORTED("vkGetDescriptorSetLayoutBindingOffsetEXT is only available through Volk");
+    return 0;
+#endif
+}
+
+void LogicalDevice::GetDescriptor(const VkDescriptorGetInfoEXT& DescriptorInfo, size_t dataSize, void* pDescriptor) const
+{
+#if DILIGENT_USE_VOLK
+    VERIFY_EXPR(pDescriptor != nullptr);
+    vkGetDescriptorEXT(m_VkDevice, &DescriptorInfo, dataSize, pDescriptor);
+#else
+    UNSUPPORTED("vkGetDescriptorEXT is only available through Volk");
+#endif
+}
+
 VkResult LogicalDevice::ResetCommandPool(VkCommandPool           vkCmdPool,
                                          VkCommandPoolResetFlags flags) const
 {
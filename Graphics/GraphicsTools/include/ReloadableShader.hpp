@@ -29,8 +29,13 @@
 /// \file
 /// Definition of the Diligent::ReloadableShader class
 
+#include <string>
+#include <vector>
+#include <unordered_map>
+
 #include "Shader.h"
 #include "ShaderBase.hpp"
+#include "XXH128Hasher.hpp"
 
 namespace Diligent
 {
@@ -48,10 +53,21 @@ public:
     static constexpr INTERFACE_ID IID_InternalImpl =
         {0x6bfaaabd, 0xfe55, 0x4420, {0xb0, 0xc8, 0x5c, 0x4b, 0x4f, 0x5f, 0x8d, 0x65}};
 
+    /// \param [in] pStateCache        - Render state cache that owns the shader.
+    /// \param [in] pShader            - Internal shader object.
+    /// \param [in] CreateInfo         - Shader create info that will be used to reload the shader.
+    /// \param [in] CompiledCreateInfo - Shader create info that pShader was compiled from.
+    ///                                  It differs from CreateInfo by the source stream factory
+    ///                                  when the render state cache uses a reload source.
+    ///
+    /// Source dependencies are always hashed through the CreateInfo factory, so that they are compared
+    /// with the sources the shader will be reloaded from. If these sources differ from the ones the shader
+    /// was compiled from, the shader is recompiled by the next reload.
     ReloadableShader(IReferenceCounters*     pRefCounters,
                      RenderStateCacheImpl*   pStateCache,
                      IShader*                pShader,
-                     const ShaderCreateInfo& CreateInfo);
+                     const ShaderCreateInfo& CreateInfo,
+                     const ShaderCreateInfo& CompiledCreateInfo);
 
     ~ReloadableShader();
 
@@ -107,14 +123,62 @@ public:
     static void Create(RenderStateCacheImpl*   pStateCache,
                        IShader*                pShader,
                        const ShaderCreateInfo& CreateInfo,
+                       const ShaderCreateInfo& CompiledCreateInfo,
                        IShader**               ppReloadableShader);
 
     bool Reload();
 
+    /// Compiles the shader from its current sources without replacing the internal shader object.
+    /// The method only reads the shader's create info and calls thread-safe render state cache methods,
+    /// so it may be called from a worker thread while other shaders are being recompiled, provided that
+    /// pSourceFactory is safe to use from multiple threads.
+    /// \param [in]  pSourceFactory - Source stream factory to read the sources through instead of the one
+    ///                               in the create info, or null to use the create info factory.
+    /// \param [out] FoundInCache   - Whether the shader was found in the cache and thus was not recompiled.
+    /// \return                      The new shader object, or null if the compilation failed.
+    RefCntAutoPtr<IShader> Recompile(IShaderSourceInputStreamFactory* pSourceFactory, bool& FoundInCache) const;
+
+    /// Returns the source stream factory the shader is reloaded from.
+    IShaderSourceInputStreamFactory* GetSourceFactory() const
+    {
+        return m_CreateInfo.Get().pShaderSourceStreamFactory;
+    }
+
+    /// Replaces the internal shader object with pNewShader (unless it is null) and records
+    /// the hashes of the current sources.
+    /// \note  This method is not thread-safe and must be called from the thread that runs the reload.
+    void CommitReload(IShader* pNewShader);
+
+    /// Hashes of the source files read during a single reload, keyed by the source stream factory and the file path.
+    /// Files shared by multiple shaders are thus only read once.
+    using SourceHashCache = std::unordered_map<IShaderSourceInputStreamFactory*, std::unordered_map<std::string, XXH128Hash>>;
+
+    /// Returns true if any of the source files the shader was compiled from, including
+    /// all files it transitively includes, has changed since the shader was last compiled.
+    /// \param [in] HashCache     - Hashes of the files that have already been read during this reload.
+    /// \param [in] pChangedFiles - Optional list of files reported as modified by a file watcher.
+    ///                             If not null, only the dependencies that match one of these files
+    ///                             are read, while all other dependencies are assumed to be unchanged.
+    bool HasSourceChanges(SourceHashCache& HashCache, const std::vector<std::string>* pChangedFiles = nullptr) const;
+
+private:
+    void UpdateSourceDependencies(const ShaderCreateInfo& ShaderCI);
+
 private:
     RefCntAutoPtr<RenderStateCacheImpl> m_pStateCache;
     RefCntAutoPtr<IShader>              m_pShader;
     ShaderCreateInfoWrapper             m_CreateInfo;
+
+    struct SourceDependency
+    {
+        std::string FilePath;
+        XXH128Hash  Hash;
+    };
+    // All source files the shader depends on (the main source file and all includes)
+    std::vector<SourceDependency> m_SourceDependencies;
+
+    // False if the dependencies could not be determined, in which case the shader is always reloaded
+    bool m_SourceDependenciesValid = false;
 };
 
 } // namespace Diligent
@@ -31,6 +31,7 @@
 
 #include <unordered_map>
 #include <mutex>
+#include <memory>
 
 #include "RenderStateCache.h"
 #include "SerializationDevice.h"
@@ -38,6 +39,7 @@
 #include "UniqueIdentifier.hpp"
 #include "ObjectBase.hpp"
 #include "XXH128Hasher.hpp"
+#include "FileWatcher.hpp"
 
 namespace Diligent
 {
@@ -134,6 +136,8 @@ private:
     bool CreatePipelineState(const CreateInfoType& PSOCreateInfo,
                              IPipelineState**      ppPipelineState);
 
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> GetCompoundReloadSource(IShaderSourceInputStreamFactory* pSourceFactory);
+
 private:
     RefCntAutoPtr<IRenderDevice>                   m_pDevice;
     const RENDER_DEVICE_TYPE                       m_DeviceType;
@@ -143,6 +147,15 @@ private:
     RefCntAutoPtr<IArchiver>                       m_pArchiver;
     RefCntAutoPtr<IDearchiver>                     m_pDearchiver;
 
+    // Reports the modified source files so that the reload does not need to re-read all of them.
+    // Null if no directory is watched or the platform does not support file change notifications.
+    std::unique_ptr<FileWatcher> m_pFileWatcher;
+
+    // Compound reload source factories, one per original shader source factory.
+    // Sharing the factories lets the reload detect changes in each source file only once.
+    std::mutex                                                                                       m_CompoundReloadSourcesMtx;
+    std::unordered_map<IShaderSourceInputStreamFactory*, RefCntAutoPtr<IShaderSourceInputStreamFactory>> m_CompoundReloadSources;
+
     std::mutex                                             m_ShadersMtx;
     std::unordered_map<XXH128Hash, RefCntWeakPtr<IShader>> m_Shaders;
 
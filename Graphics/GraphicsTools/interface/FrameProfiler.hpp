@@ -0,0 +1,296 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Definition of the Diligent::FrameProfiler class
+
+#include <vector>
+#include <deque>
+#include <string>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Query.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+#include "../../../Common/interface/Timer.hpp"
+#include "GPUCompletionAwaitQueue.hpp"
+
+namespace Diligent
+{
+
+/// Frame profiler create info.
+struct FrameProfilerCreateInfo
+{
+    /// Render device used to create timestamp queries.
+
+    /// If null, or if the device does not support timestamp queries,
+    /// only CPU scopes are recorded.
+    IRenderDevice* pDevice = nullptr;
+
+    /// The maximum number of resolved frames to keep in the history.
+    Uint32 MaxFrameHistory = 256;
+
+    /// Whether GPU scopes should also open debug groups in the device context.
+    bool EmitDebugGroups = false;
+};
+
+/// Hierarchical CPU/GPU frame profiler.
+
+/// The profiler records nested named CPU scopes and GPU timestamp ranges for every
+/// immediate device context used during the frame. GPU timestamps are read back
+/// several frames later, once the fence signaled at the end of the frame has
+/// completed, so the profiler never stalls the CPU waiting for the GPU.
+/// Resolved frames can be exported in the Chrome trace event format
+/// (chrome://tracing, Perfetto).
+///
+/// BeginFrame(), EndFrame() and GPU scopes must be used from the thread that owns the
+/// device contexts. CPU scopes may be recorded from any thread.
+class FrameProfiler
+{
+public:
+    explicit FrameProfiler(const FrameProfilerCreateInfo& CI);
+
+    // clang-format off
+    FrameProfiler           (const FrameProfiler&) = delete;
+    FrameProfiler& operator=(const FrameProfiler&) = delete;
+    FrameProfiler           (FrameProfiler&&)      = delete;
+    FrameProfiler& operator=(FrameProfiler&&)      = delete;
+    // clang-format on
+
+    ~FrameProfiler();
+
+    /// Timing scope.
+    struct Scope
+    {
+        static constexpr Uint32 InvalidIndex = ~0u;
+
+        /// Scope name.
+        std::string Name;
+
+        /// Begin and end times, in seconds. CPU times are measured from the profiler
+        /// creation. GPU times are aligned with the CPU timeline when the first frame
+        /// is resolved for the context, so that only relative GPU timings are meaningful.
+        double Begin = 0;
+        double End   = 0;
+
+        /// Nesting depth, where 0 is the top level.
+        Uint32 Depth = 0;
+
+        /// Index of the parent scope in the same array, or InvalidIndex for top-level scopes.
+        Uint32 Parent = InvalidIndex;
+
+        /// Index of the CPU thread that recorded the scope. Not used for GPU scopes.
+        Uint32 ThreadIndex = 0;
+    };
+
+    /// Per-context frame data.
+    struct ContextData
+    {
+        /// Context name.
+        std::string Name;
+
+        /// GPU scopes recorded in the context, in the order they were begun.
+        std::vector<Scope> GPUScopes;
+
+        /// Difference between the context statistics at the end of this frame and the previous one.
+        DeviceContextStats Stats;
+    };
+
+    /// Frame data.
+    struct FrameData
+    {
+        /// Frame index, starting from 0.
+        Uint64 FrameIndex = 0;
+
+        /// Frame begin and end CPU times, in seconds.
+        double Begin = 0;
+        double End   = 0;
+
+        /// Index of the CPU thread that called BeginFrame().
+        Uint32 ThreadIndex = 0;
+
+        /// CPU scopes recorded during the frame, in the order they were begun.
+        std::vector<Scope> CPUScopes;
+
+        /// Device contexts that were used during the frame.
+        std::vector<ContextData> Contexts;
+    };
+
+    /// Begins a new frame.
+    void BeginFrame();
+
+    /// Ends the current frame.
+
+    /// \param [in] ppContexts  - Immediate contexts whose statistics should be attached to the frame.
+    ///                           Contexts that recorded GPU scopes during the frame are always included.
+    /// \param [in] NumContexts - The number of contexts in ppContexts array.
+    ///
+    /// \remarks    The method signals a fence in every context that recorded GPU scopes,
+    ///             and must thus be called before the frame is presented.
+    ///             The method also resolves all previous frames whose GPU data is available.
+    void EndFrame(IDeviceContext* const* ppContexts = nullptr, Uint32 NumContexts = 0);
+
+    /// Begins a CPU scope on the calling thread.
+    void BeginCPUScope(const Char* Name);
+
+    /// Ends the last CPU scope begun on the calling thread.
+    void EndCPUScope();
+
+    /// Begins a GPU scope in the immediate device context.
+    void BeginGPUScope(IDeviceContext* pCtx, const Char* Name);
+
+    /// Ends the last GPU scope begun in the device context.
+    void EndGPUScope(IDeviceContext* pCtx);
+
+    /// Resolves all frames whose GPU data is available.
+    void Resolve();
+
+    /// Returns the resolved frames, from the oldest to the newest.
+    const std::deque<FrameData>& GetResolvedFrames() const
+    {
+        return m_ResolvedFrames;
+    }
+
+    /// Returns the last resolved frame, or null if no frame has been resolved yet.
+    const FrameData* GetLastResolvedFrame() const
+    {
+        return !m_ResolvedFrames.empty() ? &m_ResolvedFrames.back() : nullptr;
+    }
+
+    /// Returns the number of frames whose GPU data has not been resolved yet.
+    size_t GetNumPendingFrames() const
+    {
+        return m_PendingFrames.size();
+    }
+
+    /// Exports the resolved frames in the Chrome trace event JSON format.
+    std::string ExportChromeTrace() const;
+
+    /// Clears the resolved frame history.
+    void ClearHistory()
+    {
+        m_ResolvedFrames.clear();
+    }
+
+    /// RAII helper that records a CPU scope.
+    class CPUScope
+    {
+    public:
+        CPUScope(FrameProfiler& Profiler, const Char* Name) :
+            m_Profiler{Profiler}
+        {
+            m_Profiler.BeginCPUScope(Name);
+        }
+        ~CPUScope()
+        {
+            m_Profiler.EndCPUScope();
+        }
+
+        // clang-format off
+        CPUScope           (const CPUScope&) = delete;
+        CPUScope& operator=(const CPUScope&) = delete;
+        // clang-format on
+
+    private:
+        FrameProfiler& m_Profiler;
+    };
+
+    /// RAII helper that records a GPU scope.
+    class GPUScope
+    {
+    public:
+        GPUScope(FrameProfiler& Profiler, IDeviceContext* pCtx, const Char* Name) :
+            m_Profiler{Profiler},
+            m_pCtx{pCtx}
+        {
+            m_Profiler.BeginGPUScope(m_pCtx, Name);
+        }
+        ~GPUScope()
+        {
+            m_Profiler.EndGPUScope(m_pCtx);
+        }
+
+        // clang-format off
+        GPUScope           (const GPUScope&) = delete;
+        GPUScope& operator=(const GPUScope&) = delete;
+        // clang-format on
+
+    private:
+        FrameProfiler&  m_Profiler;
+        IDeviceContext* m_pCtx;
+    };
+
+private:
+    struct PendingFrame;
+    struct PendingGPUFrame;
+    struct ContextState;
+
+    ContextState& GetContextState(IDeviceContext* pCtx);
+    void          ResolveContext(ContextState& Ctx);
+    void          RetireResolvedFrames();
+    Uint32        GetThreadIndex(std::thread::id ThreadId);
+
+private:
+    RefCntAutoPtr<IRenderDevice> m_pDevice;
+
+    const Uint32 m_MaxFrameHistory;
+    const bool   m_EmitDebugGroups;
+    const bool   m_GPUTimingSupported;
+
+    Timer m_Timer;
+
+    Uint64 m_FrameIndex = 0;
+
+    // Frame currently being recorded
+    std::unique_ptr<PendingFrame> m_pCurrFrame;
+
+    // Frames waiting for GPU data, from the oldest to the newest
+    std::deque<std::unique_ptr<PendingFrame>> m_PendingFrames;
+
+    std::deque<FrameData> m_ResolvedFrames;
+
+    std::vector<std::unique_ptr<ContextState>> m_Contexts;
+
+    // CPU scopes may be recorded from multiple threads
+    std::mutex                                  m_CPUScopesMtx;
+    std::unordered_map<std::thread::id, Uint32> m_ThreadIndices;
+
+    struct OpenCPUScope
+    {
+        Uint64 FrameIndex;
+        Uint32 ScopeIndex;
+    };
+    // Per-thread stacks of open CPU scopes
+    std::vector<std::vector<OpenCPUScope>> m_CPUScopeStacks;
+};
+
+} // namespace Diligent
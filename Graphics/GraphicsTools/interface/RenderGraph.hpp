@@ -0,0 +1,338 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+/// \file
+/// Declaration of Diligent::RenderGraph class
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "../../GraphicsEngine/interface/RenderDevice.h"
+#include "../../GraphicsEngine/interface/DeviceContext.h"
+#include "../../GraphicsEngine/interface/Texture.h"
+#include "../../GraphicsEngine/interface/Buffer.h"
+#include "../../GraphicsEngine/interface/DeviceMemory.h"
+#include "../../GraphicsEngine/interface/Fence.h"
+#include "../../../Common/interface/RefCntAutoPtr.hpp"
+
+namespace Diligent
+{
+
+/// Handle of a resource declared in the render graph.
+struct RenderGraphResource
+{
+    static constexpr Uint32 InvalidIndex = ~0u;
+
+    /// Index of the resource in the render graph.
+    Uint32 Index = InvalidIndex;
+
+    constexpr bool IsValid() const { return Index != InvalidIndex; }
+
+    explicit constexpr operator bool() const { return IsValid(); }
+
+    constexpr bool operator==(const RenderGraphResource& RHS) const { return Index == RHS.Index; }
+    constexpr bool operator!=(const RenderGraphResource& RHS) const { return Index != RHS.Index; }
+};
+
+/// Render graph create information.
+struct RenderGraphCreateInfo
+{
+    /// Whether to place transient textures into a shared sparse memory object,
+    /// so that textures with non-overlapping lifetimes alias the same memory.
+
+    /// Sparse aliasing is only used in Direct3D12 and Vulkan backends when the
+    /// device supports sparse 2D textures with aliasing and the required bind flags.
+    /// Otherwise, transient resources are aliased by reusing pooled resources with
+    /// identical descriptions.
+    bool EnableSparseAliasing = true;
+
+    /// The number of Execute() calls a pooled resource may stay unused before it is released.
+    Uint32 MaxUnusedFrames = 4;
+};
+
+
+/// Frame render graph.
+
+/// Passes declare the resources they read and write, and the graph
+///   - culls passes whose results are not used,
+///   - computes the minimal set of resource state transitions and issues them
+///     in one batch before every pass,
+///   - aliases transient resources with non-overlapping lifetimes.
+///
+/// Typical usage:
+///
+///     RenderGraph Graph;
+///     auto GBuffer = Graph.CreateTexture(GBufferDesc);
+///     auto Output  = Graph.ImportTexture(pBackBuffer, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_PRESENT);
+///     Graph.AddPass("GBuffer", [&](IDeviceContext* pCtx, const RenderGraph& G) { ... })
+///         .Write(GBuffer, RESOURCE_STATE_RENDER_TARGET);
+///     Graph.AddPass("Lighting", [&](IDeviceContext* pCtx, const RenderGraph& G) { ... })
+///         .Read(GBuffer, RESOURCE_STATE_SHADER_RESOURCE)
+///         .Write(Output, RESOURCE_STATE_RENDER_TARGET);
+///     Graph.Execute(pDevice, pContext);
+///
+/// Passes are executed in the order they were added. Pass callbacks must not change the states
+/// of graph resources and should use Diligent::RESOURCE_STATE_TRANSITION_MODE_VERIFY.
+/// The graph may be executed multiple times; call Reset() to rebuild it.
+class RenderGraph
+{
+public:
+    /// Pass execution callback.
+    using PassCallbackType = std::function<void(IDeviceContext* pContext, const RenderGraph& Graph)>;
+
+    /// Helper object that declares the resources accessed by a pass.
+    class PassBuilder
+    {
+    public:
+        /// Declares that the pass reads the resource in the given state.
+        PassBuilder& Read(RenderGraphResource Resource, RESOURCE_STATE State);
+
+        /// Declares that the pass writes the resource in the given state.
+
+        /// A write does not depend on the previous contents of the resource.
+        /// If the pass needs the previous contents (e.g. blending or loading a render target),
+        /// use ReadWrite().
+        PassBuilder& Write(RenderGraphResource Resource, RESOURCE_STATE State);
+
+        /// Declares that the pass reads and writes the resource in the given state.
+        PassBuilder& ReadWrite(RenderGraphResource Resource, RESOURCE_STATE State);
+
+        /// Prevents the pass from being culled, e.g. when it has side effects
+        /// that are not expressed through graph resources.
+        PassBuilder& SetNeverCull(bool NeverCull = true);
+
+        /// Returns the index of the pass in the graph.
+        Uint32 GetPassIndex() const { return m_PassIndex; }
+
+    private:
+        friend RenderGraph;
+        PassBuilder(RenderGraph& Graph, Uint32 PassIndex) noexcept :
+            m_Graph{Graph},
+            m_PassIndex{PassIndex}
+        {}
+
+        PassBuilder& AddAccess(RenderGraphResource Resource, RESOURCE_STATE State, bool Read, bool Write);
+
+        RenderGraph& m_Graph;
+        const Uint32 m_PassIndex;
+    };
+
+    /// Compiled resource state transition.
+    struct Transition
+    {
+        /// Resource to transition.
+        RenderGraphResource Resource;
+
+        /// The state the resource is expected to be in, or Diligent::RESOURCE_STATE_UNKNOWN
+        /// if the state is not known at compile time.
+        RESOURCE_STATE OldState = RESOURCE_STATE_UNKNOWN;
+
+        /// The new resource state.
+        RESOURCE_STATE NewState = RESOURCE_STATE_UNKNOWN;
+
+        /// Whether previous resource contents may be discarded.
+        bool DiscardContent = false;
+    };
+
+    /// Render graph statistics.
+    struct Statistics
+    {
+        /// The total number of passes in the graph.
+        Uint32 NumPasses = 0;
+
+        /// The number of passes that were culled.
+        Uint32 NumCulledPasses = 0;
+
+        /// The number of state transitions, including UAV barriers and final transitions.
+        Uint32 NumTransitions = 0;
+
+        /// The number of transition batches (i.e. TransitionResourceStates calls).
+        Uint32 NumTransitionBatches = 0;
+
+        /// The number of transient resources used by the passes that were not culled.
+        Uint32 NumTransientResources = 0;
+
+        /// The number of physical resources backing the transient resources.
+        Uint32 NumPhysicalResources = 0;
+
+        /// The estimated amount of memory, in bytes, that the transient resources
+        /// would take without aliasing.
+        Uint64 TransientMemorySize = 0;
+
+        /// The estimated amount of memory, in bytes, taken by the physical resources.
+        Uint64 PhysicalMemorySize = 0;
+
+        /// The size of the sparse memory object that backs aliased textures, in bytes.
+        /// This value is only known after Execute().
+        Uint64 SparseMemorySize = 0;
+    };
+
+    explicit RenderGraph(const RenderGraphCreateInfo& CreateInfo = {});
+    ~RenderGraph();
+
+    // clang-format off
+    RenderGraph           (const RenderGraph&)  = delete;
+    RenderGraph& operator=(const RenderGraph&)  = delete;
+    RenderGraph           (      RenderGraph&&) = delete;
+    RenderGraph& operator=(      RenderGraph&&) = delete;
+    // clang-format on
+
+    /// Declares a transient texture that is created and owned by the graph.
+
+    /// The texture contents are undefined at the beginning of the first pass
+    /// that accesses it and are discarded after the last one, unless the
+    /// texture is marked as output with MarkOutput().
+    RenderGraphResource CreateTexture(const TextureDesc& Desc);
+
+    /// Declares a transient buffer that is created and owned by the graph.
+    RenderGraphResource CreateBuffer(const BufferDesc& Desc);
+
+    /// Imports an external texture into the graph.
+
+    /// \param[in] pTexture     - Texture to import.
+    /// \param[in] InitialState - The state of the texture before the first pass, or
+    ///                           Diligent::RESOURCE_STATE_UNKNOWN to use the state tracked by the engine.
+    /// \param[in] FinalState   - The state to transition the texture to after the last pass, or
+    ///                           Diligent::RESOURCE_STATE_UNKNOWN to leave it in the state of the last access.
+    ///
+    /// Passes that write to imported resources are never culled.
+    RenderGraphResource ImportTexture(ITexture*      pTexture,
+                                      RESOURCE_STATE InitialState = RESOURCE_STATE_UNKNOWN,
+                                      RESOURCE_STATE FinalState   = RESOURCE_STATE_UNKNOWN);
+
+    /// Imports an external buffer into the graph, see ImportTexture().
+    RenderGraphResource ImportBuffer(IBuffer*       pBuffer,
+                                     RESOURCE_STATE InitialState = RESOURCE_STATE_UNKNOWN,
+                                     RESOURCE_STATE FinalState   = RESOURCE_STATE_UNKNOWN);
+
+    /// Marks the transient resource as the graph output.
+
+    /// Passes that produce the output are never culled, and the physical resource
+    /// is not reused by other transient resources until the end of the graph,
+    /// so that its contents can be retrieved with GetTexture() or GetBuffer() after Execute().
+    void MarkOutput(RenderGraphResource Resource);
+
+    /// Adds a pass to the graph.
+
+    /// \param[in] Name     - Pass name. It is also used as the debug group name.
+    /// \param[in] Callback - Pass execution callback. May be null, in which case the pass
+    ///                       only transitions the resources to the declared states.
+    ///
+    /// \return     Pass builder object that should be used to declare resource accesses.
+    PassBuilder AddPass(const char* Name, PassCallbackType Callback);
+
+    /// Compiles the graph.
+
+    /// Culls unused passes, computes resource lifetimes, state transitions and
+    /// the assignment of transient resources to physical resources.
+    /// Compilation does not require a render device. If the graph is not compiled,
+    /// Execute() compiles it automatically.
+    void Compile();
+
+    /// Executes the graph.
+
+    /// Creates or reuses physical resources, binds sparse memory if necessary,
+    /// and runs the passes that were not culled.
+    void Execute(IRenderDevice* pDevice, IDeviceContext* pContext);
+
+    /// Removes all passes and resources from the graph.
+
+    /// Physical resources are kept in the pool and are reused by the next graph.
+    void Reset();
+
+    /// Returns the texture object that backs the resource.
+
+    /// For transient resources, the texture is only available during and after Execute().
+    ITexture* GetTexture(RenderGraphResource Resource) const;
+
+    /// Returns the buffer object that backs the resource, see GetTexture().
+    IBuffer* GetBuffer(RenderGraphResource Resource) const;
+
+    /// Returns true if the pass was culled by the last Compile().
+    bool IsPassCulled(Uint32 PassIndex) const;
+
+    /// Returns the transitions that are issued before the pass.
+    const std::vector<Transition>& GetPassTransitions(Uint32 PassIndex) const;
+
+    /// Returns the transitions that are issued after the last pass.
+    const std::vector<Transition>& GetFinalTransitions() const { return m_FinalTransitions; }
+
+    /// Returns the index of the physical resource that backs the transient resource,
+    /// or RenderGraphResource::InvalidIndex if the resource is imported or not used.
+
+    /// Transient resources that share the same physical index alias each other.
+    Uint32 GetPhysicalResourceIndex(RenderGraphResource Resource) const;
+
+    /// Returns the graph statistics.
+    const Statistics& GetStatistics() const { return m_Stats; }
+
+private:
+    struct ResourceInfo;
+    struct PassInfo;
+    struct PhysicalResource;
+    struct PooledResource;
+    struct SparseMemoryLayout;
+
+    ResourceInfo&       GetResource(RenderGraphResource Resource);
+    const ResourceInfo& GetResource(RenderGraphResource Resource) const;
+
+    void CullPasses();
+    void ComputeLifetimes();
+    void ComputeTransitions();
+    void AssignPhysicalResources();
+
+    void RecyclePhysicalResources();
+    void PreparePhysicalResources(IRenderDevice* pDevice);
+    void PrepareSparseTextures(IRenderDevice* pDevice, IDeviceContext* pContext);
+    void ReleaseUnusedResources();
+
+    RefCntAutoPtr<IDeviceObject> FindPooledResource(const PhysicalResource& PhysRes);
+
+    const RenderGraphCreateInfo m_CreateInfo;
+
+    std::vector<ResourceInfo>     m_Resources;
+    std::vector<PassInfo>         m_Passes;
+    std::vector<PhysicalResource> m_PhysicalResources;
+    std::vector<Transition>       m_FinalTransitions;
+
+    bool       m_IsCompiled = false;
+    Statistics m_Stats;
+
+    std::vector<PooledResource> m_Pool;
+
+    // Sparse memory that backs aliased transient textures
+    RefCntAutoPtr<IDeviceMemory>    m_pSparseMemory;
+    std::vector<SparseMemoryLayout> m_SparseLayout;
+
+    RefCntAutoPtr<IFence> m_pBeforeBindFence;
+    RefCntAutoPtr<IFence> m_pAfterBindFence;
+    Uint64                m_NextFenceValue = 1;
+};
+
+} // namespace Diligent
@@ -76,6 +76,13 @@ struct RenderStateCacheCreateInfo
     /// shaders. If null, original source factory will be used.
     IShaderSourceInputStreamFactory* pReloadSource DEFAULT_INITIALIZER(nullptr);
 
+    /// Optional directory to watch for shader source changes when hot reloading is enabled.
+
+    /// If the platform supports file change notifications (currently Linux only),
+    /// IRenderStateCache::Reload only re-reads the source files modified in this directory
+    /// since the previous reload. Otherwise, all source files of all shaders are re-read.
+    const Char* WatchDirectory DEFAULT_INITIALIZER(nullptr);
+
 #if DILIGENT_CPP_INTERFACE
     constexpr RenderStateCacheCreateInfo() noexcept
     {}
@@ -85,12 +92,14 @@ struct RenderStateCacheCreateInfo
         RENDER_STATE_CACHE_LOG_LEVEL     _LogLevel          = RenderStateCacheCreateInfo{}.LogLevel,
         bool                             _EnableHotReload   = RenderStateCacheCreateInfo{}.EnableHotReload,
         bool                             _OptimizeGLShaders = RenderStateCacheCreateInfo{}.OptimizeGLShaders,
-        IShaderSourceInputStreamFactory* _pReloadSource     = RenderStateCacheCreateInfo{}.pReloadSource) noexcept :
+        IShaderSourceInputStreamFactory* _pReloadSource     = RenderStateCacheCreateInfo{}.pReloadSource,
+        const Char*                      _WatchDirectory    = RenderStateCacheCreateInfo{}.WatchDirectory) noexcept :
         pDevice{_pDevice},
         LogLevel{_LogLevel},
         EnableHotReload{_EnableHotReload},
         OptimizeGLShaders{_OptimizeGLShaders},
-        pReloadSource{_pReloadSource}
+        pReloadSource{_pReloadSource},
+        WatchDirectory{_WatchDirectory}
     {}
 #endif
 };
@@ -244,6 +253,12 @@ DILIGENT_BEGIN_INTERFACE(IRenderStateCache, IObject)
     ///
     /// Reloading is only enabled if the cache was created with the `EnableHotReload` member of
     /// `Diligent::RenderStateCacheCreateInfo` struct set to true.
+    ///
+    /// Only the shaders whose source files (including all transitively included files) have changed
+    /// since the last reload are recompiled. The shaders are recompiled in parallel using the
+    /// render device's shader compilation thread pool. Only the pipelines that use the recompiled
+    /// shaders are re-created, except when ReloadGraphicsPipeline is not null, in which case all
+    /// graphics pipelines are re-created since the callback may modify their create info.
     VIRTUAL Uint32 METHOD(Reload)(THIS_
                                   ReloadGraphicsPipelineCallbackType ReloadGraphicsPipeline DEFAULT_VALUE(nullptr), 
                                   void*                              pUserData              DEFAULT_VALUE(nullptr)) PURE;
@@ -66,13 +66,56 @@ public:
 /// Texture uploader description.
 struct TextureUploaderDesc
 {
+    /// Size of the staging ring buffer, in bytes.
+
+    /// When non-zero, upload buffers are suballocated from a single fixed-size
+    /// staging ring instead of using a dedicated staging texture per
+    /// upload buffer description. This avoids creating and caching staging
+    /// resources for every distinct texture size, which is beneficial when
+    /// streaming many textures of heterogeneous sizes.
+    /// The ring is a persistently mapped staging buffer that the data is copied
+    /// from directly, and its regions are reused once the GPU has completed the copies,
+    /// so the render thread context must be flushed regularly.
+    /// Upload buffers that do not fit into the ring or whose texel size is not
+    /// a power of two are allocated separately.
+    ///
+    /// \note  Currently only used by Direct3D12 and Vulkan backends.
+    Uint64 StagingBufferSize = 0;
+
+    /// Maximum number of bytes copied to GPU textures by one RenderThreadUpdate() call.
+
+    /// Copy operations scheduled from worker threads that exceed the budget are
+    /// postponed until the next call. At least one pending copy is always executed.
+    /// Copies executed directly on the render thread are never postponed, but
+    /// are counted against the budget of the next update.
+    /// Zero means no limit.
+    ///
+    /// \note  Currently only used by Direct3D12 and Vulkan backends.
+    Uint64 MaxBytesPerFrame = 0;
 };
 
 
 /// Texture uploader statistics.
 struct TextureUploaderStats
 {
+    /// The number of pending render-thread operations, including
+    /// copies postponed due to the per-frame budget.
     Uint32 NumPendingOperations = 0;
+
+    /// The number of bytes copied to GPU textures since the previous RenderThreadUpdate() call.
+    Uint64 BytesUploadedLastUpdate = 0;
+
+    /// The total number of bytes copied to GPU textures.
+    Uint64 TotalBytesUploaded = 0;
+
+    /// Average upload bandwidth over the last measurement interval, in bytes per second.
+    double UploadBandwidth = 0;
+
+    /// Staging ring buffer size, see Diligent::TextureUploaderDesc::StagingBufferSize.
+    Uint64 StagingBufferSize = 0;
+
+    /// The number of bytes currently allocated in the staging ring buffer.
+    Uint64 StagingBufferBytesUsed = 0;
 };
 
 /// Asynchronous texture uploader
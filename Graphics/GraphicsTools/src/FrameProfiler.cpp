@@ -0,0 +1,654 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrameProfiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+struct FrameProfiler::PendingFrame
+{
+    FrameData Data;
+
+    // The number of contexts whose GPU data has not been resolved yet
+    Uint32 NumPendingContexts = 0;
+};
+
+struct FrameProfiler::PendingGPUFrame
+{
+    Uint64 FrameIndex = 0;
+
+    // Index of the context data in the frame's Contexts array
+    Uint32 ContextDataIndex = 0;
+
+    // CPU time when the first GPU scope was begun, used to align GPU and CPU timelines
+    double FirstScopeCPUTime = 0;
+
+    std::vector<Scope> Scopes;
+
+    // Begin and end timestamp queries for every scope
+    std::vector<RefCntAutoPtr<IQuery>> Queries;
+};
+
+struct FrameProfiler::ContextState
+{
+    RefCntAutoPtr<IDeviceContext> pCtx;
+    std::string                   Name;
+
+    // GPU frame being recorded
+    std::unique_ptr<PendingGPUFrame> pCurrFrame;
+
+    std::unique_ptr<GPUCompletionAwaitQueue<std::unique_ptr<PendingGPUFrame>>> pAwaitQueue;
+
+    std::vector<Uint32>                ScopeStack;
+    std::vector<RefCntAutoPtr<IQuery>> FreeQueries;
+
+    DeviceContextStats LastStats;
+    bool               UsedInFrame = false;
+
+    double GPUTimeOffset      = 0;
+    bool   GPUTimeOffsetValid = false;
+};
+
+static bool IsGPUTimingSupported(IRenderDevice* pDevice)
+{
+    return pDevice != nullptr && pDevice->GetDeviceInfo().Features.TimestampQueries != DEVICE_FEATURE_STATE_DISABLED;
+}
+
+FrameProfiler::FrameProfiler(const FrameProfilerCreateInfo& CI) :
+    // clang-format off
+    m_pDevice           {CI.pDevice},
+    m_MaxFrameHistory   {std::max(CI.MaxFrameHistory, Uint32{1})},
+    m_EmitDebugGroups   {CI.EmitDebugGroups},
+    m_GPUTimingSupported{IsGPUTimingSupported(CI.pDevice)}
+// clang-format on
+{
+}
+
+FrameProfiler::~FrameProfiler()
+{
+}
+
+Uint32 FrameProfiler::GetThreadIndex(std::thread::id ThreadId)
+{
+    auto it = m_ThreadIndices.emplace(ThreadId, static_cast<Uint32>(m_ThreadIndices.size())).first;
+    if (it->second >= m_CPUScopeStacks.size())
+        m_CPUScopeStacks.resize(it->second + 1);
+    return it->second;
+}
+
+void FrameProfiler::BeginFrame()
+{
+    if (m_pCurrFrame)
+    {
+        DEV_ERROR("BeginFrame() is called twice without EndFrame()");
+        return;
+    }
+
+    std::unique_ptr<PendingFrame> pFrame = std::make_unique<PendingFrame>();
+    pFrame->Data.FrameIndex = m_FrameIndex;
+    pFrame->Data.Begin      = m_Timer.GetElapsedTime();
+
+    std::lock_guard<std::mutex> Guard{m_CPUScopesMtx};
+    pFrame->Data.ThreadIndex = GetThreadIndex(std::this_thread::get_id());
+    m_pCurrFrame             = std::move(pFrame);
+}
+
+void FrameProfiler::BeginCPUScope(const Char* Name)
+{
+    VERIFY_EXPR(Name != nullptr);
+    const double Time = m_Timer.GetElapsedTime();
+
+    std::lock_guard<std::mutex> Guard{m_CPUScopesMtx};
+
+    const Uint32               ThreadIndex = GetThreadIndex(std::this_thread::get_id());
+    std::vector<OpenCPUScope>& Stack       = m_CPUScopeStacks[ThreadIndex];
+    if (!m_pCurrFrame)
+    {
+        // Scopes begun outside of a frame are not recorded, but still need a matching stack entry
+        Stack.push_back({~Uint64{0}, 0});
+        return;
+    }
+
+    std::vector<Scope>& Scopes = m_pCurrFrame->Data.CPUScopes;
+
+    Scope NewScope;
+    NewScope.Name        = Name;
+    NewScope.Begin       = Time;
+    NewScope.End         = Time;
+    NewScope.ThreadIndex = ThreadIndex;
+    if (!Stack.empty() && Stack.back().FrameIndex == m_FrameIndex)
+    {
+        NewScope.Parent = Stack.back().ScopeIndex;
+        NewScope.Depth  = Scopes[NewScope.Parent].Depth + 1;
+    }
+
+    Stack.push_back({m_FrameIndex, static_cast<Uint32>(Scopes.size())});
+    Scopes.emplace_back(std::move(NewScope));
+}
+
+void FrameProfiler::EndCPUScope()
+{
+    const double Time = m_Timer.GetElapsedTime();
+
+    std::lock_guard<std::mutex> Guard{m_CPUScopesMtx};
+
+    std::vector<OpenCPUScope>& Stack = m_CPUScopeStacks[GetThreadIndex(std::this_thread::get_id())];
+    if (Stack.empty())
+    {
+        DEV_ERROR("There are no open CPU scopes on this thread, which indicates inconsistent BeginCPUScope()/EndCPUScope() calls");
+        return;
+    }
+
+    const OpenCPUScope OpenScope = Stack.back();
+    Stack.pop_back();
+
+    // Scopes that were not ended in the frame they were begun in are closed by EndFrame()
+    if (m_pCurrFrame && OpenScope.FrameIndex == m_FrameIndex)
+        m_pCurrFrame->Data.CPUScopes[OpenScope.ScopeIndex].End = Time;
+}
+
+FrameProfiler::ContextState& FrameProfiler::GetContextState(IDeviceContext* pCtx)
+{
+    for (std::unique_ptr<ContextState>& pState : m_Contexts)
+    {
+        if (pState->pCtx == pCtx)
+            return *pState;
+    }
+
+    std::unique_ptr<ContextState> pState = std::make_unique<ContextState>();
+    pState->pCtx = pCtx;
+
+    const DeviceContextDesc& CtxDesc = pCtx->GetDesc();
+    pState->Name                     = CtxDesc.Name != nullptr ? CtxDesc.Name : "Context " + std::to_string(CtxDesc.ContextId);
+    pState->LastStats                = pCtx->GetStats();
+
+    if (m_GPUTimingSupported && !CtxDesc.IsDeferred)
+        pState->pAwaitQueue = std::make_unique<GPUCompletionAwaitQueue<std::unique_ptr<PendingGPUFrame>>>(m_pDevice);
+
+    m_Contexts.emplace_back(std::move(pState));
+    return *m_Contexts.back();
+}
+
+void FrameProfiler::BeginGPUScope(IDeviceContext* pCtx, const Char* Name)
+{
+    VERIFY_EXPR(pCtx != nullptr && Name != nullptr);
+    DEV_CHECK_ERR(!pCtx->GetDesc().IsDeferred, "GPU scopes can only be recorded in immediate contexts");
+
+    if (m_EmitDebugGroups)
+        pCtx->BeginDebugGroup(Name);
+
+    if (!m_pCurrFrame)
+        return;
+
+    ContextState& Ctx = GetContextState(pCtx);
+    Ctx.UsedInFrame   = true;
+    if (!Ctx.pAwaitQueue)
+        return;
+
+    if (!Ctx.pCurrFrame)
+    {
+        Ctx.pCurrFrame = Ctx.pAwaitQueue->GetRecycled();
+        if (!Ctx.pCurrFrame)
+            Ctx.pCurrFrame = std::make_unique<PendingGPUFrame>();
+        Ctx.pCurrFrame->FirstScopeCPUTime = m_Timer.GetElapsedTime();
+    }
+    PendingGPUFrame& GPUFrame = *Ctx.pCurrFrame;
+
+    Scope NewScope;
+    NewScope.Name = Name;
+    if (!Ctx.ScopeStack.empty())
+    {
+        NewScope.Parent = Ctx.ScopeStack.back();
+        NewScope.Depth  = GPUFrame.Scopes[NewScope.Parent].Depth + 1;
+    }
+    Ctx.ScopeStack.push_back(static_cast<Uint32>(GPUFrame.Scopes.size()));
+    GPUFrame.Scopes.emplace_back(std::move(NewScope));
+
+    for (size_t i = 0; i < 2; ++i)
+    {
+        RefCntAutoPtr<IQuery> pQuery;
+        if (!Ctx.FreeQueries.empty())
+        {
+            pQuery = std::move(Ctx.FreeQueries.back());
+            Ctx.FreeQueries.pop_back();
+        }
+        else
+        {
+            QueryDesc Desc{QUERY_TYPE_TIMESTAMP};
+            Desc.Name = "Frame profiler timestamp query";
+            m_pDevice->CreateQuery(Desc, &pQuery);
+            VERIFY(pQuery, "Failed to create timestamp query");
+        }
+        GPUFrame.Queries.emplace_back(std::move(pQuery));
+    }
+
+    IQuery* pBeginQuery = GPUFrame.Queries[GPUFrame.Queries.size() - 2];
+    if (pBeginQuery != nullptr)
+        pCtx->EndQuery(pBeginQuery);
+}
+
+void FrameProfiler::EndGPUScope(IDeviceContext* pCtx)
+{
+    VERIFY_EXPR(pCtx != nullptr);
+
+    if (m_pCurrFrame)
+    {
+        ContextState& Ctx = GetContextState(pCtx);
+        if (Ctx.pCurrFrame)
+        {
+            if (!Ctx.ScopeStack.empty())
+            {
+                const Uint32 ScopeIndex = Ctx.ScopeStack.back();
+                Ctx.ScopeStack.pop_back();
+
+                if (IQuery* pEndQuery = Ctx.pCurrFrame->Queries[ScopeIndex * 2 + 1])
+                    pCtx->EndQuery(pEndQuery);
+            }
+            else
+            {
+                DEV_ERROR("There are no open GPU scopes in context '", Ctx.Name, "', which indicates inconsistent BeginGPUScope()/EndGPUScope() calls");
+            }
+        }
+    }
+
+    if (m_EmitDebugGroups)
+        pCtx->EndDebugGroup();
+}
+
+static DeviceContextStats GetStatsDelta(const DeviceContextStats& CurrStats, const DeviceContextStats& PrevStats)
+{
+    // All members of DeviceContextStats are Uint32 counters
+    static_assert(sizeof(DeviceContextStats) % sizeof(Uint32) == 0, "DeviceContextStats is expected to only contain Uint32 counters");
+    constexpr size_t NumCounters = sizeof(DeviceContextStats) / sizeof(Uint32);
+
+    Uint32 Curr[NumCounters];
+    Uint32 Prev[NumCounters];
+    memcpy(Curr, &CurrStats, sizeof(Curr));
+    memcpy(Prev, &PrevStats, sizeof(Prev));
+    for (size_t i = 0; i < NumCounters; ++i)
+    {
+        // The counters are reset when the application calls ClearStats()
+        Curr[i] = Curr[i] >= Prev[i] ? Curr[i] - Prev[i] : Curr[i];
+    }
+
+    DeviceContextStats Delta;
+    memcpy(&Delta, Curr, sizeof(Curr));
+    return Delta;
+}
+
+void FrameProfiler::EndFrame(IDeviceContext* const* ppContexts, Uint32 NumContexts)
+{
+    if (!m_pCurrFrame)
+    {
+        DEV_ERROR("EndFrame() is called without BeginFrame()");
+        return;
+    }
+
+    for (Uint32 i = 0; i < NumContexts; ++i)
+    {
+        if (ppContexts[i] != nullptr)
+            GetContextState(ppContexts[i]).UsedInFrame = true;
+    }
+
+    std::unique_ptr<PendingFrame> pFrame;
+    {
+        std::lock_guard<std::mutex> Guard{m_CPUScopesMtx};
+
+        pFrame           = std::move(m_pCurrFrame);
+        pFrame->Data.End = m_Timer.GetElapsedTime();
+
+        // Close CPU scopes that are still open
+        for (const std::vector<OpenCPUScope>& Stack : m_CPUScopeStacks)
+        {
+            for (const OpenCPUScope& OpenScope : Stack)
+            {
+                if (OpenScope.FrameIndex == m_FrameIndex)
+                    pFrame->Data.CPUScopes[OpenScope.ScopeIndex].End = pFrame->Data.End;
+            }
+        }
+
+        ++m_FrameIndex;
+    }
+
+    for (std::unique_ptr<ContextState>& pCtxState : m_Contexts)
+    {
+        ContextState& Ctx = *pCtxState;
+        if (!Ctx.UsedInFrame)
+            continue;
+        Ctx.UsedInFrame = false;
+
+        ContextData CtxData;
+        CtxData.Name = Ctx.Name;
+        {
+            const DeviceContextStats& CurrStats = Ctx.pCtx->GetStats();
+            CtxData.Stats                       = GetStatsDelta(CurrStats, Ctx.LastStats);
+            Ctx.LastStats                       = CurrStats;
+        }
+
+        if (Ctx.pCurrFrame)
+        {
+            if (!Ctx.ScopeStack.empty())
+            {
+                DEV_ERROR("There are ", Ctx.ScopeStack.size(), " GPU scope(s) open in context '", Ctx.Name, "' at the end of the frame");
+                while (!Ctx.ScopeStack.empty())
+                {
+                    if (IQuery* pEndQuery = Ctx.pCurrFrame->Queries[Ctx.ScopeStack.back() * 2 + 1])
+                        Ctx.pCtx->EndQuery(pEndQuery);
+                    Ctx.ScopeStack.pop_back();
+                }
+            }
+
+            Ctx.pCurrFrame->FrameIndex       = pFrame->Data.FrameIndex;
+            Ctx.pCurrFrame->ContextDataIndex = static_cast<Uint32>(pFrame->Data.Contexts.size());
+            Ctx.pAwaitQueue->Enqueue(Ctx.pCtx, std::move(Ctx.pCurrFrame));
+            ++pFrame->NumPendingContexts;
+        }
+
+        pFrame->Data.Contexts.emplace_back(std::move(CtxData));
+    }
+
+    m_PendingFrames.emplace_back(std::move(pFrame));
+
+    Resolve();
+}
+
+void FrameProfiler::ResolveContext(ContextState& Ctx)
+{
+    if (!Ctx.pAwaitQueue)
+        return;
+
+    while (std::unique_ptr<PendingGPUFrame> pGPUFrame = Ctx.pAwaitQueue->GetFirstCompleted())
+    {
+        PendingFrame* pFrame = nullptr;
+        for (std::unique_ptr<PendingFrame>& pPendingFrame : m_PendingFrames)
+        {
+            if (pPendingFrame->Data.FrameIndex == pGPUFrame->FrameIndex)
+            {
+                pFrame = pPendingFrame.get();
+                break;
+            }
+        }
+        VERIFY(pFrame != nullptr, "Pending frame ", pGPUFrame->FrameIndex, " is not found");
+
+        // The fence has completed, so the query data must be available
+        for (size_t i = 0; i < pGPUFrame->Scopes.size(); ++i)
+        {
+            Scope& GPUScp = pGPUFrame->Scopes[i];
+
+            QueryDataTimestamp BeginData, EndData;
+            IQuery*            pBeginQuery = pGPUFrame->Queries[i * 2 + 0];
+            IQuery*            pEndQuery   = pGPUFrame->Queries[i * 2 + 1];
+            if (pBeginQuery != nullptr && pEndQuery != nullptr &&
+                pBeginQuery->GetData(&BeginData, sizeof(BeginData)) &&
+                pEndQuery->GetData(&EndData, sizeof(EndData)) &&
+                BeginData.Frequency != 0 && EndData.Frequency != 0)
+            {
+                GPUScp.Begin = static_cast<double>(BeginData.Counter) / static_cast<double>(BeginData.Frequency);
+                GPUScp.End   = static_cast<double>(EndData.Counter) / static_cast<double>(EndData.Frequency);
+            }
+        }
+
+        if (!pGPUFrame->Scopes.empty())
+        {
+            if (!Ctx.GPUTimeOffsetValid)
+            {
+                Ctx.GPUTimeOffset      = pGPUFrame->FirstScopeCPUTime - pGPUFrame->Scopes[0].Begin;
+                Ctx.GPUTimeOffsetValid = true;
+            }
+            for (Scope& GPUScp : pGPUFrame->Scopes)
+            {
+                GPUScp.Begin += Ctx.GPUTimeOffset;
+                GPUScp.End += Ctx.GPUTimeOffset;
+            }
+        }
+
+        if (pFrame != nullptr)
+        {
+            std::vector<Scope>& DstScopes = pFrame->Data.Contexts[pGPUFrame->ContextDataIndex].GPUScopes;
+            DstScopes.swap(pGPUFrame->Scopes);
+            VERIFY_EXPR(pFrame->NumPendingContexts > 0);
+            --pFrame->NumPendingContexts;
+        }
+
+        for (RefCntAutoPtr<IQuery>& pQuery : pGPUFrame->Queries)
+        {
+            if (pQuery)
+                Ctx.FreeQueries.emplace_back(std::move(pQuery));
+        }
+        pGPUFrame->Queries.clear();
+        pGPUFrame->Scopes.clear();
+        Ctx.pAwaitQueue->Recycle(std::move(pGPUFrame));
+    }
+}
+
+void FrameProfiler::RetireResolvedFrames()
+{
+    while (!m_PendingFrames.empty() && m_PendingFrames.front()->NumPendingContexts == 0)
+    {
+        m_ResolvedFrames.emplace_back(std::move(m_PendingFrames.front()->Data));
+        m_PendingFrames.pop_front();
+    }
+
+    while (m_ResolvedFrames.size() > m_MaxFrameHistory)
+        m_ResolvedFrames.pop_front();
+}
+
+void FrameProfiler::Resolve()
+{
+    for (std::unique_ptr<ContextState>& pCtxState : m_Contexts)
+        ResolveContext(*pCtxState);
+
+    RetireResolvedFrames();
+}
+
+namespace
+{
+
+class ChromeTraceWriter
+{
+public:
+    void BeginEvent()
+    {
+        m_Json += m_NumEvents++ == 0 ? "\n" : ",\n";
+        m_Json += '{';
+    }
+
+    void AddString(const char* Key, const std::string& Value, bool First = false)
+    {
+        AddKey(Key, First);
+        m_Json += '"';
+        for (char c : Value)
+        {
+            switch (c)
+            {
+                case '"': m_Json += "\\\""; break;
+                case '\\': m_Json += "\\\\"; break;
+                case '\n': m_Json += "\\n"; break;
+                case '\r': m_Json += "\\r"; break;
+                case '\t': m_Json += "\\t"; break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        char Buffer[8];
+                        snprintf(Buffer, sizeof(Buffer), "\\u%04x", static_cast<unsigned int>(c));
+                        m_Json += Buffer;
+                    }
+                    else
+                    {
+                        m_Json += c;
+                    }
+            }
+        }
+        m_Json += '"';
+    }
+
+    void AddUint(const char* Key, Uint64 Value, bool First = false)
+    {
+        AddKey(Key, First);
+        m_Json += std::to_string(Value);
+    }
+
+    // Chrome trace uses microseconds
+    void AddTime(const char* Key, double Seconds)
+    {
+        AddKey(Key, false);
+        char Buffer[64];
+        snprintf(Buffer, sizeof(Buffer), "%.3f", Seconds * 1e6);
+        m_Json += Buffer;
+    }
+
+    void BeginObject(const char* Key)
+    {
+        AddKey(Key, false);
+        m_Json += '{';
+    }
+
+    void EndObject()
+    {
+        m_Json += '}';
+    }
+
+    void AddCompleteEvent(const FrameProfiler::Scope& Scp, const char* Category, Uint32 Pid, Uint32 Tid)
+    {
+        BeginEvent();
+        AddString("name", Scp.Name, true);
+        AddString("cat", Category);
+        AddString("ph", "X");
+        AddTime("ts", Scp.Begin);
+        AddTime("dur", std::max(Scp.End - Scp.Begin, 0.0));
+        AddUint("pid", Pid);
+        AddUint("tid", Tid);
+        EndObject();
+    }
+
+    void AddMetadata(const char* Name, Uint32 Pid, Uint32 Tid, const std::string& Value)
+    {
+        BeginEvent();
+        AddString("name", Name, true);
+        AddString("ph", "M");
+        AddUint("pid", Pid);
+        AddUint("tid", Tid);
+        BeginObject("args");
+        AddString("name", Value, true);
+        EndObject();
+        EndObject();
+    }
+
+    std::string Finish()
+    {
+        m_Json += "\n]}\n";
+        return std::move(m_Json);
+    }
+
+private:
+    void AddKey(const char* Key, bool First)
+    {
+        if (!First)
+            m_Json += ',';
+        m_Json += '"';
+        m_Json += Key;
+        m_Json += "\":";
+    }
+
+    std::string m_Json      = "{\"traceEvents\":[";
+    size_t      m_NumEvents = 0;
+};
+
+} // namespace
+
+std::string FrameProfiler::ExportChromeTrace() const
+{
+    // CPU threads are reported in process 0, GPU contexts in process 1
+    constexpr Uint32 CPUPid = 0;
+    constexpr Uint32 GPUPid = 1;
+
+    ChromeTraceWriter Writer;
+    Writer.AddMetadata("process_name", CPUPid, 0, "CPU");
+    Writer.AddMetadata("process_name", GPUPid, 0, "GPU");
+
+    std::vector<const std::string*> ContextNames;
+    auto GetContextTid = [&ContextNames](const std::string& Name) {
+        for (size_t i = 0; i < ContextNames.size(); ++i)
+        {
+            if (*ContextNames[i] == Name)
+                return static_cast<Uint32>(i);
+        }
+        ContextNames.push_back(&Name);
+        return static_cast<Uint32>(ContextNames.size() - 1);
+    };
+
+    for (const FrameData& Frame : m_ResolvedFrames)
+    {
+        Scope FrameScope;
+        FrameScope.Name  = "Frame " + std::to_string(Frame.FrameIndex);
+        FrameScope.Begin = Frame.Begin;
+        FrameScope.End   = Frame.End;
+        Writer.AddCompleteEvent(FrameScope, "Frame", CPUPid, Frame.ThreadIndex);
+
+        for (const Scope& CPUScp : Frame.CPUScopes)
+            Writer.AddCompleteEvent(CPUScp, "CPU", CPUPid, CPUScp.ThreadIndex);
+
+        for (const ContextData& Ctx : Frame.Contexts)
+        {
+            const Uint32 Tid = GetContextTid(Ctx.Name);
+            for (const Scope& GPUScp : Ctx.GPUScopes)
+                Writer.AddCompleteEvent(GPUScp, "GPU", GPUPid, Tid);
+
+            const DeviceContextCommandCounters& Counters = Ctx.Stats.CommandCounters;
+
+            Writer.BeginEvent();
+            Writer.AddString("name", Ctx.Name + " stats", true);
+            Writer.AddString("ph", "C");
+            Writer.AddTime("ts", Frame.Begin);
+            Writer.AddUint("pid", GPUPid);
+            Writer.AddUint("tid", Tid);
+            Writer.BeginObject("args");
+            Writer.AddUint("Draws", Counters.Draw + Counters.DrawIndexed + Counters.DrawIndirect + Counters.DrawIndexedIndirect +
+                                        Counters.MultiDraw + Counters.MultiDrawIndexed + Counters.DrawMesh + Counters.DrawMeshIndirect,
+                           true);
+            Writer.AddUint("Dispatches", Counters.DispatchCompute + Counters.DispatchComputeIndirect + Counters.DispatchTile);
+            Writer.AddUint("Triangles", Ctx.Stats.GetTotalTriangleCount());
+            Writer.AddUint("SetPipelineState", Counters.SetPipelineState);
+            Writer.AddUint("CommitShaderResources", Counters.CommitShaderResources);
+            Writer.EndObject();
+            Writer.EndObject();
+        }
+    }
+
+    for (size_t i = 0; i < ContextNames.size(); ++i)
+        Writer.AddMetadata("thread_name", GPUPid, static_cast<Uint32>(i), *ContextNames[i]);
+
+    return Writer.Finish();
+}
+
+} // namespace Diligent
@@ -25,17 +25,33 @@
  */
 
 #include "ReloadableShader.hpp"
+
+#include <algorithm>
+
 #include "RenderStateCacheImpl.hpp"
+#include "ShaderToolsCommon.hpp"
+#include "DataBlobImpl.hpp"
+#include "FileStream.h"
+#include "FileSystem.hpp"
 
 namespace Diligent
 {
 
 constexpr INTERFACE_ID ReloadableShader::IID_InternalImpl;
 
+static XXH128Hash ComputeSourceHash(const char* Source, size_t SourceLength)
+{
+    XXH128State Hasher;
+    if (SourceLength != 0)
+        Hasher.UpdateRaw(Source, SourceLength);
+    return Hasher.Digest();
+}
+
 ReloadableShader::ReloadableShader(IReferenceCounters*     pRefCounters,
                                    RenderStateCacheImpl*   pStateCache,
                                    IShader*                pShader,
-                                   const ShaderCreateInfo& CreateInfo) :
+                                   const ShaderCreateInfo& CreateInfo,
+                                   const ShaderCreateInfo& CompiledCreateInfo) :
     TBase{pRefCounters},
     m_pStateCache{pStateCache},
     m_pShader{pShader},
@@ -45,6 +61,27 @@ ReloadableShader::ReloadableShader(IReferenceCounters*     pRefCounters,
     {
         LOG_ERROR_AND_THROW("Internal shader object must not be null");
     }
+
+    UpdateSourceDependencies(m_CreateInfo);
+
+    if (m_SourceDependenciesValid && CreateInfo.pShaderSourceStreamFactory != CompiledCreateInfo.pShaderSourceStreamFactory)
+    {
+        // The shader was compiled from the original sources, while it is reloaded from the reload sources.
+        // If they differ, the shader must be recompiled by the next reload.
+        size_t     DependencyIdx = 0;
+        bool       SourcesMatch  = true;
+        const bool Processed     = ProcessShaderIncludes(CompiledCreateInfo, [&](const ShaderIncludePreprocessInfo& ProcessInfo) {
+            if (ProcessInfo.FilePath.empty() || !SourcesMatch)
+                return;
+
+            SourcesMatch = (DependencyIdx < m_SourceDependencies.size() &&
+                            m_SourceDependencies[DependencyIdx].FilePath == ProcessInfo.FilePath &&
+                            m_SourceDependencies[DependencyIdx].Hash == ComputeSourceHash(ProcessInfo.Source, ProcessInfo.SourceLength));
+            ++DependencyIdx;
+        });
+        if (!Processed || !SourcesMatch || DependencyIdx != m_SourceDependencies.size())
+            m_SourceDependenciesValid = false;
+    }
 }
 
 ReloadableShader::~ReloadableShader()
@@ -83,10 +120,26 @@ void ReloadableShader::QueryInterface(const INTERFACE_ID& IID, IObject** ppInter
 
 bool ReloadableShader::Reload()
 {
+    bool                   FoundInCache = false;
+    RefCntAutoPtr<IShader> pNewShader   = Recompile(nullptr, FoundInCache);
+    CommitReload(pNewShader);
+    return !FoundInCache;
+}
+
+RefCntAutoPtr<IShader> ReloadableShader::Recompile(IShaderSourceInputStreamFactory* pSourceFactory, bool& FoundInCache) const
+{
+    ShaderCreateInfo ShaderCI = m_CreateInfo.Get();
+    if (pSourceFactory != nullptr)
+        ShaderCI.pShaderSourceStreamFactory = pSourceFactory;
+
     RefCntAutoPtr<IShader> pNewShader;
+    FoundInCache = m_pStateCache->CreateShaderInternal(ShaderCI, &pNewShader);
+    return pNewShader;
+}
 
-    const bool FoundInCache = m_pStateCache->CreateShaderInternal(m_CreateInfo, &pNewShader);
-    if (pNewShader)
+void ReloadableShader::CommitReload(IShader* pNewShader)
+{
+    if (pNewShader != nullptr)
     {
         m_pShader = pNewShader;
     }
@@ -95,18 +148,112 @@ bool ReloadableShader::Reload()
         const char* Name = m_CreateInfo.Get().Desc.Name;
         LOG_ERROR_MESSAGE("Failed to reload shader '", (Name ? Name : "<unnamed>"), "'.");
     }
-    return !FoundInCache;
+
+    // Record the new source hashes even if the compilation failed so that the shader
+    // is not recompiled again until the sources are modified.
+    UpdateSourceDependencies(m_CreateInfo);
+}
+
+void ReloadableShader::UpdateSourceDependencies(const ShaderCreateInfo& ShaderCI)
+{
+    m_SourceDependencies.clear();
+
+    if (ShaderCI.Source == nullptr && ShaderCI.FilePath == nullptr)
+    {
+        // Shaders created from byte code never change
+        m_SourceDependenciesValid = true;
+        return;
+    }
+
+    m_SourceDependenciesValid = ProcessShaderIncludes(ShaderCI, [this](const ShaderIncludePreprocessInfo& ProcessInfo) {
+        // Source code provided in the create info has an empty path and can't change
+        if (!ProcessInfo.FilePath.empty())
+            m_SourceDependencies.push_back({ProcessInfo.FilePath, ComputeSourceHash(ProcessInfo.Source, ProcessInfo.SourceLength)});
+    });
+}
+
+// Returns true if one path ends with the other one at a path component boundary.
+// File watcher paths are relative to the watched directory, while dependency paths are relative to
+// the search directories of the source factory, so the paths generally only share the trailing components.
+static bool PathTailsMatch(const std::vector<String>& Components0, const std::vector<String>& Components1)
+{
+    const size_t NumComponents = std::min(Components0.size(), Components1.size());
+    if (NumComponents == 0)
+        return false;
+
+    return std::equal(Components0.end() - NumComponents, Components0.end(), Components1.end() - NumComponents);
+}
+
+bool ReloadableShader::HasSourceChanges(SourceHashCache& HashCache, const std::vector<std::string>* pChangedFiles) const
+{
+    if (!m_SourceDependenciesValid)
+        return true;
+
+    IShaderSourceInputStreamFactory* pSourceFactory = m_CreateInfo.Get().pShaderSourceStreamFactory;
+    if (m_SourceDependencies.empty() || pSourceFactory == nullptr)
+        return false;
+
+    if (pChangedFiles != nullptr && pChangedFiles->empty())
+        return false;
+
+    std::vector<std::vector<String>> ChangedFileComponents;
+    if (pChangedFiles != nullptr)
+    {
+        ChangedFileComponents.reserve(pChangedFiles->size());
+        for (const std::string& ChangedFile : *pChangedFiles)
+            ChangedFileComponents.emplace_back(FileSystem::SplitPath(ChangedFile.c_str(), /*Simplify = */ true));
+    }
+
+    std::unordered_map<std::string, XXH128Hash>& FileHashes = HashCache[pSourceFactory];
+    for (const SourceDependency& Dependency : m_SourceDependencies)
+    {
+        if (pChangedFiles != nullptr)
+        {
+            const std::vector<String> DependencyComponents = FileSystem::SplitPath(Dependency.FilePath.c_str(), /*Simplify = */ true);
+
+            const bool MayHaveChanged = std::any_of(ChangedFileComponents.begin(), ChangedFileComponents.end(),
+                                                    [&DependencyComponents](const std::vector<String>& Components) {
+                                                        return PathTailsMatch(Components, DependencyComponents);
+                                                    });
+            if (!MayHaveChanged)
+                continue;
+        }
+
+        auto it = FileHashes.find(Dependency.FilePath);
+        if (it == FileHashes.end())
+        {
+            // Missing files are given the default hash, so that the shader is reloaded and the error is reported
+            XXH128Hash FileHash;
+
+            RefCntAutoPtr<IFileStream> pSourceStream;
+            pSourceFactory->CreateInputStream2(Dependency.FilePath.c_str(), CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_SILENT, &pSourceStream);
+            if (pSourceStream)
+            {
+                RefCntAutoPtr<DataBlobImpl> pFileData = DataBlobImpl::Create();
+                pSourceStream->ReadBlob(pFileData);
+                FileHash = ComputeSourceHash(pFileData->GetConstDataPtr<char>(), pFileData->GetSize());
+            }
+
+            it = FileHashes.emplace(Dependency.FilePath, FileHash).first;
+        }
+
+        if (!(it->second == Dependency.Hash))
+            return true;
+    }
+
+    return false;
 }
 
 
 void ReloadableShader::Create(RenderStateCacheImpl*   pStateCache,
                               IShader*                pShader,
                               const ShaderCreateInfo& CreateInfo,
+                              const ShaderCreateInfo& CompiledCreateInfo,
                               IShader**               ppReloadableShader)
 {
     try
     {
-        RefCntAutoPtr<ReloadableShader> pReloadableShader{MakeNewRCObj<ReloadableShader>()(pStateCache, pShader, CreateInfo)};
+        RefCntAutoPtr<ReloadableShader> pReloadableShader{MakeNewRCObj<ReloadableShader>()(pStateCache, pShader, CreateInfo, CompiledCreateInfo)};
         *ppReloadableShader = pReloadableShader.Detach();
     }
     catch (...)
@@ -0,0 +1,1004 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "RenderGraph.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include "DebugUtilities.hpp"
+#include "GraphicsAccessories.hpp"
+#include "Align.hpp"
+#include "ScopedDebugGroup.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+constexpr Uint32 InvalidIndex = RenderGraphResource::InvalidIndex;
+
+constexpr RESOURCE_STATE ReadOnlyStates =
+    RESOURCE_STATE_GENERIC_READ |
+    RESOURCE_STATE_DEPTH_READ |
+    RESOURCE_STATE_RESOLVE_SOURCE |
+    RESOURCE_STATE_INPUT_ATTACHMENT |
+    RESOURCE_STATE_BUILD_AS_READ |
+    RESOURCE_STATE_RAY_TRACING |
+    RESOURCE_STATE_SHADING_RATE;
+
+bool IsReadOnlyState(RESOURCE_STATE State)
+{
+    return State != RESOURCE_STATE_UNKNOWN && (State & ~ReadOnlyStates) == 0;
+}
+
+bool IsSparseAliasingSupported(IRenderDevice* pDevice)
+{
+    const RenderDeviceInfo& DeviceInfo = pDevice->GetDeviceInfo();
+    // Sparse memory binding requires general fences to synchronize with the rendering commands
+    if (DeviceInfo.Type != RENDER_DEVICE_TYPE_D3D12 && DeviceInfo.Type != RENDER_DEVICE_TYPE_VULKAN)
+        return false;
+
+    if (!DeviceInfo.Features.SparseResources)
+        return false;
+
+    constexpr SPARSE_RESOURCE_CAP_FLAGS RequiredCaps = SPARSE_RESOURCE_CAP_FLAG_TEXTURE_2D | SPARSE_RESOURCE_CAP_FLAG_ALIASED;
+    return (pDevice->GetAdapterInfo().SparseResources.CapFlags & RequiredCaps) == RequiredCaps;
+}
+
+bool IsSparseTextureCompatible(IRenderDevice* pDevice, const TextureDesc& Desc)
+{
+    if (Desc.Type != RESOURCE_DIM_TEX_2D || Desc.SampleCount != 1 || Desc.Usage != USAGE_DEFAULT || Desc.CPUAccessFlags != CPU_ACCESS_NONE)
+        return false;
+
+    const SparseTextureFormatInfo SparseInfo = pDevice->GetSparseTextureFormatInfo(Desc.Format, Desc.Type, Desc.SampleCount);
+    return (SparseInfo.BindFlags & Desc.BindFlags) == Desc.BindFlags;
+}
+
+Uint64 GetSparseTextureMemorySize(ITexture* pTexture)
+{
+    const TextureDesc&             Desc          = pTexture->GetDesc();
+    const SparseTextureProperties& SparseProps   = pTexture->GetSparseProperties();
+    const Uint32                   NumNormalMips = std::min(Desc.MipLevels, SparseProps.FirstMipInTail);
+
+    Uint64 Size = 0;
+    for (Uint32 Mip = 0; Mip < NumNormalMips; ++Mip)
+    {
+        const uint3 NumTiles = GetNumSparseTilesInMipLevel(Desc, SparseProps.TileSize, Mip);
+        Size += Uint64{NumTiles.x} * NumTiles.y * NumTiles.z * SparseProps.BlockSize;
+    }
+    if (Desc.MipLevels > SparseProps.FirstMipInTail)
+        Size += SparseProps.MipTailSize;
+
+    return Size;
+}
+
+} // namespace
+
+struct RenderGraph::ResourceInfo
+{
+    std::string Name;
+
+    bool IsTexture  = false;
+    bool IsImported = false;
+    bool IsOutput   = false;
+
+    // Name members are null; names are kept in the Name string
+    TextureDesc TexDesc;
+    BufferDesc  BuffDesc;
+
+    RefCntAutoPtr<ITexture> pImportedTexture;
+    RefCntAutoPtr<IBuffer>  pImportedBuffer;
+
+    RESOURCE_STATE InitialState = RESOURCE_STATE_UNKNOWN;
+    RESOURCE_STATE FinalState   = RESOURCE_STATE_UNKNOWN;
+
+    // Compiled data
+    Uint32 FirstPass     = InvalidIndex;
+    Uint32 LastPass      = InvalidIndex;
+    Uint32 PhysicalIndex = InvalidIndex;
+
+    Uint64 GetMemorySize() const
+    {
+        if (IsTexture)
+            return GetStagingTextureDataSize(TexDesc) * TexDesc.SampleCount;
+        else
+            return BuffDesc.Size;
+    }
+};
+
+struct RenderGraph::PassInfo
+{
+    struct Access
+    {
+        Uint32         Resource;
+        RESOURCE_STATE State;
+        bool           Read;
+        bool           Write;
+    };
+
+    std::string         Name;
+    PassCallbackType    Callback;
+    std::vector<Access> Accesses;
+
+    bool NeverCull = false;
+    bool IsCulled  = false;
+
+    std::vector<Transition> Transitions;
+
+    // Returns the combined access of the pass to the resource
+    bool FindAccess(Uint32 Resource, Access& CombinedAccess) const
+    {
+        bool Found = false;
+        for (const Access& Acc : Accesses)
+        {
+            if (Acc.Resource != Resource)
+                continue;
+
+            if (!Found)
+            {
+                CombinedAccess = Acc;
+                Found          = true;
+            }
+            else
+            {
+                CombinedAccess.State |= Acc.State;
+                CombinedAccess.Read = CombinedAccess.Read || Acc.Read;
+                CombinedAccess.Write = CombinedAccess.Write || Acc.Write;
+            }
+        }
+        return Found;
+    }
+};
+
+struct RenderGraph::PhysicalResource
+{
+    std::string Name;
+
+    bool IsTexture = false;
+    bool IsSparse  = false;
+    // The resource shares sparse memory with other resources
+    bool IsAliased = false;
+
+    TextureDesc TexDesc;
+    BufferDesc  BuffDesc;
+
+    // Union of the lifetimes of all transient resources that use this physical resource
+    Uint32 FirstPass = InvalidIndex;
+    Uint32 LastPass  = InvalidIndex;
+
+    Uint64 MemorySize = 0;
+
+    RefCntAutoPtr<ITexture> pTexture;
+    RefCntAutoPtr<IBuffer>  pBuffer;
+};
+
+struct RenderGraph::PooledResource
+{
+    RefCntAutoPtr<ITexture> pTexture;
+    RefCntAutoPtr<IBuffer>  pBuffer;
+
+    Uint32 UnusedFrames = 0;
+};
+
+struct RenderGraph::SparseMemoryLayout
+{
+    RefCntAutoPtr<ITexture> pTexture;
+
+    Uint64 Offset = 0;
+    Uint64 Size   = 0;
+
+    bool operator==(const SparseMemoryLayout& RHS) const
+    {
+        return pTexture == RHS.pTexture && Offset == RHS.Offset && Size == RHS.Size;
+    }
+};
+
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::AddAccess(RenderGraphResource Resource, RESOURCE_STATE State, bool Read, bool Write)
+{
+    DEV_CHECK_ERR(Resource.Index < m_Graph.m_Resources.size(), "Invalid render graph resource");
+    DEV_CHECK_ERR(State != RESOURCE_STATE_UNKNOWN && State != RESOURCE_STATE_UNDEFINED, "Resource access state must not be UNKNOWN or UNDEFINED");
+
+    PassInfo& Pass = m_Graph.m_Passes[m_PassIndex];
+    Pass.Accesses.push_back({Resource.Index, State, Read, Write});
+    m_Graph.m_IsCompiled = false;
+    return *this;
+}
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::Read(RenderGraphResource Resource, RESOURCE_STATE State)
+{
+    return AddAccess(Resource, State, /*Read = */ true, /*Write = */ false);
+}
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::Write(RenderGraphResource Resource, RESOURCE_STATE State)
+{
+    return AddAccess(Resource, State, /*Read = */ false, /*Write = */ true);
+}
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::ReadWrite(RenderGraphResource Resource, RESOURCE_STATE State)
+{
+    return AddAccess(Resource, State, /*Read = */ true, /*Write = */ true);
+}
+
+RenderGraph::PassBuilder& RenderGraph::PassBuilder::SetNeverCull(bool NeverCull)
+{
+    m_Graph.m_Passes[m_PassIndex].NeverCull = NeverCull;
+    m_Graph.m_IsCompiled                    = false;
+    return *this;
+}
+
+
+RenderGraph::RenderGraph(const RenderGraphCreateInfo& CreateInfo) :
+    m_CreateInfo{CreateInfo}
+{
+}
+
+RenderGraph::~RenderGraph()
+{
+}
+
+RenderGraph::ResourceInfo& RenderGraph::GetResource(RenderGraphResource Resource)
+{
+    DEV_CHECK_ERR(Resource.Index < m_Resources.size(), "Invalid render graph resource");
+    return m_Resources[Resource.Index];
+}
+
+const RenderGraph::ResourceInfo& RenderGraph::GetResource(RenderGraphResource Resource) const
+{
+    DEV_CHECK_ERR(Resource.Index < m_Resources.size(), "Invalid render graph resource");
+    return m_Resources[Resource.Index];
+}
+
+RenderGraphResource RenderGraph::CreateTexture(const TextureDesc& Desc)
+{
+    DEV_CHECK_ERR(Desc.Format != TEX_FORMAT_UNKNOWN, "Transient texture format must not be UNKNOWN");
+    DEV_CHECK_ERR(Desc.Usage == USAGE_DEFAULT, "Transient textures must use USAGE_DEFAULT");
+
+    ResourceInfo Res;
+    Res.Name         = Desc.Name != nullptr ? Desc.Name : "Render graph texture";
+    Res.IsTexture    = true;
+    Res.TexDesc      = Desc;
+    Res.TexDesc.Name = nullptr;
+    if (Res.TexDesc.MipLevels == 0)
+        Res.TexDesc.MipLevels = ComputeMipLevelsCount(Desc.GetWidth(), Desc.GetHeight(), Desc.GetDepth());
+
+    m_Resources.emplace_back(std::move(Res));
+    m_IsCompiled = false;
+    return RenderGraphResource{static_cast<Uint32>(m_Resources.size() - 1)};
+}
+
+RenderGraphResource RenderGraph::CreateBuffer(const BufferDesc& Desc)
+{
+    DEV_CHECK_ERR(Desc.Size > 0, "Transient buffer size must not be zero");
+    DEV_CHECK_ERR(Desc.Usage == USAGE_DEFAULT, "Transient buffers must use USAGE_DEFAULT");
+
+    ResourceInfo Res;
+    Res.Name          = Desc.Name != nullptr ? Desc.Name : "Render graph buffer";
+    Res.BuffDesc      = Desc;
+    Res.BuffDesc.Name = nullptr;
+
+    m_Resources.emplace_back(std::move(Res));
+    m_IsCompiled = false;
+    return RenderGraphResource{static_cast<Uint32>(m_Resources.size() - 1)};
+}
+
+RenderGraphResource RenderGraph::ImportTexture(ITexture* pTexture, RESOURCE_STATE InitialState, RESOURCE_STATE FinalState)
+{
+    DEV_CHECK_ERR(pTexture != nullptr, "Imported texture must not be null");
+
+    ResourceInfo Res;
+    Res.Name             = pTexture->GetDesc().Name != nullptr ? pTexture->GetDesc().Name : "Imported texture";
+    Res.IsTexture        = true;
+    Res.IsImported       = true;
+    Res.TexDesc          = pTexture->GetDesc();
+    Res.TexDesc.Name     = nullptr;
+    Res.pImportedTexture = pTexture;
+    Res.InitialState     = InitialState;
+    Res.FinalState       = FinalState;
+
+    m_Resources.emplace_back(std::move(Res));
+    m_IsCompiled = false;
+    return RenderGraphResource{static_cast<Uint32>(m_Resources.size() - 1)};
+}
+
+RenderGraphResource RenderGraph::ImportBuffer(IBuffer* pBuffer, RESOURCE_STATE InitialState, RESOURCE_STATE FinalState)
+{
+    DEV_CHECK_ERR(pBuffer != nullptr, "Imported buffer must not be null");
+
+    ResourceInfo Res;
+    Res.Name            = pBuffer->GetDesc().Name != nullptr ? pBuffer->GetDesc().Name : "Imported buffer";
+    Res.IsImported      = true;
+    Res.BuffDesc        = pBuffer->GetDesc();
+    Res.BuffDesc.Name   = nullptr;
+    Res.pImportedBuffer = pBuffer;
+    Res.InitialState    = InitialState;
+    Res.FinalState      = FinalState;
+
+    m_Resources.emplace_back(std::move(Res));
+    m_IsCompiled = false;
+    return RenderGraphResource{static_cast<Uint32>(m_Resources.size() - 1)};
+}
+
+void RenderGraph::MarkOutput(RenderGraphResource Resource)
+{
+    ResourceInfo& Res = GetResource(Resource);
+    DEV_CHECK_ERR(!Res.IsImported, "Imported resources are always treated as outputs");
+    Res.IsOutput = true;
+    m_IsCompiled = false;
+}
+
+RenderGraph::PassBuilder RenderGraph::AddPass(const char* Name, PassCallbackType Callback)
+{
+    PassInfo Pass;
+    Pass.Name     = Name != nullptr ? Name : "Render graph pass";
+    Pass.Callback = std::move(Callback);
+
+    m_Passes.emplace_back(std::move(Pass));
+    m_IsCompiled = false;
+    return PassBuilder{*this, static_cast<Uint32>(m_Passes.size() - 1)};
+}
+
+void RenderGraph::CullPasses()
+{
+    // Resources whose contents must be produced
+    std::vector<bool> IsNeeded(m_Resources.size());
+    for (size_t i = 0; i < m_Resources.size(); ++i)
+        IsNeeded[i] = m_Resources[i].IsImported || m_Resources[i].IsOutput;
+
+    for (size_t PassIdx = m_Passes.size(); PassIdx-- > 0;)
+    {
+        PassInfo& Pass = m_Passes[PassIdx];
+
+        Pass.IsCulled = !Pass.NeverCull;
+        for (const PassInfo::Access& Acc : Pass.Accesses)
+        {
+            if (Acc.Write && IsNeeded[Acc.Resource])
+                Pass.IsCulled = false;
+        }
+
+        if (Pass.IsCulled)
+        {
+            ++m_Stats.NumCulledPasses;
+            continue;
+        }
+
+        // All resources read by a pass that is kept must be produced by preceding passes
+        for (const PassInfo::Access& Acc : Pass.Accesses)
+        {
+            if (Acc.Read)
+                IsNeeded[Acc.Resource] = true;
+        }
+    }
+}
+
+void RenderGraph::ComputeLifetimes()
+{
+    for (ResourceInfo& Res : m_Resources)
+    {
+        Res.FirstPass     = InvalidIndex;
+        Res.LastPass      = InvalidIndex;
+        Res.PhysicalIndex = InvalidIndex;
+    }
+
+    for (Uint32 PassIdx = 0; PassIdx < m_Passes.size(); ++PassIdx)
+    {
+        const PassInfo& Pass = m_Passes[PassIdx];
+        if (Pass.IsCulled)
+            continue;
+
+        for (const PassInfo::Access& Acc : Pass.Accesses)
+        {
+            ResourceInfo& Res = m_Resources[Acc.Resource];
+            if (Res.FirstPass == InvalidIndex)
+            {
+                Res.FirstPass = PassIdx;
+                if (!Res.IsImported && !Acc.Write)
+                {
+                    LOG_WARNING_MESSAGE("Transient resource '", Res.Name, "' is read by pass '", Pass.Name,
+                                        "' before it is written. Its contents are undefined.");
+                }
+            }
+            Res.LastPass = PassIdx;
+        }
+    }
+
+    for (ResourceInfo& Res : m_Resources)
+    {
+        if (Res.IsImported || Res.FirstPass == InvalidIndex)
+            continue;
+
+        // Outputs must stay intact until the end of the graph
+        if (Res.IsOutput)
+            Res.LastPass = static_cast<Uint32>(m_Passes.size());
+
+        ++m_Stats.NumTransientResources;
+        m_Stats.TransientMemorySize += Res.GetMemorySize();
+    }
+}
+
+void RenderGraph::ComputeTransitions()
+{
+    struct ResourceState
+    {
+        RESOURCE_STATE State     = RESOURCE_STATE_UNKNOWN;
+        bool           FirstUse  = true;
+        bool           LastWrite = false;
+    };
+    std::vector<ResourceState> States(m_Resources.size());
+    for (size_t i = 0; i < m_Resources.size(); ++i)
+        States[i].State = m_Resources[i].InitialState;
+
+    std::vector<Uint32> PassResources;
+    for (Uint32 PassIdx = 0; PassIdx < m_Passes.size(); ++PassIdx)
+    {
+        PassInfo& Pass = m_Passes[PassIdx];
+        Pass.Transitions.clear();
+        if (Pass.IsCulled)
+            continue;
+
+        PassResources.clear();
+        for (const PassInfo::Access& Acc : Pass.Accesses)
+        {
+            if (std::find(PassResources.begin(), PassResources.end(), Acc.Resource) == PassResources.end())
+                PassResources.push_back(Acc.Resource);
+        }
+
+        for (Uint32 ResIdx : PassResources)
+        {
+            const ResourceInfo& Res = m_Resources[ResIdx];
+            ResourceState&      RS  = States[ResIdx];
+
+            PassInfo::Access Acc{};
+            Pass.FindAccess(ResIdx, Acc);
+
+            Transition Trans;
+            Trans.Resource = RenderGraphResource{ResIdx};
+            Trans.OldState = RS.State;
+            Trans.NewState = Acc.State;
+
+            bool NeedTransition = true;
+            if (!Res.IsImported && RS.FirstUse)
+            {
+                // The contents of the physical resource are left from the previous user
+                Trans.OldState       = RESOURCE_STATE_UNKNOWN;
+                Trans.DiscardContent = !Acc.Read;
+            }
+            else if (RS.State == RESOURCE_STATE_UNKNOWN)
+            {
+                // The state of the imported resource is tracked by the engine
+            }
+            else if (RS.State == Acc.State)
+            {
+                // Accesses through UAVs must be separated by a barrier if any of them writes
+                NeedTransition = (Acc.State & RESOURCE_STATE_UNORDERED_ACCESS) != 0 && (RS.LastWrite || Acc.Write);
+            }
+            else if (IsReadOnlyState(Acc.State) && IsReadOnlyState(RS.State) && (RS.State & Acc.State) == Acc.State)
+            {
+                // The resource is already in a combined read state that includes the required state
+                NeedTransition = false;
+            }
+
+            if (NeedTransition)
+            {
+                if (!Res.IsTexture && IsReadOnlyState(Acc.State) && !Acc.Write)
+                {
+                    // Buffers may be in a combination of read states. Merge the states of all subsequent
+                    // read-only accesses so that they do not require separate transitions.
+                    for (Uint32 NextPassIdx = PassIdx + 1; NextPassIdx < m_Passes.size(); ++NextPassIdx)
+                    {
+                        const PassInfo& NextPass = m_Passes[NextPassIdx];
+                        if (NextPass.IsCulled)
+                            continue;
+
+                        PassInfo::Access NextAcc{};
+                        if (!NextPass.FindAccess(ResIdx, NextAcc))
+                            continue;
+
+                        if (NextAcc.Write || !IsReadOnlyState(NextAcc.State))
+                            break;
+
+                        Trans.NewState |= NextAcc.State;
+                    }
+                }
+
+                Pass.Transitions.push_back(Trans);
+                RS.State = Trans.NewState;
+            }
+
+            RS.FirstUse  = false;
+            RS.LastWrite = Acc.Write;
+        }
+
+        if (!Pass.Transitions.empty())
+        {
+            m_Stats.NumTransitions += static_cast<Uint32>(Pass.Transitions.size());
+            ++m_Stats.NumTransitionBatches;
+        }
+    }
+
+    m_FinalTransitions.clear();
+    for (Uint32 ResIdx = 0; ResIdx < m_Resources.size(); ++ResIdx)
+    {
+        const ResourceInfo& Res = m_Resources[ResIdx];
+        if (!Res.IsImported || Res.FinalState == RESOURCE_STATE_UNKNOWN)
+            continue;
+
+        const RESOURCE_STATE State = States[ResIdx].State;
+        if (State == Res.FinalState)
+            continue;
+
+        Transition Trans;
+        Trans.Resource = RenderGraphResource{ResIdx};
+        Trans.OldState = State;
+        Trans.NewState = Res.FinalState;
+        m_FinalTransitions.push_back(Trans);
+    }
+    if (!m_FinalTransitions.empty())
+    {
+        m_Stats.NumTransitions += static_cast<Uint32>(m_FinalTransitions.size());
+        ++m_Stats.NumTransitionBatches;
+    }
+}
+
+void RenderGraph::RecyclePhysicalResources()
+{
+    for (PhysicalResource& PhysRes : m_PhysicalResources)
+    {
+        if (PhysRes.pTexture || PhysRes.pBuffer)
+        {
+            PooledResource Pooled;
+            Pooled.pTexture = std::move(PhysRes.pTexture);
+            Pooled.pBuffer  = std::move(PhysRes.pBuffer);
+            m_Pool.emplace_back(std::move(Pooled));
+        }
+    }
+    m_PhysicalResources.clear();
+}
+
+void RenderGraph::AssignPhysicalResources()
+{
+    // Return the resources of the previous compilation to the pool
+    RecyclePhysicalResources();
+
+    std::vector<Uint32> SortedResources;
+    for (Uint32 ResIdx = 0; ResIdx < m_Resources.size(); ++ResIdx)
+    {
+        const ResourceInfo& Res = m_Resources[ResIdx];
+        if (!Res.IsImported && Res.FirstPass != InvalidIndex)
+            SortedResources.push_back(ResIdx);
+    }
+    std::stable_sort(SortedResources.begin(), SortedResources.end(),
+                     [this](Uint32 lhs, Uint32 rhs) { return m_Resources[lhs].FirstPass < m_Resources[rhs].FirstPass; });
+
+    for (Uint32 ResIdx : SortedResources)
+    {
+        ResourceInfo& Res = m_Resources[ResIdx];
+
+        // Find a physical resource with identical description that is not used
+        // by other transient resources during the lifetime of this one.
+        for (Uint32 PhysIdx = 0; PhysIdx < m_PhysicalResources.size() && Res.PhysicalIndex == InvalidIndex; ++PhysIdx)
+        {
+            PhysicalResource& PhysRes = m_PhysicalResources[PhysIdx];
+            if (PhysRes.IsTexture != Res.IsTexture || PhysRes.LastPass >= Res.FirstPass)
+                continue;
+
+            const bool IsCompatible = Res.IsTexture ? PhysRes.TexDesc == Res.TexDesc : PhysRes.BuffDesc == Res.BuffDesc;
+            if (IsCompatible)
+            {
+                PhysRes.LastPass  = Res.LastPass;
+                Res.PhysicalIndex = PhysIdx;
+            }
+        }
+
+        if (Res.PhysicalIndex == InvalidIndex)
+        {
+            PhysicalResource PhysRes;
+            PhysRes.Name       = Res.Name;
+            PhysRes.IsTexture  = Res.IsTexture;
+            PhysRes.TexDesc    = Res.TexDesc;
+            PhysRes.BuffDesc   = Res.BuffDesc;
+            PhysRes.FirstPass  = Res.FirstPass;
+            PhysRes.LastPass   = Res.LastPass;
+            PhysRes.MemorySize = Res.GetMemorySize();
+
+            Res.PhysicalIndex = static_cast<Uint32>(m_PhysicalResources.size());
+            m_PhysicalResources.emplace_back(std::move(PhysRes));
+
+            m_Stats.PhysicalMemorySize += Res.GetMemorySize();
+        }
+    }
+
+    m_Stats.NumPhysicalResources = static_cast<Uint32>(m_PhysicalResources.size());
+}
+
+void RenderGraph::Compile()
+{
+    m_Stats           = {};
+    m_Stats.NumPasses = static_cast<Uint32>(m_Passes.size());
+
+    CullPasses();
+    ComputeLifetimes();
+    ComputeTransitions();
+    AssignPhysicalResources();
+
+    m_IsCompiled = true;
+}
+
+RefCntAutoPtr<IDeviceObject> RenderGraph::FindPooledResource(const PhysicalResource& PhysRes)
+{
+    for (auto it = m_Pool.begin(); it != m_Pool.end(); ++it)
+    {
+        bool IsCompatible = false;
+        if (PhysRes.IsTexture)
+            IsCompatible = it->pTexture && it->pTexture->GetDesc() == PhysRes.TexDesc;
+        else
+            IsCompatible = it->pBuffer && it->pBuffer->GetDesc() == PhysRes.BuffDesc;
+
+        if (IsCompatible)
+        {
+            RefCntAutoPtr<IDeviceObject> pObject{PhysRes.IsTexture ? static_cast<IDeviceObject*>(it->pTexture) : static_cast<IDeviceObject*>(it->pBuffer)};
+            m_Pool.erase(it);
+            return pObject;
+        }
+    }
+    return {};
+}
+
+void RenderGraph::PreparePhysicalResources(IRenderDevice* pDevice)
+{
+    const bool UseSparseAliasing = m_CreateInfo.EnableSparseAliasing && IsSparseAliasingSupported(pDevice);
+
+    for (PhysicalResource& PhysRes : m_PhysicalResources)
+    {
+        if (PhysRes.pTexture || PhysRes.pBuffer)
+            continue;
+
+        if (PhysRes.IsTexture && UseSparseAliasing && IsSparseTextureCompatible(pDevice, PhysRes.TexDesc))
+        {
+            PhysRes.IsSparse = true;
+            PhysRes.TexDesc.Usage = USAGE_SPARSE;
+            PhysRes.TexDesc.MiscFlags |= MISC_TEXTURE_FLAG_SPARSE_ALIASING;
+        }
+
+        if (RefCntAutoPtr<IDeviceObject> pPooled = FindPooledResource(PhysRes))
+        {
+            if (PhysRes.IsTexture)
+                PhysRes.pTexture = RefCntAutoPtr<ITexture>{pPooled, IID_Texture};
+            else
+                PhysRes.pBuffer = RefCntAutoPtr<IBuffer>{pPooled, IID_Buffer};
+            continue;
+        }
+
+        if (PhysRes.IsTexture)
+        {
+            TextureDesc Desc = PhysRes.TexDesc;
+            Desc.Name        = PhysRes.Name.c_str();
+            pDevice->CreateTexture(Desc, nullptr, &PhysRes.pTexture);
+            DEV_CHECK_ERR(PhysRes.pTexture, "Failed to create render graph texture '", PhysRes.Name, "'");
+        }
+        else
+        {
+            BufferDesc Desc = PhysRes.BuffDesc;
+            Desc.Name       = PhysRes.Name.c_str();
+            pDevice->CreateBuffer(Desc, nullptr, &PhysRes.pBuffer);
+            DEV_CHECK_ERR(PhysRes.pBuffer, "Failed to create render graph buffer '", PhysRes.Name, "'");
+        }
+    }
+}
+
+void RenderGraph::PrepareSparseTextures(IRenderDevice* pDevice, IDeviceContext* pContext)
+{
+    std::vector<Uint32> SparseResources;
+    Uint64              PageSize = 0;
+    for (Uint32 PhysIdx = 0; PhysIdx < m_PhysicalResources.size(); ++PhysIdx)
+    {
+        const PhysicalResource& PhysRes = m_PhysicalResources[PhysIdx];
+        if (PhysRes.IsSparse && PhysRes.pTexture)
+        {
+            SparseResources.push_back(PhysIdx);
+            PageSize = std::max(PageSize, Uint64{PhysRes.pTexture->GetSparseProperties().BlockSize});
+        }
+    }
+
+    if (SparseResources.empty())
+    {
+        m_SparseLayout.clear();
+        m_pSparseMemory.Release();
+        return;
+    }
+
+    std::vector<SparseMemoryLayout> Layout(SparseResources.size());
+    for (size_t i = 0; i < SparseResources.size(); ++i)
+    {
+        Layout[i].pTexture = m_PhysicalResources[SparseResources[i]].pTexture;
+        Layout[i].Size     = AlignUp(GetSparseTextureMemorySize(Layout[i].pTexture), PageSize);
+    }
+
+    // Place the largest textures first. Textures whose lifetimes do not overlap may share memory.
+    std::vector<size_t> Order(Layout.size());
+    std::iota(Order.begin(), Order.end(), size_t{0});
+    std::stable_sort(Order.begin(), Order.end(), [&Layout](size_t lhs, size_t rhs) { return Layout[lhs].Size > Layout[rhs].Size; });
+
+    auto LifetimesOverlap = [&](size_t i, size_t j) {
+        const PhysicalResource& Res0 = m_PhysicalResources[SparseResources[i]];
+        const PhysicalResource& Res1 = m_PhysicalResources[SparseResources[j]];
+        return Res0.FirstPass <= Res1.LastPass && Res1.FirstPass <= Res0.LastPass;
+    };
+    auto MemoryOverlaps = [&Layout](size_t i, size_t j) {
+        return Layout[i].Offset < Layout[j].Offset + Layout[j].Size && Layout[j].Offset < Layout[i].Offset + Layout[i].Size;
+    };
+
+    Uint64 MemorySize = 0;
+    for (size_t i = 0; i < Order.size(); ++i)
+    {
+        const size_t Curr = Order[i];
+        for (bool Moved = true; Moved;)
+        {
+            Moved = false;
+            for (size_t j = 0; j < i; ++j)
+            {
+                const size_t Placed = Order[j];
+                if (LifetimesOverlap(Curr, Placed) && MemoryOverlaps(Curr, Placed))
+                {
+                    Layout[Curr].Offset = Layout[Placed].Offset + Layout[Placed].Size;
+                    Moved               = true;
+                }
+            }
+        }
+        MemorySize = std::max(MemorySize, Layout[Curr].Offset + Layout[Curr].Size);
+    }
+
+    for (size_t i = 0; i < Layout.size(); ++i)
+    {
+        PhysicalResource& PhysRes = m_PhysicalResources[SparseResources[i]];
+        PhysRes.IsAliased         = false;
+        for (size_t j = 0; j < Layout.size() && !PhysRes.IsAliased; ++j)
+            PhysRes.IsAliased = i != j && MemoryOverlaps(i, j);
+    }
+    m_Stats.SparseMemorySize = MemorySize;
+
+    if (Layout == m_SparseLayout && m_pSparseMemory)
+        return;
+
+    // Recreate the memory so that it is compatible with all textures in the new layout
+    {
+        std::vector<IDeviceObject*> CompatibleResources(Layout.size());
+        for (size_t i = 0; i < Layout.size(); ++i)
+            CompatibleResources[i] = Layout[i].pTexture;
+
+        DeviceMemoryCreateInfo MemCI;
+        MemCI.Desc.Name             = "Render graph transient memory";
+        MemCI.Desc.Type             = DEVICE_MEMORY_TYPE_SPARSE;
+        MemCI.Desc.PageSize         = PageSize;
+        MemCI.InitialSize           = MemorySize;
+        MemCI.ppCompatibleResources = CompatibleResources.data();
+        MemCI.NumResources          = static_cast<Uint32>(CompatibleResources.size());
+
+        m_pSparseMemory.Release();
+        pDevice->CreateDeviceMemory(MemCI, &m_pSparseMemory);
+        DEV_CHECK_ERR(m_pSparseMemory, "Failed to create render graph transient memory");
+    }
+
+    if (!m_pBeforeBindFence)
+    {
+        FenceDesc Desc;
+        Desc.Type = FENCE_TYPE_GENERAL;
+
+        Desc.Name = "Render graph before-bind fence";
+        pDevice->CreateFence(Desc, &m_pBeforeBindFence);
+        Desc.Name = "Render graph after-bind fence";
+        pDevice->CreateFence(Desc, &m_pAfterBindFence);
+    }
+
+    std::vector<SparseTextureMemoryBindInfo>  TexBinds(Layout.size());
+    std::vector<SparseTextureMemoryBindRange> Ranges;
+    for (const SparseMemoryLayout& TexLayout : Layout)
+        Ranges.resize(Ranges.size() + TexLayout.pTexture->GetDesc().MipLevels);
+
+    size_t RangeIdx = 0;
+    for (size_t i = 0; i < Layout.size(); ++i)
+    {
+        ITexture*                      pTexture    = Layout[i].pTexture;
+        const TextureDesc&             Desc        = pTexture->GetDesc();
+        const SparseTextureProperties& SparseProps = pTexture->GetSparseProperties();
+
+        TexBinds[i].pTexture = pTexture;
+        TexBinds[i].pRanges  = &Ranges[RangeIdx];
+
+        Uint64 MemOffset = Layout[i].Offset;
+        for (Uint32 Mip = 0; Mip < std::min(Desc.MipLevels, SparseProps.FirstMipInTail); ++Mip)
+        {
+            const MipLevelProperties MipProps = GetMipLevelProperties(Desc, Mip);
+
+            SparseTextureMemoryBindRange& Range = Ranges[RangeIdx++];
+            Range.MipLevel                      = Mip;
+            Range.Region                        = Box{0, MipProps.StorageWidth, 0, MipProps.StorageHeight, 0, MipProps.Depth};
+
+            const uint3 NumTiles = GetNumSparseTilesInBox(Range.Region, SparseProps.TileSize);
+            Range.pMemory        = m_pSparseMemory;
+            Range.MemoryOffset   = MemOffset;
+            Range.MemorySize     = Uint64{NumTiles.x} * NumTiles.y * NumTiles.z * SparseProps.BlockSize;
+            MemOffset += Range.MemorySize;
+        }
+        if (Desc.MipLevels > SparseProps.FirstMipInTail)
+        {
+            SparseTextureMemoryBindRange& Range = Ranges[RangeIdx++];
+            Range.MipLevel                      = SparseProps.FirstMipInTail;
+            Range.pMemory                       = m_pSparseMemory;
+            Range.MemoryOffset                  = MemOffset;
+            Range.MemorySize                    = SparseProps.MipTailSize;
+        }
+        TexBinds[i].NumRanges = static_cast<Uint32>(&Ranges[0] + RangeIdx - TexBinds[i].pRanges);
+    }
+
+    // Make sure that the previous commands that use the textures are complete before the memory is rebound
+    Uint64  WaitFenceValue = m_NextFenceValue;
+    IFence* pWaitFence     = m_pBeforeBindFence;
+    pContext->EnqueueSignal(m_pBeforeBindFence, WaitFenceValue);
+
+    Uint64  SignalFenceValue = m_NextFenceValue;
+    IFence* pSignalFence     = m_pAfterBindFence;
+    ++m_NextFenceValue;
+
+    BindSparseResourceMemoryAttribs BindMemAttribs;
+    BindMemAttribs.pTextureBinds      = TexBinds.data();
+    BindMemAttribs.NumTextureBinds    = static_cast<Uint32>(TexBinds.size());
+    BindMemAttribs.ppWaitFences       = &pWaitFence;
+    BindMemAttribs.pWaitFenceValues   = &WaitFenceValue;
+    BindMemAttribs.NumWaitFences      = 1;
+    BindMemAttribs.ppSignalFences     = &pSignalFence;
+    BindMemAttribs.pSignalFenceValues = &SignalFenceValue;
+    BindMemAttribs.NumSignalFences    = 1;
+    pContext->BindSparseResourceMemory(BindMemAttribs);
+
+    pContext->DeviceWaitForFence(m_pAfterBindFence, SignalFenceValue);
+
+    m_SparseLayout = std::move(Layout);
+}
+
+void RenderGraph::ReleaseUnusedResources()
+{
+    m_Pool.erase(std::remove_if(m_Pool.begin(), m_Pool.end(),
+                                [this](PooledResource& Pooled) { return ++Pooled.UnusedFrames > m_CreateInfo.MaxUnusedFrames; }),
+                 m_Pool.end());
+}
+
+void RenderGraph::Execute(IRenderDevice* pDevice, IDeviceContext* pContext)
+{
+    DEV_CHECK_ERR(pDevice != nullptr && pContext != nullptr, "Render device and device context must not be null");
+
+    if (!m_IsCompiled)
+        Compile();
+
+    PreparePhysicalResources(pDevice);
+    PrepareSparseTextures(pDevice, pContext);
+
+    // Physical resources that share sparse memory require an aliasing barrier before the first use
+    std::vector<bool> IsPhysResUsed(m_PhysicalResources.size());
+
+    std::vector<StateTransitionDesc> Barriers;
+    auto AddTransition = [&](const Transition& Trans) {
+        const ResourceInfo& Res     = m_Resources[Trans.Resource.Index];
+        IDeviceObject*      pObject = Res.IsTexture ? static_cast<IDeviceObject*>(GetTexture(Trans.Resource)) : static_cast<IDeviceObject*>(GetBuffer(Trans.Resource));
+
+        if (Res.PhysicalIndex != InvalidIndex && !IsPhysResUsed[Res.PhysicalIndex])
+        {
+            IsPhysResUsed[Res.PhysicalIndex] = true;
+            if (m_PhysicalResources[Res.PhysicalIndex].IsAliased)
+                Barriers.emplace_back(nullptr, pObject);
+        }
+
+        StateTransitionDesc Barrier;
+        Barrier.pResource = pObject;
+        // Rely on the state tracked by the engine unless the application specified the initial state of the imported resource
+        Barrier.OldState = (Res.IsImported && Trans.OldState == Res.InitialState) ? Trans.OldState : RESOURCE_STATE_UNKNOWN;
+        Barrier.NewState = Trans.NewState;
+        Barrier.Flags    = STATE_TRANSITION_FLAG_UPDATE_STATE;
+        if (Trans.DiscardContent)
+            Barrier.Flags |= STATE_TRANSITION_FLAG_DISCARD_CONTENT;
+        Barriers.push_back(Barrier);
+    };
+
+    for (const PassInfo& Pass : m_Passes)
+    {
+        if (Pass.IsCulled)
+            continue;
+
+        Barriers.clear();
+        for (const Transition& Trans : Pass.Transitions)
+            AddTransition(Trans);
+        if (!Barriers.empty())
+            pContext->TransitionResourceStates(static_cast<Uint32>(Barriers.size()), Barriers.data());
+
+        if (Pass.Callback)
+        {
+            ScopedDebugGroup DebugGroup{pContext, Pass.Name};
+            Pass.Callback(pContext, *this);
+        }
+    }
+
+    Barriers.clear();
+    for (const Transition& Trans : m_FinalTransitions)
+        AddTransition(Trans);
+    if (!Barriers.empty())
+        pContext->TransitionResourceStates(static_cast<Uint32>(Barriers.size()), Barriers.data());
+
+    ReleaseUnusedResources();
+}
+
+void RenderGraph::Reset()
+{
+    RecyclePhysicalResources();
+
+    m_Resources.clear();
+    m_Passes.clear();
+    m_FinalTransitions.clear();
+    m_IsCompiled = false;
+    m_Stats      = {};
+}
+
+ITexture* RenderGraph::GetTexture(RenderGraphResource Resource) const
+{
+    const ResourceInfo& Res = GetResource(Resource);
+    DEV_CHECK_ERR(Res.IsTexture, "Resource '", Res.Name, "' is not a texture");
+    if (Res.IsImported)
+        return Res.pImportedTexture;
+
+    return Res.PhysicalIndex != InvalidIndex && m_IsCompiled ? m_PhysicalResources[Res.PhysicalIndex].pTexture.RawPtr() : nullptr;
+}
+
+IBuffer* RenderGraph::GetBuffer(RenderGraphResource Resource) const
+{
+    const ResourceInfo& Res = GetResource(Resource);
+    DEV_CHECK_ERR(!Res.IsTexture, "Resource '", Res.Name, "' is not a buffer");
+    if (Res.IsImported)
+        return Res.pImportedBuffer;
+
+    return Res.PhysicalIndex != InvalidIndex && m_IsCompiled ? m_PhysicalResources[Res.PhysicalIndex].pBuffer.RawPtr() : nullptr;
+}
+
+bool RenderGraph::IsPassCulled(Uint32 PassIndex) const
+{
+    DEV_CHECK_ERR(PassIndex < m_Passes.size(), "Pass index (", PassIndex, ") is out of range");
+    DEV_CHECK_ERR(m_IsCompiled, "The graph is not compiled");
+    return m_Passes[PassIndex].IsCulled;
+}
+
+const std::vector<RenderGraph::Transition>& RenderGraph::GetPassTransitions(Uint32 PassIndex) const
+{
+    DEV_CHECK_ERR(PassIndex < m_Passes.size(), "Pass index (", PassIndex, ") is out of range");
+    DEV_CHECK_ERR(m_IsCompiled, "The graph is not compiled");
+    return m_Passes[PassIndex].Transitions;
+}
+
+Uint32 RenderGraph::GetPhysicalResourceIndex(RenderGraphResource Resource) const
+{
+    return GetResource(Resource).PhysicalIndex;
+}
+
+} // namespace Diligent
@@ -35,6 +35,7 @@
 #include <array>
 #include <mutex>
 #include <vector>
+#include <unordered_set>
 
 #include "Archiver.h"
 #include "Dearchiver.h"
@@ -50,10 +51,72 @@
 #include "GraphicsUtilities.h"
 #include "ShaderSourceFactoryUtils.hpp"
 #include "DXCompiler.hpp"
+#include "ThreadPool.hpp"
+#include "DataBlobImpl.hpp"
+#include "MemoryFileStream.hpp"
 
 namespace Diligent
 {
 
+namespace
+{
+
+// Shader source stream factory that serializes all reads from the wrapped factory.
+// Source stream factories are not required to be thread-safe, and different factories
+// may share the same underlying factory (e.g. the reload source), so all wrappers
+// created for a single reload share the same mutex.
+class SerializingShaderSourceFactory final : public ObjectBase<IShaderSourceInputStreamFactory>
+{
+public:
+    using TBase = ObjectBase<IShaderSourceInputStreamFactory>;
+
+    SerializingShaderSourceFactory(IReferenceCounters*              pRefCounters,
+                                   IShaderSourceInputStreamFactory* pFactory,
+                                   std::shared_ptr<std::mutex>      pMtx) :
+        TBase{pRefCounters},
+        m_pFactory{pFactory},
+        m_pMtx{std::move(pMtx)}
+    {}
+
+    IMPLEMENT_QUERY_INTERFACE_IN_PLACE(IID_IShaderSourceInputStreamFactory, TBase)
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream(const Char*   Name,
+                                                      IFileStream** ppStream) override final
+    {
+        CreateInputStream2(Name, CREATE_SHADER_SOURCE_INPUT_STREAM_FLAG_NONE, ppStream);
+    }
+
+    virtual void DILIGENT_CALL_TYPE CreateInputStream2(const Char*                             Name,
+                                                       CREATE_SHADER_SOURCE_INPUT_STREAM_FLAGS Flags,
+                                                       IFileStream**                           ppStream) override final
+    {
+        VERIFY_EXPR(ppStream != nullptr && *ppStream == nullptr);
+
+        // Read the entire file while holding the lock, so that the returned stream
+        // does not access the wrapped factory.
+        RefCntAutoPtr<DataBlobImpl> pFileData;
+        {
+            std::lock_guard<std::mutex> Guard{*m_pMtx};
+
+            RefCntAutoPtr<IFileStream> pSourceStream;
+            m_pFactory->CreateInputStream2(Name, Flags, &pSourceStream);
+            if (!pSourceStream)
+                return;
+
+            pFileData = DataBlobImpl::Create();
+            pSourceStream->ReadBlob(pFileData);
+        }
+
+        *ppStream = MemoryFileStream::Create(pFileData).Detach();
+    }
+
+private:
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> m_pFactory;
+    const std::shared_ptr<std::mutex>              m_pMtx;
+};
+
+} // namespace
+
 Bool RenderStateCacheImpl::WriteToBlob(Uint32 ContentVersion, IDataBlob** ppBlob)
 {
     if (ContentVersion == ~0u)
@@ -105,6 +168,7 @@ void RenderStateCacheImpl::Reset()
     m_ReloadableShaders.clear();
     m_Pipelines.clear();
     m_ReloadablePipelines.clear();
+    m_CompoundReloadSources.clear();
 }
 
 RefCntAutoPtr<IShader> RenderStateCacheImpl::FindReloadableShader(IShader* pShader)
@@ -233,6 +297,17 @@ RenderStateCacheImpl::RenderStateCacheImpl(IReferenceCounters*               pRe
     m_pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCI, &m_pDearchiver);
     if (!m_pDearchiver)
         LOG_ERROR_AND_THROW("Failed to create dearchiver");
+
+    if (m_CI.EnableHotReload && CreateInfo.WatchDirectory != nullptr && CreateInfo.WatchDirectory[0] != '\0')
+    {
+        m_pFileWatcher = std::make_unique<FileWatcher>(CreateInfo.WatchDirectory);
+        if (!m_pFileWatcher->IsValid())
+        {
+            LOG_WARNING_MESSAGE("File change notifications are not available for directory '", CreateInfo.WatchDirectory,
+                                "'. Reload will re-read all shader source files.");
+            m_pFileWatcher.reset();
+        }
+    }
 }
 
 #define RENDER_STATE_CACHE_LOG(Level, ...)                         \
@@ -244,6 +319,19 @@ RenderStateCacheImpl::RenderStateCacheImpl(IReferenceCounters*               pRe
         }                                                          \
     } while (false)
 
+RefCntAutoPtr<IShaderSourceInputStreamFactory> RenderStateCacheImpl::GetCompoundReloadSource(IShaderSourceInputStreamFactory* pSourceFactory)
+{
+    VERIFY_EXPR(m_pReloadSource && pSourceFactory != nullptr);
+
+    std::lock_guard<std::mutex> Guard{m_CompoundReloadSourcesMtx};
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory>& pCompoundReloadSource = m_CompoundReloadSources[pSourceFactory];
+    if (!pCompoundReloadSource)
+        pCompoundReloadSource = CreateCompoundShaderSourceFactory({m_pReloadSource, pSourceFactory});
+
+    return pCompoundReloadSource;
+}
+
 bool RenderStateCacheImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
                                         IShader**               ppShader)
 {
@@ -287,10 +375,9 @@ bool RenderStateCacheImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
             {
                 if (ShaderCI.pShaderSourceStreamFactory)
                 {
-                    // Create compound shader source factory that will first try to load shader from the reload source
+                    // Use compound shader source factory that will first try to load shader from the reload source
                     // and if it fails, will fall back to the original source factory.
-                    pCompoundReloadSource =
-                        CreateCompoundShaderSourceFactory({m_pReloadSource, ShaderCI.pShaderSourceStreamFactory});
+                    pCompoundReloadSource                = GetCompoundReloadSource(ShaderCI.pShaderSourceStreamFactory);
                     _ShaderCI.pShaderSourceStreamFactory = pCompoundReloadSource;
                 }
                 else
@@ -298,7 +385,7 @@ bool RenderStateCacheImpl::CreateShader(const ShaderCreateInfo& ShaderCI,
                     _ShaderCI.pShaderSourceStreamFactory = m_pReloadSource;
                 }
             }
-            ReloadableShader::Create(this, pShader, _ShaderCI, ppShader);
+            ReloadableShader::Create(this, pShader, _ShaderCI, ShaderCI, ppShader);
 
             std::lock_guard<std::mutex> Guard{m_ReloadableShadersMtx};
             m_ReloadableShaders.emplace(pShader->GetUniqueID(), RefCntWeakPtr<IShader>{*ppShader});
@@ -904,9 +991,19 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
 
     Uint32 NumStatesReloaded = 0;
 
-    // Reload all shaders first
+    // Find the shaders whose sources have changed. Source files shared by multiple
+    // shaders are read and hashed only once. If the file watcher is available,
+    // only the files it reports as modified are read.
+    std::vector<RefCntAutoPtr<ReloadableShader>> ChangedShaders;
     {
+        ReloadableShader::SourceHashCache HashCache;
+
         std::lock_guard<std::mutex> Guard{m_ReloadableShadersMtx};
+
+        std::vector<std::string> ChangedFiles;
+        if (m_pFileWatcher)
+            ChangedFiles = m_pFileWatcher->GetChangedFiles();
+
         for (auto shader_it : m_ReloadableShaders)
         {
             if (RefCntAutoPtr<IShader> pShader = shader_it.second.Lock())
@@ -914,8 +1011,8 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
                 RefCntAutoPtr<ReloadableShader> pReloadableShader{pShader, ReloadableShader::IID_InternalImpl};
                 if (pReloadableShader)
                 {
-                    if (pReloadableShader->Reload())
-                        ++NumStatesReloaded;
+                    if (pReloadableShader->HasSourceChanges(HashCache, m_pFileWatcher ? &ChangedFiles : nullptr))
+                        ChangedShaders.emplace_back(std::move(pReloadableShader));
                 }
                 else
                 {
@@ -925,9 +1022,85 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
         }
     }
 
-    // Reload pipelines.
+    // Recompile the changed shaders in parallel.
+    // Worker threads only call ReloadableShader::Recompile, which reads the shader's own create info
+    // and calls thread-safe cache methods (CreateShaderInternal guards the shader map with m_ShadersMtx,
+    // while the archiver, dearchiver and serialization device are thread-safe). Each task writes its
+    // result to its own slot. Compilation reads the sources, and since source stream factories are not
+    // required to be thread-safe, the workers read them through wrappers that serialize all reads.
+    // Replacing the internal shader objects and re-hashing the sources is done on this thread afterwards.
+    {
+        std::vector<RefCntAutoPtr<IShader>> NewShaders(ChangedShaders.size());
+        std::vector<Uint8>                  FoundInCache(ChangedShaders.size(), 0);
+
+        IThreadPool* pThreadPool = m_pDevice->GetShaderCompilationThreadPool();
+
+        std::vector<RefCntAutoPtr<IShaderSourceInputStreamFactory>> SourceFactories(ChangedShaders.size());
+        if (pThreadPool != nullptr && ChangedShaders.size() > 1)
+        {
+            std::shared_ptr<std::mutex> pSourceMtx = std::make_shared<std::mutex>();
+
+            std::unordered_map<IShaderSourceInputStreamFactory*, RefCntAutoPtr<IShaderSourceInputStreamFactory>> SerializingFactories;
+            for (size_t i = 0; i < ChangedShaders.size(); ++i)
+            {
+                if (IShaderSourceInputStreamFactory* pFactory = ChangedShaders[i]->GetSourceFactory())
+                {
+                    RefCntAutoPtr<IShaderSourceInputStreamFactory>& pSerializingFactory = SerializingFactories[pFactory];
+                    if (!pSerializingFactory)
+                        pSerializingFactory = RefCntAutoPtr<IShaderSourceInputStreamFactory>{MakeNewRCObj<SerializingShaderSourceFactory>()(pFactory, pSourceMtx)};
+                    SourceFactories[i] = pSerializingFactory;
+                }
+            }
+        }
+
+        const auto RecompileShader = [&](size_t Idx) {
+            bool Found        = false;
+            NewShaders[Idx]   = ChangedShaders[Idx]->Recompile(SourceFactories[Idx], Found);
+            FoundInCache[Idx] = Found ? 1 : 0;
+        };
+
+        if (pThreadPool != nullptr && ChangedShaders.size() > 1)
+        {
+            std::vector<RefCntAutoPtr<IAsyncTask>> Tasks;
+            Tasks.reserve(ChangedShaders.size() - 1);
+            for (size_t i = 1; i < ChangedShaders.size(); ++i)
+            {
+                Tasks.emplace_back(EnqueueAsyncWork(pThreadPool,
+                                                    [&RecompileShader, i](Uint32 ThreadId) {
+                                                        RecompileShader(i);
+                                                        return ASYNC_TASK_STATUS_COMPLETE;
+                                                    }));
+            }
+
+            RecompileShader(0);
+
+            for (RefCntAutoPtr<IAsyncTask>& pTask : Tasks)
+                pTask->WaitForCompletion();
+        }
+        else
+        {
+            for (size_t i = 0; i < ChangedShaders.size(); ++i)
+                RecompileShader(i);
+        }
+
+        for (size_t i = 0; i < ChangedShaders.size(); ++i)
+        {
+            ChangedShaders[i]->CommitReload(NewShaders[i]);
+            if (!FoundInCache[i])
+                ++NumStatesReloaded;
+        }
+    }
+
+    std::unordered_set<const IShader*> ReloadedShaders;
+    ReloadedShaders.reserve(ChangedShaders.size());
+    for (const RefCntAutoPtr<ReloadableShader>& pShader : ChangedShaders)
+        ReloadedShaders.emplace(pShader.RawPtr());
+
+    // Reload pipelines that use the reloaded shaders.
     // Note that create info structs reference reloadable shaders, so that when pipelines
     // are re-created, they will automatically use reloaded shaders.
+    // If the ReloadGraphicsPipeline callback is provided, all graphics pipelines are re-created
+    // since the callback may modify the pipeline create info.
     {
         std::lock_guard<std::mutex> Guard{m_ReloadablePipelinesMtx};
         for (auto pso_it : m_ReloadablePipelines)
@@ -935,8 +1108,12 @@ Uint32 RenderStateCacheImpl::Reload(ReloadGraphicsPipelineCallbackType ReloadGra
             if (RefCntAutoPtr<IPipelineState> pPSO = pso_it.second.Lock())
             {
                 RefCntAutoPtr<ReloadablePipelineState> pReloadablePSO{pPSO, ReloadablePipelineState::IID_InternalImpl};
-                if (pPSO)
+                if (pReloadablePSO)
                 {
+                    const bool ForceReload = ReloadGraphicsPipeline != nullptr && pPSO->GetDesc().IsAnyGraphicsPipeline();
+                    if (!ForceReload && !pReloadablePSO->UsesAnyShader(ReloadedShaders))
+                        continue;
+
                     if (pReloadablePSO->Reload(ReloadGraphicsPipeline, pUserData))
                         ++NumStatesReloaded;
                 }
@@ -26,13 +26,19 @@
  */
 
 #include <mutex>
+#include <condition_variable>
 #include <unordered_map>
 #include <deque>
 #include <vector>
+#include <memory>
+#include <atomic>
+#include <algorithm>
 
 #include "TextureUploaderD3D12_Vk.hpp"
 #include "ThreadSignal.hpp"
 #include "GraphicsAccessories.hpp"
+#include "Align.hpp"
+#include "Timer.hpp"
 
 namespace Diligent
 {
@@ -134,6 +140,425 @@ private:
     Uint64                  m_CopyScheduledFenceValue = 0;
 };
 
+
+TextureDesc GetUploadTextureDesc(const UploadBufferDesc& Desc)
+{
+    TextureDesc TexDesc;
+    TexDesc.Type      = Desc.ArraySize == 1 ? RESOURCE_DIM_TEX_2D : RESOURCE_DIM_TEX_2D_ARRAY;
+    TexDesc.Width     = Desc.Width;
+    TexDesc.Height    = Desc.Height;
+    TexDesc.Format    = Desc.Format;
+    TexDesc.MipLevels = Desc.MipLevels;
+    TexDesc.ArraySize = Desc.ArraySize;
+    return TexDesc;
+}
+
+// Returns the number of bytes copied to the GPU texture by one copy operation
+Uint64 GetUploadDataSize(const UploadBufferDesc& Desc)
+{
+    const TextureDesc TexDesc = GetUploadTextureDesc(Desc);
+
+    Uint64 SliceSize = 0;
+    for (Uint32 Mip = 0; Mip < Desc.MipLevels; ++Mip)
+        SliceSize += GetMipLevelProperties(TexDesc, Mip).MipSize;
+    return SliceSize * Desc.ArraySize;
+}
+
+
+// Fixed-size ring that upload buffers are suballocated from. The ring is backed by
+// a USAGE_STAGING buffer that is mapped once by the render thread and stays mapped
+// for the lifetime of the ring, so the data is copied to the destination textures
+// directly from the buffer.
+// Regions may be released in any order, but the memory is only reclaimed
+// from the tail of the ring, so the ring works best when copies are
+// scheduled in roughly the same order the buffers were allocated.
+class StagingRing
+{
+public:
+    static constexpr Uint64 InvalidOffset = ~Uint64{0};
+    // D3D12 requires buffer-to-texture copy source offsets to be aligned
+    // to D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT (512) and row pitches to be aligned to
+    // D3D12_TEXTURE_DATA_PITCH_ALIGNMENT (256). These alignments also satisfy Vulkan
+    // requirements for all formats whose texel block size is a power of two.
+    static constexpr Uint64 Alignment    = 512;
+    static constexpr Uint64 RowAlignment = 256;
+
+    explicit StagingRing(IBuffer* pBuffer) :
+        m_pBuffer{pBuffer},
+        m_Size{pBuffer->GetDesc().Size}
+    {}
+
+    ~StagingRing()
+    {
+        VERIFY(m_Regions.empty(), "Destroying the staging ring with outstanding allocations");
+        VERIFY(m_pMappedData == nullptr, "Destroying the staging ring that is still mapped");
+    }
+
+    // Returns true if textures of the given format can be copied from the ring
+    static bool IsFormatSupported(TEXTURE_FORMAT Format)
+    {
+        const TextureFormatAttribs& FmtAttribs = GetTextureFormatAttribs(Format);
+
+        const Uint32 BlockSize = FmtAttribs.ComponentType == COMPONENT_TYPE_COMPRESSED ?
+            Uint32{FmtAttribs.ComponentSize} :
+            Uint32{FmtAttribs.ComponentSize} * Uint32{FmtAttribs.NumComponents};
+        return BlockSize != 0 && RowAlignment % BlockSize == 0;
+    }
+
+    // Maps the buffer if it has not been mapped yet. Must only be called by the render thread.
+    void Map(IDeviceContext* pContext)
+    {
+        if (m_pMapContext)
+            return;
+
+        void* pMappedData = nullptr;
+        pContext->MapBuffer(m_pBuffer, MAP_WRITE, MAP_FLAG_NONE, pMappedData);
+        if (pMappedData == nullptr)
+        {
+            UNEXPECTED("Failed to map the staging ring buffer");
+            return;
+        }
+        m_pMapContext = pContext;
+
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+            m_pMappedData = static_cast<Uint8*>(pMappedData);
+        }
+        m_SpaceReleasedCV.notify_all();
+    }
+
+    void Unmap()
+    {
+        if (!m_pMapContext)
+            return;
+
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+            m_pMappedData = nullptr;
+        }
+        m_pMapContext->UnmapBuffer(m_pBuffer, MAP_WRITE);
+        m_pMapContext.Release();
+    }
+
+    // Allocates a region of the given size and returns its offset or InvalidOffset
+    // if there is not enough space in the ring or the ring has not been mapped yet.
+    // If WaitForSpace is true, the method waits until the ring is mapped by the render
+    // thread and until the regions scheduled for copy are released. It never waits for
+    // regions that have not been scheduled, as there is no guarantee they will ever be released.
+    Uint64 Allocate(Uint64 Size, bool WaitForSpace)
+    {
+        Size = std::max(AlignUp(Size, Alignment), Alignment);
+
+        std::unique_lock<std::mutex> Lock{m_Mtx};
+        while (true)
+        {
+            if (m_pMappedData != nullptr)
+            {
+                const Uint64 Offset = TryAllocate(Size);
+                if (Offset != InvalidOffset || !WaitForSpace || m_ScheduledSize == 0)
+                    return Offset;
+            }
+            else if (!WaitForSpace)
+            {
+                return InvalidOffset;
+            }
+
+            m_SpaceReleasedCV.wait(Lock);
+        }
+    }
+
+    void MarkScheduled(Uint64 Offset)
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        Region& Reg = FindRegion(Offset);
+        VERIFY(!Reg.Scheduled, "This region has already been scheduled for copy");
+        Reg.Scheduled = true;
+        m_ScheduledSize += Reg.Size;
+    }
+
+    void Release(Uint64 Offset)
+    {
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+
+            Region& Reg = FindRegion(Offset);
+            if (Reg.Scheduled)
+            {
+                VERIFY_EXPR(m_ScheduledSize >= Reg.Size);
+                m_ScheduledSize -= Reg.Size;
+            }
+            Reg.Released = true;
+
+            while (!m_Regions.empty() && m_Regions.front().Released)
+            {
+                const Region& Tail = m_Regions.front();
+                VERIFY_EXPR(m_UsedSize >= Tail.Size + Tail.Padding);
+                m_UsedSize -= Tail.Size + Tail.Padding;
+                m_Regions.pop_front();
+            }
+            if (m_Regions.empty())
+            {
+                VERIFY(m_UsedSize == 0, "All regions have been released, but the used size is not zero");
+                m_Head = 0;
+            }
+        }
+        m_SpaceReleasedCV.notify_all();
+    }
+
+    // Makes the CPU writes to the given range visible to the GPU
+    void FlushRange(Uint64 Offset, Uint64 Size)
+    {
+        if ((m_pBuffer->GetMemoryProperties() & MEMORY_PROPERTY_HOST_COHERENT) == 0)
+            m_pBuffer->FlushMappedRange(Offset, Size);
+    }
+
+    Uint8* GetDataPtr(Uint64 Offset)
+    {
+        VERIFY(m_pMappedData != nullptr, "The staging ring is not mapped");
+        VERIFY_EXPR(Offset < m_Size);
+        return m_pMappedData + Offset;
+    }
+
+    IBuffer* GetBuffer() const
+    {
+        return m_pBuffer;
+    }
+
+    Uint64 GetSize() const
+    {
+        return m_Size;
+    }
+
+    Uint64 GetUsedSize()
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        return m_UsedSize;
+    }
+
+private:
+    struct Region
+    {
+        Uint64 Offset = 0;
+        Uint64 Size   = 0;
+        // Unused space at the end of the ring that is skipped when the
+        // next allocation wraps around.
+        Uint64 Padding   = 0;
+        bool   Scheduled = false;
+        bool   Released  = false;
+    };
+
+    Uint64 TryAllocate(Uint64 Size)
+    {
+        const Uint64 Capacity = m_Size;
+        if (Size > Capacity)
+            return InvalidOffset;
+
+        Uint64 Offset = InvalidOffset;
+        if (m_Regions.empty())
+        {
+            Offset = 0;
+        }
+        else
+        {
+            const Uint64 Tail = m_Regions.front().Offset;
+            if (m_Head > Tail)
+            {
+                // [Tail, Head) is used
+                if (m_Head + Size <= Capacity)
+                {
+                    Offset = m_Head;
+                }
+                else if (Size <= Tail)
+                {
+                    Offset = 0;
+                    // Skip the space at the end of the ring
+                    m_Regions.back().Padding = Capacity - m_Head;
+                    m_UsedSize += Capacity - m_Head;
+                }
+            }
+            else if (m_Head < Tail)
+            {
+                // [Head, Tail) is free
+                if (m_Head + Size <= Tail)
+                    Offset = m_Head;
+            }
+            // else Head == Tail and the ring is full
+        }
+
+        if (Offset != InvalidOffset)
+        {
+            Region Reg;
+            Reg.Offset = Offset;
+            Reg.Size   = Size;
+            m_Regions.push_back(Reg);
+            m_Head = Offset + Size;
+            m_UsedSize += Size;
+        }
+
+        return Offset;
+    }
+
+    Region& FindRegion(Uint64 Offset)
+    {
+        // Regions are typically released in allocation order, so the search is short
+        auto it = std::find_if(m_Regions.begin(), m_Regions.end(), [Offset](const Region& Reg) { return Reg.Offset == Offset && !Reg.Released; });
+        VERIFY(it != m_Regions.end(), "Region at offset ", Offset, " is not found in the staging ring");
+        return *it;
+    }
+
+    RefCntAutoPtr<IBuffer> m_pBuffer;
+    const Uint64           m_Size;
+
+    // The context that mapped the buffer. Only accessed by the render thread.
+    RefCntAutoPtr<IDeviceContext> m_pMapContext;
+
+    std::mutex              m_Mtx;
+    std::condition_variable m_SpaceReleasedCV;
+    std::deque<Region>      m_Regions;
+    Uint8*                  m_pMappedData   = nullptr;
+    Uint64                  m_Head          = 0;
+    Uint64                  m_UsedSize      = 0;
+    Uint64                  m_ScheduledSize = 0;
+};
+
+
+// Upload buffer whose data resides in the staging ring or, if the buffer
+// does not fit into the ring, in a dedicated system memory allocation.
+// The data is copied to the destination texture with IDeviceContext::UpdateTexture.
+// Ring regions are released once the fence signaled after the copy is completed,
+// while the dedicated memory is copied to the context's upload heap and is
+// released immediately.
+class RingUploadBuffer : public UploadBufferBase
+{
+public:
+    RingUploadBuffer(IReferenceCounters* pRefCounters, const UploadBufferDesc& Desc) :
+        // clang-format off
+        UploadBufferBase{pRefCounters, Desc},
+        m_SubresourceOffsets(size_t{Desc.MipLevels} * size_t{Desc.ArraySize} + 1),
+        m_SubresourceStrides(size_t{Desc.MipLevels} * size_t{Desc.ArraySize}    )
+    // clang-format on
+    {
+        const TextureDesc TexDesc = GetUploadTextureDesc(Desc);
+
+        Uint32 SubRes = 0;
+        for (Uint32 Slice = 0; Slice < Desc.ArraySize; ++Slice)
+        {
+            for (Uint32 Mip = 0; Mip < Desc.MipLevels; ++Mip)
+            {
+                const MipLevelProperties MipProps = GetMipLevelProperties(TexDesc, Mip);
+
+                const Uint64 RowStride       = AlignUp(MipProps.RowSize, StagingRing::RowAlignment);
+                m_SubresourceStrides[SubRes] = RowStride;
+
+                const Uint64 MipSize                     = AlignUp(MipProps.StorageHeight * RowStride, StagingRing::Alignment);
+                m_SubresourceOffsets[size_t{SubRes} + 1] = m_SubresourceOffsets[SubRes] + MipSize;
+                ++SubRes;
+            }
+        }
+    }
+
+    ~RingUploadBuffer()
+    {
+        ReleaseMemory();
+    }
+
+    void InitFromRing(std::shared_ptr<StagingRing> pRing, Uint64 Offset)
+    {
+        VERIFY_EXPR(!m_pRing && m_DedicatedData.empty());
+        m_pRing      = std::move(pRing);
+        m_RingOffset = Offset;
+        SetDataPtr(m_pRing->GetDataPtr(Offset));
+    }
+
+    void InitDedicated()
+    {
+        VERIFY_EXPR(!m_pRing && m_DedicatedData.empty());
+        m_DedicatedData.resize(StaticCast<size_t>(GetTotalSize()));
+        SetDataPtr(m_DedicatedData.data());
+    }
+
+    bool IsInRing() const
+    {
+        return m_pRing != nullptr;
+    }
+
+    // Returns the offset of the subresource data in the staging ring buffer
+    Uint64 GetRingOffset(Uint32 Mip, Uint32 Slice) const
+    {
+        VERIFY_EXPR(m_pRing);
+        return m_RingOffset + m_SubresourceOffsets[size_t{m_Desc.MipLevels} * size_t{Slice} + size_t{Mip}];
+    }
+
+    void FlushRing()
+    {
+        VERIFY_EXPR(m_pRing);
+        m_pRing->FlushRange(m_RingOffset, GetTotalSize());
+    }
+
+    void MarkScheduled()
+    {
+        if (m_pRing)
+            m_pRing->MarkScheduled(m_RingOffset);
+    }
+
+    // Releases the ring region or the dedicated memory. Must only be
+    // called after the GPU has finished reading the data.
+    void ReleaseMemory()
+    {
+        if (m_pRing)
+        {
+            m_pRing->Release(m_RingOffset);
+            m_pRing.reset();
+            m_RingOffset = StagingRing::InvalidOffset;
+        }
+        std::vector<Uint8>{}.swap(m_DedicatedData);
+        UploadBufferBase::Reset();
+    }
+
+    void SignalCopyScheduled()
+    {
+        m_CopyScheduledSignal.Trigger();
+    }
+
+    virtual void WaitForCopyScheduled() override final
+    {
+        m_CopyScheduledSignal.Wait();
+    }
+
+    bool DbgIsCopyScheduled() const
+    {
+        return m_CopyScheduledSignal.IsTriggered();
+    }
+
+    Uint64 GetTotalSize() const
+    {
+        return m_SubresourceOffsets.back();
+    }
+
+private:
+    void SetDataPtr(Uint8* pData)
+    {
+        for (Uint32 Slice = 0; Slice < m_Desc.ArraySize; ++Slice)
+        {
+            for (Uint32 Mip = 0; Mip < m_Desc.MipLevels; ++Mip)
+            {
+                const size_t SubRes = size_t{m_Desc.MipLevels} * size_t{Slice} + size_t{Mip};
+                SetMappedData(Mip, Slice, MappedTextureSubresource{pData + m_SubresourceOffsets[SubRes], m_SubresourceStrides[SubRes], 0});
+            }
+        }
+    }
+
+    std::vector<Uint64> m_SubresourceOffsets;
+    std::vector<Uint64> m_SubresourceStrides;
+
+    std::shared_ptr<StagingRing> m_pRing;
+    Uint64                       m_RingOffset = StagingRing::InvalidOffset;
+    std::vector<Uint8>           m_DedicatedData;
+
+    Threading::Signal m_CopyScheduledSignal;
+};
+
 } // namespace
 
 
@@ -144,12 +569,14 @@ struct TextureUploaderD3D12_Vk::InternalData
         enum Operation
         {
             Copy,
-            Map
+            Map,
+            RingCopy
         } operation;
-        RefCntAutoPtr<UploadTexture> pUploadTexture;
-        RefCntAutoPtr<ITexture>      pDstTexture;
-        Uint32                       DstSlice = 0;
-        Uint32                       DstMip   = 0;
+        RefCntAutoPtr<UploadTexture>    pUploadTexture;
+        RefCntAutoPtr<RingUploadBuffer> pRingBuffer;
+        RefCntAutoPtr<ITexture>         pDstTexture;
+        Uint32                          DstSlice = 0;
+        Uint32                          DstMip   = 0;
 
         // clang-format off
         PendingBufferOperation(Operation op, UploadTexture* pUploadTex) :
@@ -163,18 +590,61 @@ struct TextureUploaderD3D12_Vk::InternalData
             DstSlice       {dstSlice  },
             DstMip         {dstMip    }
         {}
+        PendingBufferOperation(Operation op, RingUploadBuffer* pRingBuff, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip) :
+            operation      {op        },
+            pRingBuffer    {pRingBuff },
+            pDstTexture    {pDstTex   },
+            DstSlice       {dstSlice  },
+            DstMip         {dstMip    }
+        {}
         // clang-format on
+
+        const UploadBufferDesc& GetUploadBufferDesc() const
+        {
+            return pUploadTexture ? pUploadTexture->GetDesc() : pRingBuffer->GetDesc();
+        }
     };
 
-    InternalData(IRenderDevice* pDevice)
+    InternalData(IRenderDevice* pDevice, const TextureUploaderDesc& Desc)
     {
         FenceDesc fenceDesc;
         fenceDesc.Name = "Texture uploader sync fence";
         pDevice->CreateFence(fenceDesc, &m_pFence);
+
+        if (Desc.StagingBufferSize != 0)
+        {
+            BufferDesc RingBuffDesc;
+            RingBuffDesc.Name           = "Texture uploader staging ring";
+            RingBuffDesc.Size           = Desc.StagingBufferSize;
+            RingBuffDesc.Usage          = USAGE_STAGING;
+            RingBuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+
+            RefCntAutoPtr<IBuffer> pRingBuffer;
+            pDevice->CreateBuffer(RingBuffDesc, nullptr, &pRingBuffer);
+            if (pRingBuffer)
+            {
+                m_pStagingRing = std::make_shared<StagingRing>(pRingBuffer);
+                LOG_INFO_MESSAGE("TextureUploaderD3D12_Vk: created ", Desc.StagingBufferSize, "-byte staging ring buffer");
+            }
+            else
+            {
+                LOG_ERROR_MESSAGE("TextureUploaderD3D12_Vk: failed to create ", Desc.StagingBufferSize, "-byte staging ring buffer. Staging textures will be used instead.");
+            }
+        }
     }
 
     ~InternalData()
     {
+        if (m_pStagingRing)
+        {
+            // Resources are released by the engine only after the GPU has finished using them,
+            // so the regions that are still in flight can be safely released now.
+            for (InFlightRingBuffer& InFlightBuff : m_InFlightRingBuffers)
+                InFlightBuff.pRingBuffer->ReleaseMemory();
+            m_InFlightRingBuffers.clear();
+            m_pStagingRing->Unmap();
+        }
+
         for (auto it : m_UploadTexturesCache)
         {
             if (it.second.size())
@@ -201,6 +671,12 @@ struct TextureUploaderD3D12_Vk::InternalData
         m_PendingOperations.emplace_back(PendingBufferOperation::Operation::Copy, pUploadBuffer, pDstTex, dstSlice, dstMip);
     }
 
+    void EnqueueRingCopy(RingUploadBuffer* pRingBuffer, ITexture* pDstTex, Uint32 dstSlice, Uint32 dstMip)
+    {
+        std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
+        m_PendingOperations.emplace_back(PendingBufferOperation::Operation::RingCopy, pRingBuffer, pDstTex, dstSlice, dstMip);
+    }
+
     void EnqueueMap(UploadTexture* pUploadBuffer)
     {
         std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
@@ -256,16 +732,106 @@ struct TextureUploaderD3D12_Vk::InternalData
     Uint32 GetNumPendingOperations()
     {
         std::lock_guard<std::mutex> QueueLock(m_PendingOperationsMtx);
-        return static_cast<Uint32>(m_PendingOperations.size());
+        return static_cast<Uint32>(m_PendingOperations.size()) + m_NumPostponedCopies.load();
+    }
+
+    StagingRing* GetStagingRing()
+    {
+        return m_pStagingRing.get();
+    }
+
+    // Maps the staging ring if it has not been mapped yet. Must be called by the render thread.
+    void MapStagingRing(IDeviceContext* pContext)
+    {
+        if (m_pStagingRing)
+            m_pStagingRing->Map(pContext);
+    }
+
+    // Associates the ring buffers copied since the last call with the fence value
+    // signaled after the copies. Must be called by the render thread.
+    void RetireCopiedRingBuffers(Uint64 FenceValue)
+    {
+        for (RefCntAutoPtr<RingUploadBuffer>& pRingBuffer : m_CopiedRingBuffers)
+            m_InFlightRingBuffers.push_back({FenceValue, std::move(pRingBuffer)});
+        m_CopiedRingBuffers.clear();
+    }
+
+    // Releases the ring regions that the GPU has finished reading. Must be called by
+    // the render thread after UpdatedCompletedFenceValue().
+    void ReleaseCompletedRingBuffers()
+    {
+        while (!m_InFlightRingBuffers.empty() && m_InFlightRingBuffers.front().FenceValue <= m_CompletedFenceValue)
+        {
+            m_InFlightRingBuffers.front().pRingBuffer->ReleaseMemory();
+            m_InFlightRingBuffers.pop_front();
+        }
+    }
+
+    bool HasCopiedRingBuffers() const
+    {
+        return !m_CopiedRingBuffers.empty();
+    }
+
+    RefCntAutoPtr<RingUploadBuffer> AllocateRingUploadBuffer(const UploadBufferDesc& Desc, bool WaitForSpace)
+    {
+        RefCntAutoPtr<RingUploadBuffer> pRingBuffer{MakeNewRCObj<RingUploadBuffer>()(Desc)};
+
+        const Uint64 Offset = m_pStagingRing->Allocate(pRingBuffer->GetTotalSize(), WaitForSpace);
+        if (Offset != StagingRing::InvalidOffset)
+            pRingBuffer->InitFromRing(m_pStagingRing, Offset);
+
+        return pRingBuffer;
     }
 
     void Execute(IDeviceContext* pContext, PendingBufferOperation& OperationInfo);
 
+    // Executes pending map operations and as many pending copy operations as
+    // the per-frame budget allows. Zero budget means no limit.
+    void ProcessPendingOperations(IDeviceContext* pContext, Uint64 MaxBytesPerFrame);
+
+    // Must be called by the render thread once per RenderThreadUpdate()
+    void EndFrame();
+
+    void GetStats(TextureUploaderStats& Stats)
+    {
+        std::lock_guard<std::mutex> StatsLock{m_StatsMtx};
+        Stats.BytesUploadedLastUpdate = m_Stats.BytesUploadedLastUpdate;
+        Stats.TotalBytesUploaded      = m_Stats.TotalBytesUploaded;
+        Stats.UploadBandwidth         = m_Stats.UploadBandwidth;
+    }
+
 private:
     std::mutex                          m_PendingOperationsMtx;
     std::vector<PendingBufferOperation> m_PendingOperations;
     std::vector<PendingBufferOperation> m_InWorkOperations;
 
+    // Copy operations postponed due to the per-frame budget. Only accessed by the render thread.
+    std::deque<PendingBufferOperation> m_PostponedCopies;
+    std::atomic<Uint32>                m_NumPostponedCopies{0};
+
+    std::shared_ptr<StagingRing> m_pStagingRing;
+
+    // Ring buffers whose copies have been recorded, but the fence has not been signaled yet.
+    // Only accessed by the render thread.
+    std::vector<RefCntAutoPtr<RingUploadBuffer>> m_CopiedRingBuffers;
+
+    struct InFlightRingBuffer
+    {
+        Uint64                          FenceValue = 0;
+        RefCntAutoPtr<RingUploadBuffer> pRingBuffer;
+    };
+    // Ring buffers that may still be read by the GPU. Only accessed by the render thread.
+    std::deque<InFlightRingBuffer> m_InFlightRingBuffers;
+
+    // The number of bytes copied since the last EndFrame(). Only accessed by the render thread.
+    Uint64 m_FrameBytes = 0;
+    // Bandwidth measurement window
+    Uint64 m_WindowBytes = 0;
+    Timer  m_WindowTimer;
+
+    std::mutex           m_StatsMtx;
+    TextureUploaderStats m_Stats;
+
     std::mutex                                                                     m_UploadTexturesCacheMtx;
     std::unordered_map<UploadBufferDesc, std::deque<RefCntAutoPtr<UploadTexture>>> m_UploadTexturesCache;
 
@@ -276,7 +842,7 @@ private:
 
 TextureUploaderD3D12_Vk::TextureUploaderD3D12_Vk(IReferenceCounters* pRefCounters, IRenderDevice* pDevice, const TextureUploaderDesc Desc) :
     TextureUploaderBase{pRefCounters, pDevice, Desc},
-    m_pInternalData{new InternalData(pDevice)}
+    m_pInternalData{new InternalData(pDevice, Desc)}
 {
 }
 
@@ -292,50 +858,91 @@ TextureUploaderD3D12_Vk::~TextureUploaderD3D12_Vk()
     }
 }
 
-void TextureUploaderD3D12_Vk::RenderThreadUpdate(IDeviceContext* pContext)
+void TextureUploaderD3D12_Vk::InternalData::ProcessPendingOperations(IDeviceContext* pContext, Uint64 MaxBytesPerFrame)
 {
-    auto& InWorkOperations = m_pInternalData->SwapMapQueues();
-    if (!InWorkOperations.empty())
+    auto& InWorkOperations = SwapMapQueues();
+    for (PendingBufferOperation& OperationInfo : InWorkOperations)
     {
-        Uint32 NumCopyOperations = 0;
-        for (InternalData::PendingBufferOperation& OperationInfo : InWorkOperations)
-        {
-            m_pInternalData->Execute(pContext, OperationInfo);
-            if (OperationInfo.operation == InternalData::PendingBufferOperation::Copy)
-                ++NumCopyOperations;
-        }
+        // Map operations are never postponed as worker threads are waiting for them
+        if (OperationInfo.operation == PendingBufferOperation::Map)
+            Execute(pContext, OperationInfo);
+        else
+            m_PostponedCopies.emplace_back(std::move(OperationInfo));
+    }
+    InWorkOperations.clear();
 
-        if (NumCopyOperations > 0)
-        {
-            // The buffer may be recycled immediately after the copy scheduled is signaled,
-            // so we must signal the fence first.
-            Uint64 SignaledFenceValue = m_pInternalData->SignalFence(pContext);
+    Uint32                                    NumCopyOperations = 0;
+    std::vector<RefCntAutoPtr<UploadTexture>> CopiedUploadTextures;
+    while (!m_PostponedCopies.empty())
+    {
+        PendingBufferOperation& OperationInfo = m_PostponedCopies.front();
+        // Always execute at least one copy to guarantee progress
+        if (MaxBytesPerFrame != 0 && NumCopyOperations > 0 &&
+            m_FrameBytes + GetUploadDataSize(OperationInfo.GetUploadBufferDesc()) > MaxBytesPerFrame)
+            break;
 
-            for (InternalData::PendingBufferOperation& OperationInfo : InWorkOperations)
-            {
-                if (OperationInfo.operation == InternalData::PendingBufferOperation::Copy)
-                    OperationInfo.pUploadTexture->SignalCopyScheduled(SignaledFenceValue);
-            }
-        }
+        Execute(pContext, OperationInfo);
+        if (OperationInfo.operation == PendingBufferOperation::Copy)
+            CopiedUploadTextures.emplace_back(std::move(OperationInfo.pUploadTexture));
+        m_PostponedCopies.pop_front();
+        ++NumCopyOperations;
+    }
+    m_NumPostponedCopies.store(static_cast<Uint32>(m_PostponedCopies.size()));
 
-        InWorkOperations.clear();
+    if (!CopiedUploadTextures.empty() || HasCopiedRingBuffers())
+    {
+        // The buffer may be recycled immediately after the copy scheduled is signaled,
+        // so we must signal the fence first.
+        Uint64 SignaledFenceValue = SignalFence(pContext);
+
+        for (RefCntAutoPtr<UploadTexture>& pUploadTexture : CopiedUploadTextures)
+            pUploadTexture->SignalCopyScheduled(SignaledFenceValue);
+        RetireCopiedRingBuffers(SignaledFenceValue);
+    }
+}
+
+void TextureUploaderD3D12_Vk::InternalData::EndFrame()
+{
+    static constexpr double BandwidthMeasurementInterval = 0.5;
+
+    m_WindowBytes += m_FrameBytes;
+    const double WindowTime = m_WindowTimer.GetElapsedTime();
+
+    std::lock_guard<std::mutex> StatsLock{m_StatsMtx};
+    m_Stats.BytesUploadedLastUpdate = m_FrameBytes;
+    m_Stats.TotalBytesUploaded += m_FrameBytes;
+    if (WindowTime >= BandwidthMeasurementInterval)
+    {
+        m_Stats.UploadBandwidth = static_cast<double>(m_WindowBytes) / WindowTime;
+        m_WindowBytes           = 0;
+        m_WindowTimer.Restart();
     }
+    m_FrameBytes = 0;
+}
+
+void TextureUploaderD3D12_Vk::RenderThreadUpdate(IDeviceContext* pContext)
+{
+    // Worker threads wait for the staging ring to be mapped
+    m_pInternalData->MapStagingRing(pContext);
+
+    m_pInternalData->ProcessPendingOperations(pContext, m_Desc.MaxBytesPerFrame);
+    m_pInternalData->EndFrame();
 
     // This must be called by the same thread that signals the fence
     m_pInternalData->UpdatedCompletedFenceValue();
+    m_pInternalData->ReleaseCompletedRingBuffers();
 }
 
 
 void TextureUploaderD3D12_Vk::InternalData::Execute(IDeviceContext*         pContext,
                                                     PendingBufferOperation& OperationInfo)
 {
-    RefCntAutoPtr<UploadTexture>& pUploadTex     = OperationInfo.pUploadTexture;
-    const UploadBufferDesc&       StagingTexDesc = pUploadTex->GetDesc();
-
     switch (OperationInfo.operation)
     {
         case InternalData::PendingBufferOperation::Map:
         {
+            RefCntAutoPtr<UploadTexture>& pUploadTex     = OperationInfo.pUploadTexture;
+            const UploadBufferDesc&       StagingTexDesc = pUploadTex->GetDesc();
             for (Uint32 Slice = 0; Slice < StagingTexDesc.ArraySize; ++Slice)
             {
                 for (Uint32 Mip = 0; Mip < StagingTexDesc.MipLevels; ++Mip)
@@ -349,6 +956,8 @@ void TextureUploaderD3D12_Vk::InternalData::Execute(IDeviceContext*         pCon
 
         case InternalData::PendingBufferOperation::Copy:
         {
+            RefCntAutoPtr<UploadTexture>& pUploadTex     = OperationInfo.pUploadTexture;
+            const UploadBufferDesc&       StagingTexDesc = pUploadTex->GetDesc();
             VERIFY(pUploadTex->DbgIsMapped(), "Upload texture must be copied only after it has been mapped");
             for (Uint32 Slice = 0; Slice < StagingTexDesc.ArraySize; ++Slice)
             {
@@ -370,6 +979,47 @@ void TextureUploaderD3D12_Vk::InternalData::Execute(IDeviceContext*         pCon
                     pContext->CopyTexture(CopyInfo);
                 }
             }
+            m_FrameBytes += GetUploadDataSize(StagingTexDesc);
+        }
+        break;
+
+        case InternalData::PendingBufferOperation::RingCopy:
+        {
+            RefCntAutoPtr<RingUploadBuffer>& pRingBuffer = OperationInfo.pRingBuffer;
+            const UploadBufferDesc&          BuffDesc    = pRingBuffer->GetDesc();
+            const TextureDesc                SrcTexDesc  = GetUploadTextureDesc(BuffDesc);
+            const bool                       IsInRing    = pRingBuffer->IsInRing();
+            if (IsInRing)
+                pRingBuffer->FlushRing();
+
+            for (Uint32 Slice = 0; Slice < BuffDesc.ArraySize; ++Slice)
+            {
+                for (Uint32 Mip = 0; Mip < BuffDesc.MipLevels; ++Mip)
+                {
+                    const MappedTextureSubresource SrcData = pRingBuffer->GetMappedData(Mip, Slice);
+                    // Ring data is copied directly from the staging buffer, while the dedicated
+                    // memory is copied through the context's upload heap.
+                    const TextureSubResData SubResData = IsInRing ?
+                        TextureSubResData{m_pStagingRing->GetBuffer(), pRingBuffer->GetRingOffset(Mip, Slice), SrcData.Stride} :
+                        TextureSubResData{SrcData.pData, SrcData.Stride};
+
+                    const MipLevelProperties MipProps = GetMipLevelProperties(SrcTexDesc, Mip);
+                    Box                      DstBox;
+                    DstBox.MaxX = MipProps.LogicalWidth;
+                    DstBox.MaxY = MipProps.LogicalHeight;
+                    pContext->UpdateTexture(OperationInfo.pDstTexture, OperationInfo.DstMip + Mip, OperationInfo.DstSlice + Slice, DstBox,
+                                            SubResData, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+                }
+            }
+            m_FrameBytes += GetUploadDataSize(BuffDesc);
+
+            // The ring region is released after the fence signaled after the copy is completed,
+            // while the dedicated memory has been copied to the upload heap and can be released right away.
+            if (IsInRing)
+                m_CopiedRingBuffers.emplace_back(pRingBuffer);
+            else
+                pRingBuffer->ReleaseMemory();
+            pRingBuffer->SignalCopyScheduled();
         }
         break;
     }
@@ -379,6 +1029,45 @@ void TextureUploaderD3D12_Vk::AllocateUploadBuffer(IDeviceContext*         pCont
                                                    const UploadBufferDesc& Desc,
                                                    IUploadBuffer**         ppBuffer)
 {
+    if (StagingRing* pRing = m_pInternalData->GetStagingRing())
+    {
+        RefCntAutoPtr<RingUploadBuffer> pRingBuffer;
+        if (StagingRing::IsFormatSupported(Desc.Format))
+        {
+            if (pContext != nullptr)
+                m_pInternalData->MapStagingRing(pContext);
+
+            // Worker threads wait for the space to be released by RenderThreadUpdate(),
+            // while the render thread executes the pending copies itself.
+            pRingBuffer = m_pInternalData->AllocateRingUploadBuffer(Desc, pContext == nullptr);
+            if (!pRingBuffer->IsInRing() && pContext != nullptr)
+            {
+                m_pInternalData->ProcessPendingOperations(pContext, 0);
+                m_pInternalData->UpdatedCompletedFenceValue();
+                m_pInternalData->ReleaseCompletedRingBuffers();
+                pRingBuffer = m_pInternalData->AllocateRingUploadBuffer(Desc, false);
+            }
+
+            if (!pRingBuffer->IsInRing())
+            {
+                LOG_INFO_MESSAGE("TextureUploaderD3D12_Vk: ", pRingBuffer->GetTotalSize(), " bytes required for ", Desc.Width, 'x', Desc.Height, ' ',
+                                 Desc.MipLevels, "-mip ", Desc.ArraySize, "-slice ", GetTextureFormatAttribs(Desc.Format).Name,
+                                 " upload buffer are not available in the ", pRing->GetSize(), "-byte staging ring. Allocating dedicated memory.");
+            }
+        }
+        else
+        {
+            // The texel size does not divide the copy alignment of the ring
+            pRingBuffer = MakeNewRCObj<RingUploadBuffer>()(Desc);
+        }
+
+        if (!pRingBuffer->IsInRing())
+            pRingBuffer->InitDedicated();
+
+        *ppBuffer = pRingBuffer.Detach();
+        return;
+    }
+
     RefCntAutoPtr<UploadTexture> pUploadTexture = m_pInternalData->FindCachedUploadTexture(Desc);
 
     // No available buffer found in the cache
@@ -425,6 +1114,39 @@ void TextureUploaderD3D12_Vk::ScheduleGPUCopy(IDeviceContext* pContext,
                                               Uint32          MipLevel,
                                               IUploadBuffer*  pUploadBuffer)
 {
+    if (m_pInternalData->GetStagingRing() != nullptr)
+    {
+        RingUploadBuffer* pRingBuffer = ClassPtrCast<RingUploadBuffer>(pUploadBuffer);
+        if (pContext != nullptr)
+        {
+            // Render thread
+            InternalData::PendingBufferOperation CopyOp //
+                {
+                    InternalData::PendingBufferOperation::Operation::RingCopy,
+                    pRingBuffer,
+                    pDstTexture,
+                    ArraySlice,
+                    MipLevel //
+                };
+            m_pInternalData->Execute(pContext, CopyOp);
+
+            if (m_pInternalData->HasCopiedRingBuffers())
+            {
+                m_pInternalData->RetireCopiedRingBuffers(m_pInternalData->SignalFence(pContext));
+                // This must be called by the same thread that signals the fence
+                m_pInternalData->UpdatedCompletedFenceValue();
+                m_pInternalData->ReleaseCompletedRingBuffers();
+            }
+        }
+        else
+        {
+            // Worker thread
+            pRingBuffer->MarkScheduled();
+            m_pInternalData->EnqueueRingCopy(pRingBuffer, pDstTexture, ArraySlice, MipLevel);
+        }
+        return;
+    }
+
     UploadTexture* pUploadTexture = ClassPtrCast<UploadTexture>(pUploadBuffer);
     if (pContext != nullptr)
     {
@@ -455,6 +1177,14 @@ void TextureUploaderD3D12_Vk::ScheduleGPUCopy(IDeviceContext* pContext,
 
 void TextureUploaderD3D12_Vk::RecycleBuffer(IUploadBuffer* pUploadBuffer)
 {
+    if (m_pInternalData->GetStagingRing() != nullptr)
+    {
+        // Ring upload buffers release their memory once the GPU has finished the copy
+        // and are never reused.
+        VERIFY(ClassPtrCast<RingUploadBuffer>(pUploadBuffer)->DbgIsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
+        return;
+    }
+
     UploadTexture* pUploadTexture = ClassPtrCast<UploadTexture>(pUploadBuffer);
     VERIFY(pUploadTexture->DbgIsCopyScheduled(), "Upload buffer must be recycled only after copy operation has been scheduled on the GPU");
 
@@ -465,6 +1195,12 @@ TextureUploaderStats TextureUploaderD3D12_Vk::GetStats()
 {
     TextureUploaderStats Stats;
     Stats.NumPendingOperations = static_cast<Uint32>(m_pInternalData->GetNumPendingOperations());
+    m_pInternalData->GetStats(Stats);
+    if (StagingRing* pRing = m_pInternalData->GetStagingRing())
+    {
+        Stats.StagingBufferSize      = pRing->GetSize();
+        Stats.StagingBufferBytesUsed = pRing->GetUsedSize();
+    }
     return Stats;
 }
 
@@ -0,0 +1,119 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "BasicTypes.h"
+
+namespace Diligent
+{
+
+/// Removes macros and functions that are not referenced by the shader from GLSL definitions.
+
+/// The definitions are parsed once when the object is created into a list of top-level
+/// items (macros, functions, structs, preprocessor conditionals and other declarations), and
+/// the identifiers referenced by every item are recorded. Pruning then starts from the
+/// identifiers used by the shader source, follows the references to collect all required
+/// items and emits them in the original order, preserving the enclosing preprocessor
+/// conditionals. Other declarations (e.g. gl_PerVertex redeclarations or structs that also
+/// declare variables) as well as directives other than #define are always kept.
+/// Comments are removed.
+///
+/// \note   Macros and functions are tracked by name only, so all overloads of a referenced
+///         function are kept. Identifiers constructed by token pasting in the shader source
+///         are not detected.
+class GLSLDefinitionsPruner
+{
+public:
+    explicit GLSLDefinitionsPruner(const char* Definitions);
+
+    // clang-format off
+    GLSLDefinitionsPruner           (const GLSLDefinitionsPruner&)  = delete;
+    GLSLDefinitionsPruner           (      GLSLDefinitionsPruner&&) = delete;
+    GLSLDefinitionsPruner& operator=(const GLSLDefinitionsPruner&)  = delete;
+    GLSLDefinitionsPruner& operator=(      GLSLDefinitionsPruner&&) = delete;
+    // clang-format on
+
+    /// Returns the definitions required by the given sources.
+
+    /// \param [in] Sources    - Sources that will be compiled together with the definitions.
+    ///                          Null pointers are ignored.
+    /// \param [in] NumSources - The number of elements in Sources array.
+    /// \return     The pruned definitions.
+    ///
+    /// \remarks    The method is thread-safe.
+    std::string Prune(const char* const* Sources, size_t NumSources) const;
+
+    /// Returns the total number of macros, functions and structs in the definitions.
+    size_t GetNumPrunableItems() const { return m_NumPrunableItems; }
+
+private:
+    struct Item
+    {
+        enum class ItemType : Uint8
+        {
+            // #if, #ifdef, #ifndef
+            BeginConditional,
+            // #elif, #else
+            ElseConditional,
+            // #endif
+            EndConditional,
+            // Macro, function or struct that is only kept when referenced
+            Prunable,
+            // Any other directive or declaration
+            Required
+        };
+
+        ItemType Type = ItemType::Required;
+
+        // Item text, including the trailing new line
+        std::string Text;
+
+        // Indices of the names referenced by the item
+        std::vector<Uint32> Refs;
+    };
+
+    void ParseDefinitions(const std::string& Definitions);
+
+    Uint32 GetNameIndex(const std::string& Name);
+
+    std::vector<Item> m_Items;
+
+    // Name -> name index
+    std::unordered_map<std::string, Uint32> m_NameIndices;
+    // Name index -> indices of the prunable items that define the name
+    std::vector<std::vector<size_t>> m_NameDefinitions;
+    // Names referenced by required items and conditional directives
+    std::vector<Uint32> m_RequiredRefs;
+
+    size_t m_NumPrunableItems = 0;
+};
+
+} // namespace Diligent
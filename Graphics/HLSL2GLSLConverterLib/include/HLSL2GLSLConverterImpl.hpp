@@ -36,9 +36,12 @@
 #include "HLSL2GLSLConverter.h"
 #include "ObjectBase.hpp"
 #include "Shader.h"
+#include "ThreadPool.h"
 #include "HashUtils.hpp"
 #include "Constants.h"
 #include "HLSLTokenizer.hpp"
+#include "GLSLDefinitionsPruner.hpp"
+#include "HLSL2GLSLConversionCache.hpp"
 
 namespace Diligent
 {
@@ -122,6 +125,17 @@ public:
         /// Whether to include GLSL definitions supporting HLSL->GLSL conversion.
         bool                                IncludeDefinitions         = false;
 
+        /// Whether to only include the GLSL definitions (macros and helper functions) that are
+        /// referenced by the converted source or by PrecedingSource. Ignored if IncludeDefinitions is false.
+        ///
+        /// \note  Definitions referenced by code that follows the converted source are not detected.
+        bool                                PruneUnusedDefinitions     = false;
+
+        /// Optional source code that will precede the converted source in the final shader
+        /// (e.g. shader macros). Definitions referenced by this code are kept when unused
+        /// definitions are pruned.
+        const Char*                         PrecedingSource            = nullptr;
+
         /// Input file name. If HLSLSource is not null, this name will only be used for
         /// information purposes. If HLSLSource is null, the name will be used to load
         /// shader source from the input stream factory.
@@ -147,6 +161,28 @@ public:
     /// \return     Converted GLSL source code.
     String Convert(ConversionAttribs& Attribs) const;
 
+    /// Converts multiple HLSL shaders to GLSL in parallel
+
+    /// \param [in]  pJobs       - Array of NumJobs conversion attributes. ppConversionStream member
+    ///                            of every element must be null.
+    /// \param [in]  NumJobs     - The number of elements in pJobs and pResults arrays.
+    /// \param [in]  pThreadPool - Optional thread pool to use. If null, all jobs are processed
+    ///                            by the calling thread.
+    /// \param [in]  pCache      - Optional conversion cache. Converted sources are looked up in and
+    ///                            added to the cache using the hash of the expanded source and
+    ///                            all conversion attributes that affect the output.
+    /// \param [out] pResults    - Array of NumJobs strings that receive the converted GLSL sources.
+    ///                            If a job fails, the corresponding string is empty.
+    ///
+    /// \remarks Jobs that use the same source (same HLSLSource pointer and NumSymbols, or the same
+    ///          InputFileName if HLSLSource is null, and the same source stream factory) load, expand
+    ///          and tokenize it only once. Source stream factories must be thread-safe.
+    void ConvertBatch(const ConversionAttribs*  pJobs,
+                      size_t                    NumJobs,
+                      IThreadPool*              pThreadPool,
+                      HLSL2GLSLConversionCache* pCache,
+                      String*                   pResults) const;
+
     /// Creates a conversion stream
 
     /// \param [in] InputFileName - Input file name. If HLSLSource is null, this name will be
@@ -250,9 +286,28 @@ private:
                          size_t                           NumSymbols,
                          bool                             bPreserveTokens);
 
+        /// Creates a conversion stream from the tokenized source code.
+
+        /// \param [in] pRefCounters  - Pointer to a reference counters object
+        /// \param [in] Converter     - Reference to HLSL2GLSLConverterImpl class instance
+        /// \param [in] InputFileName - Input file name. Only used for information purposes.
+        /// \param [in] Tokens        - Tokens produced from the source code by Converter's HLSL tokenizer.
+        ConversionStream(IReferenceCounters*           pRefCounters,
+                         const HLSL2GLSLConverterImpl& Converter,
+                         const char*                   InputFileName,
+                         TokenListType&&               Tokens);
+
+        /// Loads the shader source code and inserts the contents of all included files.
+        static String LoadSource(const char*                      InputFileName,
+                                 IShaderSourceInputStreamFactory* pInputStreamFactory,
+                                 const Char*                      HLSLSource,
+                                 size_t                           NumSymbols);
+
         String Convert(const Char* EntryPoint,
                        SHADER_TYPE ShaderType,
                        bool        IncludeDefintions,
+                       bool        PruneUnusedDefinitions,
+                       const Char* PrecedingSource,
                        const char* SamplerSuffix,
                        bool        UseInOutLocationQualifiers,
                        bool        UseRowMajorMatrices);
@@ -270,7 +325,7 @@ private:
         const String& GetInputFileName() const { return m_InputFileName; }
 
     private:
-        void InsertIncludes(String& GLSLSource, IShaderSourceInputStreamFactory* pSourceStreamFactory);
+        static void InsertIncludes(String& GLSLSource, IShaderSourceInputStreamFactory* pSourceStreamFactory);
 
         using SamplerHashType = std::unordered_map<String, bool>;
 
@@ -489,6 +544,9 @@ private:
 
     Parsing::HLSLTokenizer m_HLSLTokenizer;
 
+    // GLSL definitions parsed once for all conversions
+    const GLSLDefinitionsPruner m_DefinitionsPruner;
+
     // Set of all GLSL image types (image1D, uimage1D, iimage1D, image2D, ... )
     std::unordered_set<HashMapStringKey> m_ImageTypes;
 
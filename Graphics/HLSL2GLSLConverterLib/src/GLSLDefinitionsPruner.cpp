@@ -0,0 +1,398 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GLSLDefinitionsPruner.hpp"
+
+#include <cstring>
+#include <algorithm>
+
+#include "DebugUtilities.hpp"
+#include "ParsingTools.hpp"
+
+namespace Diligent
+{
+
+namespace
+{
+
+// Calls Handler for every identifier in [Start, End), skipping comments and numeric literals.
+template <typename HandlerType>
+void ForEachIdentifier(const char* Start, const char* End, HandlerType&& Handler)
+{
+    const char* Pos = Start;
+    while (Pos < End && *Pos != '\0')
+    {
+        const char c = *Pos;
+        if (c == '/' && Pos + 1 < End && Pos[1] == '/')
+        {
+            Pos = Parsing::SkipLine(Pos, End);
+        }
+        else if (c == '/' && Pos + 1 < End && Pos[1] == '*')
+        {
+            const char* CommentEnd = Pos + 2;
+            while (CommentEnd < End && *CommentEnd != '\0' && !(CommentEnd[0] == '*' && CommentEnd + 1 < End && CommentEnd[1] == '/'))
+                ++CommentEnd;
+            Pos = CommentEnd < End && *CommentEnd != '\0' ? CommentEnd + 2 : CommentEnd;
+        }
+        else if (IsNum(c))
+        {
+            // Skip numeric literals including suffixes (e.g. 0x0ffffu, 1.0f)
+            while (Pos < End && (isalnum(*Pos) || *Pos == '_' || *Pos == '.'))
+                ++Pos;
+        }
+        else if (isalpha(c) || c == '_')
+        {
+            const char* IdEnd = Parsing::SkipIdentifier(Pos, End);
+            Handler(Pos, IdEnd);
+            Pos = IdEnd;
+        }
+        else
+        {
+            ++Pos;
+        }
+    }
+}
+
+// Removes comments, replacing multi-line comments with a single space.
+std::string StripComments(const char* Source)
+{
+    const char* const End = Source + strlen(Source);
+
+    std::string Stripped;
+    Stripped.reserve(End - Source);
+    for (const char* Pos = Source; Pos < End;)
+    {
+        if (Pos[0] == '/' && Pos + 1 < End && (Pos[1] == '/' || Pos[1] == '*'))
+        {
+            const bool IsSingleLine = Pos[1] == '/';
+            // Single-line comments are skipped up to, but not including, the new line
+            Pos = IsSingleLine ?
+                Parsing::SkipLine(Pos, End) :
+                Parsing::SkipComment(Pos, End, Parsing::SKIP_COMMENT_FLAG_MULTILINE);
+            if (!IsSingleLine)
+                Stripped.push_back(' ');
+        }
+        else
+        {
+            Stripped.push_back(*Pos++);
+        }
+    }
+    return Stripped;
+}
+
+bool IsBlankLine(const char* Start, const char* End)
+{
+    for (const char* Pos = Start; Pos < End; ++Pos)
+    {
+        if (!Parsing::IsWhitespace(*Pos))
+            return false;
+    }
+    return true;
+}
+
+// Returns the last non-whitespace character of the line or 0 if the line is blank
+char GetLastSymbol(const char* Start, const char* End)
+{
+    for (const char* Pos = End; Pos > Start; --Pos)
+    {
+        if (!Parsing::IsWhitespace(Pos[-1]))
+            return Pos[-1];
+    }
+    return 0;
+}
+
+} // namespace
+
+GLSLDefinitionsPruner::GLSLDefinitionsPruner(const char* Definitions)
+{
+    VERIFY_EXPR(Definitions != nullptr);
+    ParseDefinitions(StripComments(Definitions));
+}
+
+Uint32 GLSLDefinitionsPruner::GetNameIndex(const std::string& Name)
+{
+    auto it = m_NameIndices.emplace(Name, static_cast<Uint32>(m_NameDefinitions.size()));
+    if (it.second)
+        m_NameDefinitions.emplace_back();
+    return it.first->second;
+}
+
+void GLSLDefinitionsPruner::ParseDefinitions(const std::string& Definitions)
+{
+    const char* const End = Definitions.data() + Definitions.size();
+
+    auto AddItem = [&](Item::ItemType Type, const char* TextStart, const char* TextEnd, const char* RefsStart, const std::string& Name) {
+        Item NewItem;
+        NewItem.Type = Type;
+        NewItem.Text.assign(TextStart, TextEnd);
+        NewItem.Text.push_back('\n');
+        ForEachIdentifier(RefsStart, TextEnd, [&](const char* IdStart, const char* IdEnd) {
+            const Uint32 NameIdx = GetNameIndex(std::string{IdStart, IdEnd});
+            if (std::find(NewItem.Refs.begin(), NewItem.Refs.end(), NameIdx) == NewItem.Refs.end())
+                NewItem.Refs.push_back(NameIdx);
+        });
+
+        if (Type == Item::ItemType::Prunable)
+        {
+            VERIFY_EXPR(!Name.empty());
+            m_NameDefinitions[GetNameIndex(Name)].push_back(m_Items.size());
+            ++m_NumPrunableItems;
+        }
+        else
+        {
+            m_RequiredRefs.insert(m_RequiredRefs.end(), NewItem.Refs.begin(), NewItem.Refs.end());
+        }
+        m_Items.emplace_back(std::move(NewItem));
+    };
+
+    const char* DeclStart = nullptr;
+    int         Depth     = 0;
+    for (const char* LineStart = Definitions.data(); LineStart < End;)
+    {
+        const char* LineEnd  = Parsing::SkipLine(LineStart, End);
+        const char* NextLine = Parsing::SkipLine(LineStart, End, true);
+
+        if (DeclStart == nullptr)
+        {
+            if (IsBlankLine(LineStart, LineEnd))
+            {
+                LineStart = NextLine;
+                continue;
+            }
+
+            const char* Pos = Parsing::SkipDelimiters(LineStart, LineEnd, " \t");
+            if (*Pos == '#')
+            {
+                // Preprocessor directive, possibly continued on the following lines
+                while (GetLastSymbol(LineStart, LineEnd) == '\\' && NextLine < End)
+                {
+                    LineEnd  = Parsing::SkipLine(NextLine, End);
+                    NextLine = Parsing::SkipLine(NextLine, End, true);
+                }
+
+                const char* NameStart = Parsing::SkipDelimiters(Pos + 1, LineEnd, " \t");
+                const char* NameEnd   = Parsing::SkipIdentifier(NameStart, LineEnd);
+                const std::string Directive{NameStart, NameEnd};
+                if (Directive == "define")
+                {
+                    const char* MacroStart = Parsing::SkipDelimiters(NameEnd, LineEnd, " \t");
+                    const char* MacroEnd   = Parsing::SkipIdentifier(MacroStart, LineEnd);
+                    AddItem(Item::ItemType::Prunable, LineStart, LineEnd, MacroEnd, std::string{MacroStart, MacroEnd});
+                }
+                else if (Directive == "if" || Directive == "ifdef" || Directive == "ifndef")
+                {
+                    AddItem(Item::ItemType::BeginConditional, LineStart, LineEnd, NameEnd, {});
+                }
+                else if (Directive == "elif" || Directive == "else")
+                {
+                    AddItem(Item::ItemType::ElseConditional, LineStart, LineEnd, NameEnd, {});
+                }
+                else if (Directive == "endif")
+                {
+                    AddItem(Item::ItemType::EndConditional, LineStart, LineEnd, NameEnd, {});
+                }
+                else
+                {
+                    AddItem(Item::ItemType::Required, LineStart, LineEnd, NameEnd, {});
+                }
+
+                LineStart = NextLine;
+                continue;
+            }
+
+            DeclStart = LineStart;
+        }
+
+        // Declaration that may span multiple lines. Directives inside the declaration
+        // (e.g. in a function body) are considered part of it.
+        for (const char* Pos = LineStart; Pos < LineEnd; ++Pos)
+        {
+            if (*Pos == '{' || *Pos == '(' || *Pos == '[')
+                ++Depth;
+            else if (*Pos == '}' || *Pos == ')' || *Pos == ']')
+                --Depth;
+        }
+        VERIFY(Depth >= 0, "Unbalanced brackets in GLSL definitions");
+
+        const char LastSymbol = GetLastSymbol(LineStart, LineEnd);
+        if (Depth <= 0 && (LastSymbol == '}' || LastSymbol == ';'))
+        {
+            // Function definitions and prototypes are prunable and are identified by
+            // the name that precedes the first opening parenthesis.
+            // Struct definitions that do not declare variables ('struct Name { ... };')
+            // are prunable and are identified by the struct name.
+            std::string Name;
+            std::string StructName;
+            bool        IsPrunable = false;
+            for (const char* Pos = DeclStart; Pos < LineEnd;)
+            {
+                if (*Pos == '(')
+                {
+                    IsPrunable = !Name.empty();
+                    break;
+                }
+                else if (*Pos == '{')
+                {
+                    // The declaration must end with '};', otherwise it also declares variables
+                    const char* LastSymbolPos = LineEnd;
+                    while (LastSymbolPos > Pos && Parsing::IsWhitespace(LastSymbolPos[-1]))
+                        --LastSymbolPos;
+                    IsPrunable = (!StructName.empty() && Name == StructName &&
+                                  LastSymbol == ';' && GetLastSymbol(Pos, LastSymbolPos - 1) == '}');
+                    break;
+                }
+                else if (*Pos == ';' || *Pos == '=')
+                {
+                    break;
+                }
+                else if (isalpha(*Pos) || *Pos == '_')
+                {
+                    const char* IdEnd = Parsing::SkipIdentifier(Pos, LineEnd);
+                    if (Name == "struct" && StructName.empty())
+                        StructName.assign(Pos, IdEnd);
+                    Name.assign(Pos, IdEnd);
+                    Pos = IdEnd;
+                }
+                else
+                {
+                    ++Pos;
+                }
+            }
+
+            if (IsPrunable)
+                AddItem(Item::ItemType::Prunable, DeclStart, LineEnd, DeclStart, Name);
+            else
+                AddItem(Item::ItemType::Required, DeclStart, LineEnd, DeclStart, {});
+
+            DeclStart = nullptr;
+            Depth     = 0;
+        }
+
+        LineStart = NextLine;
+    }
+    VERIFY(DeclStart == nullptr, "Unterminated declaration at the end of GLSL definitions");
+}
+
+std::string GLSLDefinitionsPruner::Prune(const char* const* Sources, size_t NumSources) const
+{
+    std::vector<bool>   KeepItem(m_Items.size(), false);
+    std::vector<bool>   NameVisited(m_NameDefinitions.size(), false);
+    std::vector<Uint32> PendingNames{m_RequiredRefs};
+
+    std::string Name;
+    for (size_t i = 0; i < NumSources; ++i)
+    {
+        const char* Source = Sources[i];
+        if (Source == nullptr)
+            continue;
+
+        ForEachIdentifier(Source, Source + strlen(Source), [&](const char* IdStart, const char* IdEnd) {
+            Name.assign(IdStart, IdEnd);
+            auto it = m_NameIndices.find(Name);
+            if (it != m_NameIndices.end() && !NameVisited[it->second])
+                PendingNames.push_back(it->second);
+        });
+    }
+
+    while (!PendingNames.empty())
+    {
+        const Uint32 NameIdx = PendingNames.back();
+        PendingNames.pop_back();
+        if (NameVisited[NameIdx])
+            continue;
+        NameVisited[NameIdx] = true;
+
+        for (size_t ItemIdx : m_NameDefinitions[NameIdx])
+        {
+            if (KeepItem[ItemIdx])
+                continue;
+            KeepItem[ItemIdx] = true;
+            for (Uint32 RefIdx : m_Items[ItemIdx].Refs)
+            {
+                if (!NameVisited[RefIdx])
+                    PendingNames.push_back(RefIdx);
+            }
+        }
+    }
+
+    // Conditional blocks are only emitted if they contain at least one item.
+    // Directives of a block are accumulated until the first item is emitted.
+    struct ConditionalBlock
+    {
+        std::string PendingText;
+        bool        Emitted = false;
+    };
+    std::vector<ConditionalBlock> Blocks;
+
+    std::string Pruned;
+    for (size_t ItemIdx = 0; ItemIdx < m_Items.size(); ++ItemIdx)
+    {
+        const Item& CurrItem = m_Items[ItemIdx];
+        switch (CurrItem.Type)
+        {
+            case Item::ItemType::BeginConditional:
+                Blocks.emplace_back();
+                Blocks.back().PendingText = CurrItem.Text;
+                break;
+
+            case Item::ItemType::ElseConditional:
+            case Item::ItemType::EndConditional:
+                VERIFY(!Blocks.empty(), "Unmatched ", CurrItem.Text);
+                if (Blocks.empty())
+                    break;
+                if (Blocks.back().Emitted)
+                    Pruned.append(CurrItem.Text);
+                else
+                    Blocks.back().PendingText.append(CurrItem.Text);
+                if (CurrItem.Type == Item::ItemType::EndConditional)
+                    Blocks.pop_back();
+                break;
+
+            case Item::ItemType::Prunable:
+            case Item::ItemType::Required:
+                if (CurrItem.Type == Item::ItemType::Prunable && !KeepItem[ItemIdx])
+                    break;
+                for (ConditionalBlock& Block : Blocks)
+                {
+                    if (!Block.Emitted)
+                    {
+                        Pruned.append(Block.PendingText);
+                        Block.Emitted = true;
+                    }
+                }
+                Pruned.append(CurrItem.Text);
+                break;
+
+            default:
+                UNEXPECTED("Unexpected item type");
+        }
+    }
+    VERIFY(Blocks.empty(), "Unterminated conditional block in GLSL definitions");
+
+    return Pruned;
+}
+
+} // namespace Diligent
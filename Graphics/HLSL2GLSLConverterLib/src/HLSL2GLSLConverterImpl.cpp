@@ -371,6 +371,11 @@
 #include "pch.h"
 #include <unordered_set>
 #include <string>
+#include <map>
+#include <tuple>
+#include <mutex>
+#include <atomic>
+#include <memory>
 
 #include "HLSL2GLSLConverterImpl.hpp"
 #include "GraphicsAccessories.hpp"
@@ -380,6 +385,8 @@
 #include "ParsingTools.hpp"
 #include "EngineMemory.h"
 #include "GLSLParsingTools.hpp"
+#include "ThreadPool.hpp"
+#include "xxhash.h"
 
 using namespace std;
 
@@ -400,7 +407,8 @@ const HLSL2GLSLConverterImpl& HLSL2GLSLConverterImpl::GetInstance()
     return Converter;
 }
 
-HLSL2GLSLConverterImpl::HLSL2GLSLConverterImpl()
+HLSL2GLSLConverterImpl::HLSL2GLSLConverterImpl() :
+    m_DefinitionsPruner{g_GLSLDefinitions}
 {
     // Prepare texture function stubs
     //                          sampler  usampler  isampler sampler*Shadow
@@ -4418,19 +4426,10 @@ String HLSL2GLSLConverterImpl::ConversionStream::BuildGLSLSource()
     return Output;
 }
 
-HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*              pRefCounters,
-                                                           const HLSL2GLSLConverterImpl&    Converter,
-                                                           const char*                      InputFileName,
-                                                           IShaderSourceInputStreamFactory* pInputStreamFactory,
-                                                           const Char*                      HLSLSource,
-                                                           size_t                           NumSymbols,
-                                                           bool                             bPreserveTokens) :
-    // clang-format off
-    TBase            {pRefCounters   },
-    m_bPreserveTokens{bPreserveTokens},
-    m_Converter      {Converter      },
-    m_InputFileName  {InputFileName != nullptr ? InputFileName : "<Unknown>"}
-// clang-format on
+String HLSL2GLSLConverterImpl::ConversionStream::LoadSource(const char*                      InputFileName,
+                                                            IShaderSourceInputStreamFactory* pInputStreamFactory,
+                                                            const Char*                      HLSLSource,
+                                                            size_t                           NumSymbols)
 {
     RefCntAutoPtr<IDataBlob> pFileData;
     if (HLSLSource == nullptr)
@@ -4456,9 +4455,42 @@ HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*
 
     InsertIncludes(Source, pInputStreamFactory);
 
+    return Source;
+}
+
+HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*              pRefCounters,
+                                                           const HLSL2GLSLConverterImpl&    Converter,
+                                                           const char*                      InputFileName,
+                                                           IShaderSourceInputStreamFactory* pInputStreamFactory,
+                                                           const Char*                      HLSLSource,
+                                                           size_t                           NumSymbols,
+                                                           bool                             bPreserveTokens) :
+    // clang-format off
+    TBase            {pRefCounters   },
+    m_bPreserveTokens{bPreserveTokens},
+    m_Converter      {Converter      },
+    m_InputFileName  {InputFileName != nullptr ? InputFileName : "<Unknown>"}
+// clang-format on
+{
+    const String Source = LoadSource(InputFileName, pInputStreamFactory, HLSLSource, NumSymbols);
+
     m_Tokens = m_Converter.m_HLSLTokenizer.Tokenize(Source);
 }
 
+HLSL2GLSLConverterImpl::ConversionStream::ConversionStream(IReferenceCounters*           pRefCounters,
+                                                           const HLSL2GLSLConverterImpl& Converter,
+                                                           const char*                   InputFileName,
+                                                           TokenListType&&               Tokens) :
+    // clang-format off
+    TBase            {pRefCounters     },
+    m_Tokens         {std::move(Tokens)},
+    m_bPreserveTokens{false            },
+    m_Converter      {Converter        },
+    m_InputFileName  {InputFileName != nullptr ? InputFileName : "<Unknown>"}
+// clang-format on
+{
+}
+
 
 String HLSL2GLSLConverterImpl::Convert(ConversionAttribs& Attribs) const
 {
@@ -4468,6 +4500,7 @@ String HLSL2GLSLConverterImpl::Convert(ConversionAttribs& Attribs) const
         {
             ConversionStream Stream(nullptr, *this, Attribs.InputFileName, Attribs.pSourceStreamFactory, Attribs.HLSLSource, Attribs.NumSymbols, false);
             return Stream.Convert(Attribs.EntryPoint, Attribs.ShaderType, Attribs.IncludeDefinitions,
+                                  Attribs.PruneUnusedDefinitions, Attribs.PrecedingSource,
                                   Attribs.SamplerSuffix, Attribs.UseInOutLocationQualifiers,
                                   Attribs.UseRowMajorMatrices);
         }
@@ -4499,6 +4532,7 @@ String HLSL2GLSLConverterImpl::Convert(ConversionAttribs& Attribs) const
         }
 
         return pStream->Convert(Attribs.EntryPoint, Attribs.ShaderType, Attribs.IncludeDefinitions,
+                                Attribs.PruneUnusedDefinitions, Attribs.PrecedingSource,
                                 Attribs.SamplerSuffix, Attribs.UseInOutLocationQualifiers,
                                 Attribs.UseRowMajorMatrices);
     }
@@ -4521,6 +4555,221 @@ void HLSL2GLSLConverterImpl::CreateStream(const Char*                      Input
     }
 }
 
+namespace
+{
+
+// Increment this version whenever the converter changes in a way that
+// affects the output so that stale cache entries are not reused.
+constexpr Uint32 ConverterVersion = 1;
+
+class CacheKeyHasher
+{
+public:
+    CacheKeyHasher() :
+        m_State{XXH3_createState()}
+    {
+        XXH3_128bits_reset(m_State);
+    }
+
+    ~CacheKeyHasher()
+    {
+        XXH3_freeState(m_State);
+    }
+
+    // clang-format off
+    CacheKeyHasher           (const CacheKeyHasher&) = delete;
+    CacheKeyHasher& operator=(const CacheKeyHasher&) = delete;
+    // clang-format on
+
+    template <typename T>
+    void Update(const T& Val)
+    {
+        static_assert(std::is_fundamental<T>::value || std::is_enum<T>::value, "Only fundamental and enum types are allowed");
+        XXH3_128bits_update(m_State, &Val, sizeof(Val));
+    }
+
+    void Update(const HLSL2GLSLConversionCache::Key& Key)
+    {
+        Update(Key.Low);
+        Update(Key.High);
+    }
+
+    void UpdateStr(const char* Str)
+    {
+        // Hash the length to distinguish null, empty and concatenated strings
+        const Uint64 Len = Str != nullptr ? strlen(Str) : ~Uint64{0};
+        Update(Len);
+        if (Str != nullptr)
+            XXH3_128bits_update(m_State, Str, static_cast<size_t>(Len));
+    }
+
+    HLSL2GLSLConversionCache::Key Digest() const
+    {
+        return ToCacheKey(XXH3_128bits_digest(m_State));
+    }
+
+    static HLSL2GLSLConversionCache::Key ToCacheKey(const XXH128_hash_t& Hash)
+    {
+        HLSL2GLSLConversionCache::Key Key;
+        Key.Low  = Hash.low64;
+        Key.High = Hash.high64;
+        return Key;
+    }
+
+private:
+    XXH3_state_t* m_State = nullptr;
+};
+
+} // namespace
+
+void HLSL2GLSLConverterImpl::ConvertBatch(const ConversionAttribs*  pJobs,
+                                          size_t                    NumJobs,
+                                          IThreadPool*              pThreadPool,
+                                          HLSL2GLSLConversionCache* pCache,
+                                          String*                   pResults) const
+{
+    if (NumJobs == 0)
+        return;
+
+    DEV_CHECK_ERR(pJobs != nullptr, "pJobs must not be null");
+    DEV_CHECK_ERR(pResults != nullptr, "pResults must not be null");
+
+    struct SourceGroup
+    {
+        // The first job that uses the source
+        const ConversionAttribs* pAttribs = nullptr;
+
+        // Source code with all includes expanded
+        String ExpandedSource;
+
+        HLSL2GLSLConversionCache::Key SourceHash;
+
+        bool IsValid = false;
+
+        std::once_flag TokenizeFlag;
+        TokenListType  Tokens;
+
+        std::atomic<size_t> NumPendingJobs{0};
+    };
+
+    // Group the jobs by source so that every source is loaded and tokenized only once
+    std::vector<std::unique_ptr<SourceGroup>> Groups;
+    std::vector<size_t>                       JobGroups(NumJobs);
+    {
+        std::map<std::tuple<const void*, size_t, const void*, String>, size_t> GroupIds;
+        for (size_t i = 0; i < NumJobs; ++i)
+        {
+            const ConversionAttribs& Job = pJobs[i];
+            DEV_CHECK_ERR(Job.ppConversionStream == nullptr, "Conversion streams are not supported by batch conversion");
+
+            auto SourceId = Job.HLSLSource != nullptr ?
+                std::make_tuple(static_cast<const void*>(Job.HLSLSource), Job.NumSymbols, static_cast<const void*>(Job.pSourceStreamFactory), String{}) :
+                std::make_tuple(static_cast<const void*>(nullptr), size_t{0}, static_cast<const void*>(Job.pSourceStreamFactory), String{Job.InputFileName != nullptr ? Job.InputFileName : ""});
+
+            auto it = GroupIds.emplace(std::move(SourceId), Groups.size());
+            if (it.second)
+            {
+                Groups.emplace_back(std::make_unique<SourceGroup>());
+                Groups.back()->pAttribs = &Job;
+            }
+            JobGroups[i] = it.first->second;
+            Groups[JobGroups[i]]->NumPendingJobs.fetch_add(1);
+        }
+    }
+
+    // Load the sources and expand includes
+    ProcessInParallel(pThreadPool, Groups.size(), [&](size_t GroupIdx) {
+        SourceGroup&             Group   = *Groups[GroupIdx];
+        const ConversionAttribs& Attribs = *Group.pAttribs;
+        try
+        {
+            Group.ExpandedSource = ConversionStream::LoadSource(Attribs.InputFileName, Attribs.pSourceStreamFactory, Attribs.HLSLSource, Attribs.NumSymbols);
+            if (pCache != nullptr)
+                Group.SourceHash = CacheKeyHasher::ToCacheKey(XXH3_128bits(Group.ExpandedSource.data(), Group.ExpandedSource.size()));
+            Group.IsValid = true;
+        }
+        catch (std::runtime_error&)
+        {
+        }
+    });
+
+    HLSL2GLSLConversionCache::Key ConverterHash;
+    if (pCache != nullptr)
+    {
+        CacheKeyHasher Hasher;
+        Hasher.Update(ConverterVersion);
+        Hasher.UpdateStr(g_GLSLDefinitions);
+        ConverterHash = Hasher.Digest();
+    }
+
+    const auto ComputeCacheKey = [&ConverterHash](const HLSL2GLSLConversionCache::Key& SourceHash, const ConversionAttribs& Attribs) {
+        CacheKeyHasher Hasher;
+        Hasher.Update(ConverterHash);
+        Hasher.Update(SourceHash);
+        Hasher.UpdateStr(Attribs.EntryPoint);
+        Hasher.Update(Attribs.ShaderType);
+        Hasher.Update(Attribs.IncludeDefinitions);
+        if (Attribs.IncludeDefinitions)
+        {
+            Hasher.Update(Attribs.PruneUnusedDefinitions);
+            // Preceding source only affects the set of emitted definitions
+            if (Attribs.PruneUnusedDefinitions)
+                Hasher.UpdateStr(Attribs.PrecedingSource);
+        }
+        Hasher.UpdateStr(Attribs.SamplerSuffix);
+        Hasher.Update(Attribs.UseInOutLocationQualifiers);
+        Hasher.Update(Attribs.UseRowMajorMatrices);
+        return Hasher.Digest();
+    };
+
+    // Convert the shaders
+    ProcessInParallel(pThreadPool, NumJobs, [&](size_t JobIdx) {
+        const ConversionAttribs& Attribs = pJobs[JobIdx];
+        SourceGroup&             Group   = *Groups[JobGroups[JobIdx]];
+        String&                  Result  = pResults[JobIdx];
+
+        Result.clear();
+        if (Group.IsValid)
+        {
+            HLSL2GLSLConversionCache::Key CacheKey;
+            if (pCache != nullptr)
+                CacheKey = ComputeCacheKey(Group.SourceHash, Attribs);
+
+            if (pCache == nullptr || !pCache->Find(CacheKey, Result))
+            {
+                try
+                {
+                    // Tokenize the source when the first job that misses the cache needs it
+                    std::call_once(Group.TokenizeFlag, [&]() {
+                        Group.Tokens = m_HLSLTokenizer.Tokenize(Group.ExpandedSource);
+                    });
+
+                    // Conversion modifies the tokens, so every job works on its own copy
+                    ConversionStream Stream{nullptr, *this, Attribs.InputFileName, TokenListType{Group.Tokens}};
+
+                    Result = Stream.Convert(Attribs.EntryPoint, Attribs.ShaderType, Attribs.IncludeDefinitions,
+                                            Attribs.PruneUnusedDefinitions, Attribs.PrecedingSource,
+                                            Attribs.SamplerSuffix, Attribs.UseInOutLocationQualifiers,
+                                            Attribs.UseRowMajorMatrices);
+                    if (pCache != nullptr)
+                        pCache->Add(CacheKey, Result);
+                }
+                catch (std::runtime_error&)
+                {
+                    Result.clear();
+                }
+            }
+        }
+
+        // Release the source as soon as the last job that uses it is complete
+        if (Group.NumPendingJobs.fetch_sub(1) == 1)
+        {
+            Group.Tokens         = TokenListType{};
+            Group.ExpandedSource = String{};
+        }
+    });
+}
+
 void HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
                                                        SHADER_TYPE ShaderType,
                                                        bool        IncludeDefintions,
@@ -4531,7 +4780,8 @@ void HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
 {
     try
     {
-        auto                GLSLSource = Convert(EntryPoint, ShaderType, IncludeDefintions, SamplerSuffix, UseInOutLocationQualifiers, UseRowMajorMatrices);
+        // The caller composes the final shader source, so all definitions are included
+        auto                GLSLSource = Convert(EntryPoint, ShaderType, IncludeDefintions, false, nullptr, SamplerSuffix, UseInOutLocationQualifiers, UseRowMajorMatrices);
         StringDataBlobImpl* pDataBlob  = MakeNewRCObj<StringDataBlobImpl>()(std::move(GLSLSource));
         pDataBlob->QueryInterface(IID_DataBlob, reinterpret_cast<IObject**>(ppGLSLSource));
     }
@@ -4544,6 +4794,8 @@ void HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
 String HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
                                                          SHADER_TYPE ShaderType,
                                                          bool        IncludeDefintions,
+                                                         bool        PruneUnusedDefinitions,
+                                                         const Char* PrecedingSource,
                                                          const char* SamplerSuffix,
                                                          bool        UseInOutLocationQualifiers,
                                                          bool        UseRowMajorMatrices)
@@ -4799,7 +5051,17 @@ String HLSL2GLSLConverterImpl::ConversionStream::Convert(const Char* EntryPoint,
     }
 
     if (IncludeDefintions)
-        GLSLSource.insert(0, g_GLSLDefinitions);
+    {
+        if (PruneUnusedDefinitions)
+        {
+            const Char* Sources[] = {PrecedingSource, GLSLSource.c_str()};
+            GLSLSource.insert(0, m_Converter.m_DefinitionsPruner.Prune(Sources, _countof(Sources)));
+        }
+        else
+        {
+            GLSLSource.insert(0, g_GLSLDefinitions);
+        }
+    }
 
     GLSLSource.shrink_to_fit();
     return GLSLSource;
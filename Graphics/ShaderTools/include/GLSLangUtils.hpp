@@ -34,6 +34,8 @@
 namespace Diligent
 {
 
+struct IThreadPool;
+
 namespace GLSLangUtils
 {
 
@@ -73,6 +75,37 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
                                       const char*             ExtraDefinitions,
                                       IDataBlob**             ppCompilerOutput);
 
+/// Compiles multiple macro permutations of the same GLSL source.
+
+/// The macro-independent part of the preamble is built once, and include files
+/// are loaded once and shared by all permutations. Each element of pPermutations
+/// replaces Attribs.Macros. If pThreadPool is not null, permutations are compiled
+/// in parallel. If ppCompilerOutputs is not null, it must point to an array of
+/// NumPermutations elements that receives the compiler output of each permutation.
+///
+/// Returns an array of NumPermutations SPIR-V byte codes. Empty byte code
+/// indicates that the corresponding permutation failed to compile.
+std::vector<std::vector<unsigned int>> GLSLtoSPIRVPermutations(const GLSLtoSPIRVAttribs& Attribs,
+                                                               const ShaderMacroArray*   pPermutations,
+                                                               size_t                    NumPermutations,
+                                                               IThreadPool*              pThreadPool       = nullptr,
+                                                               IDataBlob**               ppCompilerOutputs = nullptr);
+
+/// Compiles multiple macro permutations of the same HLSL source.
+
+/// The source file is read once, the macro-independent part of the preamble
+/// (type definitions and ExtraDefinitions) is built once, and include files are
+/// loaded once and shared by all permutations. Each element of pPermutations
+/// replaces ShaderCI.Macros. See GLSLtoSPIRVPermutations for the description of
+/// the remaining parameters.
+std::vector<std::vector<unsigned int>> HLSLtoSPIRVPermutations(const ShaderCreateInfo& ShaderCI,
+                                                               const ShaderMacroArray* pPermutations,
+                                                               size_t                  NumPermutations,
+                                                               SpirvVersion            Version,
+                                                               const char*             ExtraDefinitions,
+                                                               IThreadPool*            pThreadPool       = nullptr,
+                                                               IDataBlob**             ppCompilerOutputs = nullptr);
+
 } // namespace GLSLangUtils
 
 } // namespace Diligent
@@ -175,6 +175,9 @@ struct HLSLTokenInfo
     }
 };
 
+/// HLSL token that references the source string, see TokenView.
+using HLSLTokenView = TokenView<HLSLTokenType>;
+
 class HLSLTokenizer
 {
 public:
@@ -186,13 +189,52 @@ public:
         return it != m_Keywords.end() ? &it->second : nullptr;
     }
 
+    /// Returns the keyword type for the given identifier, or HLSLTokenType::Identifier
+    /// if the identifier is not a keyword. The function does not allocate memory.
+    HLSLTokenType GetTokenType(const char* IdentifierStart, const char* IdentifierEnd) const;
+
     using TokenListType = std::list<HLSLTokenInfo>;
     TokenListType Tokenize(const String& Source) const;
 
+    /// Tokenizes the source into token views that reference the source string.
+
+    /// \param [in]  SourceStart - start of the source string.
+    /// \param [in]  SourceEnd   - end of the source string.
+    /// \param [out] Tokens      - token container, e.g. std::vector<HLSLTokenView> or
+    ///                            ArenaTokenVector<HLSLTokenView>. The container is cleared
+    ///                            first, but its memory is reused.
+    /// \return      true if the source was tokenized successfully, and false otherwise.
+    ///
+    /// \remarks     Unlike the overload that returns a list of HLSLTokenInfo, this method does not
+    ///              copy literals and delimiters, and does not allocate memory when the container
+    ///              has enough capacity.
+    template <typename ContainerType>
+    bool Tokenize(const char* SourceStart, const char* SourceEnd, ContainerType& Tokens) const
+    {
+        try
+        {
+            Parsing::Tokenize<HLSLTokenView>(
+                SourceStart, SourceEnd, HLSLTokenView::Create,
+                [this](const char* Start, const char* End) {
+                    return GetTokenType(Start, End);
+                },
+                Tokens);
+            return true;
+        }
+        catch (...)
+        {
+            Tokens.clear();
+            return false;
+        }
+    }
+
 private:
     // HLSL keyword -> token info hash map
     // Example: "Texture2D" -> TokenInfo{TokenType::Texture2D, "Texture2D"}
     std::unordered_map<HashMapStringKey, HLSLTokenInfo> m_Keywords;
+
+    // The length of the longest keyword. Longer identifiers can't be keywords.
+    size_t m_MaxKeywordLen = 0;
 };
 
 } // namespace Parsing
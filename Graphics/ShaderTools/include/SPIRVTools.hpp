@@ -27,14 +27,29 @@
 #pragma once
 
 #include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <map>
+#include <string>
+#include <sstream>
 
 #include "FlagEnum.h"
+#include "ContentHashCache.hpp"
 
 #include "spirv-tools/libspirv.h"
 
+namespace spvtools
+{
+class Optimizer;
+class OptimizerOptions;
+} // namespace spvtools
+
 namespace Diligent
 {
 
+struct IThreadPool;
+
 enum SPIRV_OPTIMIZATION_FLAGS : Uint32
 {
     SPIRV_OPTIMIZATION_FLAG_NONE             = 0u,
@@ -45,8 +60,149 @@ enum SPIRV_OPTIMIZATION_FLAGS : Uint32
 DEFINE_FLAG_ENUM_OPERATORS(SPIRV_OPTIMIZATION_FLAGS);
 
 
+
+/// SPIR-V optimizer with a preconstructed set of passes.
+
+/// Constructing spvtools::Optimizer and registering the passes is not free, so an
+/// instance of this class should be reused to optimize multiple modules.
+/// The class is not thread-safe: every thread must use its own instance.
+class SPIRVOptimizer
+{
+public:
+    /// \param [in] TargetEnv        - Target environment. Must not be SPV_ENV_MAX.
+    /// \param [in] Passes           - Optimization passes to register.
+    /// \param [in] EnableTimeReport - Whether to collect the per-pass time report, see GetTimeReport().
+    SPIRVOptimizer(spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes, bool EnableTimeReport = false);
+    ~SPIRVOptimizer();
+
+    // clang-format off
+    SPIRVOptimizer           (const SPIRVOptimizer&) = delete;
+    SPIRVOptimizer& operator=(const SPIRVOptimizer&) = delete;
+    // clang-format on
+
+    /// Runs the optimization passes. Returns an empty vector in case of failure.
+    std::vector<uint32_t> Run(const std::vector<uint32_t>& SrcSPIRV);
+
+    spv_target_env           GetTargetEnv() const { return m_TargetEnv; }
+    SPIRV_OPTIMIZATION_FLAGS GetPasses() const { return m_Passes; }
+
+    /// Returns the number of modules processed by this optimizer.
+    Uint32 GetRunCount() const { return m_RunCount; }
+
+    /// Returns the total time, in seconds, spent in Run().
+    double GetTotalRunTime() const { return m_TotalRunTime; }
+
+    /// Returns the accumulated per-pass time report.
+
+    /// The report is only produced if the optimizer was created with EnableTimeReport = true
+    /// and SPIRV-Tools were built with SPIRV_TIMER_ENABLED. Otherwise the string is empty.
+    std::string GetTimeReport() const;
+
+private:
+    const spv_target_env           m_TargetEnv;
+    const SPIRV_OPTIMIZATION_FLAGS m_Passes;
+
+    std::unique_ptr<spvtools::Optimizer>        m_pOptimizer;
+    std::unique_ptr<spvtools::OptimizerOptions> m_pOptions;
+    std::unique_ptr<std::ostringstream>         m_pTimeReport;
+
+    Uint32 m_RunCount     = 0;
+    double m_TotalRunTime = 0;
+};
+
+
+/// Pool of SPIR-V optimizers that can be shared by multiple threads.
+
+/// An optimizer is used by one thread at a time and is returned to the pool afterwards,
+/// so at most one instance per concurrently running thread is ever constructed.
+class SPIRVOptimizerPool
+{
+public:
+    /// \param [in] Passes           - Optimization passes to register in every optimizer.
+    /// \param [in] EnableTimeReport - Whether the optimizers collect the per-pass time report.
+    SPIRVOptimizerPool(SPIRV_OPTIMIZATION_FLAGS Passes, bool EnableTimeReport = false);
+    ~SPIRVOptimizerPool();
+
+    // clang-format off
+    SPIRVOptimizerPool           (const SPIRVOptimizerPool&) = delete;
+    SPIRVOptimizerPool& operator=(const SPIRVOptimizerPool&) = delete;
+    // clang-format on
+
+    /// Returns a free optimizer for the given target environment, or constructs a new one.
+    std::unique_ptr<SPIRVOptimizer> Acquire(spv_target_env TargetEnv);
+
+    /// Returns the optimizer to the pool.
+    void Release(std::unique_ptr<SPIRVOptimizer>&& pOptimizer);
+
+    /// Returns the number of optimizers constructed by the pool.
+    Uint32 GetNumOptimizers() const { return m_NumOptimizers.load(); }
+
+    /// Returns the combined time report of all optimizers that have been returned to the pool.
+    std::string GetTimeReport() const;
+
+private:
+    const SPIRV_OPTIMIZATION_FLAGS m_Passes;
+    const bool                     m_EnableTimeReport;
+
+    mutable std::mutex                                                      m_Mtx;
+    std::map<spv_target_env, std::vector<std::unique_ptr<SPIRVOptimizer>>> m_FreeOptimizers;
+
+    std::atomic<Uint32> m_NumOptimizers{0};
+};
+
+
+/// Thread-safe content-addressed cache of optimized SPIR-V modules.
+
+/// Optimized byte code is keyed by a 128-bit hash of the source byte code,
+/// the target environment and the optimization passes (see ComputeKey()).
+/// Storage, size limiting, eviction and serialization are implemented by ContentHashCache.
+class SPIRVOptimizationCache final : public ContentHashCache<std::vector<uint32_t>>
+{
+public:
+    /// \param [in] MaxDataSize - Maximum total size, in bytes, of the optimized byte code
+    ///                           in the cache. Zero means no limit.
+    explicit SPIRVOptimizationCache(size_t MaxDataSize = 0);
+
+    /// Computes the cache key. TargetEnv must be resolved, i.e. must not be SPV_ENV_MAX.
+    static Key ComputeKey(const std::vector<uint32_t>& SrcSPIRV, spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes);
+};
+
+
+/// Optimizes the SPIR-V byte code.
+
+/// \param [in] SrcSPIRV  - Source byte code.
+/// \param [in] TargetEnv - Target environment. If SPV_ENV_MAX is given, the environment
+///                         is derived from the byte code version.
+/// \param [in] Passes    - Optimization passes to run.
+/// \param [in] pCache    - Optional optimization cache. If the result for the same source
+///                         byte code, environment and passes is found in the cache, the
+///                         optimizer is not run. Successful results are added to the cache.
+/// \return     Optimized byte code, or an empty vector in case of failure.
 std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV,
                                     spv_target_env               TargetEnv,
-                                    SPIRV_OPTIMIZATION_FLAGS     Passes);
+                                    SPIRV_OPTIMIZATION_FLAGS     Passes,
+                                    SPIRVOptimizationCache*      pCache = nullptr);
+
+/// Optimizes multiple SPIR-V modules, optionally in parallel.
+
+/// \param [in]  pSrcSPIRVs   - An array of NumModules source modules.
+/// \param [in]  NumModules   - The number of modules.
+/// \param [in]  TargetEnv    - Target environment, see OptimizeSPIRV.
+/// \param [in]  Passes       - Optimization passes to run.
+/// \param [in]  pThreadPool  - Optional thread pool to run the optimization in.
+/// \param [in]  pCache       - Optional optimization cache, see OptimizeSPIRV.
+/// \param [out] pTimeReport  - Optional pointer to the string that receives the
+///                             per-pass time report of all optimizer instances.
+/// \return      An array of NumModules optimized modules. Empty module indicates failure.
+///
+/// \remarks    Optimizer instances are constructed once and are reused by the threads
+///             that process the modules. Identical source modules are only optimized once.
+std::vector<std::vector<uint32_t>> OptimizeSPIRVBatch(const std::vector<uint32_t>* pSrcSPIRVs,
+                                                      size_t                       NumModules,
+                                                      spv_target_env               TargetEnv,
+                                                      SPIRV_OPTIMIZATION_FLAGS     Passes,
+                                                      IThreadPool*                 pThreadPool = nullptr,
+                                                      SPIRVOptimizationCache*      pCache      = nullptr,
+                                                      std::string*                 pTimeReport = nullptr);
 
 } // namespace Diligent
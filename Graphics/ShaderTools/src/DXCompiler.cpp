@@ -34,6 +34,8 @@
 #include <atomic>
 #include <array>
 #include <sstream>
+#include <thread>
+#include <algorithm>
 
 #if PLATFORM_WIN32 || PLATFORM_UNIVERSAL_WINDOWS
 #    include "WinHPreface.h"
@@ -73,6 +75,8 @@ namespace
 constexpr Uint32 VK_API_VERSION_1_1 = (1u << 22) | (1u << 12);
 constexpr Uint32 VK_API_VERSION_1_2 = (1u << 22) | (2u << 12);
 
+struct DxcInstances;
+
 
 class DXCompilerImpl final : public IDXCompiler
 {
@@ -124,8 +128,16 @@ public:
                                        IDxcBlob*                  pSrcBytecode,
                                        IDxcBlob**                 ppDstByteCode) override final;
 
+    ~DXCompilerImpl();
+
 private:
-    bool ValidateAndSign(DxcCreateInstanceProc CreateInstance, IDxcLibrary* pdxcLibrary, CComPtr<IDxcBlob>& pCompiled, IDxcBlob** ppOutput) const noexcept(false);
+    // Holds DXC instances borrowed from the pool and returns them when going out of scope
+    class PooledDxcInstances;
+
+    std::unique_ptr<DxcInstances> AcquireDxcInstances(DxcCreateInstanceProc CreateInstance) noexcept(false);
+    void                          ReleaseDxcInstances(std::unique_ptr<DxcInstances> pInstances);
+
+    bool ValidateAndSign(DxcInstances& Instances, CComPtr<IDxcBlob>& pCompiled, IDxcBlob** ppOutput) const noexcept(false);
 
     enum RES_TYPE : Uint32
     {
@@ -163,6 +175,14 @@ private:
 private:
     DXCompilerLibrary m_Library;
     const Uint32      m_APIVersion;
+
+    // DXC objects are not thread-safe, but are expensive to create. Every compilation
+    // borrows a set of instances for exclusive use and returns it to the pool when done.
+    // Instances are only reused by the thread that created them.
+    static constexpr size_t MaxPooledDxcInstances = 64;
+
+    std::mutex                                 m_DxcInstancesPoolMtx;
+    std::vector<std::unique_ptr<DxcInstances>> m_DxcInstancesPool;
 };
 
 #define CHECK_D3D_RESULT(Expr, Message)   \
@@ -184,6 +204,15 @@ public:
     {
     }
 
+    // Prepares the handler for the next compilation. Include files loaded by the previous
+    // compilation are released as the compiler no longer references them.
+    void Reset(IShaderSourceInputStreamFactory* pStreamFactory)
+    {
+        VERIFY(m_RefCount == 0, "Include handler is still referenced by the compiler");
+        m_pStreamFactory = pStreamFactory;
+        m_FileDataCache.clear();
+    }
+
     HRESULT STDMETHODCALLTYPE LoadSource(_In_ LPCWSTR pFilename, _COM_Outptr_result_maybenull_ IDxcBlob** ppIncludeSource) override
     {
         if (pFilename == nullptr)
@@ -255,10 +284,74 @@ public:
     }
 
 private:
-    CComPtr<IDxcLibrary>                   m_pdxcLibrary;
-    IShaderSourceInputStreamFactory* const m_pStreamFactory;
-    std::atomic_long                       m_RefCount{0};
-    std::vector<RefCntAutoPtr<IDataBlob>>  m_FileDataCache;
+    CComPtr<IDxcLibrary>                  m_pdxcLibrary;
+    IShaderSourceInputStreamFactory*      m_pStreamFactory = nullptr;
+    std::atomic_long                      m_RefCount{0};
+    std::vector<RefCntAutoPtr<IDataBlob>> m_FileDataCache;
+};
+
+// A set of DXC objects that is used by one thread at a time
+struct DxcInstances
+{
+    DxcInstances(DxcCreateInstanceProc _CreateInstance) noexcept(false) :
+        CreateInstance{_CreateInstance}
+    {
+        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcLibrary, IID_PPV_ARGS(&pLibrary)), "Failed to create DXC Library");
+        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&pCompiler)), "Failed to create DXC Compiler");
+        pIncludeHandler = std::make_unique<DxcIncludeHandlerImpl>(nullptr, pLibrary);
+    }
+
+    IDxcValidator* GetValidator() noexcept(false)
+    {
+        if (!pValidator)
+            CHECK_D3D_RESULT(CreateInstance(CLSID_DxcValidator, IID_PPV_ARGS(&pValidator)), "Failed to create DXC Validator");
+        return pValidator;
+    }
+
+    IDxcAssembler* GetAssembler() noexcept(false)
+    {
+        if (!pAssembler)
+            CHECK_D3D_RESULT(CreateInstance(CLSID_DxcAssembler, IID_PPV_ARGS(&pAssembler)), "Failed to create DXC assembler");
+        return pAssembler;
+    }
+
+    const DxcCreateInstanceProc CreateInstance;
+    const std::thread::id       OwnerThreadId = std::this_thread::get_id();
+
+    CComPtr<IDxcLibrary>  pLibrary;
+    CComPtr<IDxcCompiler> pCompiler;
+
+    // Validator and assembler are only needed by some operations and are created on first use
+    CComPtr<IDxcValidator> pValidator;
+    CComPtr<IDxcAssembler> pAssembler;
+
+    std::unique_ptr<DxcIncludeHandlerImpl> pIncludeHandler;
+};
+
+class DXCompilerImpl::PooledDxcInstances
+{
+public:
+    PooledDxcInstances(DXCompilerImpl& Compiler, DxcCreateInstanceProc CreateInstance) noexcept(false) :
+        m_Compiler{Compiler},
+        m_pInstances{Compiler.AcquireDxcInstances(CreateInstance)}
+    {}
+
+    ~PooledDxcInstances()
+    {
+        m_Compiler.ReleaseDxcInstances(std::move(m_pInstances));
+    }
+
+    // clang-format off
+    PooledDxcInstances           (const PooledDxcInstances&) = delete;
+    PooledDxcInstances& operator=(const PooledDxcInstances&) = delete;
+    // clang-format on
+
+    DxcInstances* operator->() const { return m_pInstances.get(); }
+    DxcInstances& operator*() const { return *m_pInstances; }
+
+private:
+    DXCompilerImpl&               m_Compiler;
+    std::unique_ptr<DxcInstances> m_pInstances;
 };
 
 class DxcBlobWrapper final : public IDxcBlob
@@ -333,6 +426,53 @@ std::unique_ptr<IDXCompiler> CreateDXCompiler(DXCompilerTarget Target, Uint32 AP
     return std::make_unique<DXCompilerImpl>(Target, APIVersion, pLibraryName);
 }
 
+DXCompilerImpl::~DXCompilerImpl()
+{
+    // DXC objects must be released before the library is unloaded
+    m_DxcInstancesPool.clear();
+}
+
+std::unique_ptr<DxcInstances> DXCompilerImpl::AcquireDxcInstances(DxcCreateInstanceProc CreateInstance) noexcept(false)
+{
+    // NOTE: The call to DxcCreateInstance is thread-safe, but objects created by DxcCreateInstance aren't thread-safe.
+    // Compiler objects should be created and then used on the same thread.
+    // https://github.com/microsoft/DirectXShaderCompiler/wiki/Using-dxc.exe-and-dxcompiler.dll#dxcompiler-dll-interface
+    const std::thread::id ThreadId = std::this_thread::get_id();
+    {
+        std::lock_guard<std::mutex> Lock{m_DxcInstancesPoolMtx};
+
+        auto it = std::find_if(m_DxcInstancesPool.rbegin(), m_DxcInstancesPool.rend(),
+                               [ThreadId](const std::unique_ptr<DxcInstances>& pInstances) {
+                                   return pInstances->OwnerThreadId == ThreadId;
+                               });
+        if (it != m_DxcInstancesPool.rend())
+        {
+            std::unique_ptr<DxcInstances> pInstances = std::move(*it);
+            m_DxcInstancesPool.erase(std::next(it).base());
+            return pInstances;
+        }
+    }
+
+    return std::make_unique<DxcInstances>(CreateInstance);
+}
+
+void DXCompilerImpl::ReleaseDxcInstances(std::unique_ptr<DxcInstances> pInstances)
+{
+    if (!pInstances)
+        return;
+
+    // Do not keep the source stream factory alive in the pool
+    pInstances->pIncludeHandler->Reset(nullptr);
+
+    std::lock_guard<std::mutex> Lock{m_DxcInstancesPoolMtx};
+    if (m_DxcInstancesPool.size() >= MaxPooledDxcInstances)
+    {
+        // Drop the least recently used instances, which likely belong to threads that no longer exist
+        m_DxcInstancesPool.erase(m_DxcInstancesPool.begin());
+    }
+    m_DxcInstancesPool.emplace_back(std::move(pInstances));
+}
+
 bool DXCompilerImpl::Compile(const CompileAttribs& Attribs)
 {
     try
@@ -351,20 +491,16 @@ bool DXCompilerImpl::Compile(const CompileAttribs& Attribs)
 
         HRESULT hr;
 
-        // NOTE: The call to DxcCreateInstance is thread-safe, but objects created by DxcCreateInstance aren't thread-safe.
-        // Compiler objects should be created and then used on the same thread.
-        // https://github.com/microsoft/DirectXShaderCompiler/wiki/Using-dxc.exe-and-dxcompiler.dll#dxcompiler-dll-interface
-
-        CComPtr<IDxcLibrary> pdxcLibrary;
-        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcLibrary, IID_PPV_ARGS(&pdxcLibrary)), "Failed to create DXC Library");
+        PooledDxcInstances Instances{*this, CreateInstance};
 
-        CComPtr<IDxcCompiler> pdxcCompiler;
-        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&pdxcCompiler)), "Failed to create DXC Compiler");
+        IDxcLibrary*  pdxcLibrary  = Instances->pLibrary;
+        IDxcCompiler* pdxcCompiler = Instances->pCompiler;
 
         CComPtr<IDxcBlobEncoding> pSourceBlob;
         CHECK_D3D_RESULT(pdxcLibrary->CreateBlobWithEncodingFromPinned(Attribs.Source, UINT32{Attribs.SourceLength}, CP_UTF8, &pSourceBlob), "Failed to create DXC Blob Encoding");
 
-        DxcIncludeHandlerImpl IncludeHandler{Attribs.pShaderSourceStreamFactory, pdxcLibrary};
+        DxcIncludeHandlerImpl& IncludeHandler = *Instances->pIncludeHandler;
+        IncludeHandler.Reset(Attribs.pShaderSourceStreamFactory);
 
         CComPtr<IDxcOperationResult> pdxcResult;
         hr = pdxcCompiler->Compile(
@@ -405,7 +541,7 @@ bool DXCompilerImpl::Compile(const CompileAttribs& Attribs)
         // Validate and sign
         if (m_Library.GetTarget() == DXCompilerTarget::Direct3D12)
         {
-            return ValidateAndSign(CreateInstance, pdxcLibrary, pCompiledBlob, Attribs.ppBlobOut);
+            return ValidateAndSign(*Instances, pCompiledBlob, Attribs.ppBlobOut);
         }
         else
         {
@@ -419,10 +555,10 @@ bool DXCompilerImpl::Compile(const CompileAttribs& Attribs)
     }
 }
 
-bool DXCompilerImpl::ValidateAndSign(DxcCreateInstanceProc CreateInstance, IDxcLibrary* library, CComPtr<IDxcBlob>& compiled, IDxcBlob** ppBlobOut) const noexcept(false)
+bool DXCompilerImpl::ValidateAndSign(DxcInstances& Instances, CComPtr<IDxcBlob>& compiled, IDxcBlob** ppBlobOut) const noexcept(false)
 {
-    CComPtr<IDxcValidator> pdxcValidator;
-    CHECK_D3D_RESULT(CreateInstance(CLSID_DxcValidator, IID_PPV_ARGS(&pdxcValidator)), "Failed to create DXC Validator");
+    IDxcLibrary*   library       = Instances.pLibrary;
+    IDxcValidator* pdxcValidator = Instances.GetValidator();
 
     CComPtr<IDxcOperationResult> pdxcResult;
     CHECK_D3D_RESULT(pdxcValidator->Validate(compiled, DxcValidatorFlags_InPlaceEdit, &pdxcResult), "Failed to validate shader bytecode");
@@ -835,14 +971,11 @@ bool DXCompilerImpl::RemapResourceBindings(const TResourceBindingMap& ResourceMa
             return false;
         }
 
-        CComPtr<IDxcLibrary> pdxcLibrary;
-        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcLibrary, IID_PPV_ARGS(&pdxcLibrary)), "Failed to create DXC Library");
-
-        CComPtr<IDxcAssembler> pdxcAssembler;
-        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcAssembler, IID_PPV_ARGS(&pdxcAssembler)), "Failed to create DXC assembler");
+        PooledDxcInstances Instances{*this, CreateInstance};
 
-        CComPtr<IDxcCompiler> pdxcCompiler;
-        CHECK_D3D_RESULT(CreateInstance(CLSID_DxcCompiler, IID_PPV_ARGS(&pdxcCompiler)), "Failed to create DXC Compiler");
+        IDxcLibrary*   pdxcLibrary   = Instances->pLibrary;
+        IDxcAssembler* pdxcAssembler = Instances->GetAssembler();
+        IDxcCompiler*  pdxcCompiler  = Instances->pCompiler;
 
         CComPtr<IDxcBlobEncoding> pdxcDisasm;
         CHECK_D3D_RESULT(pdxcCompiler->Disassemble(pSrcBytecode, &pdxcDisasm), "Failed to disassemble bytecode");
@@ -996,7 +1129,7 @@ bool DXCompilerImpl::RemapResourceBindings(const TResourceBindingMap& ResourceMa
         CComPtr<IDxcBlob> pCompiledBlob;
         CHECK_D3D_RESULT(pdxcResult->GetResult(static_cast<IDxcBlob**>(&pCompiledBlob)), "Failed to get compiled blob from DXC result");
 
-        return ValidateAndSign(CreateInstance, pdxcLibrary, pCompiledBlob, ppDstByteCode);
+        return ValidateAndSign(*Instances, pCompiledBlob, ppDstByteCode);
     }
     catch (...)
     {
@@ -379,10 +379,14 @@ String BuildGLSLSourceString(const BuildGLSLSourceStringAttribs& Attribs) noexce
         ConvertAttribs.EntryPoint           = ShaderCI.EntryPoint;
         ConvertAttribs.ShaderType           = ShaderCI.Desc.ShaderType;
         ConvertAttribs.IncludeDefinitions   = true;
+        ConvertAttribs.PrecedingSource      = GLSLSource.c_str();
         ConvertAttribs.InputFileName        = ShaderCI.FilePath;
         ConvertAttribs.SamplerSuffix        = ShaderCI.Desc.CombinedSamplerSuffix != nullptr ?
             ShaderCI.Desc.CombinedSamplerSuffix :
             ShaderDesc{}.CombinedSamplerSuffix;
+        // The final source only consists of the header above and the converted source,
+        // so when requested, the definitions that neither of them references can be safely removed.
+        ConvertAttribs.PruneUnusedDefinitions = (ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_PRUNE_UNUSED_GLSL_DEFINITIONS) != 0;
         // Separate shader objects extension also allows input/output layout qualifiers for
         // all shader stages.
         // https://www.khronos.org/registry/OpenGL/extensions/ARB/ARB_separate_shader_objects.txt
@@ -31,6 +31,7 @@
 #include <unordered_map>
 #include <memory>
 #include <array>
+#include <mutex>
 
 #ifdef VK_USE_PLATFORM_METAL_EXT
 #    include <MoltenGLSLToSPIRVConverter/GLSLToSPIRVConverter.h>
@@ -47,6 +48,7 @@
 #include "DataBlobImpl.hpp"
 #include "RefCntAutoPtr.hpp"
 #include "ShaderToolsCommon.hpp"
+#include "ThreadPool.hpp"
 #ifdef USE_SPIRV_TOOLS
 #    include "SPIRVTools.hpp"
 #endif
@@ -295,11 +297,62 @@ std::vector<unsigned int> CompileShaderInternal(::glslang::TShader&           Sh
 }
 
 
+RefCntAutoPtr<IDataBlob> LoadIncludeFile(IShaderSourceInputStreamFactory* pInputStreamFactory, const char* headerName)
+{
+    DEV_CHECK_ERR(pInputStreamFactory != nullptr, "The shader source contains #include directives, but no input stream factory was provided");
+    RefCntAutoPtr<IFileStream> pSourceStream;
+    pInputStreamFactory->CreateInputStream(headerName, &pSourceStream);
+    if (pSourceStream == nullptr)
+    {
+        LOG_ERROR("Failed to open shader include file '", headerName, "'. Check that the file exists");
+        return {};
+    }
+
+    RefCntAutoPtr<DataBlobImpl> pFileData = DataBlobImpl::Create();
+    pSourceStream->ReadBlob(pFileData);
+    return pFileData;
+}
+
+// Include files shared by all permutations of a shader. Every file is only loaded once.
+class SharedIncludeCache
+{
+public:
+    explicit SharedIncludeCache(IShaderSourceInputStreamFactory* pInputStreamFactory) :
+        m_pInputStreamFactory{pInputStreamFactory}
+    {}
+
+    RefCntAutoPtr<IDataBlob> Load(const char* headerName)
+    {
+        {
+            std::lock_guard<std::mutex> Lock{m_Mtx};
+
+            auto it = m_Files.find(headerName);
+            if (it != m_Files.end())
+                return it->second;
+        }
+
+        // Load the file without holding the lock. If another thread loads the same file
+        // concurrently, the first inserted copy is used.
+        RefCntAutoPtr<IDataBlob> pFileData = LoadIncludeFile(m_pInputStreamFactory, headerName);
+        if (!pFileData)
+            return {};
+
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+        return m_Files.emplace(headerName, std::move(pFileData)).first->second;
+    }
+
+private:
+    IShaderSourceInputStreamFactory* const                    m_pInputStreamFactory;
+    std::mutex                                                m_Mtx;
+    std::unordered_map<std::string, RefCntAutoPtr<IDataBlob>> m_Files;
+};
+
 class IncluderImpl : public ::glslang::TShader::Includer
 {
 public:
-    IncluderImpl(IShaderSourceInputStreamFactory* pInputStreamFactory) :
-        m_pInputStreamFactory(pInputStreamFactory)
+    IncluderImpl(IShaderSourceInputStreamFactory* pInputStreamFactory, SharedIncludeCache* pIncludeCache = nullptr) :
+        m_pInputStreamFactory(pInputStreamFactory),
+        m_pIncludeCache(pIncludeCache)
     {}
 
     // For the "system" or <>-style includes; search the "system" paths.
@@ -307,17 +360,12 @@ public:
                                          const char* /*includerName*/,
                                          size_t /*inclusionDepth*/)
     {
-        DEV_CHECK_ERR(m_pInputStreamFactory != nullptr, "The shader source contains #include directives, but no input stream factory was provided");
-        RefCntAutoPtr<IFileStream> pSourceStream;
-        m_pInputStreamFactory->CreateInputStream(headerName, &pSourceStream);
-        if (pSourceStream == nullptr)
-        {
-            LOG_ERROR("Failed to open shader include file '", headerName, "'. Check that the file exists");
+        RefCntAutoPtr<IDataBlob> pFileData = m_pIncludeCache != nullptr ?
+            m_pIncludeCache->Load(headerName) :
+            LoadIncludeFile(m_pInputStreamFactory, headerName);
+        if (!pFileData)
             return nullptr;
-        }
 
-        RefCntAutoPtr<DataBlobImpl> pFileData = DataBlobImpl::Create();
-        pSourceStream->ReadBlob(pFileData);
         IncludeResult* pNewInclude =
             new IncludeResult{
                 headerName,
@@ -349,6 +397,7 @@ public:
 
 private:
     IShaderSourceInputStreamFactory* const                       m_pInputStreamFactory;
+    SharedIncludeCache* const                                    m_pIncludeCache;
     std::unordered_set<std::unique_ptr<IncludeResult>>           m_IncludeRes;
     std::unordered_map<IncludeResult*, RefCntAutoPtr<IDataBlob>> m_DataBlobs;
 };
@@ -424,12 +473,39 @@ spv_target_env SpirvVersionToSpvTargetEnv(SpirvVersion Version)
 }
 #endif
 
-} // namespace
+// Builds the part of the HLSL preamble that does not depend on shader macros
+std::string BuildHLSLPreamble(const ShaderCreateInfo& ShaderCI, const char* ExtraDefinitions)
+{
+    std::string Preamble;
+    if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_PACK_MATRIX_ROW_MAJOR) != 0)
+        Preamble += "#pragma pack_matrix(row_major)\n\n";
+    Preamble.append("#define GLSLANG\n\n");
+    Preamble.append(g_HLSLDefinitions);
+    AppendShaderTypeDefinitions(Preamble, ShaderCI.Desc.ShaderType);
 
-std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
-                                      SpirvVersion            Version,
-                                      const char*             ExtraDefinitions,
-                                      IDataBlob**             ppCompilerOutput)
+    if (ExtraDefinitions != nullptr)
+        Preamble += ExtraDefinitions;
+
+    return Preamble;
+}
+
+// Builds the part of the GLSL preamble that does not depend on shader macros
+std::string BuildGLSLPreamble(const GLSLtoSPIRVAttribs& Attribs)
+{
+    std::string Preamble;
+    if (Attribs.UseRowMajorMatrices)
+        Preamble += "layout(row_major) uniform;\n\n";
+    Preamble.append("#define GLSLANG\n\n");
+    return Preamble;
+}
+
+std::vector<unsigned int> CompileHLSL(const ShaderCreateInfo&       ShaderCI,
+                                      SpirvVersion                  Version,
+                                      const char*                   Source,
+                                      size_t                        SourceLength,
+                                      const std::string&            Preamble,
+                                      ::glslang::TShader::Includer& Includer,
+                                      IDataBlob**                   ppCompilerOutput)
 {
     EShLanguage        ShLang = ShaderTypeToShLanguage(ShaderCI.Desc.ShaderType);
     ::glslang::TShader Shader{ShLang};
@@ -449,28 +525,10 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
     Shader.setEntryPoint(ShaderCI.EntryPoint);
     Shader.setEnvTargetHlslFunctionality1();
 
-    const ShaderSourceFileData SourceData = ReadShaderSourceFile(ShaderCI);
-
-    std::string Preamble;
-    if ((ShaderCI.CompileFlags & SHADER_COMPILE_FLAG_PACK_MATRIX_ROW_MAJOR) != 0)
-        Preamble += "#pragma pack_matrix(row_major)\n\n";
-    Preamble.append("#define GLSLANG\n\n");
-    Preamble.append(g_HLSLDefinitions);
-    AppendShaderTypeDefinitions(Preamble, ShaderCI.Desc.ShaderType);
-
-    if (ExtraDefinitions != nullptr)
-        Preamble += ExtraDefinitions;
-
-    if (ShaderCI.Macros)
-    {
-        Preamble += '\n';
-        AppendShaderMacros(Preamble, ShaderCI.Macros);
-    }
-
     Shader.setPreamble(Preamble.c_str());
 
-    const char* ShaderStrings[]       = {SourceData.Source};
-    const int   ShaderStringLengths[] = {static_cast<int>(SourceData.SourceLength)};
+    const char* ShaderStrings[]       = {Source};
+    const int   ShaderStringLengths[] = {static_cast<int>(SourceLength)};
     const char* Names[]               = {ShaderCI.FilePath != nullptr ? ShaderCI.FilePath : ""};
     Shader.setStringsWithLengthsAndNames(ShaderStrings, ShaderStringLengths, Names, 1);
 
@@ -478,9 +536,7 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
     // Make the behavior consistent with DX:
     Shader.setDxPositionW(true);
 
-    IncluderImpl Includer{ShaderCI.pShaderSourceStreamFactory};
-
-    std::vector<unsigned int> SPIRV = CompileShaderInternal(Shader, messages, &Includer, SourceData.Source, SourceData.SourceLength, true, shProfile, ppCompilerOutput);
+    std::vector<unsigned int> SPIRV = CompileShaderInternal(Shader, messages, &Includer, Source, SourceLength, true, shProfile, ppCompilerOutput);
     if (SPIRV.empty())
         return SPIRV;
 
@@ -500,7 +556,10 @@ std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
     return SPIRV;
 }
 
-std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
+std::vector<unsigned int> CompileGLSL(const GLSLtoSPIRVAttribs&     Attribs,
+                                      const std::string&            Preamble,
+                                      ::glslang::TShader::Includer& Includer,
+                                      IDataBlob**                   ppCompilerOutput)
 {
     VERIFY_EXPR(Attribs.ShaderSource != nullptr && Attribs.SourceCodeLen > 0);
 
@@ -519,17 +578,9 @@ std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
     int         Lengths[]       = {Attribs.SourceCodeLen};
     Shader.setStringsWithLengths(ShaderStrings, Lengths, 1);
 
-    std::string Preamble;
-    if (Attribs.UseRowMajorMatrices)
-        Preamble += "layout(row_major) uniform;\n\n";
-    Preamble.append("#define GLSLANG\n\n");
-    if (Attribs.Macros)
-        AppendShaderMacros(Preamble, Attribs.Macros);
     Shader.setPreamble(Preamble.c_str());
 
-    IncluderImpl Includer{Attribs.pShaderSourceStreamFactory};
-
-    std::vector<unsigned int> SPIRV = CompileShaderInternal(Shader, messages, &Includer, Attribs.ShaderSource, Attribs.SourceCodeLen, Attribs.AssignBindings, shProfile, Attribs.ppCompilerOutput);
+    std::vector<unsigned int> SPIRV = CompileShaderInternal(Shader, messages, &Includer, Attribs.ShaderSource, Attribs.SourceCodeLen, Attribs.AssignBindings, shProfile, ppCompilerOutput);
     if (SPIRV.empty())
         return SPIRV;
 
@@ -547,6 +598,100 @@ std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
     return SPIRV;
 }
 
+} // namespace
+
+std::vector<unsigned int> HLSLtoSPIRV(const ShaderCreateInfo& ShaderCI,
+                                      SpirvVersion            Version,
+                                      const char*             ExtraDefinitions,
+                                      IDataBlob**             ppCompilerOutput)
+{
+    const ShaderSourceFileData SourceData = ReadShaderSourceFile(ShaderCI);
+
+    std::string Preamble = BuildHLSLPreamble(ShaderCI, ExtraDefinitions);
+    if (ShaderCI.Macros)
+    {
+        Preamble += '\n';
+        AppendShaderMacros(Preamble, ShaderCI.Macros);
+    }
+
+    IncluderImpl Includer{ShaderCI.pShaderSourceStreamFactory};
+
+    return CompileHLSL(ShaderCI, Version, SourceData.Source, SourceData.SourceLength, Preamble, Includer, ppCompilerOutput);
+}
+
+std::vector<std::vector<unsigned int>> HLSLtoSPIRVPermutations(const ShaderCreateInfo& ShaderCI,
+                                                               const ShaderMacroArray* pPermutations,
+                                                               size_t                  NumPermutations,
+                                                               SpirvVersion            Version,
+                                                               const char*             ExtraDefinitions,
+                                                               IThreadPool*            pThreadPool,
+                                                               IDataBlob**             ppCompilerOutputs)
+{
+    DEV_CHECK_ERR(pPermutations != nullptr || NumPermutations == 0, "pPermutations must not be null");
+
+    std::vector<std::vector<unsigned int>> SPIRVs(NumPermutations);
+    if (NumPermutations == 0)
+        return SPIRVs;
+
+    const ShaderSourceFileData SourceData = ReadShaderSourceFile(ShaderCI);
+
+    const std::string  CommonPreamble = BuildHLSLPreamble(ShaderCI, ExtraDefinitions);
+    SharedIncludeCache IncludeCache{ShaderCI.pShaderSourceStreamFactory};
+
+    ProcessInParallel(pThreadPool, NumPermutations, [&](size_t i) {
+        std::string Preamble = CommonPreamble;
+        if (pPermutations[i])
+        {
+            Preamble += '\n';
+            AppendShaderMacros(Preamble, pPermutations[i]);
+        }
+
+        IncluderImpl Includer{ShaderCI.pShaderSourceStreamFactory, &IncludeCache};
+
+        SPIRVs[i] = CompileHLSL(ShaderCI, Version, SourceData.Source, SourceData.SourceLength, Preamble, Includer,
+                                ppCompilerOutputs != nullptr ? &ppCompilerOutputs[i] : nullptr);
+    });
+
+    return SPIRVs;
+}
+
+std::vector<unsigned int> GLSLtoSPIRV(const GLSLtoSPIRVAttribs& Attribs)
+{
+    std::string Preamble = BuildGLSLPreamble(Attribs);
+    if (Attribs.Macros)
+        AppendShaderMacros(Preamble, Attribs.Macros);
+
+    IncluderImpl Includer{Attribs.pShaderSourceStreamFactory};
+
+    return CompileGLSL(Attribs, Preamble, Includer, Attribs.ppCompilerOutput);
+}
+
+std::vector<std::vector<unsigned int>> GLSLtoSPIRVPermutations(const GLSLtoSPIRVAttribs& Attribs,
+                                                               const ShaderMacroArray*   pPermutations,
+                                                               size_t                    NumPermutations,
+                                                               IThreadPool*              pThreadPool,
+                                                               IDataBlob**               ppCompilerOutputs)
+{
+    DEV_CHECK_ERR(pPermutations != nullptr || NumPermutations == 0, "pPermutations must not be null");
+
+    std::vector<std::vector<unsigned int>> SPIRVs(NumPermutations);
+
+    const std::string  CommonPreamble = BuildGLSLPreamble(Attribs);
+    SharedIncludeCache IncludeCache{Attribs.pShaderSourceStreamFactory};
+
+    ProcessInParallel(pThreadPool, NumPermutations, [&](size_t i) {
+        std::string Preamble = CommonPreamble;
+        if (pPermutations[i])
+            AppendShaderMacros(Preamble, pPermutations[i]);
+
+        IncluderImpl Includer{Attribs.pShaderSourceStreamFactory, &IncludeCache};
+
+        SPIRVs[i] = CompileGLSL(Attribs, Preamble, Includer, ppCompilerOutputs != nullptr ? &ppCompilerOutputs[i] : nullptr);
+    });
+
+    return SPIRVs;
+}
+
 } // namespace GLSLangUtils
 
 } // namespace Diligent
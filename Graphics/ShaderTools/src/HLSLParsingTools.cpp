@@ -34,8 +34,10 @@ namespace Diligent
 namespace Parsing
 {
 
-static std::pair<std::string, TEXTURE_FORMAT> ParseRWTextureDefinition(HLSLTokenizer::TokenListType::const_iterator& Token,
-                                                                       HLSLTokenizer::TokenListType::const_iterator  End)
+using HLSLTokenViewIterator = std::vector<HLSLTokenView>::const_iterator;
+
+static std::pair<std::string, TEXTURE_FORMAT> ParseRWTextureDefinition(HLSLTokenViewIterator& Token,
+                                                                       HLSLTokenViewIterator  End)
 {
     // RWTexture2D<unorm  /*format=rg8*/ float4>  g_RWTex;
     // ^
@@ -43,11 +45,11 @@ static std::pair<std::string, TEXTURE_FORMAT> ParseRWTextureDefinition(HLSLToken
     ++Token;
     // RWTexture2D<unorm  /*format=rg8*/ float4>  g_RWTex;
     //            ^
-    if (Token == End || Token->Literal != "<")
+    if (Token == End || !Token->CompareLiteral("<"))
         return {};
 
     TEXTURE_FORMAT Fmt = TEX_FORMAT_UNKNOWN;
-    while (Token != End && Token->Literal != ">")
+    while (Token != End && !Token->CompareLiteral(">"))
     {
         ++Token;
         if (Token != End)
@@ -58,7 +60,7 @@ static std::pair<std::string, TEXTURE_FORMAT> ParseRWTextureDefinition(HLSLToken
             //                                   ^
             // RWTexture2D< unorm float4 /*format=rg8*/> g_RWTex;
             //                                         ^
-            std::string FormatStr = ExtractGLSLImageFormatFromComment(Token->Delimiter.begin(), Token->Delimiter.end());
+            std::string FormatStr = ExtractGLSLImageFormatFromComment(Token->DelimStart, Token->DelimEnd);
             if (!FormatStr.empty())
             {
                 Fmt = ParseGLSLImageFormat(FormatStr);
@@ -80,19 +82,21 @@ static std::pair<std::string, TEXTURE_FORMAT> ParseRWTextureDefinition(HLSLToken
     if (Token->Type != HLSLTokenType::Identifier)
         return {};
 
-    return {Token->Literal, Fmt};
+    return {std::string{Token->LiteralStart, Token->LiteralEnd}, Fmt};
 }
 
 std::unordered_map<HashMapStringKey, TEXTURE_FORMAT> ExtractGLSLImageFormatsFromHLSL(const std::string& HLSLSource)
 {
-    HLSLTokenizer                      Tokenizer;
-    const HLSLTokenizer::TokenListType Tokens = Tokenizer.Tokenize(HLSLSource);
+    HLSLTokenizer              Tokenizer;
+    std::vector<HLSLTokenView> Tokens;
+    // Tokens only reference the source string, so no copies of literals are made
+    Tokenizer.Tokenize(HLSLSource.data(), HLSLSource.data() + HLSLSource.length(), Tokens);
 
     std::unordered_map<HashMapStringKey, TEXTURE_FORMAT> ImageFormats;
 
-    auto Token      = Tokens.begin();
+    auto Token      = Tokens.cbegin();
     int  ScopeLevel = 0;
-    while (Token != Tokens.end())
+    while (Token != Tokens.cend())
     {
         if (Token->Type == HLSLTokenType::OpenBrace ||
             Token->Type == HLSLTokenType::OpenParen ||
@@ -119,7 +123,7 @@ std::unordered_map<HashMapStringKey, TEXTURE_FORMAT> ExtractGLSLImageFormatsFrom
              Token->Type == HLSLTokenType::kw_RWTexture2DArray ||
              Token->Type == HLSLTokenType::kw_RWTexture3D))
         {
-            auto NameAndFmt = ParseRWTextureDefinition(Token, Tokens.end());
+            auto NameAndFmt = ParseRWTextureDefinition(Token, Tokens.cend());
             if (NameAndFmt.second != TEX_FORMAT_UNKNOWN)
             {
                 auto it_inserted = ImageFormats.emplace(NameAndFmt);
@@ -38,6 +38,32 @@ HLSLTokenizer::HLSLTokenizer()
 #define DEFINE_KEYWORD(keyword) m_Keywords.insert(std::make_pair(#keyword, HLSLTokenInfo(HLSLTokenType::kw_##keyword, #keyword)));
     ITERATE_HLSL_KEYWORDS(DEFINE_KEYWORD)
 #undef DEFINE_KEYWORD
+
+    for (const auto& Keyword : m_Keywords)
+        m_MaxKeywordLen = std::max(m_MaxKeywordLen, Keyword.second.Literal.length());
+}
+
+HLSLTokenType HLSLTokenizer::GetTokenType(const char* IdentifierStart, const char* IdentifierEnd) const
+{
+    const size_t Len = IdentifierEnd - IdentifierStart;
+
+    // Copy the identifier to a null-terminated buffer on the stack so that
+    // the hash map can be searched without allocating a string.
+    char Name[64];
+    VERIFY(m_MaxKeywordLen < sizeof(Name), "The buffer is too small for the longest HLSL keyword");
+    if (Len == 0 || Len > m_MaxKeywordLen || Len >= sizeof(Name))
+        return HLSLTokenType::Identifier;
+
+    memcpy(Name, IdentifierStart, Len);
+    Name[Len] = '\0';
+
+    auto KeywordIt = m_Keywords.find(HashMapStringKey{Name});
+    if (KeywordIt != m_Keywords.end())
+    {
+        VERIFY(KeywordIt->second.Literal == Name, "Inconsistent literal");
+        return KeywordIt->second.Type;
+    }
+    return HLSLTokenType::Identifier;
 }
 
 HLSLTokenizer::TokenListType HLSLTokenizer::Tokenize(const String& Source) const
@@ -57,13 +83,8 @@ HLSLTokenizer::TokenListType HLSLTokenizer::Tokenize(const String& Source) const
             },
             [&](const std::string::const_iterator& Start, const std::string::const_iterator& End) //
             {
-                auto KeywordIt = m_Keywords.find(HashMapStringKey{std::string{Start, End}});
-                if (KeywordIt != m_Keywords.end())
-                {
-                    VERIFY(std::string(Start, End) == KeywordIt->second.Literal, "Inconsistent literal");
-                    return KeywordIt->second.Type;
-                }
-                return HLSLTokenType::Identifier;
+                // Identifiers are never empty, so Start can be dereferenced
+                return GetTokenType(&*Start, &*Start + (End - Start));
             });
     }
     catch (...)
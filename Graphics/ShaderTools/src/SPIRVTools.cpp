@@ -25,10 +25,16 @@
  */
 
 #include "SPIRVTools.hpp"
+
 #include "DebugUtilities.hpp"
+#include "ThreadPool.hpp"
+#include "Timer.hpp"
 
 #include "spirv-tools/optimizer.hpp"
 
+#define XXH_STATIC_LINKING_ONLY
+#include "xxhash.h"
+
 namespace Diligent
 {
 
@@ -105,22 +111,26 @@ spv_target_env SpvTargetEnvFromSPIRV(const std::vector<uint32_t>& SPIRV)
     }
 }
 
+constexpr Uint32 CacheMagic         = 0x43545053; // SPTC
+constexpr Uint32 CacheFormatVersion = 1;
+
 } // namespace
 
-std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV, spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes)
+SPIRVOptimizer::SPIRVOptimizer(spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes, bool EnableTimeReport) :
+    m_TargetEnv{TargetEnv},
+    m_Passes{Passes},
+    m_pOptimizer{std::make_unique<spvtools::Optimizer>(TargetEnv)},
+    m_pOptions{std::make_unique<spvtools::OptimizerOptions>()}
 {
     VERIFY_EXPR(Passes != SPIRV_OPTIMIZATION_FLAG_NONE);
+    VERIFY(TargetEnv != SPV_ENV_MAX, "Target environment must be resolved");
 
-    if (TargetEnv == SPV_ENV_MAX)
-        TargetEnv = SpvTargetEnvFromSPIRV(SrcSPIRV);
-
-    spvtools::Optimizer SpirvOptimizer(TargetEnv);
+    spvtools::Optimizer& SpirvOptimizer = *m_pOptimizer;
     SpirvOptimizer.SetMessageConsumer(SpvOptimizerMessageConsumer);
 
-    spvtools::OptimizerOptions Options;
 #ifndef DILIGENT_DEVELOPMENT
     // Do not run validator in release build
-    Options.set_run_validator(false);
+    m_pOptions->set_run_validator(false);
 #endif
 
     // SPIR-V bytecode generated from HLSL must be legalized to
@@ -131,7 +141,7 @@ std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV, spv_t
 
         spvtools::ValidatorOptions ValidatorOptions;
         ValidatorOptions.SetBeforeHlslLegalization(true);
-        Options.set_validator_options(ValidatorOptions);
+        m_pOptions->set_validator_options(ValidatorOptions);
     }
 
     if (Passes & SPIRV_OPTIMIZATION_FLAG_PERFORMANCE)
@@ -146,11 +156,202 @@ std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV, spv_t
         SpirvOptimizer.RegisterPass(spvtools::CreateStripReflectInfoPass());
     }
 
+    if (EnableTimeReport)
+    {
+        m_pTimeReport = std::make_unique<std::ostringstream>();
+        SpirvOptimizer.SetTimeReport(m_pTimeReport.get());
+    }
+}
+
+SPIRVOptimizer::~SPIRVOptimizer()
+{
+}
+
+std::vector<uint32_t> SPIRVOptimizer::Run(const std::vector<uint32_t>& SrcSPIRV)
+{
+    Timer RunTimer;
+
     std::vector<uint32_t> OptimizedSPIRV;
-    if (!SpirvOptimizer.Run(SrcSPIRV.data(), SrcSPIRV.size(), &OptimizedSPIRV, Options))
+    if (!m_pOptimizer->Run(SrcSPIRV.data(), SrcSPIRV.size(), &OptimizedSPIRV, *m_pOptions))
         OptimizedSPIRV.clear();
 
+    ++m_RunCount;
+    m_TotalRunTime += RunTimer.GetElapsedTime();
+
+    return OptimizedSPIRV;
+}
+
+std::string SPIRVOptimizer::GetTimeReport() const
+{
+    return m_pTimeReport ? m_pTimeReport->str() : std::string{};
+}
+
+
+SPIRVOptimizerPool::SPIRVOptimizerPool(SPIRV_OPTIMIZATION_FLAGS Passes, bool EnableTimeReport) :
+    m_Passes{Passes},
+    m_EnableTimeReport{EnableTimeReport}
+{
+}
+
+SPIRVOptimizerPool::~SPIRVOptimizerPool()
+{
+}
+
+std::unique_ptr<SPIRVOptimizer> SPIRVOptimizerPool::Acquire(spv_target_env TargetEnv)
+{
+    {
+        std::lock_guard<std::mutex> Lock{m_Mtx};
+
+        auto it = m_FreeOptimizers.find(TargetEnv);
+        if (it != m_FreeOptimizers.end() && !it->second.empty())
+        {
+            std::unique_ptr<SPIRVOptimizer> pOptimizer = std::move(it->second.back());
+            it->second.pop_back();
+            return pOptimizer;
+        }
+    }
+
+    m_NumOptimizers.fetch_add(1);
+    return std::make_unique<SPIRVOptimizer>(TargetEnv, m_Passes, m_EnableTimeReport);
+}
+
+void SPIRVOptimizerPool::Release(std::unique_ptr<SPIRVOptimizer>&& pOptimizer)
+{
+    VERIFY_EXPR(pOptimizer && pOptimizer->GetPasses() == m_Passes);
+
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+    m_FreeOptimizers[pOptimizer->GetTargetEnv()].emplace_back(std::move(pOptimizer));
+}
+
+std::string SPIRVOptimizerPool::GetTimeReport() const
+{
+    std::lock_guard<std::mutex> Lock{m_Mtx};
+
+    std::string Report;
+    for (const auto& it : m_FreeOptimizers)
+    {
+        for (const std::unique_ptr<SPIRVOptimizer>& pOptimizer : it.second)
+            Report += pOptimizer->GetTimeReport();
+    }
+    return Report;
+}
+
+
+SPIRVOptimizationCache::SPIRVOptimizationCache(size_t MaxDataSize) :
+    ContentHashCache{"SPIR-V optimization cache", CacheMagic, CacheFormatVersion, MaxDataSize}
+{}
+
+SPIRVOptimizationCache::Key SPIRVOptimizationCache::ComputeKey(const std::vector<uint32_t>& SrcSPIRV, spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes)
+{
+    VERIFY(TargetEnv != SPV_ENV_MAX, "Target environment must be resolved");
+
+    XXH3_state_t State;
+    XXH3_128bits_reset(&State);
+
+    const Uint32 Params[] = {CacheFormatVersion, static_cast<Uint32>(TargetEnv), static_cast<Uint32>(Passes)};
+    XXH3_128bits_update(&State, Params, sizeof(Params));
+    XXH3_128bits_update(&State, SrcSPIRV.data(), SrcSPIRV.size() * sizeof(uint32_t));
+
+    const XXH128_hash_t Hash = XXH3_128bits_digest(&State);
+
+    Key CacheKey;
+    CacheKey.Low  = Hash.low64;
+    CacheKey.High = Hash.high64;
+    return CacheKey;
+}
+
+std::vector<uint32_t> OptimizeSPIRV(const std::vector<uint32_t>& SrcSPIRV, spv_target_env TargetEnv, SPIRV_OPTIMIZATION_FLAGS Passes, SPIRVOptimizationCache* pCache)
+{
+    VERIFY_EXPR(Passes != SPIRV_OPTIMIZATION_FLAG_NONE);
+
+    if (TargetEnv == SPV_ENV_MAX)
+        TargetEnv = SpvTargetEnvFromSPIRV(SrcSPIRV);
+
+    SPIRVOptimizationCache::Key CacheKey;
+    if (pCache != nullptr)
+    {
+        CacheKey = SPIRVOptimizationCache::ComputeKey(SrcSPIRV, TargetEnv, Passes);
+
+        std::vector<uint32_t> OptimizedSPIRV;
+        if (pCache->Find(CacheKey, OptimizedSPIRV))
+            return OptimizedSPIRV;
+    }
+
+    SPIRVOptimizer        Optimizer{TargetEnv, Passes};
+    std::vector<uint32_t> OptimizedSPIRV = Optimizer.Run(SrcSPIRV);
+
+    if (pCache != nullptr && !OptimizedSPIRV.empty())
+        pCache->Add(CacheKey, OptimizedSPIRV);
+
     return OptimizedSPIRV;
 }
 
+std::vector<std::vector<uint32_t>> OptimizeSPIRVBatch(const std::vector<uint32_t>* pSrcSPIRVs,
+                                                      size_t                       NumModules,
+                                                      spv_target_env               TargetEnv,
+                                                      SPIRV_OPTIMIZATION_FLAGS     Passes,
+                                                      IThreadPool*                 pThreadPool,
+                                                      SPIRVOptimizationCache*      pCache,
+                                                      std::string*                 pTimeReport)
+{
+    VERIFY_EXPR(Passes != SPIRV_OPTIMIZATION_FLAG_NONE);
+    DEV_CHECK_ERR(pSrcSPIRVs != nullptr || NumModules == 0, "pSrcSPIRVs must not be null");
+
+    std::vector<std::vector<uint32_t>> OptimizedSPIRVs(NumModules);
+    if (NumModules == 0)
+        return OptimizedSPIRVs;
+
+    // Find unique modules so that identical byte code is only optimized once
+    struct UniqueModule
+    {
+        SPIRVOptimizationCache::Key Key;
+        spv_target_env              TargetEnv = SPV_ENV_MAX;
+        std::vector<size_t>         Indices;
+    };
+    std::vector<UniqueModule> UniqueModules;
+    {
+        std::unordered_map<SPIRVOptimizationCache::Key, size_t, SPIRVOptimizationCache::Key::Hasher> KeyToUniqueIdx;
+        for (size_t i = 0; i < NumModules; ++i)
+        {
+            const spv_target_env ModuleEnv = TargetEnv != SPV_ENV_MAX ? TargetEnv : SpvTargetEnvFromSPIRV(pSrcSPIRVs[i]);
+
+            const SPIRVOptimizationCache::Key Key = SPIRVOptimizationCache::ComputeKey(pSrcSPIRVs[i], ModuleEnv, Passes);
+
+            auto it = KeyToUniqueIdx.emplace(Key, UniqueModules.size()).first;
+            if (it->second == UniqueModules.size())
+                UniqueModules.push_back({Key, ModuleEnv, {}});
+            UniqueModules[it->second].Indices.push_back(i);
+        }
+    }
+
+    SPIRVOptimizerPool OptimizerPool{Passes, pTimeReport != nullptr};
+
+    auto OptimizeModule = [&](size_t UniqueIdx) {
+        const UniqueModule&          Module   = UniqueModules[UniqueIdx];
+        const std::vector<uint32_t>& SrcSPIRV = pSrcSPIRVs[Module.Indices[0]];
+
+        std::vector<uint32_t> OptimizedSPIRV;
+        if (pCache == nullptr || !pCache->Find(Module.Key, OptimizedSPIRV))
+        {
+            std::unique_ptr<SPIRVOptimizer> pOptimizer = OptimizerPool.Acquire(Module.TargetEnv);
+            OptimizedSPIRV                             = pOptimizer->Run(SrcSPIRV);
+            OptimizerPool.Release(std::move(pOptimizer));
+
+            if (pCache != nullptr && !OptimizedSPIRV.empty())
+                pCache->Add(Module.Key, OptimizedSPIRV);
+        }
+
+        for (size_t i = 1; i < Module.Indices.size(); ++i)
+            OptimizedSPIRVs[Module.Indices[i]] = OptimizedSPIRV;
+        OptimizedSPIRVs[Module.Indices[0]] = std::move(OptimizedSPIRV);
+    };
+
+    ProcessInParallel(pThreadPool, UniqueModules.size(), OptimizeModule);
+
+    if (pTimeReport != nullptr)
+        *pTimeReport = OptimizerPool.GetTimeReport();
+
+    return OptimizedSPIRVs;
+}
+
 } // namespace Diligent
@@ -35,6 +35,7 @@
 #include "StringDataBlobImpl.hpp"
 #include "GraphicsAccessories.hpp"
 #include "ParsingTools.hpp"
+#include "StringScanTools.hpp"
 
 namespace Diligent
 {
@@ -322,7 +323,9 @@ bool FindIncludes(const char* pBuffer, size_t BufferSize, HandlerType&& IncludeH
 
             if (*pCurrPos != '#')
             {
-                ++pCurrPos;
+                // Only '/' (potential comment) and '#' may change the parsing state,
+                // so jump directly to the next one of them.
+                pCurrPos = FindFirstOf(pCurrPos + 1, pBufferEnd, '#', '/');
                 continue;
             }
 
@@ -373,9 +376,7 @@ bool FindIncludes(const char* pBuffer, size_t BufferSize, HandlerType&& IncludeH
                 throw ErrorType{pCurrPos, "\'<\' or \'\"\' is expected"};
 
             const char ClosingChar = *pCurrPos == '<' ? '>' : '"';
-            ++pCurrPos;
-            while (pCurrPos < pBufferEnd && *pCurrPos != ClosingChar)
-                ++pCurrPos;
+            pCurrPos = FindChar(pCurrPos + 1, pBufferEnd, ClosingChar);
 
             if (pCurrPos == pBufferEnd)
                 throw ErrorType{pOpenQuoteOrAngleBracket, (ClosingChar == '>' ? "Unable to find the matching angle bracket" : "Unable to find the matching closing quote")};
@@ -0,0 +1,83 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "../../Basic/interface/BasicFileWatcher.hpp"
+
+namespace Diligent
+{
+
+/// Watches a directory for file changes using inotify.
+
+/// The watcher reports files that were written, created, moved or deleted
+/// in the watched directory and, if Recursive is true, in all its subdirectories.
+/// Subdirectories created after the watcher is initialized are watched as well.
+/// Polling is non-blocking, which makes the watcher suitable for checking
+/// for changes once per frame (e.g. to trigger IRenderStateCache::Reload).
+class LinuxFileWatcher
+{
+public:
+    LinuxFileWatcher(const Char* Directory, bool Recursive = true);
+    ~LinuxFileWatcher();
+
+    // clang-format off
+    LinuxFileWatcher           (const LinuxFileWatcher&)  = delete;
+    LinuxFileWatcher& operator=(const LinuxFileWatcher&)  = delete;
+    LinuxFileWatcher           (LinuxFileWatcher&&)       = delete;
+    LinuxFileWatcher& operator=(LinuxFileWatcher&&)       = delete;
+    // clang-format on
+
+    /// Returns true if the watcher was successfully initialized.
+    bool IsValid() const
+    {
+        return m_fd >= 0;
+    }
+
+    /// Returns the list of files that changed since the last call.
+
+    /// The paths are relative to the watched directory and use '/' as the separator.
+    /// Each file is reported only once, regardless of the number of events.
+    /// The method never blocks.
+    std::vector<std::string> GetChangedFiles();
+
+private:
+    void AddWatch(const std::string& RelativeDir);
+
+private:
+    int               m_fd = -1;
+    const std::string m_Root;
+    const bool        m_Recursive;
+
+    // Watch descriptor -> directory relative to the root
+    std::unordered_map<int, std::string> m_WatchDirs;
+};
+
+} // namespace Diligent
@@ -0,0 +1,177 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "../interface/LinuxFileWatcher.hpp"
+
+#include <unistd.h>
+#include <dirent.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/inotify.h>
+
+#include <unordered_set>
+
+#include "Errors.hpp"
+#include "DebugUtilities.hpp"
+
+namespace Diligent
+{
+
+static constexpr uint32_t WatchEventMask =
+    IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE | IN_CREATE;
+
+LinuxFileWatcher::LinuxFileWatcher(const Char* Directory, bool Recursive) :
+    m_Root{Directory != nullptr ? Directory : ""},
+    m_Recursive{Recursive}
+{
+    if (m_Root.empty())
+    {
+        LOG_ERROR_MESSAGE("Directory to watch must not be empty");
+        return;
+    }
+
+    m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_fd < 0)
+    {
+        LOG_ERROR_MESSAGE("Failed to initialize inotify: ", strerror(errno));
+        return;
+    }
+
+    AddWatch("");
+    if (m_WatchDirs.empty())
+    {
+        close(m_fd);
+        m_fd = -1;
+    }
+}
+
+LinuxFileWatcher::~LinuxFileWatcher()
+{
+    if (m_fd >= 0)
+        close(m_fd);
+}
+
+void LinuxFileWatcher::AddWatch(const std::string& RelativeDir)
+{
+    const std::string FullPath = RelativeDir.empty() ? m_Root : m_Root + '/' + RelativeDir;
+
+    const int wd = inotify_add_watch(m_fd, FullPath.c_str(), WatchEventMask | IN_ONLYDIR);
+    if (wd < 0)
+    {
+        LOG_WARNING_MESSAGE("Failed to watch directory '", FullPath, "': ", strerror(errno));
+        return;
+    }
+    m_WatchDirs[wd] = RelativeDir;
+
+    if (!m_Recursive)
+        return;
+
+    DIR* pDir = opendir(FullPath.c_str());
+    if (pDir == nullptr)
+        return;
+
+    while (const dirent* pEntry = readdir(pDir))
+    {
+        if (strcmp(pEntry->d_name, ".") == 0 || strcmp(pEntry->d_name, "..") == 0)
+            continue;
+
+        bool IsDir = pEntry->d_type == DT_DIR;
+        if (pEntry->d_type == DT_UNKNOWN)
+        {
+            // Some file systems do not report the entry type
+            DIR* pSubDir = opendir((FullPath + '/' + pEntry->d_name).c_str());
+            if (pSubDir != nullptr)
+            {
+                IsDir = true;
+                closedir(pSubDir);
+            }
+        }
+
+        if (IsDir)
+            AddWatch(RelativeDir.empty() ? std::string{pEntry->d_name} : RelativeDir + '/' + pEntry->d_name);
+    }
+    closedir(pDir);
+}
+
+std::vector<std::string> LinuxFileWatcher::GetChangedFiles()
+{
+    std::vector<std::string> ChangedFiles;
+    if (m_fd < 0)
+        return ChangedFiles;
+
+    std::unordered_set<std::string> UniqueFiles;
+
+    alignas(inotify_event) char Buffer[4096];
+    for (;;)
+    {
+        const ssize_t Len = read(m_fd, Buffer, sizeof(Buffer));
+        if (Len <= 0)
+        {
+            // EAGAIN means there are no more events
+            if (Len < 0 && errno != EAGAIN && errno != EINTR)
+                LOG_WARNING_MESSAGE("Failed to read inotify events: ", strerror(errno));
+            break;
+        }
+
+        for (const char* pEvent = Buffer; pEvent < Buffer + Len;)
+        {
+            const inotify_event& Event = *reinterpret_cast<const inotify_event*>(pEvent);
+            pEvent += sizeof(inotify_event) + Event.len;
+
+            if (Event.mask & IN_IGNORED)
+            {
+                // The directory was removed or unmounted
+                m_WatchDirs.erase(Event.wd);
+                continue;
+            }
+
+            if (Event.mask & IN_Q_OVERFLOW)
+            {
+                LOG_WARNING_MESSAGE("inotify event queue overflowed in directory '", m_Root, "'. Some changes may have been missed.");
+                continue;
+            }
+
+            auto dir_it = m_WatchDirs.find(Event.wd);
+            if (dir_it == m_WatchDirs.end() || Event.len == 0)
+                continue;
+
+            std::string RelativePath = dir_it->second.empty() ? std::string{Event.name} : dir_it->second + '/' + Event.name;
+            if (Event.mask & IN_ISDIR)
+            {
+                if (m_Recursive && (Event.mask & (IN_CREATE | IN_MOVED_TO)))
+                    AddWatch(RelativePath);
+                continue;
+            }
+
+            if (UniqueFiles.insert(RelativePath).second)
+                ChangedFiles.emplace_back(std::move(RelativePath));
+        }
+    }
+
+    return ChangedFiles;
+}
+
+} // namespace Diligent
@@ -34,3 +34,14 @@
 #if DILIGENT_AVX2_SUPPORTED && defined(__AVX2__)
 #    define DILIGENT_AVX2_ENABLED 1
 #endif
+
+// SSE2 is always available on x64, MSVC defines _M_IX86_FP >= 2 when targeting x86 with SSE2
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define DILIGENT_SSE2_ENABLED 1
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define DILIGENT_NEON_ENABLED 1
+#endif
@@ -25,6 +25,8 @@
  */
 
 #include <array>
+#include <cstring>
+#include <string>
 #include <unordered_set>
 
 #include "GPUTestingEnvironment.hpp"
@@ -1562,6 +1564,126 @@ TEST(ArchiveTest, ComputePipeline_SplitArchive_Async)
     TestComputePipeline(PSO_ARCHIVE_FLAG_DO_NOT_PACK_SIGNATURES, /*CompileAsync = */ true);
 }
 
+// Serializes the same compute pipelines with and without the shader compilation thread pool.
+// Asynchronous pipelines with explicit signatures are patched for every device type in parallel
+// when the thread pool is available, which must not change the resulting archive.
+TEST(ArchiveTest, ComputePipeline_ParallelSerialization)
+{
+    GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice          = pEnv->GetDevice();
+    IArchiverFactory*      pArchiverFactory = pEnv->GetArchiverFactory();
+
+    if (!pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+        GTEST_SKIP() << "Compute shaders are not supported by device";
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    ARCHIVE_DEVICE_DATA_FLAGS DeviceBits = GetDeviceBits();
+#if PLATFORM_MACOS
+    // Compute shaders are not supported in OpenGL on MacOS
+    DeviceBits &= ~(ARCHIVE_DEVICE_DATA_FLAG_GL | ARCHIVE_DEVICE_DATA_FLAG_GLES);
+#endif
+
+    auto SerializeArchive = [&](bool Parallel) {
+        RefCntAutoPtr<IDataBlob> pArchive;
+
+        SerializationDeviceCreateInfo SerDeviceCI;
+        SerDeviceCI.DeviceInfo.Features.SeparablePrograms = pDevice->GetDeviceInfo().Features.SeparablePrograms;
+        SerDeviceCI.NumAsyncShaderCompilationThreads      = Parallel ? 4 : 0;
+        RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
+        pArchiverFactory->CreateSerializationDevice(SerDeviceCI, &pSerializationDevice);
+        if (pSerializationDevice == nullptr)
+        {
+            ADD_FAILURE() << "Failed to create serialization device";
+            return pArchive;
+        }
+
+        RefCntAutoPtr<IArchiver> pArchiver;
+        pArchiverFactory->CreateArchiver(pSerializationDevice, &pArchiver);
+        if (pArchiver == nullptr)
+        {
+            ADD_FAILURE() << "Failed to create archiver";
+            return pArchive;
+        }
+
+        constexpr PipelineResourceDesc Resources[] = {
+            {SHADER_TYPE_COMPUTE, "g_tex2DUAV", 1, SHADER_RESOURCE_TYPE_TEXTURE_UAV, SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC, PIPELINE_RESOURCE_FLAG_NONE, {WEB_GPU_BINDING_TYPE_WRITE_ONLY_TEXTURE_UAV, RESOURCE_DIM_TEX_2D, TEX_FORMAT_RGBA8_UNORM}},
+        };
+
+        PipelineResourceSignatureDesc PRSDesc;
+        PRSDesc.Name         = "ArchiveTest.ComputePipeline_ParallelSerialization - PRS";
+        PRSDesc.Resources    = Resources;
+        PRSDesc.NumResources = _countof(Resources);
+
+        RefCntAutoPtr<IPipelineResourceSignature> pSerializedPRS;
+        pSerializationDevice->CreatePipelineResourceSignature(PRSDesc, ResourceSignatureArchiveInfo{DeviceBits}, &pSerializedPRS);
+        if (pSerializedPRS == nullptr)
+        {
+            ADD_FAILURE() << "Failed to create serialized resource signature";
+            return pArchive;
+        }
+
+        ShaderCreateInfo ShaderCI;
+        // The create flags are recorded in the archive, so they must be the same in both runs.
+        // Without the thread pool, the asynchronous flags are ignored and everything runs serially.
+        ShaderCI.CompileFlags = SHADER_COMPILE_FLAG_ASYNCHRONOUS;
+        RefCntAutoPtr<IShader> pSerializedCS;
+        CreateComputeShader(pDevice, pSerializationDevice, ShaderCI, nullptr, &pSerializedCS);
+        if (pSerializedCS == nullptr)
+        {
+            ADD_FAILURE() << "Failed to create serialized compute shader";
+            return pArchive;
+        }
+
+        // Several pipelines share the shader, so that shader deduplication is also covered.
+        // Both synchronous and asynchronous pipelines patch shaders in parallel when the thread pool is available.
+        constexpr Uint32 NumPSOs = 4;
+        for (Uint32 i = 0; i < NumPSOs; ++i)
+        {
+            const std::string PSOName = "ArchiveTest.ComputePipeline_ParallelSerialization - PSO " + std::to_string(i);
+
+            ComputePipelineStateCreateInfo PSOCreateInfo;
+            PSOCreateInfo.PSODesc.Name         = PSOName.c_str();
+            PSOCreateInfo.PSODesc.PipelineType = PIPELINE_TYPE_COMPUTE;
+            PSOCreateInfo.pCS                  = pSerializedCS;
+            PSOCreateInfo.Flags                = (i % 2 == 0) ? PSO_CREATE_FLAG_ASYNCHRONOUS : PSO_CREATE_FLAG_NONE;
+
+            IPipelineResourceSignature* Signatures[] = {pSerializedPRS};
+            PSOCreateInfo.ResourceSignaturesCount    = _countof(Signatures);
+            PSOCreateInfo.ppResourceSignatures       = Signatures;
+
+            PipelineStateArchiveInfo ArchiveInfo;
+            ArchiveInfo.DeviceFlags = DeviceBits;
+
+            RefCntAutoPtr<IPipelineState> pSerializedPSO;
+            pSerializationDevice->CreateComputePipelineState(PSOCreateInfo, ArchiveInfo, &pSerializedPSO);
+            if (pSerializedPSO == nullptr)
+            {
+                ADD_FAILURE() << "Failed to create serialized pipeline " << PSOName;
+                return pArchive;
+            }
+            EXPECT_EQ(pSerializedPSO->GetStatus(/*WaitForCompletion = */ true), PIPELINE_STATE_STATUS_READY);
+            EXPECT_TRUE(pArchiver->AddPipelineState(pSerializedPSO));
+        }
+
+        pArchiver->SerializeToBlob(ContentVersion, &pArchive);
+        return pArchive;
+    };
+
+    RefCntAutoPtr<IDataBlob> pSerialArchive = SerializeArchive(/*Parallel = */ false);
+    ASSERT_NE(pSerialArchive, nullptr);
+
+    RefCntAutoPtr<IDataBlob> pParallelArchive = SerializeArchive(/*Parallel = */ true);
+    ASSERT_NE(pParallelArchive, nullptr);
+
+    ASSERT_EQ(pParallelArchive->GetSize(), pSerialArchive->GetSize());
+    EXPECT_EQ(std::memcmp(pParallelArchive->GetConstDataPtr(), pSerialArchive->GetConstDataPtr(), pSerialArchive->GetSize()), 0)
+        << "Archives produced by the serial and parallel paths are not byte-identical";
+}
+
 void TestRayTracingPipeline(bool CompileAsync = false)
 {
     GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
@@ -2771,4 +2893,107 @@ TEST(ArchiveTest, MergeArchives)
     }
 }
 
+TEST(ArchiveTest, UpdateArchive)
+{
+    GPUTestingEnvironment* pEnv             = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice          = pEnv->GetDevice();
+    IArchiverFactory*      pArchiverFactory = pEnv->GetArchiverFactory();
+
+    GPUTestingEnvironment::ScopedReleaseResources AutoreleaseResources;
+
+    RefCntAutoPtr<IDearchiver> pDearchiver;
+    DearchiverCreateInfo       DearchiverCI{};
+    pDevice->GetEngineFactory()->CreateDearchiver(DearchiverCI, &pDearchiver);
+    if (!pDearchiver || !pArchiverFactory)
+        GTEST_SKIP() << "Archiver library is not loaded";
+
+    SerializationDeviceCreateInfo SerDeviceCI;
+    SerDeviceCI.DeviceInfo.Features.SeparablePrograms = pDevice->GetDeviceInfo().Features.SeparablePrograms;
+    RefCntAutoPtr<ISerializationDevice> pSerializationDevice;
+    pArchiverFactory->CreateSerializationDevice(SerDeviceCI, &pSerializationDevice);
+    ASSERT_NE(pSerializationDevice, nullptr);
+
+    RefCntAutoPtr<IArchiver> pArchiver;
+    pArchiverFactory->CreateArchiver(pSerializationDevice, &pArchiver);
+    ASSERT_NE(pArchiver, nullptr);
+
+    ShaderCreateInfo       VsCI;
+    ShaderCreateInfo       PsCI;
+    RefCntAutoPtr<IShader> pSerVS;
+    RefCntAutoPtr<IShader> pSerPS;
+    CreateGraphicsShaders(pDevice, pSerializationDevice, VsCI, nullptr, &pSerVS, PsCI, nullptr, &pSerPS);
+    ASSERT_NE(pSerVS, nullptr);
+    ASSERT_NE(pSerPS, nullptr);
+
+    RefCntAutoPtr<IDataBlob> pSrcArchive;
+    {
+        EXPECT_TRUE(pArchiver->AddShader(pSerVS));
+        EXPECT_TRUE(pArchiver->AddShader(pSerPS));
+
+        pArchiver->SerializeToBlob(ContentVersion, &pSrcArchive);
+        ASSERT_NE(pSrcArchive, nullptr);
+        pArchiver->Reset();
+    }
+
+    ShaderCreateInfo         CsCI;
+    RefCntAutoPtr<IDataBlob> pUpdateArchive;
+    {
+        RefCntAutoPtr<IShader> pSerCS;
+        CreateComputeShader(pDevice, pSerializationDevice, CsCI, nullptr, &pSerCS);
+        ASSERT_NE(pSerCS, nullptr);
+
+        // The pixel shader is the same as in the source archive and must replace it
+        EXPECT_TRUE(pArchiver->AddShader(pSerCS));
+        EXPECT_TRUE(pArchiver->AddShader(pSerPS));
+
+        pArchiver->SerializeToBlob(ContentVersion, &pUpdateArchive);
+        ASSERT_NE(pUpdateArchive, nullptr);
+        pArchiver->Reset();
+    }
+
+    RefCntAutoPtr<IDataBlob> pArchive;
+    {
+        const Char* RemovedResources[] = {VsCI.Desc.Name};
+        EXPECT_TRUE(pArchiverFactory->UpdateArchive(pSrcArchive, pUpdateArchive, RemovedResources, _countof(RemovedResources), &pArchive));
+        ASSERT_NE(pArchive, nullptr);
+        EXPECT_TRUE(pArchiverFactory->PrintArchiveContent(pArchive));
+    }
+    // The vertex shader is removed and the pixel shader is deduplicated, so the resulting archive
+    // contains exactly the same resources and shaders as the update archive. A duplicate pixel shader
+    // or the byte code of the removed vertex shader would increase the size.
+    EXPECT_EQ(pArchive->GetSize(), pUpdateArchive->GetSize());
+
+    pSrcArchive.Release();
+    pUpdateArchive.Release();
+
+    pDearchiver->LoadArchive(pArchive, ContentVersion);
+
+    auto UnpackShader = [&](const ShaderCreateInfo& CI) {
+        RefCntAutoPtr<IShader> pUnpackedShader;
+
+        ShaderUnpackInfo UnpackInfo;
+        UnpackInfo.Name    = CI.Desc.Name;
+        UnpackInfo.pDevice = pDevice;
+
+        pDearchiver->UnpackShader(UnpackInfo, &pUnpackedShader);
+        return pUnpackedShader;
+    };
+
+    {
+        RefCntAutoPtr<IShader> pPS = UnpackShader(PsCI);
+        ASSERT_NE(pPS, nullptr);
+        EXPECT_EQ(pPS->GetDesc(), PsCI.Desc);
+    }
+    {
+        RefCntAutoPtr<IShader> pCS = UnpackShader(CsCI);
+        ASSERT_NE(pCS, nullptr);
+        EXPECT_EQ(pCS->GetDesc(), CsCI.Desc);
+    }
+    {
+        // The vertex shader has been removed
+        RefCntAutoPtr<IShader> pVS = UnpackShader(VsCI);
+        EXPECT_EQ(pVS, nullptr);
+    }
+}
+
 } // namespace
@@ -28,6 +28,11 @@
 #include "GPUTestingEnvironment.hpp"
 #include "TestingSwapChainBase.hpp"
 #include "GraphicsTypesX.hpp"
+#include "MapHelper.hpp"
+
+#if VULKAN_SUPPORTED
+#    include "RenderDeviceVk.h"
+#endif
 
 #include "gtest/gtest.h"
 
@@ -621,4 +626,192 @@ TEST(ComputeShaderTest, FillTexturePS_Signatures)
     pSwapChain->Present();
 }
 
+#if VULKAN_SUPPORTED
+// Tests that with descriptor buffers, static/mutable sets that are written when resources are bound
+// and dynamic sets that are written at every commit reference the correct resources.
+TEST(ComputeShaderTest, DescriptorBufferSets)
+{
+    GPUTestingEnvironment*  pEnv       = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*          pDevice    = pEnv->GetDevice();
+    const RenderDeviceInfo& DeviceInfo = pDevice->GetDeviceInfo();
+    if (!DeviceInfo.IsVulkanDevice())
+    {
+        GTEST_SKIP() << "Descriptor buffers are only supported in Vulkan";
+    }
+    if (!DeviceInfo.Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    DeviceFeaturesVk FeaturesVk;
+    RefCntAutoPtr<IRenderDeviceVk>{pDevice, IID_RenderDeviceVk}->GetDeviceFeaturesVk(FeaturesVk);
+    if (!FeaturesVk.DescriptorBuffer)
+    {
+        GTEST_SKIP() << "Descriptor buffers are not enabled";
+    }
+
+    IDeviceContext* pContext = pEnv->GetDeviceContext();
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    static constexpr char CSSource[] = R"(
+cbuffer cbConstants
+{
+    uint4 g_Base;
+}
+
+cbuffer cbIndex
+{
+    uint4 g_Index;
+}
+
+RWStructuredBuffer<uint> g_Output;
+
+[numthreads(1, 1, 1)]
+void main()
+{
+    g_Output[g_Index.x] = g_Base.x + g_Index.y;
+}
+)";
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.Desc           = {"Descriptor buffer sets test - CS", SHADER_TYPE_COMPUTE, true};
+    ShaderCI.EntryPoint     = "main";
+    ShaderCI.Source         = CSSource;
+    RefCntAutoPtr<IShader> pCS;
+    pDevice->CreateShader(ShaderCI, &pCS);
+    ASSERT_NE(pCS, nullptr);
+
+    ShaderResourceVariableDesc Vars[] = {{SHADER_TYPE_COMPUTE, "cbIndex", SHADER_RESOURCE_VARIABLE_TYPE_DYNAMIC}};
+
+    ComputePipelineStateCreateInfo PSOCreateInfo;
+    PSOCreateInfo.PSODesc.Name                               = "Descriptor buffer sets test";
+    PSOCreateInfo.PSODesc.PipelineType                       = PIPELINE_TYPE_COMPUTE;
+    PSOCreateInfo.PSODesc.ResourceLayout.DefaultVariableType = SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE;
+    PSOCreateInfo.PSODesc.ResourceLayout.Variables           = Vars;
+    PSOCreateInfo.PSODesc.ResourceLayout.NumVariables        = _countof(Vars);
+    PSOCreateInfo.pCS                                        = pCS;
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    pDevice->CreateComputePipelineState(PSOCreateInfo, &pPSO);
+    ASSERT_NE(pPSO, nullptr);
+
+    auto CreateConstBuffer = [&](const char* Name, USAGE Usage, Uint32 Base) {
+        const Uint32 Data[4] = {Base, 0, 0, 0};
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = Name;
+        BuffDesc.Usage          = Usage;
+        BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+        BuffDesc.CPUAccessFlags = Usage == USAGE_DYNAMIC ? CPU_ACCESS_WRITE : CPU_ACCESS_NONE;
+        BuffDesc.Size           = sizeof(Data);
+
+        BufferData InitData{Data, sizeof(Data)};
+
+        RefCntAutoPtr<IBuffer> pBuffer;
+        pDevice->CreateBuffer(BuffDesc, Usage == USAGE_DYNAMIC ? nullptr : &InitData, &pBuffer);
+        if (pBuffer && Usage == USAGE_DYNAMIC)
+        {
+            MapHelper<Uint32> pMapped{pContext, pBuffer, MAP_WRITE, MAP_FLAG_DISCARD};
+            memcpy(pMapped, Data, sizeof(Data));
+        }
+        return pBuffer;
+    };
+
+    RefCntAutoPtr<IBuffer> pConstants100 = CreateConstBuffer("Descriptor buffer sets test - constants 100", USAGE_DEFAULT, 100);
+    ASSERT_NE(pConstants100, nullptr);
+    RefCntAutoPtr<IBuffer> pConstants300 = CreateConstBuffer("Descriptor buffer sets test - constants 300", USAGE_DEFAULT, 300);
+    ASSERT_NE(pConstants300, nullptr);
+    RefCntAutoPtr<IBuffer> pIndex = CreateConstBuffer("Descriptor buffer sets test - index", USAGE_DYNAMIC, 0);
+    ASSERT_NE(pIndex, nullptr);
+
+    static constexpr Uint32 NumDispatches = 6;
+
+    RefCntAutoPtr<IBuffer> pOutput;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name              = "Descriptor buffer sets test - output";
+        BuffDesc.Usage             = USAGE_DEFAULT;
+        BuffDesc.BindFlags         = BIND_UNORDERED_ACCESS;
+        BuffDesc.Mode              = BUFFER_MODE_STRUCTURED;
+        BuffDesc.ElementByteStride = sizeof(Uint32);
+        BuffDesc.Size              = sizeof(Uint32) * NumDispatches;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pOutput);
+        ASSERT_NE(pOutput, nullptr);
+    }
+
+    RefCntAutoPtr<IBuffer> pStagingBuff;
+    {
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = "Descriptor buffer sets test - staging";
+        BuffDesc.Usage          = USAGE_STAGING;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_READ;
+        BuffDesc.Size           = sizeof(Uint32) * NumDispatches;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &pStagingBuff);
+        ASSERT_NE(pStagingBuff, nullptr);
+    }
+
+    // The static/mutable set of SRB1 only references a default buffer and is kept in persistent memory.
+    RefCntAutoPtr<IShaderResourceBinding> pSRB1;
+    pPSO->CreateShaderResourceBinding(&pSRB1, true);
+    ASSERT_NE(pSRB1, nullptr);
+    pSRB1->GetVariableByName(SHADER_TYPE_COMPUTE, "cbConstants")->Set(pConstants100);
+    pSRB1->GetVariableByName(SHADER_TYPE_COMPUTE, "cbIndex")->Set(pIndex);
+    pSRB1->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Output")->Set(pOutput->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+
+    // The static/mutable set of SRB2 references a dynamic buffer and is written at every commit.
+    RefCntAutoPtr<IBuffer> pConstants200 = CreateConstBuffer("Descriptor buffer sets test - constants 200", USAGE_DYNAMIC, 200);
+    ASSERT_NE(pConstants200, nullptr);
+    RefCntAutoPtr<IShaderResourceBinding> pSRB2;
+    pPSO->CreateShaderResourceBinding(&pSRB2, true);
+    ASSERT_NE(pSRB2, nullptr);
+    pSRB2->GetVariableByName(SHADER_TYPE_COMPUTE, "cbConstants")->Set(pConstants200);
+    pSRB2->GetVariableByName(SHADER_TYPE_COMPUTE, "cbIndex")->Set(pIndex);
+    pSRB2->GetVariableByName(SHADER_TYPE_COMPUTE, "g_Output")->Set(pOutput->GetDefaultView(BUFFER_VIEW_UNORDERED_ACCESS));
+
+    auto Dispatch = [&](Uint32 Index) {
+        {
+            MapHelper<Uint32> pMapped{pContext, pIndex, MAP_WRITE, MAP_FLAG_DISCARD};
+            pMapped[0] = Index;
+            pMapped[1] = Index;
+        }
+        pContext->DispatchCompute(DispatchComputeAttribs{1, 1, 1});
+    };
+
+    pContext->SetPipelineState(pPSO);
+
+    // Dynamic buffer offset changes must be picked up without recommitting the SRB
+    pContext->CommitShaderResources(pSRB1, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    Dispatch(0);
+    Dispatch(1);
+    Dispatch(2);
+
+    pContext->CommitShaderResources(pSRB2, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    Dispatch(3);
+
+    pContext->CommitShaderResources(pSRB1, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    Dispatch(4);
+
+    // Similar to descriptor sets, the persistent set data must not be overwritten while it is in use by the GPU
+    pContext->WaitForIdle();
+    pSRB1->GetVariableByName(SHADER_TYPE_COMPUTE, "cbConstants")->Set(pConstants300, SET_SHADER_RESOURCE_FLAG_ALLOW_OVERWRITE);
+    pContext->CommitShaderResources(pSRB1, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    Dispatch(5);
+
+    pContext->CopyBuffer(pOutput, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, pStagingBuff, 0, sizeof(Uint32) * NumDispatches, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    pContext->WaitForIdle();
+
+    const Uint32 RefData[NumDispatches] = {100, 101, 102, 203, 104, 305};
+
+    void* pData = nullptr;
+    pContext->MapBuffer(pStagingBuff, MAP_READ, MAP_FLAG_DO_NOT_WAIT, pData);
+    ASSERT_NE(pData, nullptr);
+    for (Uint32 i = 0; i < NumDispatches; ++i)
+        EXPECT_EQ(static_cast<const Uint32*>(pData)[i], RefData[i]) << "i = " << i;
+    pContext->UnmapBuffer(pStagingBuff, MAP_READ);
+}
+#endif
+
 } // namespace
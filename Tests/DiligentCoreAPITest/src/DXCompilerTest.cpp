@@ -31,6 +31,9 @@
 
 #include "gtest/gtest.h"
 
+#include <thread>
+#include <vector>
+
 #include <atlcomcli.h>
 #include <d3d12shader.h>
 
@@ -193,6 +196,64 @@ TEST(DXCompilerTest, Reflection)
     }
 }
 
+// Compiler instances are pooled and reused across compilations, check that
+// concurrent and repeated compilations produce identical results.
+TEST(DXCompilerTest, ParallelCompile)
+{
+    auto pDXC = CreateDXCompiler(DXCompilerTarget::Direct3D12, 0, nullptr);
+    ASSERT_TRUE(pDXC);
+    if (pDXC->GetMaxShaderModel() < ShaderVersion{6, 3})
+        GTEST_SKIP() << "Shader model 6.3 is not supported";
+
+    const auto Compile = [&pDXC](CComPtr<IDxcBlob>& pDXIL) {
+        IDXCompiler::CompileAttribs CA;
+        CA.Source       = ReflectionTest_RG.c_str();
+        CA.SourceLength = static_cast<Uint32>(ReflectionTest_RG.length());
+        CA.EntryPoint   = L"main";
+        CA.Profile      = L"lib_6_3";
+        CA.pArgs        = DXCArgs;
+        CA.ArgsCount    = _countof(DXCArgs);
+
+        DxcDefine Defines[] = {{L"ASSIGN_BINDINGS", L"1"}};
+        CA.pDefines         = Defines;
+        CA.DefinesCount     = _countof(Defines);
+
+        CComPtr<IDxcBlob> pOutput;
+        CA.ppBlobOut        = &pDXIL.p;
+        CA.ppCompilerOutput = &pOutput.p;
+        return pDXC->Compile(CA);
+    };
+
+    CComPtr<IDxcBlob> pRefDXIL;
+    ASSERT_TRUE(Compile(pRefDXIL));
+    ASSERT_TRUE(pRefDXIL);
+
+    constexpr size_t NumThreads               = 4;
+    constexpr size_t NumCompilationsPerThread = 4;
+
+    std::vector<std::vector<CComPtr<IDxcBlob>>> DXILs(NumThreads, std::vector<CComPtr<IDxcBlob>>(NumCompilationsPerThread));
+    std::vector<std::thread>                    Threads;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&Compile, &ThreadDXILs = DXILs[t]]() {
+            for (CComPtr<IDxcBlob>& pDXIL : ThreadDXILs)
+                Compile(pDXIL);
+        });
+    }
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    for (const std::vector<CComPtr<IDxcBlob>>& ThreadDXILs : DXILs)
+    {
+        for (const CComPtr<IDxcBlob>& pDXIL : ThreadDXILs)
+        {
+            ASSERT_TRUE(pDXIL);
+            ASSERT_EQ(pDXIL->GetBufferSize(), pRefDXIL->GetBufferSize());
+            EXPECT_EQ(memcmp(pDXIL->GetBufferPointer(), pRefDXIL->GetBufferPointer(), pRefDXIL->GetBufferSize()), 0);
+        }
+    }
+}
+
 TEST(DXCompilerTest, RemapBindingsRG)
 {
     auto pDXC = CreateDXCompiler(DXCompilerTarget::Direct3D12, 0, nullptr);
@@ -2468,6 +2468,86 @@ TEST_F(DrawCommandTest, DeferredContexts)
 }
 
 
+// Pipelines that share shaders and differ only in some states may share parts of
+// the backend pipeline objects (e.g. graphics pipeline libraries in Vulkan).
+// Check that such pipelines render correctly and that the shared parts are
+// correctly released and re-created.
+TEST_F(DrawCommandTest, PipelinesWithSharedShaders)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    GraphicsPipelineStateCreateInfo PSOCreateInfo;
+
+    auto& PSODesc          = PSOCreateInfo.PSODesc;
+    auto& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+
+    PSODesc.PipelineType                          = PIPELINE_TYPE_GRAPHICS;
+    GraphicsPipeline.NumRenderTargets             = 1;
+    GraphicsPipeline.RTVFormats[0]                = pSwapChain->GetDesc().ColorBufferFormat;
+    GraphicsPipeline.PrimitiveTopology            = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    GraphicsPipeline.RasterizerDesc.CullMode      = CULL_MODE_NONE;
+    GraphicsPipeline.DepthStencilDesc.DepthEnable = False;
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+    ShaderCI.EntryPoint     = "main";
+
+    RefCntAutoPtr<IShader> pVS;
+    {
+        ShaderCI.Desc   = {"Shared shaders test vertex shader", SHADER_TYPE_VERTEX, true};
+        ShaderCI.Source = HLSL::DrawTest_ProceduralTriangleVS.c_str();
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+    }
+
+    RefCntAutoPtr<IShader> pPS;
+    {
+        ShaderCI.Desc   = {"Shared shaders test pixel shader", SHADER_TYPE_PIXEL, true};
+        ShaderCI.Source = HLSL::DrawTest_PS.c_str();
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+    }
+
+    PSOCreateInfo.pVS = pVS;
+    PSOCreateInfo.pPS = pPS;
+
+    auto CreatePSO = [&](const char* Name, COLOR_MASK WriteMask) {
+        PSODesc.Name                                                      = Name;
+        GraphicsPipeline.BlendDesc.RenderTargets[0].RenderTargetWriteMask = WriteMask;
+
+        RefCntAutoPtr<IPipelineState> pNewPSO;
+        pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pNewPSO);
+        return pNewPSO;
+    };
+
+    // The pipelines only differ in the blend state
+    RefCntAutoPtr<IPipelineState> pMaskedPSO = CreatePSO("Shared shaders test - masked", COLOR_MASK_NONE);
+    ASSERT_NE(pMaskedPSO, nullptr);
+    RefCntAutoPtr<IPipelineState> pPSO = CreatePSO("Shared shaders test", COLOR_MASK_ALL);
+    ASSERT_NE(pPSO, nullptr);
+
+    // Release the pipeline and create it again while the shared parts are still used by the masked pipeline
+    pPSO.Release();
+    pPSO = CreatePSO("Shared shaders test - recreated", COLOR_MASK_ALL);
+    ASSERT_NE(pPSO, nullptr);
+
+    SetRenderTargets(pMaskedPSO);
+
+    DrawAttribs drawAttrs{6, DRAW_FLAG_VERIFY_ALL};
+    // Draw with all color writes disabled first. This must not affect the render target.
+    pContext->Draw(drawAttrs);
+
+    pContext->SetPipelineState(pPSO);
+    pContext->Draw(drawAttrs);
+
+    Present();
+}
+
+
 void DrawCommandTest::TestDynamicBufferUpdates(IShader*                      pVS,
                                                IShader*                      pPS,
                                                IBuffer*                      pDynamicCB0,
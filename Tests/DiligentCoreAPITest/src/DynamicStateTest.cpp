@@ -0,0 +1,419 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include <cstring>
+
+#include "GPUTestingEnvironment.hpp"
+#include "MapHelper.hpp"
+
+#if VULKAN_SUPPORTED
+#    include "RenderDeviceVk.h"
+#    include "DeviceContextVk.h"
+#endif
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+#if VULKAN_SUPPORTED
+
+static constexpr char DynamicStateTestHLSL[] = R"(
+cbuffer cbDraw
+{
+    float4 g_Color;
+    float4 g_Depth;
+}
+
+struct PSInput
+{
+    float4 Pos : SV_POSITION;
+};
+
+void VSMain(in uint VertId : SV_VertexID, out PSInput PSIn)
+{
+    float2 Pos[3];
+    Pos[0] = float2(-1.0, -1.0);
+    Pos[1] = float2(-1.0, +3.0);
+    Pos[2] = float2(+3.0, -1.0);
+    PSIn.Pos = float4(Pos[VertId], g_Depth.x, 1.0);
+}
+
+float4 PSMain(in PSInput PSIn) : SV_Target
+{
+    return g_Color;
+}
+)";
+
+constexpr Uint32 TestRTSize = 4;
+
+// RGBA8 colors packed the same way as they are stored in the render target
+constexpr Uint32 Black = 0xFF000000u;
+constexpr Uint32 Red   = 0xFF0000FFu;
+constexpr Uint32 Green = 0xFF00FF00u;
+constexpr Uint32 Blue  = 0xFFFF0000u;
+
+float4 UnpackColor(Uint32 Color)
+{
+    return float4{
+        static_cast<float>((Color >> 0u) & 0xFFu) / 255.f,
+        static_cast<float>((Color >> 8u) & 0xFFu) / 255.f,
+        static_cast<float>((Color >> 16u) & 0xFFu) / 255.f,
+        static_cast<float>((Color >> 24u) & 0xFFu) / 255.f,
+    };
+}
+
+class DynamicStateTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GPUTestingEnvironment* pEnv    = GPUTestingEnvironment::GetInstance();
+        IRenderDevice*         pDevice = pEnv->GetDevice();
+        if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+            return;
+
+        DeviceFeaturesVk FeaturesVk;
+        RefCntAutoPtr<IRenderDeviceVk>{pDevice, IID_RenderDeviceVk}->GetDeviceFeaturesVk(FeaturesVk);
+        if (!FeaturesVk.ExtendedDynamicState)
+            return;
+
+        TextureDesc TexDesc;
+        TexDesc.Name      = "Dynamic state test render target";
+        TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+        TexDesc.Width     = TestRTSize;
+        TexDesc.Height    = TestRTSize;
+        TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+        TexDesc.BindFlags = BIND_RENDER_TARGET;
+        pDevice->CreateTexture(TexDesc, nullptr, &sm_pRT);
+        ASSERT_NE(sm_pRT, nullptr);
+
+        TexDesc.Name      = "Dynamic state test depth buffer";
+        TexDesc.Format    = TEX_FORMAT_D32_FLOAT;
+        TexDesc.BindFlags = BIND_DEPTH_STENCIL;
+        pDevice->CreateTexture(TexDesc, nullptr, &sm_pDepth);
+        ASSERT_NE(sm_pDepth, nullptr);
+
+        TexDesc.Name           = "Dynamic state test staging texture";
+        TexDesc.Format         = TEX_FORMAT_RGBA8_UNORM;
+        TexDesc.BindFlags      = BIND_NONE;
+        TexDesc.Usage          = USAGE_STAGING;
+        TexDesc.CPUAccessFlags = CPU_ACCESS_READ;
+        pDevice->CreateTexture(TexDesc, nullptr, &sm_pStagingTex);
+        ASSERT_NE(sm_pStagingTex, nullptr);
+
+        BufferDesc BuffDesc;
+        BuffDesc.Name           = "Dynamic state test constants";
+        BuffDesc.Usage          = USAGE_DYNAMIC;
+        BuffDesc.BindFlags      = BIND_UNIFORM_BUFFER;
+        BuffDesc.CPUAccessFlags = CPU_ACCESS_WRITE;
+        BuffDesc.Size           = sizeof(float4) * 2;
+        pDevice->CreateBuffer(BuffDesc, nullptr, &sm_pConstants);
+        ASSERT_NE(sm_pConstants, nullptr);
+
+        ShaderCreateInfo ShaderCI;
+        ShaderCI.SourceLanguage = SHADER_SOURCE_LANGUAGE_HLSL;
+        ShaderCI.ShaderCompiler = pEnv->GetDefaultCompiler(ShaderCI.SourceLanguage);
+        ShaderCI.Source         = DynamicStateTestHLSL;
+
+        RefCntAutoPtr<IShader> pVS;
+        ShaderCI.Desc       = {"Dynamic state test - VS", SHADER_TYPE_VERTEX, true};
+        ShaderCI.EntryPoint = "VSMain";
+        pDevice->CreateShader(ShaderCI, &pVS);
+        ASSERT_NE(pVS, nullptr);
+
+        RefCntAutoPtr<IShader> pPS;
+        ShaderCI.Desc       = {"Dynamic state test - PS", SHADER_TYPE_PIXEL, true};
+        ShaderCI.EntryPoint = "PSMain";
+        pDevice->CreateShader(ShaderCI, &pPS);
+        ASSERT_NE(pPS, nullptr);
+
+        GraphicsPipelineStateCreateInfo PSOCreateInfo;
+        PSOCreateInfo.pVS = pVS;
+        PSOCreateInfo.pPS = pPS;
+
+        GraphicsPipelineDesc& GraphicsPipeline = PSOCreateInfo.GraphicsPipeline;
+        GraphicsPipeline.NumRenderTargets      = 1;
+        GraphicsPipeline.RTVFormats[0]         = TEX_FORMAT_RGBA8_UNORM;
+        GraphicsPipeline.DSVFormat             = TEX_FORMAT_D32_FLOAT;
+        GraphicsPipeline.PrimitiveTopology     = PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+        // The pipeline states are chosen so that every draw is visible unless
+        // the dynamic states are used.
+        GraphicsPipeline.RasterizerDesc.CullMode           = CULL_MODE_NONE;
+        GraphicsPipeline.DepthStencilDesc.DepthEnable      = False;
+        GraphicsPipeline.DepthStencilDesc.DepthWriteEnable = False;
+
+        auto CreatePSO = [&](const char* Name, PIPELINE_DYNAMIC_STATE_FLAGS DynamicStates, RefCntAutoPtr<IPipelineState>& pPSO, RefCntAutoPtr<IShaderResourceBinding>& pSRB) {
+            PSOCreateInfo.PSODesc.Name     = Name;
+            GraphicsPipeline.DynamicStates = DynamicStates;
+            pDevice->CreateGraphicsPipelineState(PSOCreateInfo, &pPSO);
+            ASSERT_NE(pPSO, nullptr);
+
+            for (SHADER_TYPE ShaderType : {SHADER_TYPE_VERTEX, SHADER_TYPE_PIXEL})
+            {
+                IShaderResourceVariable* pVar = pPSO->GetStaticVariableByName(ShaderType, "cbDraw");
+                ASSERT_NE(pVar, nullptr);
+                pVar->Set(sm_pConstants);
+            }
+            pPSO->CreateShaderResourceBinding(&pSRB, true);
+            ASSERT_NE(pSRB, nullptr);
+        };
+
+        CreatePSO("Dynamic state test - dynamic PSO",
+                  PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE |
+                      PIPELINE_DYNAMIC_STATE_FLAG_FRONT_FACE |
+                      PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_TEST |
+                      PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_WRITE |
+                      PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_FUNC,
+                  sm_pDynamicPSO, sm_pDynamicSRB);
+        CreatePSO("Dynamic state test - static PSO", PIPELINE_DYNAMIC_STATE_FLAG_NONE, sm_pStaticPSO, sm_pStaticSRB);
+    }
+
+    static void TearDownTestSuite()
+    {
+        sm_pDynamicSRB.Release();
+        sm_pDynamicPSO.Release();
+        sm_pStaticSRB.Release();
+        sm_pStaticPSO.Release();
+        sm_pConstants.Release();
+        sm_pStagingTex.Release();
+        sm_pDepth.Release();
+        sm_pRT.Release();
+        GPUTestingEnvironment::GetInstance()->ReleaseResources();
+    }
+
+    void SetUp() override
+    {
+        IRenderDevice* pDevice = GPUTestingEnvironment::GetInstance()->GetDevice();
+        if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+            GTEST_SKIP() << "Dynamic pipeline states are only supported in Vulkan";
+        if (!sm_pDynamicPSO)
+            GTEST_SKIP() << "Extended dynamic state is not supported by this device";
+
+        m_pContext   = GPUTestingEnvironment::GetInstance()->GetDeviceContext();
+        m_pContextVk = RefCntAutoPtr<IDeviceContextVk>{m_pContext, IID_DeviceContextVk};
+        ASSERT_NE(m_pContextVk, nullptr);
+    }
+
+    void TearDown() override
+    {
+        m_pContextVk.Release();
+    }
+
+    // Binds the render target and clears it to black and the depth buffer to the given value
+    void Clear(float Depth)
+    {
+        ITextureView* pRTV = sm_pRT->GetDefaultView(TEXTURE_VIEW_RENDER_TARGET);
+        ITextureView* pDSV = sm_pDepth->GetDefaultView(TEXTURE_VIEW_DEPTH_STENCIL);
+        m_pContext->SetRenderTargets(1, &pRTV, pDSV, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        m_pContext->SetViewports(1, nullptr, 0, 0);
+
+        const float4 ClearColor = UnpackColor(Black);
+        m_pContext->ClearRenderTarget(pRTV, ClearColor.Data(), RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        m_pContext->ClearDepthStencil(pDSV, CLEAR_DEPTH_FLAG, Depth, 0, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+    }
+
+    // Draws a full-screen triangle with the given color at the given depth
+    void Draw(bool UseDynamicPSO, Uint32 Color, float Depth)
+    {
+        {
+            MapHelper<float4> Constants{m_pContext, sm_pConstants, MAP_WRITE, MAP_FLAG_DISCARD};
+            Constants[0] = UnpackColor(Color);
+            Constants[1] = float4{Depth, 0, 0, 0};
+        }
+
+        m_pContext->SetPipelineState(UseDynamicPSO ? sm_pDynamicPSO : sm_pStaticPSO);
+        m_pContext->CommitShaderResources(UseDynamicPSO ? sm_pDynamicSRB : sm_pStaticSRB, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+        m_pContext->Draw(DrawAttribs{3, DRAW_FLAG_VERIFY_ALL});
+    }
+
+    // Returns the color of the center pixel of the render target.
+    // The context is flushed, so the render targets and the pipeline must be set again.
+    Uint32 ReadColor()
+    {
+        CopyTextureAttribs CopyAttribs{sm_pRT, RESOURCE_STATE_TRANSITION_MODE_TRANSITION, sm_pStagingTex, RESOURCE_STATE_TRANSITION_MODE_TRANSITION};
+        m_pContext->CopyTexture(CopyAttribs);
+        m_pContext->WaitForIdle();
+
+        Uint32 Color = 0;
+
+        MappedTextureSubresource MappedData;
+        m_pContext->MapTextureSubresource(sm_pStagingTex, 0, 0, MAP_READ, MAP_FLAG_DO_NOT_WAIT, nullptr, MappedData);
+        const Uint8* pRow = static_cast<const Uint8*>(MappedData.pData) + MappedData.Stride * (TestRTSize / 2);
+        std::memcpy(&Color, pRow + sizeof(Uint32) * (TestRTSize / 2), sizeof(Color));
+        m_pContext->UnmapTextureSubresource(sm_pStagingTex, 0, 0);
+
+        return Color;
+    }
+
+    IDeviceContext*                 m_pContext = nullptr;
+    RefCntAutoPtr<IDeviceContextVk> m_pContextVk;
+
+    static RefCntAutoPtr<ITexture>               sm_pRT;
+    static RefCntAutoPtr<ITexture>               sm_pDepth;
+    static RefCntAutoPtr<ITexture>               sm_pStagingTex;
+    static RefCntAutoPtr<IBuffer>                sm_pConstants;
+    static RefCntAutoPtr<IPipelineState>         sm_pDynamicPSO;
+    static RefCntAutoPtr<IShaderResourceBinding> sm_pDynamicSRB;
+    static RefCntAutoPtr<IPipelineState>         sm_pStaticPSO;
+    static RefCntAutoPtr<IShaderResourceBinding> sm_pStaticSRB;
+};
+
+RefCntAutoPtr<ITexture>               DynamicStateTest::sm_pRT;
+RefCntAutoPtr<ITexture>               DynamicStateTest::sm_pDepth;
+RefCntAutoPtr<ITexture>               DynamicStateTest::sm_pStagingTex;
+RefCntAutoPtr<IBuffer>                DynamicStateTest::sm_pConstants;
+RefCntAutoPtr<IPipelineState>         DynamicStateTest::sm_pDynamicPSO;
+RefCntAutoPtr<IShaderResourceBinding> DynamicStateTest::sm_pDynamicSRB;
+RefCntAutoPtr<IPipelineState>         DynamicStateTest::sm_pStaticPSO;
+RefCntAutoPtr<IShaderResourceBinding> DynamicStateTest::sm_pStaticSRB;
+
+
+TEST_F(DynamicStateTest, CullModeAndFrontFace)
+{
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    // The triangle winding is not known, so find the cull mode that hides it
+    Clear(1);
+    m_pContextVk->SetFrontFace(False);
+    m_pContextVk->SetCullMode(CULL_MODE_FRONT);
+    Draw(true, Red, 0.5f);
+    const Uint32 FrontCullColor = ReadColor();
+
+    Clear(1);
+    m_pContextVk->SetFrontFace(False);
+    m_pContextVk->SetCullMode(CULL_MODE_BACK);
+    Draw(true, Green, 0.5f);
+    const Uint32 BackCullColor = ReadColor();
+
+    ASSERT_TRUE((FrontCullColor == Red && BackCullColor == Black) || (FrontCullColor == Black && BackCullColor == Green))
+        << "Exactly one of the front and back cull modes must hide the triangle";
+    const CULL_MODE HidingCullMode = FrontCullColor == Black ? CULL_MODE_FRONT : CULL_MODE_BACK;
+
+    // Flipping the front face makes the triangle visible
+    Clear(1);
+    m_pContextVk->SetCullMode(HidingCullMode);
+    m_pContextVk->SetFrontFace(True);
+    Draw(true, Blue, 0.5f);
+    EXPECT_EQ(ReadColor(), Blue);
+
+    // Disabling culling makes the triangle visible
+    Clear(1);
+    m_pContextVk->SetFrontFace(False);
+    m_pContextVk->SetCullMode(CULL_MODE_NONE);
+    Draw(true, Red, 0.5f);
+    EXPECT_EQ(ReadColor(), Red);
+}
+
+TEST_F(DynamicStateTest, Depth)
+{
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    m_pContextVk->SetCullMode(CULL_MODE_NONE);
+    m_pContextVk->SetDepthTestEnable(True);
+    m_pContextVk->SetDepthWriteEnable(True);
+    m_pContextVk->SetDepthFunc(COMPARISON_FUNC_LESS);
+
+    // The second triangle fails the depth test
+    Clear(1);
+    Draw(true, Red, 0.25f);
+    Draw(true, Green, 0.5f);
+    EXPECT_EQ(ReadColor(), Red);
+
+    // Without depth writes, the second triangle passes the depth test against the cleared value
+    m_pContextVk->SetCullMode(CULL_MODE_NONE);
+    m_pContextVk->SetDepthTestEnable(True);
+    m_pContextVk->SetDepthWriteEnable(False);
+    m_pContextVk->SetDepthFunc(COMPARISON_FUNC_LESS);
+    Clear(1);
+    Draw(true, Red, 0.5f);
+    Draw(true, Green, 0.75f);
+    EXPECT_EQ(ReadColor(), Green);
+
+    // With the greater comparison function, the second triangle passes the depth test
+    m_pContextVk->SetCullMode(CULL_MODE_NONE);
+    m_pContextVk->SetDepthTestEnable(True);
+    m_pContextVk->SetDepthWriteEnable(True);
+    m_pContextVk->SetDepthFunc(COMPARISON_FUNC_LESS);
+    Clear(1);
+    Draw(true, Red, 0.5f);
+    m_pContextVk->SetDepthFunc(COMPARISON_FUNC_GREATER);
+    Draw(true, Green, 0.75f);
+    EXPECT_EQ(ReadColor(), Green);
+
+    // With the depth test disabled, the second triangle is always visible
+    m_pContextVk->SetCullMode(CULL_MODE_NONE);
+    m_pContextVk->SetDepthTestEnable(True);
+    m_pContextVk->SetDepthWriteEnable(True);
+    m_pContextVk->SetDepthFunc(COMPARISON_FUNC_LESS);
+    Clear(1);
+    Draw(true, Red, 0.25f);
+    m_pContextVk->SetDepthTestEnable(False);
+    Draw(true, Green, 0.5f);
+    EXPECT_EQ(ReadColor(), Green);
+}
+
+// Binding a pipeline without dynamic states overwrites the dynamic states in the command buffer,
+// so they must be emitted again when the dynamic pipeline is bound next time.
+TEST_F(DynamicStateTest, ReemitAfterPSOSwitch)
+{
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    Clear(1);
+    m_pContextVk->SetFrontFace(False);
+    m_pContextVk->SetCullMode(CULL_MODE_FRONT);
+    Draw(true, Red, 0.5f);
+    const CULL_MODE HidingCullMode = ReadColor() == Black ? CULL_MODE_FRONT : CULL_MODE_BACK;
+
+    Clear(1);
+    m_pContextVk->SetFrontFace(False);
+    m_pContextVk->SetCullMode(HidingCullMode);
+    Draw(true, Red, 0.5f);
+    // The static pipeline does not cull the triangle
+    Draw(false, Green, 0.5f);
+    // The hiding cull mode must still be used
+    Draw(true, Blue, 0.5f);
+    EXPECT_EQ(ReadColor(), Green);
+
+    m_pContextVk->SetCullMode(CULL_MODE_NONE);
+    m_pContextVk->SetDepthTestEnable(True);
+    m_pContextVk->SetDepthWriteEnable(True);
+    m_pContextVk->SetDepthFunc(COMPARISON_FUNC_LESS);
+    Clear(1);
+    Draw(true, Red, 0.25f);
+    // The static pipeline has the depth test disabled
+    Draw(false, Green, 0.5f);
+    // The depth test must still be enabled and reject the triangle
+    Draw(true, Blue, 0.5f);
+    EXPECT_EQ(ReadColor(), Green);
+}
+
+#endif // VULKAN_SUPPORTED
+
+} // namespace
@@ -0,0 +1,101 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrameProfiler.hpp"
+#include "GPUTestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(FrameProfilerTest, GPUScopes)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pContext   = pEnv->GetDeviceContext();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    if (!pDevice->GetDeviceInfo().Features.TimestampQueries)
+    {
+        GTEST_SKIP() << "Timestamp queries are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    FrameProfilerCreateInfo CI;
+    CI.pDevice         = pDevice;
+    CI.EmitDebugGroups = true;
+    FrameProfiler Profiler{CI};
+
+    constexpr Uint32 NumFrames = 3;
+    for (Uint32 frame = 0; frame < NumFrames; ++frame)
+    {
+        Profiler.BeginFrame();
+        {
+            FrameProfiler::CPUScope CPUScope{Profiler, "Render"};
+            FrameProfiler::GPUScope GPUScope{Profiler, pContext, "Clear"};
+
+            const float   ClearColor[] = {0.25f, 0.5f, 0.75f, 1.0f};
+            ITextureView* pRTVs[]      = {pSwapChain->GetCurrentBackBufferRTV()};
+            pContext->SetRenderTargets(1, pRTVs, nullptr, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            {
+                FrameProfiler::GPUScope NestedScope{Profiler, pContext, "ClearRenderTarget"};
+                pContext->ClearRenderTarget(pRTVs[0], ClearColor, RESOURCE_STATE_TRANSITION_MODE_TRANSITION);
+            }
+        }
+        Profiler.EndFrame();
+        pContext->Flush();
+    }
+
+    pContext->WaitForIdle();
+    Profiler.Resolve();
+
+    EXPECT_EQ(Profiler.GetNumPendingFrames(), size_t{0});
+    ASSERT_EQ(Profiler.GetResolvedFrames().size(), size_t{NumFrames});
+    for (const FrameProfiler::FrameData& Frame : Profiler.GetResolvedFrames())
+    {
+        ASSERT_EQ(Frame.Contexts.size(), size_t{1});
+
+        const FrameProfiler::ContextData& Ctx = Frame.Contexts[0];
+        ASSERT_EQ(Ctx.GPUScopes.size(), size_t{2});
+        EXPECT_EQ(Ctx.GPUScopes[0].Name, "Clear");
+        EXPECT_EQ(Ctx.GPUScopes[1].Name, "ClearRenderTarget");
+        EXPECT_EQ(Ctx.GPUScopes[1].Parent, 0u);
+        EXPECT_LE(Ctx.GPUScopes[0].Begin, Ctx.GPUScopes[0].End);
+        EXPECT_LE(Ctx.GPUScopes[0].Begin, Ctx.GPUScopes[1].Begin);
+        EXPECT_EQ(Ctx.Stats.CommandCounters.ClearRenderTarget, 1u);
+    }
+
+    const std::string Trace = Profiler.ExportChromeTrace();
+    EXPECT_NE(Trace.find("\"cat\":\"GPU\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"ph\":\"C\""), std::string::npos);
+}
+
+} // namespace
@@ -27,6 +27,9 @@
 
 #include "GPUTestingEnvironment.hpp"
 #include "HLSL2GLSLConverter.h"
+#include "HLSL2GLSLConverterImpl.hpp"
+#include "GLSLDefinitionsPruner.hpp"
+#include "ThreadPool.hpp"
 
 #include "gtest/gtest.h"
 
@@ -175,4 +178,249 @@ TEST(HLSL2GLSLConverterTest, Preprocessor)
     }
 }
 
+TEST(HLSL2GLSLConverterTest, ConvertBatch)
+{
+    GPUTestingEnvironment* pEnv    = GPUTestingEnvironment::GetInstance();
+    IRenderDevice*         pDevice = pEnv->GetDevice();
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    pDevice->GetEngineFactory()->CreateDefaultShaderSourceStreamFactory("shaders/HLSL2GLSLConverter", &pShaderSourceFactory);
+    ASSERT_NE(pShaderSourceFactory, nullptr);
+
+    struct JobInfo
+    {
+        const char* FileName;
+        const char* EntryPoint;
+        SHADER_TYPE ShaderType;
+    };
+    constexpr JobInfo JobInfos[] = {
+        {"VS_PS.hlsl", "TestVS", SHADER_TYPE_VERTEX},
+        {"VS_PS.hlsl", "TestPS", SHADER_TYPE_PIXEL},
+        {"CS_RWTex2D_1.hlsl", "TestCS", SHADER_TYPE_COMPUTE},
+        {"GS.hlsl", "main", SHADER_TYPE_GEOMETRY},
+        {"PreprocessorTest.hlsl", "main1", SHADER_TYPE_PIXEL},
+        {"PreprocessorTest.hlsl", "main2", SHADER_TYPE_PIXEL},
+        {"PreprocessorTest.hlsl", "main3", SHADER_TYPE_PIXEL},
+        {"VS_PS.hlsl", "MissingEntryPoint", SHADER_TYPE_PIXEL},
+    };
+
+    const HLSL2GLSLConverterImpl& Converter = HLSL2GLSLConverterImpl::GetInstance();
+
+    std::vector<HLSL2GLSLConverterImpl::ConversionAttribs> Jobs;
+    std::vector<String>                                    RefSources;
+    for (const JobInfo& Info : JobInfos)
+    {
+        HLSL2GLSLConverterImpl::ConversionAttribs Attribs;
+        Attribs.pSourceStreamFactory = pShaderSourceFactory;
+        Attribs.InputFileName        = Info.FileName;
+        Attribs.EntryPoint           = Info.EntryPoint;
+        Attribs.ShaderType           = Info.ShaderType;
+        Attribs.IncludeDefinitions   = true;
+        Jobs.push_back(Attribs);
+        RefSources.push_back(Converter.Convert(Attribs));
+    }
+    EXPECT_TRUE(RefSources.back().empty());
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    const size_t NumJobs = Jobs.size();
+    for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+    {
+        std::vector<String> Sources(NumJobs);
+        Converter.ConvertBatch(Jobs.data(), NumJobs, pPool, nullptr, Sources.data());
+        for (size_t i = 0; i < NumJobs; ++i)
+            EXPECT_EQ(Sources[i], RefSources[i]) << JobInfos[i].FileName << ": " << JobInfos[i].EntryPoint;
+    }
+
+    RefCntAutoPtr<IDataBlob> pCacheData;
+    {
+        HLSL2GLSLConversionCache Cache;
+
+        std::vector<String> Sources(NumJobs);
+        Converter.ConvertBatch(Jobs.data(), NumJobs, pThreadPool, &Cache, Sources.data());
+        for (size_t i = 0; i < NumJobs; ++i)
+            EXPECT_EQ(Sources[i], RefSources[i]) << JobInfos[i].FileName << ": " << JobInfos[i].EntryPoint;
+
+        const HLSL2GLSLConversionCache::Statistics Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumEntries, NumJobs - 1);
+        EXPECT_EQ(Stats.NumHits, 0u);
+        EXPECT_EQ(Stats.NumMisses, NumJobs);
+
+        Cache.Store(&pCacheData);
+        ASSERT_NE(pCacheData, nullptr);
+    }
+
+    {
+        HLSL2GLSLConversionCache Cache;
+        EXPECT_TRUE(Cache.Load(pCacheData));
+
+        std::vector<String> Sources(NumJobs);
+        Converter.ConvertBatch(Jobs.data(), NumJobs, pThreadPool, &Cache, Sources.data());
+        for (size_t i = 0; i < NumJobs; ++i)
+            EXPECT_EQ(Sources[i], RefSources[i]) << JobInfos[i].FileName << ": " << JobInfos[i].EntryPoint;
+
+        // Failed conversions are not cached
+        const HLSL2GLSLConversionCache::Statistics Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumEntries, NumJobs - 1);
+        EXPECT_EQ(Stats.NumHits, NumJobs - 1);
+        EXPECT_EQ(Stats.NumMisses, 1u);
+    }
+}
+
+TEST(HLSL2GLSLConverterTest, PruneDefinitions)
+{
+    static constexpr char Definitions[] = R"(
+// Comment
+#define float4 vec4
+#define UNUSED_MACRO 1
+#define USED_MACRO(x) UsedFunc(x)
+
+struct UsedStruct
+{
+    float4 Value;
+};
+
+struct UnusedStruct
+{
+    float Value;
+};
+
+struct VarStruct
+{
+    float Value;
+} g_Var;
+
+float UsedFunc(float x) { return x * 2.0; }
+float UnusedFunc(float x)
+{
+    return x;
+}
+
+#ifdef FEATURE
+float FeatureFunc(float x) { return x; }
+#else
+float FeatureFunc(float x) { return NestedFunc(x); }
+#endif
+
+float NestedFunc(float x);
+
+#if defined(OTHER_FEATURE)
+#   define OTHER_MACRO 1
+#endif
+
+UsedStruct MakeStruct(float v)
+{
+    UsedStruct s;
+    s.Value = float4(v, v, v, v);
+    return s;
+}
+)";
+
+    const GLSLDefinitionsPruner Pruner{Definitions};
+    // float4, UNUSED_MACRO, USED_MACRO, UsedStruct, UnusedStruct, UsedFunc, UnusedFunc,
+    // FeatureFunc (x2), NestedFunc, OTHER_MACRO, MakeStruct
+    EXPECT_EQ(Pruner.GetNumPrunableItems(), 12u);
+
+    auto Contains = [](const std::string& Str, const char* SubStr) {
+        return Str.find(SubStr) != std::string::npos;
+    };
+
+    {
+        const char* const Sources[] = {
+            nullptr,
+            "void main() { float a = USED_MACRO(1.0); MakeStruct(a); FeatureFunc(a); }",
+        };
+        const std::string Pruned = Pruner.Prune(Sources, _countof(Sources));
+
+        // Used items and the items they reference are kept
+        EXPECT_TRUE(Contains(Pruned, "#define USED_MACRO(x) UsedFunc(x)")) << Pruned;
+        EXPECT_TRUE(Contains(Pruned, "float UsedFunc(float x)")) << Pruned;
+        EXPECT_TRUE(Contains(Pruned, "UsedStruct MakeStruct(float v)")) << Pruned;
+        EXPECT_TRUE(Contains(Pruned, "struct UsedStruct")) << Pruned;
+        EXPECT_TRUE(Contains(Pruned, "#define float4 vec4")) << Pruned;
+        EXPECT_TRUE(Contains(Pruned, "float NestedFunc(float x);")) << Pruned;
+
+        // Both branches of the conditional block are kept
+        EXPECT_TRUE(Contains(Pruned, "#ifdef FEATURE\nfloat FeatureFunc(float x) { return x; }\n#else\nfloat FeatureFunc(float x) { return NestedFunc(x); }\n#endif\n")) << Pruned;
+
+        // Unused items are removed
+        EXPECT_FALSE(Contains(Pruned, "UNUSED_MACRO")) << Pruned;
+        EXPECT_FALSE(Contains(Pruned, "UnusedStruct")) << Pruned;
+        EXPECT_FALSE(Contains(Pruned, "UnusedFunc")) << Pruned;
+        // Conditional blocks that become empty are removed
+        EXPECT_FALSE(Contains(Pruned, "OTHER")) << Pruned;
+        // Comments are removed
+        EXPECT_FALSE(Contains(Pruned, "// Comment")) << Pruned;
+
+        // Structs that declare variables are always kept
+        EXPECT_TRUE(Contains(Pruned, "} g_Var;")) << Pruned;
+    }
+
+    {
+        // Items referenced by the preceding source are kept
+        const char* const Sources[] = {
+            "#define MY_MACRO UnusedFunc(1.0)\n",
+            "void main() {}",
+        };
+        const std::string Pruned = Pruner.Prune(Sources, _countof(Sources));
+        EXPECT_TRUE(Contains(Pruned, "float UnusedFunc(float x)")) << Pruned;
+        EXPECT_FALSE(Contains(Pruned, "UsedFunc(float x) {")) << Pruned;
+    }
+
+    {
+        // Only the items that are always required are kept
+        const char* const Sources[] = {"void main() {}"};
+        EXPECT_EQ(Pruner.Prune(Sources, _countof(Sources)), "struct VarStruct\n{\n    float Value;\n} g_Var;\n");
+    }
+}
+
+TEST(HLSL2GLSLConverterTest, ConvertPrunedDefinitions)
+{
+    static constexpr char HLSLSource[] = R"(
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return saturate(Pos);
+}
+)";
+
+    const HLSL2GLSLConverterImpl& Converter = HLSL2GLSLConverterImpl::GetInstance();
+
+    HLSL2GLSLConverterImpl::ConversionAttribs Attribs;
+    Attribs.HLSLSource    = HLSLSource;
+    Attribs.NumSymbols    = sizeof(HLSLSource) - 1;
+    Attribs.EntryPoint    = "main";
+    Attribs.ShaderType    = SHADER_TYPE_PIXEL;
+    Attribs.InputFileName = "ConvertPrunedDefinitions";
+    EXPECT_FALSE(Attribs.PruneUnusedDefinitions);
+
+    const String Body = Converter.Convert(Attribs);
+    ASSERT_FALSE(Body.empty());
+
+    Attribs.IncludeDefinitions = true;
+    const String Full          = Converter.Convert(Attribs);
+    ASSERT_GT(Full.length(), Body.length());
+    ASSERT_EQ(Full.substr(Full.length() - Body.length()), Body);
+    const String FullDefinitions = Full.substr(0, Full.length() - Body.length());
+
+    Attribs.PruneUnusedDefinitions = true;
+    const String Pruned            = Converter.Convert(Attribs);
+    ASSERT_GT(Pruned.length(), Body.length());
+    ASSERT_EQ(Pruned.substr(Pruned.length() - Body.length()), Body);
+    const String PrunedDefinitions = Pruned.substr(0, Pruned.length() - Body.length());
+    EXPECT_LT(PrunedDefinitions.length(), FullDefinitions.length());
+
+    // Definitions used by the shader are kept
+    EXPECT_NE(PrunedDefinitions.find("#define float4 vec4"), String::npos);
+    EXPECT_NE(PrunedDefinitions.find("vec4  saturate( vec4  x )"), String::npos);
+    // Unused definitions are removed
+    EXPECT_NE(FullDefinitions.find("f16tof32"), String::npos);
+    EXPECT_EQ(PrunedDefinitions.find("f16tof32"), String::npos);
+
+    // Definitions used by the preceding source are kept
+    Attribs.PrecedingSource      = "#define UNPACK_HALF(x) f16tof32(x)\n";
+    const String PrunedWithMacro = Converter.Convert(Attribs);
+    EXPECT_NE(PrunedWithMacro.find("f16tof32"), String::npos);
+}
+
 } // namespace
@@ -26,9 +26,17 @@
  */
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <thread>
 
 #include "GPUTestingEnvironment.hpp"
 #include "TestingSwapChainBase.hpp"
+#include "ThreadSignal.hpp"
+
+#if VULKAN_SUPPORTED
+#    include "DeviceContextVk.h"
+#endif
 
 #include "gtest/gtest.h"
 
@@ -557,6 +565,141 @@ TEST_F(RenderPassTest, Draw)
     Present();
 }
 
+#if VULKAN_SUPPORTED
+TEST_F(RenderPassTest, SecondaryCommandListsVk)
+{
+    auto* pEnv       = GPUTestingEnvironment::GetInstance();
+    auto* pDevice    = pEnv->GetDevice();
+    auto* pSwapChain = pEnv->GetSwapChain();
+
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+    {
+        GTEST_SKIP() << "Secondary command lists are only supported in Vulkan";
+    }
+    if (pEnv->GetNumDeferredContexts() < 2)
+    {
+        GTEST_SKIP() << "At least two deferred contexts are required";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    RefCntAutoPtr<IDeviceContextVk> pImmediateCtxVk{pEnv->GetDeviceContext(), IID_DeviceContextVk};
+    ASSERT_NE(pImmediateCtxVk, nullptr);
+
+    // The reference image is rendered inline by the immediate context
+    constexpr float ClearColor[] = {0.125f, 0.25f, 0.625f, 0.5f};
+    RenderDrawCommandReference(pSwapChain, ClearColor);
+
+    const auto&              SCDesc = pSwapChain->GetDesc();
+    RenderPassAttachmentDesc Attachments[1];
+    Attachments[0].Format       = SCDesc.ColorBufferFormat;
+    Attachments[0].InitialState = RESOURCE_STATE_RENDER_TARGET;
+    Attachments[0].FinalState   = RESOURCE_STATE_RENDER_TARGET;
+    Attachments[0].LoadOp       = ATTACHMENT_LOAD_OP_CLEAR;
+    Attachments[0].StoreOp      = ATTACHMENT_STORE_OP_STORE;
+
+    SubpassDesc Subpasses[1];
+
+    constexpr AttachmentReference RTAttachmentRefs0[] = {{0, RESOURCE_STATE_RENDER_TARGET}};
+    Subpasses[0].RenderTargetAttachmentCount          = _countof(RTAttachmentRefs0);
+    Subpasses[0].pRenderTargetAttachments             = RTAttachmentRefs0;
+
+    RenderPassDesc RPDesc;
+    RPDesc.Name            = "Render pass secondary command lists test";
+    RPDesc.AttachmentCount = _countof(Attachments);
+    RPDesc.pAttachments    = Attachments;
+    RPDesc.SubpassCount    = _countof(Subpasses);
+    RPDesc.pSubpasses      = Subpasses;
+
+    RefCntAutoPtr<IRenderPass> pRenderPass;
+    pDevice->CreateRenderPass(RPDesc, &pRenderPass);
+    ASSERT_NE(pRenderPass, nullptr);
+
+    RefCntAutoPtr<IPipelineState> pPSO;
+    CreateDrawTrisPSO(pRenderPass, 1, pPSO);
+    ASSERT_TRUE(pPSO != nullptr);
+
+    ITextureView* pRTAttachments[] = {pSwapChain->GetCurrentBackBufferRTV()};
+
+    FramebufferDesc FBDesc;
+    FBDesc.Name            = "Render pass secondary command lists test framebuffer";
+    FBDesc.pRenderPass     = pRenderPass;
+    FBDesc.AttachmentCount = _countof(Attachments);
+    FBDesc.ppAttachments   = pRTAttachments;
+    RefCntAutoPtr<IFramebuffer> pFramebuffer;
+    pDevice->CreateFramebuffer(FBDesc, &pFramebuffer);
+    ASSERT_TRUE(pFramebuffer);
+
+    // Each thread draws one of the two triangles of the reference image
+    constexpr Uint32                                    NumThreads = 2;
+    std::array<std::thread, NumThreads>                 WorkerThreads;
+    std::array<RefCntAutoPtr<ICommandList>, NumThreads> CmdLists;
+    std::array<ICommandList*, NumThreads>               CmdListPtrs;
+
+    std::atomic<Uint32> NumCmdListsReady{0};
+    Threading::Signal   FinishFrameSignal;
+    Threading::Signal   ExecuteCommandListsSignal;
+    for (Uint32 i = 0; i < NumThreads; ++i)
+    {
+        WorkerThreads[i] = std::thread(
+            [&](Uint32 thread_id) //
+            {
+                RefCntAutoPtr<IDeviceContextVk> pCtxVk{pEnv->GetDeferredContext(thread_id), IID_DeviceContextVk};
+
+                BeginSecondaryCommandListAttribsVk BeginAttribs;
+                BeginAttribs.ImmediateContextId = 0;
+                BeginAttribs.pRenderPass        = pRenderPass;
+                BeginAttribs.SubpassIndex       = 0;
+                BeginAttribs.pFramebuffer       = pFramebuffer;
+                pCtxVk->BeginSecondaryCommandList(BeginAttribs);
+
+                pCtxVk->SetPipelineState(pPSO);
+
+                DrawAttribs DrawAttrs{3, DRAW_FLAG_VERIFY_ALL};
+                DrawAttrs.StartVertexLocation = 3 * thread_id;
+                pCtxVk->Draw(DrawAttrs);
+
+                pCtxVk->FinishCommandList(&CmdLists[thread_id]);
+                CmdListPtrs[thread_id] = CmdLists[thread_id];
+
+                const auto NumReadyLists = NumCmdListsReady.fetch_add(1) + 1;
+                if (NumReadyLists == NumThreads)
+                    ExecuteCommandListsSignal.Trigger();
+
+                FinishFrameSignal.Wait(true, NumThreads);
+
+                // Finish the frame before the immediate context is flushed to make sure
+                // that the dynamic resources used by the command lists are kept alive
+                // until the primary command buffer completes.
+                pCtxVk->FinishFrame();
+            },
+            i);
+    }
+
+    ExecuteCommandListsSignal.Wait(true, 1);
+
+    BeginRenderPassAttribs RPBeginInfo;
+    RPBeginInfo.pRenderPass  = pRenderPass;
+    RPBeginInfo.pFramebuffer = pFramebuffer;
+
+    OptimizedClearValue ClearValues[1];
+    ClearValues[0].SetColor(SCDesc.ColorBufferFormat, ClearColor);
+
+    RPBeginInfo.pClearValues        = ClearValues;
+    RPBeginInfo.ClearValueCount     = _countof(ClearValues);
+    RPBeginInfo.StateTransitionMode = RESOURCE_STATE_TRANSITION_MODE_TRANSITION;
+    pImmediateCtxVk->BeginSecondaryRenderPass(RPBeginInfo);
+    pImmediateCtxVk->ExecuteCommandLists(NumThreads, CmdListPtrs.data());
+    pImmediateCtxVk->EndRenderPass();
+
+    FinishFrameSignal.Trigger(true);
+    for (auto& t : WorkerThreads)
+        t.join();
+
+    Present();
+}
+#endif
+
 void RenderPassTest::TestMSResolve(bool UseMemoryless)
 {
     auto* pEnv       = GPUTestingEnvironment::GetInstance();
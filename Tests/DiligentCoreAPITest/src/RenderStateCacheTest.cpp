@@ -34,6 +34,7 @@
 #include "GraphicsTypesX.hpp"
 #include "CallbackWrapper.hpp"
 #include "ResourceLayoutTestCommon.hpp"
+#include "ShaderSourceFactoryUtils.hpp"
 
 #include "InlineShaders/RayTracingTestHLSL.h"
 #include "InlineShaders/DrawCommandTestHLSL.h"
@@ -1613,6 +1614,86 @@ TEST(RenderStateCacheTest, Reload_Signatures2)
     }
 }
 
+TEST(RenderStateCacheTest, Reload_ChangedSources)
+{
+    auto* pEnv    = GPUTestingEnvironment::GetInstance();
+    auto* pDevice = pEnv->GetDevice();
+    if (!pDevice->GetDeviceInfo().Features.ComputeShaders)
+    {
+        GTEST_SKIP() << "Compute shaders are not supported by this device";
+    }
+
+    GPUTestingEnvironment::ScopedReset AutoReset;
+
+    // The memory source factory does not copy the sources, so modifying the strings
+    // in place (without changing their length) emulates editing the source files.
+    std::string CommonSource = "#define THREAD_GROUP_SIZE 1\n";
+
+    constexpr Uint32         NumShaders = 4;
+    std::vector<std::string> FileNames(NumShaders);
+    std::vector<std::string> Sources(NumShaders);
+    for (Uint32 i = 0; i < NumShaders; ++i)
+    {
+        FileNames[i] = "ComputeShader" + std::to_string(i) + ".csh";
+        // Make the sources unique so that every shader is compiled separately
+        Sources[i] = "// Shader " + std::to_string(i) + ", version 0\n"
+                     "#include \"Common.h\"\n"
+                     "[numthreads(THREAD_GROUP_SIZE, 1, 1)]\n"
+                     "void main()\n"
+                     "{\n"
+                     "}\n";
+    }
+
+    std::vector<MemoryShaderSourceFileInfo> SourceFiles;
+    SourceFiles.emplace_back("Common.h", CommonSource.c_str());
+    for (Uint32 i = 0; i < NumShaders; ++i)
+        SourceFiles.emplace_back(FileNames[i].c_str(), Sources[i].c_str());
+
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceFactory;
+    CreateMemoryShaderSourceFactory(MemoryShaderSourceFactoryCreateInfo{SourceFiles.data(), static_cast<Uint32>(SourceFiles.size())}, &pShaderSourceFactory);
+    ASSERT_TRUE(pShaderSourceFactory);
+
+    constexpr bool HotReload = true;
+
+    auto pCache = CreateCache(pDevice, HotReload);
+    ASSERT_TRUE(pCache);
+
+    std::vector<RefCntAutoPtr<IShader>>        Shaders(NumShaders);
+    std::vector<RefCntAutoPtr<IPipelineState>> PSOs(NumShaders);
+    for (Uint32 i = 0; i < NumShaders; ++i)
+    {
+        CreateShader(pCache, pShaderSourceFactory, SHADER_TYPE_COMPUTE, SHADER_COMPILE_FLAG_NONE,
+                     "RenderStateCacheTest.Reload_ChangedSources", FileNames[i].c_str(), false, Shaders[i]);
+        ASSERT_NE(Shaders[i], nullptr);
+
+        ComputePipelineStateCreateInfo PsoCI;
+        PsoCI.PSODesc.Name = "RenderStateCacheTest.Reload_ChangedSources";
+        PsoCI.pCS          = Shaders[i];
+        pCache->CreateComputePipelineState(PsoCI, &PSOs[i]);
+        ASSERT_NE(PSOs[i], nullptr);
+    }
+
+    // Nothing has changed
+    EXPECT_EQ(pCache->Reload(), 0u);
+
+    // Only the modified shader and the pipeline that uses it must be reloaded
+    Sources[1].replace(Sources[1].find("version 0"), 9, "version 1");
+    EXPECT_EQ(pCache->Reload(), 2u);
+    EXPECT_EQ(pCache->Reload(), 0u);
+
+    // All shaders include the modified file. When the device has a shader compilation
+    // thread pool, the shaders are recompiled in parallel.
+    CommonSource.replace(CommonSource.find("SIZE 1"), 6, "SIZE 2");
+    EXPECT_EQ(pCache->Reload(), NumShaders * 2);
+    for (Uint32 i = 0; i < NumShaders; ++i)
+    {
+        EXPECT_EQ(PSOs[i]->GetStatus(true), PIPELINE_STATE_STATUS_READY);
+        EXPECT_EQ(Shaders[i]->GetStatus(true), SHADER_STATUS_READY);
+    }
+    // The source hashes of all shaders must have been updated
+    EXPECT_EQ(pCache->Reload(), 0u);
+}
+
 TEST(RenderStateCacheTest, GLExtensions)
 {
     auto*       pEnv       = GPUTestingEnvironment::GetInstance();
@@ -134,4 +134,143 @@ TEST(ResourceStateTest, DiscardSubresource)
     pContext->Flush();
 }
 
+TEST(ResourceStateTest, SkipRedundantSRBTransitions)
+{
+    auto* pEnv     = GPUTestingEnvironment::GetInstance();
+    auto* pDevice  = pEnv->GetDevice();
+    auto* pContext = pEnv->GetDeviceContext();
+
+    if (!pDevice->GetDeviceInfo().IsVulkanDevice())
+    {
+        GTEST_SKIP() << "Shader resource transition counters are only tracked by the Vulkan backend";
+    }
+
+    GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
+
+    PipelineResourceSignatureDesc PRSDesc;
+    PRSDesc.Name = "SkipRedundantSRBTransitions test signature";
+
+    // clang-format off
+    const PipelineResourceDesc Resources[] =
+    {
+        {SHADER_TYPE_PIXEL, "g_CB",  1, SHADER_RESOURCE_TYPE_CONSTANT_BUFFER, SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE},
+        {SHADER_TYPE_PIXEL, "g_Tex", 1, SHADER_RESOURCE_TYPE_TEXTURE_SRV,     SHADER_RESOURCE_VARIABLE_TYPE_MUTABLE}
+    };
+    // clang-format on
+    PRSDesc.Resources    = Resources;
+    PRSDesc.NumResources = _countof(Resources);
+
+    RefCntAutoPtr<IPipelineResourceSignature> pPRS;
+    pDevice->CreatePipelineResourceSignature(PRSDesc, &pPRS);
+    ASSERT_NE(pPRS, nullptr);
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "SkipRedundantSRBTransitions test buffer";
+    BuffDesc.Size      = 256;
+    BuffDesc.BindFlags = BIND_UNIFORM_BUFFER;
+
+    RefCntAutoPtr<IBuffer> pCB;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pCB);
+    ASSERT_NE(pCB, nullptr);
+
+    // The buffer that is not referenced by the SRB
+    RefCntAutoPtr<IBuffer> pOtherCB;
+    pDevice->CreateBuffer(BuffDesc, nullptr, &pOtherCB);
+    ASSERT_NE(pOtherCB, nullptr);
+
+    TextureDesc TexDesc;
+    TexDesc.Name      = "SkipRedundantSRBTransitions test texture";
+    TexDesc.Type      = RESOURCE_DIM_TEX_2D;
+    TexDesc.Width     = 64;
+    TexDesc.Height    = 64;
+    TexDesc.BindFlags = BIND_SHADER_RESOURCE;
+    TexDesc.Format    = TEX_FORMAT_RGBA8_UNORM;
+
+    RefCntAutoPtr<ITexture> pTex0, pTex1;
+    pDevice->CreateTexture(TexDesc, nullptr, &pTex0);
+    ASSERT_NE(pTex0, nullptr);
+    pDevice->CreateTexture(TexDesc, nullptr, &pTex1);
+    ASSERT_NE(pTex1, nullptr);
+
+    RefCntAutoPtr<IShaderResourceBinding> pSRB;
+    pPRS->CreateShaderResourceBinding(&pSRB, true);
+    ASSERT_NE(pSRB, nullptr);
+
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_CB")->Set(pCB);
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Tex")->Set(pTex0->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+
+    pContext->ClearStats();
+    const DeviceContextStats& Stats = pContext->GetStats();
+
+    auto CheckCounters = [&](Uint32 Transitions, Uint32 Skipped) {
+        EXPECT_EQ(Stats.ShaderResourceTransitions, Transitions);
+        EXPECT_EQ(Stats.SkippedShaderResourceTransitions, Skipped);
+    };
+
+    // The first transition is always performed
+    pContext->TransitionShaderResources(pSRB);
+    CheckCounters(1, 0);
+    EXPECT_EQ(pCB->GetState(), RESOURCE_STATE_CONSTANT_BUFFER);
+    EXPECT_EQ(pTex0->GetState(), RESOURCE_STATE_SHADER_RESOURCE);
+
+    // Nothing has changed
+    pContext->TransitionShaderResources(pSRB);
+    pContext->TransitionShaderResources(pSRB);
+    CheckCounters(1, 2);
+
+    // State changes of the resources not referenced by the SRB must not invalidate the transitions
+    {
+        const StateTransitionDesc Barrier{pOtherCB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, STATE_TRANSITION_FLAG_UPDATE_STATE};
+        pContext->TransitionResourceStates(1, &Barrier);
+    }
+    pContext->TransitionShaderResources(pSRB);
+    CheckCounters(1, 3);
+
+    // Binding a new resource invalidates the transitions
+    pSRB->GetVariableByName(SHADER_TYPE_PIXEL, "g_Tex")->Set(pTex1->GetDefaultView(TEXTURE_VIEW_SHADER_RESOURCE));
+    pContext->TransitionShaderResources(pSRB);
+    CheckCounters(2, 3);
+    EXPECT_EQ(pTex1->GetState(), RESOURCE_STATE_SHADER_RESOURCE);
+
+    pContext->TransitionShaderResources(pSRB);
+    CheckCounters(2, 4);
+
+    // The texture that is no longer bound to the SRB must not invalidate the transitions
+    {
+        const StateTransitionDesc Barrier{pTex0, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, STATE_TRANSITION_FLAG_UPDATE_STATE};
+        pContext->TransitionResourceStates(1, &Barrier);
+    }
+    pContext->TransitionShaderResources(pSRB);
+    CheckCounters(2, 5);
+
+    // External state change of the bound texture invalidates the transitions
+    {
+        const StateTransitionDesc Barrier{pTex1, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, STATE_TRANSITION_FLAG_UPDATE_STATE};
+        pContext->TransitionResourceStates(1, &Barrier);
+    }
+    EXPECT_EQ(pTex1->GetState(), RESOURCE_STATE_COPY_DEST);
+    pContext->TransitionShaderResources(pSRB);
+    CheckCounters(3, 5);
+    EXPECT_EQ(pTex1->GetState(), RESOURCE_STATE_SHADER_RESOURCE);
+
+    // External state change of the bound buffer invalidates the transitions
+    {
+        const StateTransitionDesc Barrier{pCB, RESOURCE_STATE_UNKNOWN, RESOURCE_STATE_COPY_DEST, STATE_TRANSITION_FLAG_UPDATE_STATE};
+        pContext->TransitionResourceStates(1, &Barrier);
+    }
+    pContext->TransitionShaderResources(pSRB);
+    CheckCounters(4, 5);
+    EXPECT_EQ(pCB->GetState(), RESOURCE_STATE_CONSTANT_BUFFER);
+
+    // Setting the state directly invalidates the transitions too
+    pTex1->SetState(RESOURCE_STATE_UNKNOWN);
+    pContext->TransitionShaderResources(pSRB);
+    CheckCounters(5, 5);
+
+    pContext->TransitionShaderResources(pSRB);
+    CheckCounters(5, 6);
+
+    pContext->Flush();
+}
+
 } // namespace
@@ -89,7 +89,7 @@ Uint32 WriteOrVerifyRGBAData(MappedTextureSubresource& MappedData,
     return NumInvalidPixels;
 }
 
-void TextureUploaderTest(bool IsRenderThread)
+void TextureUploaderTest(bool IsRenderThread, Uint64 StagingBufferSize = 0, Uint64 MaxBytesPerFrame = 0)
 {
     auto* pEnv     = GPUTestingEnvironment::GetInstance();
     auto* pDevice  = pEnv->GetDevice();
@@ -102,7 +102,9 @@ void TextureUploaderTest(bool IsRenderThread)
 
     GPUTestingEnvironment::ScopedReset EnvironmentAutoReset;
 
-    TextureUploaderDesc             UploaderDesc;
+    TextureUploaderDesc UploaderDesc;
+    UploaderDesc.StagingBufferSize = StagingBufferSize;
+    UploaderDesc.MaxBytesPerFrame  = MaxBytesPerFrame;
     RefCntAutoPtr<ITextureUploader> pTexUploader;
     CreateTextureUploader(pDevice, UploaderDesc, &pTexUploader);
     ASSERT_TRUE(pTexUploader);
@@ -208,6 +210,19 @@ void TextureUploaderTest(bool IsRenderThread)
             }
         }
     }
+
+    pTexUploader->RenderThreadUpdate(pContext);
+
+    const TextureUploaderStats Stats = pTexUploader->GetStats();
+    EXPECT_EQ(Stats.NumPendingOperations, 0u);
+
+    const RENDER_DEVICE_TYPE DevType = pDevice->GetDeviceInfo().Type;
+    if (DevType == RENDER_DEVICE_TYPE_D3D12 || DevType == RENDER_DEVICE_TYPE_VULKAN)
+    {
+        EXPECT_EQ(Stats.StagingBufferSize, StagingBufferSize);
+        EXPECT_EQ(Stats.StagingBufferBytesUsed, 0u);
+        EXPECT_GT(Stats.TotalBytesUploaded, 0u);
+    }
 }
 
 TEST(TextureUploaderTest, RenderThread)
@@ -220,4 +235,22 @@ TEST(TextureUploaderTest, WorkerThread)
     TextureUploaderTest(false);
 }
 
+TEST(TextureUploaderTest, StagingRingRenderThread)
+{
+    TextureUploaderTest(true, Uint64{1} << 20);
+}
+
+TEST(TextureUploaderTest, StagingRingWorkerThread)
+{
+    // Budget is smaller than one upload, so every update executes exactly one copy
+    TextureUploaderTest(false, Uint64{1} << 20, Uint64{16} << 10);
+}
+
+TEST(TextureUploaderTest, StagingRingOverflow)
+{
+    // The upload buffer does not fit into the ring and uses dedicated memory
+    TextureUploaderTest(true, Uint64{4} << 10);
+    TextureUploaderTest(false, Uint64{4} << 10);
+}
+
 } // namespace
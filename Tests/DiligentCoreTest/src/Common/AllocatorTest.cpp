@@ -26,11 +26,16 @@
  */
 
 #include <array>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "DefaultRawMemoryAllocator.hpp"
 #include "FixedBlockMemoryAllocator.hpp"
 #include "FixedLinearAllocator.hpp"
 #include "DynamicLinearAllocator.hpp"
+#include "InstrumentedMemoryAllocator.hpp"
 
 #include "gtest/gtest.h"
 
@@ -289,4 +294,227 @@ TEST(Common_DynamicLinearAllocator, ObjectConstruction)
     EXPECT_TRUE(reinterpret_cast<size_t>(Allocator.Allocate(200, 64)) % 64 == 0);
 }
 
+TEST(Common_InstrumentedMemoryAllocator, AllocDealloc)
+{
+    InstrumentedMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    void* pData0 = Allocator.Allocate(100, "Site 0", __FILE__, 1);
+    void* pData1 = Allocator.Allocate(200, "Site 0", __FILE__, 1);
+    void* pData2 = Allocator.AllocateAligned(300, 256, "Site 1", __FILE__, 2);
+    EXPECT_EQ(reinterpret_cast<size_t>(pData0) % 16, size_t{0});
+    EXPECT_EQ(reinterpret_cast<size_t>(pData2) % 256, size_t{0});
+
+    auto Snap0 = Allocator.GetSnapshot();
+    ASSERT_EQ(Snap0.Sites.size(), size_t{2});
+    EXPECT_EQ(Snap0.Sites[0].Description, "Site 0");
+    EXPECT_EQ(Snap0.Sites[0].LineNumber, 1);
+    EXPECT_EQ(Snap0.Sites[0].LiveBytes, 300);
+    EXPECT_EQ(Snap0.Sites[0].LiveAllocations, 2);
+    EXPECT_EQ(Snap0.Sites[1].Description, "Site 1");
+    EXPECT_EQ(Snap0.Sites[1].LiveBytes, 300);
+    EXPECT_EQ(Snap0.LiveBytes, 600);
+    EXPECT_EQ(Snap0.LiveAllocations, 3);
+    EXPECT_EQ(Snap0.PeakBytes, 600);
+
+    Allocator.Free(pData0);
+    Allocator.FreeAligned(pData2);
+
+    auto Snap1 = Allocator.GetSnapshot();
+    EXPECT_EQ(Snap1.Sites[0].LiveBytes, 200);
+    EXPECT_EQ(Snap1.Sites[0].LiveAllocations, 1);
+    EXPECT_EQ(Snap1.Sites[0].PeakBytes, 300);
+    EXPECT_EQ(Snap1.Sites[0].TotalAllocations, Uint64{2});
+    EXPECT_EQ(Snap1.Sites[0].TotalBytes, Uint64{300});
+    EXPECT_EQ(Snap1.Sites[1].LiveBytes, 0);
+    EXPECT_EQ(Snap1.LiveBytes, 200);
+    EXPECT_EQ(Snap1.PeakBytes, 600);
+
+    Allocator.Free(pData1);
+    EXPECT_EQ(Allocator.GetSnapshot().LiveBytes, 0);
+}
+
+TEST(Common_InstrumentedMemoryAllocator, Difference)
+{
+    InstrumentedMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    void* pTransient = Allocator.Allocate(64, "Transient", __FILE__, __LINE__);
+    auto  Snap0      = Allocator.GetSnapshot();
+
+    Allocator.Free(pTransient);
+    void* pLeak0 = Allocator.Allocate(16, "Leak", __FILE__, __LINE__);
+    void* pLeak1 = Allocator.Allocate(32, "Leak", __FILE__, __LINE__);
+    void* pTemp  = Allocator.Allocate(128, "Temp", __FILE__, __LINE__);
+    Allocator.Free(pTemp);
+
+    auto Diff = InstrumentedMemoryAllocator::GetDifference(Snap0, Allocator.GetSnapshot());
+    ASSERT_EQ(Diff.size(), size_t{3});
+    EXPECT_EQ(Diff[0].Description, "Leak");
+    EXPECT_EQ(Diff[0].LiveBytes, 32);
+    EXPECT_EQ(Diff[0].LiveAllocations, 1);
+    EXPECT_EQ(Diff[1].Description, "Leak");
+    EXPECT_EQ(Diff[1].LiveBytes, 16);
+    EXPECT_EQ(Diff[2].Description, "Transient");
+    EXPECT_EQ(Diff[2].LiveBytes, -64);
+    EXPECT_EQ(Diff[2].LiveAllocations, -1);
+
+    Allocator.Free(pLeak0);
+    Allocator.Free(pLeak1);
+}
+
+TEST(Common_InstrumentedMemoryAllocator, MultipleThreads)
+{
+    InstrumentedMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    constexpr size_t NumThreads      = 4;
+    constexpr size_t AllocsPerThread = 1000;
+    constexpr size_t AllocSize       = 24;
+
+    std::vector<void*> Allocs[NumThreads];
+
+    std::vector<std::thread> Threads;
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&, t]() {
+            for (size_t i = 0; i < AllocsPerThread; ++i)
+                Allocs[t].push_back(Allocator.Allocate(AllocSize, "Worker", __FILE__, __LINE__));
+        });
+    }
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    auto Snap0 = Allocator.GetSnapshot();
+    ASSERT_EQ(Snap0.Sites.size(), size_t{1});
+    EXPECT_EQ(Snap0.LiveAllocations, static_cast<Int64>(NumThreads * AllocsPerThread));
+    EXPECT_EQ(Snap0.LiveBytes, static_cast<Int64>(NumThreads * AllocsPerThread * AllocSize));
+
+    // Release the memory from threads other than the ones that allocated it
+    Threads.clear();
+    for (size_t t = 0; t < NumThreads; ++t)
+    {
+        Threads.emplace_back([&, t]() {
+            for (void* pData : Allocs[(t + 1) % NumThreads])
+                Allocator.Free(pData);
+        });
+    }
+    for (std::thread& Thread : Threads)
+        Thread.join();
+
+    auto Snap1 = Allocator.GetSnapshot();
+    EXPECT_EQ(Snap1.LiveAllocations, 0);
+    EXPECT_EQ(Snap1.LiveBytes, 0);
+    EXPECT_EQ(Snap1.Sites[0].TotalAllocations, static_cast<Uint64>(NumThreads * AllocsPerThread));
+}
+
+TEST(Common_InstrumentedMemoryAllocator, TransientPeak)
+{
+    InstrumentedMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    void* pPersistent = Allocator.Allocate(100, "Persistent", __FILE__, 1);
+    auto  Snap0       = Allocator.GetSnapshot();
+    EXPECT_EQ(Snap0.PeakBytes, 100);
+
+    // Allocations that are released before the next snapshot must still be reflected in the peak
+    void* pTemp0 = Allocator.Allocate(1000, "Temp", __FILE__, 2);
+    void* pTemp1 = Allocator.Allocate(2000, "Temp", __FILE__, 3);
+    Allocator.Free(pTemp0);
+    Allocator.Free(pTemp1);
+    pTemp0 = Allocator.Allocate(500, "Temp", __FILE__, 2);
+    Allocator.Free(pTemp0);
+
+    auto Snap1 = Allocator.GetSnapshot();
+    EXPECT_EQ(Snap1.LiveBytes, 100);
+    EXPECT_EQ(Snap1.PeakBytes, 3100);
+    ASSERT_EQ(Snap1.Sites.size(), size_t{3});
+    EXPECT_EQ(Snap1.Sites[1].LiveBytes, 0);
+    EXPECT_EQ(Snap1.Sites[1].PeakBytes, 1000);
+    EXPECT_EQ(Snap1.Sites[2].PeakBytes, 2000);
+
+    // The peak is not accumulated across snapshots
+    std::thread Worker{[&]() {
+        void* pData = Allocator.Allocate(1500, "Worker", __FILE__, 4);
+        Allocator.Free(pData);
+    }};
+    Worker.join();
+
+    auto Snap2 = Allocator.GetSnapshot();
+    EXPECT_EQ(Snap2.PeakBytes, 3100);
+    EXPECT_EQ(Snap2.Sites[3].PeakBytes, 1500);
+
+    void* pWorker = nullptr;
+    Worker        = std::thread{[&]() { pWorker = Allocator.Allocate(4000, "Worker", __FILE__, 4); }};
+    Worker.join();
+
+    auto Snap3 = Allocator.GetSnapshot();
+    EXPECT_EQ(Snap3.PeakBytes, 4100);
+
+    Allocator.Free(pWorker);
+    Allocator.Free(pPersistent);
+}
+
+TEST(Common_InstrumentedMemoryAllocator, Sampling)
+{
+    constexpr Uint32 SamplingInterval = 16;
+    InstrumentedMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator(), SamplingInterval};
+    EXPECT_EQ(Allocator.GetSamplingInterval(), SamplingInterval);
+
+    constexpr size_t   NumAllocs = 16384;
+    std::vector<void*> Allocs;
+    for (size_t i = 0; i < NumAllocs; ++i)
+        Allocs.push_back(Allocator.Allocate(8, "Sampled", __FILE__, __LINE__));
+
+    auto Snap = Allocator.GetSnapshot();
+    EXPECT_EQ(Snap.SamplingInterval, SamplingInterval);
+    EXPECT_EQ(Snap.LiveAllocations % SamplingInterval, 0);
+    EXPECT_GT(Snap.LiveAllocations, static_cast<Int64>(NumAllocs / 2));
+    EXPECT_LT(Snap.LiveAllocations, static_cast<Int64>(NumAllocs * 2));
+
+    for (void* pData : Allocs)
+        Allocator.Free(pData);
+
+    Snap = Allocator.GetSnapshot();
+    EXPECT_EQ(Snap.LiveAllocations, 0);
+    EXPECT_EQ(Snap.LiveBytes, 0);
+}
+
+TEST(Common_InstrumentedMemoryAllocator, SiteKeys)
+{
+    InstrumentedMemoryAllocator Allocator{DefaultRawMemoryAllocator::GetAllocator()};
+
+    constexpr size_t   NumAllocs = 1000;
+    std::vector<void*> Allocs;
+
+    // Different pointers to identical strings map to the same site
+    for (size_t i = 0; i < NumAllocs; ++i)
+    {
+        const std::string Description = "Dynamic";
+        Allocs.push_back(Allocator.Allocate(8, Description.c_str(), __FILE__, 1));
+    }
+
+    // The same buffer with different contents maps to different sites
+    char Description[16] = {};
+    for (size_t i = 0; i < 4; ++i)
+    {
+        snprintf(Description, sizeof(Description), "Buffer %d", static_cast<int>(i));
+        Allocs.push_back(Allocator.Allocate(16, Description, __FILE__, 2));
+    }
+
+    auto Snap = Allocator.GetSnapshot();
+    ASSERT_EQ(Snap.Sites.size(), size_t{5});
+    EXPECT_EQ(Snap.Sites[0].Description, "Dynamic");
+    EXPECT_EQ(Snap.Sites[0].LiveAllocations, static_cast<Int64>(NumAllocs));
+    for (size_t i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(Snap.Sites[1 + i].Description, "Buffer " + std::to_string(i));
+        EXPECT_EQ(Snap.Sites[1 + i].LiveBytes, 16);
+    }
+
+    for (void* pData : Allocs)
+        Allocator.Free(pData);
+
+    Snap = Allocator.GetSnapshot();
+    EXPECT_EQ(Snap.LiveBytes, 0);
+    EXPECT_EQ(Snap.Sites[0].PeakBytes, static_cast<Int64>(NumAllocs * 8));
+    EXPECT_EQ(Snap.PeakBytes, static_cast<Int64>(NumAllocs * 8 + 4 * 16));
+}
+
 } // namespace
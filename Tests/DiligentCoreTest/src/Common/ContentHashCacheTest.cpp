@@ -0,0 +1,203 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "ContentHashCache.hpp"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "DataBlobImpl.hpp"
+#include "ThreadPool.hpp"
+#include "TestingEnvironment.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+constexpr Uint32 TestMagic   = 0x54534554; // TEST
+constexpr Uint32 TestVersion = 1;
+
+using TestCache = ContentHashCache<std::string>;
+
+ContentHashKey MakeKey(Uint64 Value)
+{
+    ContentHashKey Key;
+    Key.Low  = Value;
+    Key.High = ~Value;
+    return Key;
+}
+
+RefCntAutoPtr<IDataBlob> CopyBlob(const IDataBlob* pData, size_t ExtraBytes = 0)
+{
+    RefCntAutoPtr<DataBlobImpl> pCopy = DataBlobImpl::Create(pData->GetSize() + ExtraBytes);
+    std::memcpy(pCopy->GetDataPtr(), pData->GetConstDataPtr(), pData->GetSize());
+    return RefCntAutoPtr<IDataBlob>{pCopy};
+}
+
+TEST(Common_ContentHashCache, StoreLoad)
+{
+    RefCntAutoPtr<IDataBlob> pData;
+    {
+        TestCache Cache{"test cache", TestMagic, TestVersion};
+        Cache.Add(MakeKey(1), "Value 1");
+        Cache.Add(MakeKey(2), "");
+        Cache.Add(MakeKey(3), std::string("Value\0 3", 8));
+        // Adding the same key again does nothing
+        Cache.Add(MakeKey(1), "Other value");
+        Cache.Store(&pData);
+        ASSERT_NE(pData, nullptr);
+
+        const TestCache::Statistics Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumEntries, 3u);
+        EXPECT_EQ(Stats.DataSize, 15u);
+    }
+
+    TestCache Cache{"test cache", TestMagic, TestVersion};
+    ASSERT_TRUE(Cache.Load(pData));
+
+    std::string Value;
+    EXPECT_TRUE(Cache.Find(MakeKey(1), Value));
+    EXPECT_EQ(Value, "Value 1");
+    EXPECT_TRUE(Cache.Find(MakeKey(2), Value));
+    EXPECT_EQ(Value, "");
+    EXPECT_TRUE(Cache.Find(MakeKey(3), Value));
+    EXPECT_EQ(Value, std::string("Value\0 3", 8));
+    EXPECT_FALSE(Cache.Find(MakeKey(4), Value));
+
+    const TestCache::Statistics Stats = Cache.GetStatistics();
+    EXPECT_EQ(Stats.NumEntries, 3u);
+    EXPECT_EQ(Stats.NumHits, 3u);
+    EXPECT_EQ(Stats.NumMisses, 1u);
+
+    // Data with a different version is ignored
+    TestCache OtherVersionCache{"test cache", TestMagic, TestVersion + 1};
+    EXPECT_FALSE(OtherVersionCache.Load(pData));
+    EXPECT_EQ(OtherVersionCache.GetStatistics().NumEntries, 0u);
+}
+
+TEST(Common_ContentHashCache, Eviction)
+{
+    TestCache Cache{"test cache", TestMagic, TestVersion, 8};
+    Cache.Add(MakeKey(1), "1234");
+    Cache.Add(MakeKey(2), "5678");
+    // The value exceeds the limit on its own and is not added
+    Cache.Add(MakeKey(3), "123456789");
+    EXPECT_EQ(Cache.GetStatistics().NumEntries, 2u);
+
+    // The oldest entry is evicted
+    Cache.Add(MakeKey(4), "90");
+
+    std::string Value;
+    EXPECT_FALSE(Cache.Find(MakeKey(1), Value));
+    EXPECT_TRUE(Cache.Find(MakeKey(2), Value));
+    EXPECT_FALSE(Cache.Find(MakeKey(3), Value));
+    EXPECT_TRUE(Cache.Find(MakeKey(4), Value));
+
+    const TestCache::Statistics Stats = Cache.GetStatistics();
+    EXPECT_EQ(Stats.NumEntries, 2u);
+    EXPECT_EQ(Stats.DataSize, 6u);
+    EXPECT_EQ(Stats.NumEvictions, 1u);
+}
+
+TEST(Common_ContentHashCache, LoadCorruptedData)
+{
+    RefCntAutoPtr<IDataBlob> pData;
+    {
+        TestCache Cache{"test cache", TestMagic, TestVersion};
+        Cache.Add(MakeKey(1), "Value 1");
+        Cache.Store(&pData);
+        ASSERT_NE(pData, nullptr);
+    }
+
+    {
+        // Trailing bytes
+        RefCntAutoPtr<IDataBlob> pTrailing = CopyBlob(pData, 4);
+
+        TestCache                      Cache{"test cache", TestMagic, TestVersion};
+        TestingEnvironment::ErrorScope ExpectedErrors{"unexpected bytes at the end of the data"};
+        EXPECT_FALSE(Cache.Load(pTrailing));
+        EXPECT_EQ(Cache.GetStatistics().NumEntries, 0u);
+    }
+
+    {
+        // The entry count that does not fit into the data must be rejected before anything is allocated
+        RefCntAutoPtr<IDataBlob> pHugeCount = CopyBlob(pData);
+
+        const Uint32 NumEntries = ~0u;
+        std::memcpy(static_cast<Uint8*>(pHugeCount->GetDataPtr()) + sizeof(Uint32) * 2, &NumEntries, sizeof(NumEntries));
+
+        TestCache                      Cache{"test cache", TestMagic, TestVersion};
+        TestingEnvironment::ErrorScope ExpectedErrors{"entries can't fit into"};
+        EXPECT_FALSE(Cache.Load(pHugeCount));
+        EXPECT_EQ(Cache.GetStatistics().NumEntries, 0u);
+    }
+
+    {
+        const char               Garbage[] = "Not a cache";
+        RefCntAutoPtr<IDataBlob> pGarbage  = DataBlobImpl::Create(sizeof(Garbage), Garbage);
+
+        TestCache                      Cache{"test cache", TestMagic, TestVersion};
+        TestingEnvironment::ErrorScope ExpectedErrors{"Data blob does not contain a valid test cache"};
+        EXPECT_FALSE(Cache.Load(pGarbage));
+    }
+}
+
+TEST(Common_ContentHashCache, ProcessInParallel)
+{
+    ThreadPoolCreateInfo ThreadPoolCI;
+    ThreadPoolCI.NumThreads = 4;
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCI);
+    ASSERT_NE(pThreadPool, nullptr);
+
+    TestCache Cache{"test cache", TestMagic, TestVersion};
+
+    constexpr size_t NumItems = 64;
+    for (IThreadPool* pPool : {static_cast<IThreadPool*>(nullptr), pThreadPool.RawPtr()})
+    {
+        std::vector<std::string> Results(NumItems);
+        ProcessInParallel(pPool, NumItems, [&](size_t i) {
+            // Every other item shares the key with its neighbor
+            const ContentHashKey Key = MakeKey(i / 2);
+            if (!Cache.Find(Key, Results[i]))
+            {
+                Results[i] = std::to_string(i / 2);
+                Cache.Add(Key, Results[i]);
+            }
+        });
+
+        for (size_t i = 0; i < NumItems; ++i)
+            EXPECT_EQ(Results[i], std::to_string(i / 2));
+    }
+    EXPECT_EQ(Cache.GetStatistics().NumEntries, NumItems / 2);
+}
+
+} // namespace
@@ -0,0 +1,150 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrustumCulling.hpp"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "FastRand.hpp"
+#include "ThreadPool.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+struct TestBoxes
+{
+    explicit TestBoxes(Uint32 NumBoxes)
+    {
+        // Use values that are multiples of 1/8 so that BoundBox{Center - Extent, Center + Extent}
+        // is exactly representable and the reference results are not affected by rounding.
+        FastRandInt Rnd{0, -800, +800};
+        FastRandInt RndExt{1, 0, 40};
+
+        CX.resize(NumBoxes);
+        CY.resize(NumBoxes);
+        CZ.resize(NumBoxes);
+        EX.resize(NumBoxes);
+        EY.resize(NumBoxes);
+        EZ.resize(NumBoxes);
+        for (Uint32 i = 0; i < NumBoxes; ++i)
+        {
+            CX[i] = static_cast<float>(Rnd()) / 8.f;
+            CY[i] = static_cast<float>(Rnd()) / 8.f;
+            CZ[i] = static_cast<float>(Rnd()) / 8.f;
+            EX[i] = static_cast<float>(RndExt()) / 8.f;
+            EY[i] = static_cast<float>(RndExt()) / 8.f;
+            EZ[i] = static_cast<float>(RndExt()) / 8.f;
+        }
+
+        SoA.CenterX     = CX.data();
+        SoA.CenterY     = CY.data();
+        SoA.CenterZ     = CZ.data();
+        SoA.HalfExtentX = EX.data();
+        SoA.HalfExtentY = EY.data();
+        SoA.HalfExtentZ = EZ.data();
+        SoA.NumBoxes    = NumBoxes;
+    }
+
+    BoundBox GetBox(Uint32 i) const
+    {
+        const float3 Center{CX[i], CY[i], CZ[i]};
+        const float3 Extent{EX[i], EY[i], EZ[i]};
+        return BoundBox{Center - Extent, Center + Extent};
+    }
+
+    std::vector<float> CX, CY, CZ, EX, EY, EZ;
+
+    BoundBoxesSoA SoA;
+};
+
+ViewFrustumExt GetTestFrustum()
+{
+    const float4x4 View = float4x4::RotationY(0.3f) * float4x4::RotationX(-0.2f) * float4x4::Translation(5.f, -3.f, 40.f);
+    const float4x4 Proj = float4x4::Projection(PI_F / 3.f, 1.5f, 1.f, 80.f, false);
+
+    ViewFrustumExt Frustum;
+    ExtractViewFrustumPlanesFromMatrix(View * Proj, Frustum, false);
+    return Frustum;
+}
+
+template <typename FrustumType>
+void TestBoxesVisibility(const FrustumType& Frustum, Uint32 NumBoxes, FRUSTUM_PLANE_FLAGS PlaneFlags, IThreadPool* pThreadPool)
+{
+    const TestBoxes Boxes{NumBoxes};
+
+    std::vector<Uint32> RefIndices;
+    for (Uint32 i = 0; i < NumBoxes; ++i)
+    {
+        if (GetBoxVisibility(Frustum, Boxes.GetBox(i), PlaneFlags) != BoxVisibility::Invisible)
+            RefIndices.push_back(i);
+    }
+
+    // Fill the mask with garbage to check that all words are written
+    std::vector<Uint32> Mask(GetBoxVisibilityMaskSize(NumBoxes), 0xDEADBEEFu);
+    GetBoxesVisibility(Frustum, Boxes.SoA, Mask.data(), PlaneFlags, pThreadPool);
+
+    std::vector<Uint32> RefMask(GetBoxVisibilityMaskSize(NumBoxes));
+    for (Uint32 Idx : RefIndices)
+        RefMask[Idx / 32] |= 1u << (Idx % 32);
+    EXPECT_EQ(Mask, RefMask);
+
+    std::vector<Uint32> Indices(NumBoxes);
+    const Uint32        NumVisible = GetVisibleBoxes(Frustum, Boxes.SoA, Indices.data(), PlaneFlags, pThreadPool);
+    Indices.resize(NumVisible);
+    EXPECT_EQ(Indices, RefIndices);
+}
+
+TEST(Common_FrustumCulling, GetBoxesVisibility)
+{
+    const ViewFrustumExt Frustum = GetTestFrustum();
+    for (Uint32 NumBoxes : {0u, 1u, 3u, 4u, 7u, 8u, 31u, 32u, 33u, 100u, 1025u})
+    {
+        for (FRUSTUM_PLANE_FLAGS PlaneFlags : {FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, FRUSTUM_PLANE_FLAG_OPEN_NEAR, FRUSTUM_PLANE_FLAG_NONE})
+        {
+            TestBoxesVisibility(static_cast<const ViewFrustum&>(Frustum), NumBoxes, PlaneFlags, nullptr);
+            TestBoxesVisibility(Frustum, NumBoxes, PlaneFlags, nullptr);
+        }
+    }
+}
+
+TEST(Common_FrustumCulling, GetBoxesVisibilityParallel)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    const ViewFrustumExt Frustum = GetTestFrustum();
+    for (Uint32 NumBoxes : {16384u, 16385u, 100000u})
+    {
+        TestBoxesVisibility(static_cast<const ViewFrustum&>(Frustum), NumBoxes, FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, pThreadPool);
+        TestBoxesVisibility(Frustum, NumBoxes, FRUSTUM_PLANE_FLAG_FULL_FRUSTUM, pThreadPool);
+    }
+}
+
+} // namespace
@@ -982,6 +982,7 @@ void TestGraphicsPipelineDescHasher()
     TEST_RANGE(NumViewports, Uint8{2u}, Uint8{32u});
     TEST_RANGE(SubpassIndex, Uint8{1u}, Uint8{8u});
     TEST_FLAGS(ShadingRateFlags, static_cast<PIPELINE_SHADING_RATE_FLAGS>(1), PIPELINE_SHADING_RATE_FLAG_LAST);
+    TEST_FLAGS(DynamicStates, static_cast<PIPELINE_DYNAMIC_STATE_FLAGS>(1), PIPELINE_DYNAMIC_STATE_FLAG_LAST);
 
     for (Uint8 i = 1; i < MAX_RENDER_TARGETS; ++i)
     {
@@ -27,6 +27,7 @@
 
 #include <climits>
 #include <sstream>
+#include <vector>
 
 #include "BasicMath.hpp"
 #include "AdvancedMath.hpp"
@@ -1206,6 +1207,73 @@ TEST(Common_BasicMath, MatrixMultiply)
     }
 }
 
+TEST(Common_BasicMath, BatchedTransforms)
+{
+    const float4x4 m = float4x4::RotationY(0.5f) * float4x4::Scale(2.f, 3.f, 4.f) * float4x4::Translation(1, -2, 3) * float4x4::Projection(PI_F / 4.f, 1.5f, 0.1f, 100.f, false);
+
+    constexpr size_t NumElements = 37;
+
+    std::vector<float3>   Points(NumElements);
+    std::vector<float4>   Vectors(NumElements);
+    std::vector<float4x4> Matrices(NumElements);
+    for (size_t i = 0; i < NumElements; ++i)
+    {
+        const float f = static_cast<float>(i);
+        Points[i]     = float3{f * 0.25f - 3.f, f * 0.5f + 1.f, f + 5.f};
+        Vectors[i]    = float4{f - 10.f, f * 0.75f, -f * 0.5f, f * 0.125f + 1.f};
+        Matrices[i]   = float4x4::RotationZ(f * 0.1f) * float4x4::Translation(f, -f, f * 2.f);
+    }
+
+    {
+        std::vector<float3> Dst(NumElements);
+        TransformPoints(Points.data(), Dst.data(), NumElements, m);
+        for (size_t i = 0; i < NumElements; ++i)
+        {
+            const float3 Ref = Points[i] * m;
+            EXPECT_LE(length(Dst[i] - Ref), 1e-5f * (length(Ref) + 1.f)) << i;
+        }
+
+        // In-place transform
+        std::vector<float3> InPlace = Points;
+        TransformPoints(InPlace.data(), InPlace.data(), NumElements, m);
+        EXPECT_EQ(InPlace, Dst);
+    }
+
+    {
+        std::vector<float4> Dst(NumElements);
+        TransformVectors(Vectors.data(), Dst.data(), NumElements, m);
+        for (size_t i = 0; i < NumElements; ++i)
+        {
+            const float4 Ref = Vectors[i] * m;
+            EXPECT_LE(length(Dst[i] - Ref), 1e-5f * (length(Ref) + 1.f)) << i;
+        }
+
+        std::vector<float4> InPlace = Vectors;
+        TransformVectors(InPlace.data(), InPlace.data(), NumElements, m);
+        EXPECT_EQ(InPlace, Dst);
+    }
+
+    {
+        std::vector<float4x4> Dst(NumElements);
+        MultiplyMatrices(Matrices.data(), Dst.data(), NumElements, m);
+        for (size_t i = 0; i < NumElements; ++i)
+        {
+            const float4x4 Ref = Matrices[i] * m;
+            for (int j = 0; j < 16; ++j)
+                EXPECT_NEAR(Dst[i].Data()[j], Ref.Data()[j], 1e-4f * (std::abs(Ref.Data()[j]) + 1.f)) << i << ' ' << j;
+        }
+
+        std::vector<float4x4> InPlace = Matrices;
+        MultiplyMatrices(InPlace.data(), InPlace.data(), NumElements, m);
+        EXPECT_EQ(InPlace, Dst);
+    }
+
+    // Empty input must be a no-op
+    TransformPoints(nullptr, nullptr, 0, m);
+    TransformVectors(nullptr, nullptr, 0, m);
+    MultiplyMatrices(nullptr, nullptr, 0, m);
+}
+
 TEST(Common_BasicMath, VectorRecast)
 {
     EXPECT_EQ(float2(1, 2).Recast<int>(), Vector2<int>(1, 2));
@@ -25,6 +25,7 @@
  */
 
 #include "ParsingTools.hpp"
+#include "DefaultRawMemoryAllocator.hpp"
 
 #include <limits.h>
 
@@ -1425,6 +1426,12 @@ TEST(Common_ParsingTools, RefinePreprocessorDirective)
         EXPECT_STREQ(RefinePreprocessorDirective(Str).c_str(), RefStr);
         EXPECT_STREQ(RefinePreprocessorDirective(Str.c_str()).c_str(), RefStr);
         EXPECT_STREQ(RefinePreprocessorDirective(Str.c_str(), Str.length()).c_str(), RefStr);
+
+        const char* DirectiveStart = nullptr;
+        const char* DirectiveEnd   = nullptr;
+        const bool  Found          = RefinePreprocessorDirective(Str.c_str(), Str.c_str() + Str.length(), DirectiveStart, DirectiveEnd);
+        EXPECT_EQ(Found, *RefStr != '\0');
+        EXPECT_EQ(std::string(DirectiveStart, DirectiveEnd), RefStr);
     };
 
     TestRefine("", "");
@@ -1662,4 +1669,128 @@ void main()
          {{"version"}, {"extension"}, {"error"}});
 }
 
+TEST(Common_ParsingTools, Tokenizer_TokenView)
+{
+    static const char* TestStr = R"(
+#include "Header.h"
+// Comment
+void main(in float4 Pos, out float4 Col)
+{
+    /* Comment */ Col = Pos * 2.0 + -1.0;
+    Col.x += Keyword1(Col.y) >> 2;
+    if (Col.x <= 0.5 && Col.y != 1.0) return;
+}
+)";
+
+    const auto* StrEnd    = TestStr + strlen(TestStr);
+    const auto  RefTokens = Tokenize<TestToken, std::vector<TestToken>>(TestStr, StrEnd, TestToken::Create, TestToken::FindType);
+
+    using TestTokenView = TokenView<TestTokenType>;
+
+    auto CheckTokens = [&](const auto& Tokens) {
+        ASSERT_EQ(Tokens.size(), RefTokens.size());
+        for (size_t i = 0; i < Tokens.size(); ++i)
+        {
+            const TestTokenView& Token    = Tokens[i];
+            const TestToken&     RefToken = RefTokens[i];
+            EXPECT_EQ(Token.GetType(), RefToken.GetType());
+            EXPECT_EQ(std::string(Token.LiteralStart, Token.LiteralEnd), RefToken.Literal);
+            EXPECT_EQ(std::string(Token.DelimStart, Token.DelimEnd), RefToken.Delimiter);
+            if (!RefToken.Literal.empty())
+            {
+                EXPECT_TRUE(Token.CompareLiteral(RefToken.Literal.c_str()));
+            }
+        }
+    };
+
+    {
+        const auto Tokens = Tokenize<TestTokenView, std::vector<TestTokenView>>(TestStr, StrEnd, TestTokenView::Create, TestToken::FindType);
+        CheckTokens(Tokens);
+        EXPECT_STREQ(BuildSource(Tokens).c_str(), TestStr);
+    }
+
+    {
+        std::vector<TestTokenView> Tokens;
+        std::string                Source;
+        for (size_t i = 0; i < 2; ++i)
+        {
+            // Container and buffer memory is reused on the second iteration
+            Tokenize<TestTokenView>(TestStr, StrEnd, TestTokenView::Create, TestToken::FindType, Tokens);
+            CheckTokens(Tokens);
+
+            BuildSource(Tokens, Source);
+            EXPECT_STREQ(Source.c_str(), TestStr);
+        }
+    }
+
+    {
+        DynamicLinearAllocator          Arena{DefaultRawMemoryAllocator::GetAllocator()};
+        ArenaTokenVector<TestTokenView> Tokens{STD_ALLOCATOR(TestTokenView, DynamicLinearAllocator, Arena, "Tokens")};
+        Tokens.reserve(strlen(TestStr) / 4);
+        Tokenize<TestTokenView>(TestStr, StrEnd, TestTokenView::Create, TestToken::FindType, Tokens);
+        CheckTokens(Tokens);
+        EXPECT_STREQ(BuildSource(Tokens).c_str(), TestStr);
+    }
+}
+
+TEST(Common_ParsingTools, VectorizedScans)
+{
+    // Vectorized scans are used for character pointers, while generic
+    // versions are used for other iterators. The results must be identical.
+    std::string Source;
+    for (int i = 0; i < 8; ++i)
+    {
+        Source += "#include \"Common.fxh\"\r\n"
+                  "  #  define MACRO_";
+        Source += std::to_string(i);
+        Source += "  1 // Comment\n"
+                  "/* Multi-line\n"
+                  "   comment */\t\t\n"
+                  "float4 main(in float4 Pos : SV_Position) : SV_Target   /***/\r"
+                  "{\n"
+                  "    return Pos * 2.0 / 3.0;      \t  \n"
+                  "}\n\n\n";
+    }
+    Source.push_back('\0');
+    Source += "   /* unterminated comment";
+
+    const char* const Ptr = Source.c_str();
+    const auto        It  = Source.cbegin();
+
+    const size_t Len = Source.length();
+    for (size_t Start = 0; Start < Len; ++Start)
+    {
+        for (size_t End : {std::min(Start + 7, Len), std::min(Start + 40, Len), Len})
+        {
+            auto ToOffset = [&](auto Pos) { return static_cast<size_t>(&*Pos - Ptr); };
+
+            EXPECT_EQ(SkipLine(Ptr + Start, Ptr + End) - Ptr, SkipLine(It + Start, It + End) - It);
+            EXPECT_EQ(SkipLine(Ptr + Start, Ptr + End, true) - Ptr, SkipLine(It + Start, It + End, true) - It);
+            EXPECT_EQ(SkipDelimiters(Ptr + Start, Ptr + End) - Ptr, SkipDelimiters(It + Start, It + End) - It);
+            EXPECT_EQ(SkipDelimiters(Ptr + Start, Ptr + End, " \t") - Ptr, SkipDelimiters(It + Start, It + End, " \t") - It);
+            EXPECT_EQ(SkipDelimiters(Ptr + Start, Ptr + End, " \t\r\n\\") - Ptr, SkipDelimiters(It + Start, It + End, " \t\r\n\\") - It);
+
+            size_t PtrPos = 0;
+            size_t ItPos  = 0;
+            try
+            {
+                PtrPos = SkipDelimitersAndComments(Ptr + Start, Ptr + End) - Ptr;
+            }
+            catch (const std::pair<const char*, const char*>& Err)
+            {
+                PtrPos = ~ToOffset(Err.first);
+            }
+            try
+            {
+                ItPos = SkipDelimitersAndComments(It + Start, It + End) - It;
+            }
+            catch (const std::pair<std::string::const_iterator, const char*>& Err)
+            {
+                ItPos = ~ToOffset(Err.first);
+            }
+            EXPECT_EQ(PtrPos, ItPos);
+        }
+    }
+}
+
 } // namespace
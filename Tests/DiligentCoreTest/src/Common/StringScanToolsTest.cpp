@@ -0,0 +1,132 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "StringScanTools.hpp"
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "FastRand.hpp"
+
+using namespace Diligent;
+
+namespace
+{
+
+const char* FindFirstOfRef(const char* Start, const char* End, const char* Chars, size_t NumChars)
+{
+    for (const char* Pos = Start; Pos != End; ++Pos)
+    {
+        if (std::char_traits<char>::find(Chars, NumChars, *Pos) != nullptr)
+            return Pos;
+    }
+    return End;
+}
+
+const char* FindFirstNotOfRef(const char* Start, const char* End, const char* Chars, size_t NumChars)
+{
+    for (const char* Pos = Start; Pos != End; ++Pos)
+    {
+        if (std::char_traits<char>::find(Chars, NumChars, *Pos) == nullptr)
+            return Pos;
+    }
+    return End;
+}
+
+TEST(Common_StringScanTools, FindChar)
+{
+    const char* Str = "0123456789abcdefghijklmnopqrstuvwxyz#0123456789";
+    const char* End = Str + strlen(Str);
+    EXPECT_EQ(FindChar(Str, End, '#'), Str + 36);
+    EXPECT_EQ(FindChar(Str, End, '!'), End);
+    EXPECT_EQ(FindChar(Str, Str, '0'), Str);
+    EXPECT_EQ(FindChar(Str + 1, End, '0'), Str + 37);
+}
+
+TEST(Common_StringScanTools, FindFirstOf)
+{
+    const char* Str = "float4 main(in float4 Pos : SV_Position) : SV_Target\n{\n    return Pos; // Comment\n}\n";
+    const char* End = Str + strlen(Str);
+
+    EXPECT_EQ(FindFirstOf(Str, End, '\r', '\n'), Str + 52);
+    EXPECT_EQ(FindFirstOf(Str, End, '/', '#', ';'), Str + 69);
+    EXPECT_EQ(FindFirstOf(Str, End, '/', '#', '!', '@'), Str + 71);
+    EXPECT_EQ(FindFirstOf(Str, End, '!', '@'), End);
+    EXPECT_EQ(FindFirstNotOf(Str + 55, End, ' ', '\t', '\r', '\n'), Str + 59);
+    EXPECT_EQ(FindFirstNotOf(Str, End, 'f', 'l', 'o'), Str + 3);
+    EXPECT_EQ(FindFirstNotOf(Str, Str, 'f', 'l'), Str);
+}
+
+TEST(Common_StringScanTools, RandomData)
+{
+    // Compare against the scalar reference at all offsets and lengths to exercise
+    // both the 16-character vector loop and the scalar tail.
+    static constexpr char Alphabet[]  = " \t\r\n#/*\"abcXYZ;{}\0";
+    static constexpr int  AlphabetLen = sizeof(Alphabet) - 1;
+
+    FastRand    Rnd{0};
+    std::string Data(256, ' ');
+    for (int Iter = 0; Iter < 64; ++Iter)
+    {
+        // Make long runs of the same character more likely
+        const int RunLen = 1 + Rnd() % 24;
+        for (size_t i = 0; i < Data.size(); ++i)
+        {
+            if (i % RunLen == 0)
+                Data[i] = Alphabet[Rnd() % AlphabetLen];
+            else
+                Data[i] = Data[i - 1];
+        }
+
+        const char Chars[4] = {
+            Alphabet[Rnd() % AlphabetLen],
+            Alphabet[Rnd() % AlphabetLen],
+            Alphabet[Rnd() % AlphabetLen],
+            Alphabet[Rnd() % AlphabetLen],
+        };
+
+        const char* Str = Data.c_str();
+        for (size_t Offset = 0; Offset < 32; ++Offset)
+        {
+            for (size_t Len : {size_t{0}, size_t{1}, size_t{15}, size_t{16}, size_t{17}, size_t{63}, Data.size() - Offset})
+            {
+                const char* Start = Str + Offset;
+                const char* End   = Start + Len;
+
+                EXPECT_EQ(FindChar(Start, End, Chars[0]), FindFirstOfRef(Start, End, Chars, 1));
+                EXPECT_EQ(FindFirstOf(Start, End, Chars[0], Chars[1]), FindFirstOfRef(Start, End, Chars, 2));
+                EXPECT_EQ(FindFirstOf(Start, End, Chars[0], Chars[1], Chars[2]), FindFirstOfRef(Start, End, Chars, 3));
+                EXPECT_EQ(FindFirstOf(Start, End, Chars[0], Chars[1], Chars[2], Chars[3]), FindFirstOfRef(Start, End, Chars, 4));
+                EXPECT_EQ(FindFirstNotOf(Start, End, Chars[0], Chars[1]), FindFirstNotOfRef(Start, End, Chars, 2));
+                EXPECT_EQ(FindFirstNotOf(Start, End, Chars[0], Chars[1], Chars[2]), FindFirstNotOfRef(Start, End, Chars, 3));
+                EXPECT_EQ(FindFirstNotOf(Start, End, Chars[0], Chars[1], Chars[2], Chars[3]), FindFirstNotOfRef(Start, End, Chars, 4));
+            }
+        }
+    }
+}
+
+} // namespace
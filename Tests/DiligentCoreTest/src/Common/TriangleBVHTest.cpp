@@ -0,0 +1,240 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "TriangleBVH.hpp"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "GeometryPrimitives.h"
+#include "FastRand.hpp"
+#include "ThreadPool.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "DataBlob.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+struct TestMesh
+{
+    std::vector<float3> Vertices;
+    std::vector<Uint32> Indices;
+
+    Uint32 GetNumTriangles() const { return static_cast<Uint32>(Indices.size() / 3); }
+
+    void AddPrimitive(const GeometryPrimitiveAttributes& Attribs, const float4x4& Transform)
+    {
+        RefCntAutoPtr<IDataBlob> pVertices;
+        RefCntAutoPtr<IDataBlob> pIndices;
+        GeometryPrimitiveInfo    Info;
+        CreateGeometryPrimitive(Attribs, &pVertices, &pIndices, &Info);
+        ASSERT_TRUE(pVertices && pIndices);
+        ASSERT_EQ(Info.VertexSize, sizeof(float3));
+
+        const Uint32 BaseVertex = static_cast<Uint32>(Vertices.size());
+
+        const float3* pPos = pVertices->GetConstDataPtr<float3>();
+        for (Uint32 v = 0; v < Info.NumVertices; ++v)
+            Vertices.push_back(pPos[v] * Transform);
+
+        const Uint32* pIdx = pIndices->GetConstDataPtr<Uint32>();
+        for (Uint32 i = 0; i < Info.NumIndices; ++i)
+            Indices.push_back(BaseVertex + pIdx[i]);
+    }
+
+    TriangleBVH::Hit CastRayBruteForce(const TriangleBVH::Ray& R, bool CullBackFace) const
+    {
+        TriangleBVH::Hit Hit;
+        for (Uint32 t = 0; t < GetNumTriangles(); ++t)
+        {
+            const float Dist = IntersectRayTriangle(Vertices[Indices[t * 3 + 0]], Vertices[Indices[t * 3 + 1]], Vertices[Indices[t * 3 + 2]],
+                                                    R.Origin, R.Direction, CullBackFace);
+            if (Dist >= 0 && Dist <= R.MaxDistance && Dist < Hit.Distance)
+            {
+                Hit.Distance      = Dist;
+                Hit.TriangleIndex = t;
+            }
+        }
+        return Hit;
+    }
+
+    TriangleBVHCreateInfo GetBVHCreateInfo() const
+    {
+        TriangleBVHCreateInfo CI;
+        CI.pVertices    = Vertices.data();
+        CI.NumVertices  = static_cast<Uint32>(Vertices.size());
+        CI.pIndices     = Indices.data();
+        CI.NumTriangles = GetNumTriangles();
+        return CI;
+    }
+};
+
+TestMesh CreateTestMesh()
+{
+    TestMesh Mesh;
+    Mesh.AddPrimitive(SphereGeometryPrimitiveAttributes{2.f, GEOMETRY_PRIMITIVE_VERTEX_FLAG_POSITION, 16}, float4x4::Translation(-3, 0, 0));
+    Mesh.AddPrimitive(SphereGeometryPrimitiveAttributes{1.f, GEOMETRY_PRIMITIVE_VERTEX_FLAG_POSITION, 8}, float4x4::Translation(3, 1, -2));
+    Mesh.AddPrimitive(CubeGeometryPrimitiveAttributes{3.f, GEOMETRY_PRIMITIVE_VERTEX_FLAG_POSITION, 4}, float4x4::RotationY(0.5f) * float4x4::Translation(1, -3, 4));
+    // Overlapping cube to create triangles with coinciding centroids
+    Mesh.AddPrimitive(CubeGeometryPrimitiveAttributes{3.f, GEOMETRY_PRIMITIVE_VERTEX_FLAG_POSITION, 4}, float4x4::RotationY(0.5f) * float4x4::Translation(1, -3, 4));
+    return Mesh;
+}
+
+std::vector<TriangleBVH::Ray> CreateTestRays(Uint32 NumRays)
+{
+    FastRandFloat Rnd{0, -10, +10};
+
+    std::vector<TriangleBVH::Ray> Rays(NumRays);
+    for (TriangleBVH::Ray& R : Rays)
+    {
+        R.Origin = float3{Rnd(), Rnd(), Rnd()};
+        // Aim at the scene with some spread, so that both hits and misses are tested
+        R.Direction = float3{Rnd(), Rnd(), Rnd()} * 0.3f - R.Origin;
+        if (R.Direction == float3{})
+            R.Direction = float3{0, 0, 1};
+    }
+    // Axis-aligned rays
+    Rays[0] = {float3{-10, 0, 0}, float3{1, 0, 0}};
+    Rays[1] = {float3{3, 1, 10}, float3{0, 0, -1}};
+    Rays[2] = {float3{1, 10, 4}, float3{0, -1, 0}, 5.f};
+    return Rays;
+}
+
+void VerifyHit(const TestMesh& Mesh, const TriangleBVH::Ray& R, const TriangleBVH::Hit& Hit, const TriangleBVH::Hit& RefHit)
+{
+    ASSERT_EQ(static_cast<bool>(Hit), static_cast<bool>(RefHit));
+    if (!RefHit)
+        return;
+
+    EXPECT_EQ(Hit.Distance, RefHit.Distance);
+    if (Hit.TriangleIndex != RefHit.TriangleIndex)
+    {
+        // Different triangles may only be hit at the same distance, e.g. at a shared edge
+        const float Dist = IntersectRayTriangle(Mesh.Vertices[Mesh.Indices[Hit.TriangleIndex * 3 + 0]],
+                                                Mesh.Vertices[Mesh.Indices[Hit.TriangleIndex * 3 + 1]],
+                                                Mesh.Vertices[Mesh.Indices[Hit.TriangleIndex * 3 + 2]],
+                                                R.Origin, R.Direction);
+        EXPECT_EQ(Dist, RefHit.Distance);
+    }
+
+    const float3& V0 = Mesh.Vertices[Mesh.Indices[Hit.TriangleIndex * 3 + 0]];
+    const float3& V1 = Mesh.Vertices[Mesh.Indices[Hit.TriangleIndex * 3 + 1]];
+    const float3& V2 = Mesh.Vertices[Mesh.Indices[Hit.TriangleIndex * 3 + 2]];
+
+    const float3 HitPos = V0 * (1 - Hit.Barycentrics.x - Hit.Barycentrics.y) + V1 * Hit.Barycentrics.x + V2 * Hit.Barycentrics.y;
+    EXPECT_LT(length(HitPos - (R.Origin + R.Direction * Hit.Distance)), 1e-3f);
+}
+
+TEST(Common_TriangleBVH, CastRay)
+{
+    const TestMesh Mesh = CreateTestMesh();
+
+    for (Uint32 MaxTrianglesPerLeaf : {1u, 4u, 16u})
+    {
+        TriangleBVHCreateInfo CI = Mesh.GetBVHCreateInfo();
+        CI.MaxTrianglesPerLeaf   = MaxTrianglesPerLeaf;
+
+        const TriangleBVH BVH{CI};
+        EXPECT_EQ(BVH.GetNumTriangles(), Mesh.GetNumTriangles());
+        EXPECT_GT(BVH.GetNumNodes(), size_t{1});
+
+        const std::vector<TriangleBVH::Ray> Rays = CreateTestRays(512);
+        Uint32                              NumHits = 0;
+        for (bool CullBackFace : {false, true})
+        {
+            for (const TriangleBVH::Ray& R : Rays)
+            {
+                const TriangleBVH::Hit RefHit = Mesh.CastRayBruteForce(R, CullBackFace);
+                const TriangleBVH::Hit Hit    = BVH.CastRay(R, CullBackFace);
+                VerifyHit(Mesh, R, Hit, RefHit);
+                EXPECT_EQ(BVH.AnyHit(R, CullBackFace), static_cast<bool>(RefHit));
+                NumHits += RefHit ? 1 : 0;
+            }
+        }
+        // Make sure that the test is meaningful
+        EXPECT_GT(NumHits, Rays.size() / 4);
+        EXPECT_LT(NumHits, Rays.size() * 2);
+    }
+}
+
+TEST(Common_TriangleBVH, NonIndexed)
+{
+    const TestMesh Mesh = CreateTestMesh();
+
+    std::vector<float4> Vertices(Mesh.Indices.size());
+    for (size_t i = 0; i < Mesh.Indices.size(); ++i)
+        Vertices[i] = float4{Mesh.Vertices[Mesh.Indices[i]], 1};
+
+    TriangleBVHCreateInfo CI;
+    CI.pVertices    = Vertices.data();
+    CI.NumVertices  = static_cast<Uint32>(Vertices.size());
+    CI.VertexStride = sizeof(float4);
+    CI.NumTriangles = Mesh.GetNumTriangles();
+
+    const TriangleBVH BVH{CI};
+    for (const TriangleBVH::Ray& R : CreateTestRays(256))
+        VerifyHit(Mesh, R, BVH.CastRay(R), Mesh.CastRayBruteForce(R, false));
+}
+
+TEST(Common_TriangleBVH, Parallel)
+{
+    auto pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    TestMesh Mesh;
+    for (int i = 0; i < 8; ++i)
+    {
+        const float f = static_cast<float>(i);
+        Mesh.AddPrimitive(SphereGeometryPrimitiveAttributes{1.f + f * 0.25f, GEOMETRY_PRIMITIVE_VERTEX_FLAG_POSITION, 24},
+                          float4x4::Translation(std::cos(f) * 6.f, std::sin(f) * 6.f, f - 4.f));
+    }
+    ASSERT_GT(Mesh.GetNumTriangles(), 4096u * 2);
+
+    TriangleBVHCreateInfo CI = Mesh.GetBVHCreateInfo();
+    CI.pThreadPool           = pThreadPool;
+
+    const TriangleBVH BVH{CI};
+
+    const std::vector<TriangleBVH::Ray> Rays = CreateTestRays(2048);
+
+    std::vector<TriangleBVH::Hit> Hits(Rays.size());
+    BVH.CastRays(Rays.data(), Hits.data(), static_cast<Uint32>(Rays.size()), false, pThreadPool);
+    for (size_t i = 0; i < Rays.size(); ++i)
+        VerifyHit(Mesh, Rays[i], Hits[i], Mesh.CastRayBruteForce(Rays[i], false));
+}
+
+TEST(Common_TriangleBVH, Empty)
+{
+    const TriangleBVH BVH{TriangleBVHCreateInfo{}};
+    EXPECT_EQ(BVH.GetNumNodes(), size_t{0});
+    EXPECT_FALSE(BVH.CastRay({float3{0, 0, 0}, float3{0, 0, 1}}));
+    EXPECT_FALSE(BVH.AnyHit({float3{0, 0, 0}, float3{0, 0, 1}}));
+}
+
+} // namespace
@@ -746,6 +746,21 @@ TEST(GraphicsAccessories_GraphicsAccessories, GetPipelineShadingRateFlagsString)
     EXPECT_STREQ(GetPipelineShadingRateFlagsString(PIPELINE_SHADING_RATE_FLAG_PER_PRIMITIVE | PIPELINE_SHADING_RATE_FLAG_TEXTURE_BASED).c_str(), "PER_PRIMITIVE | TEXTURE_BASED");
 }
 
+TEST(GraphicsAccessories_GraphicsAccessories, GetPipelineDynamicStateFlagsString)
+{
+    static_assert(PIPELINE_DYNAMIC_STATE_FLAG_LAST == 0x40, "Please update the test below to handle the new pipeline dynamic state flag");
+
+    EXPECT_STREQ(GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAG_NONE).c_str(), "NONE");
+    EXPECT_STREQ(GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE).c_str(), "CULL_MODE");
+    EXPECT_STREQ(GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAG_FRONT_FACE).c_str(), "FRONT_FACE");
+    EXPECT_STREQ(GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAG_PRIMITIVE_TOPOLOGY).c_str(), "PRIMITIVE_TOPOLOGY");
+    EXPECT_STREQ(GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_TEST).c_str(), "DEPTH_TEST");
+    EXPECT_STREQ(GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_WRITE).c_str(), "DEPTH_WRITE");
+    EXPECT_STREQ(GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_FUNC).c_str(), "DEPTH_FUNC");
+    EXPECT_STREQ(GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAG_STENCIL_OP).c_str(), "STENCIL_OP");
+    EXPECT_STREQ(GetPipelineDynamicStateFlagsString(PIPELINE_DYNAMIC_STATE_FLAG_CULL_MODE | PIPELINE_DYNAMIC_STATE_FLAG_DEPTH_FUNC).c_str(), "CULL_MODE | DEPTH_FUNC");
+}
+
 TEST(GraphicsAccessories_GraphicsAccessories, GetTextureComponentMappingString)
 {
     EXPECT_STREQ(GetTextureComponentMappingString(TextureComponentMapping::Identity()).c_str(), "rgba");
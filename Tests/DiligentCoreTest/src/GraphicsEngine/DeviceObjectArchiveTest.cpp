@@ -0,0 +1,211 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "../../../../Graphics/GraphicsEngine/include/DeviceObjectArchive.hpp"
+#include "../../../../Graphics/GraphicsEngine/include/EngineMemory.h"
+
+#include <cstring>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "RefCntAutoPtr.hpp"
+#include "Serializer.hpp"
+#include "TestingEnvironment.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+using DeviceType   = DeviceObjectArchive::DeviceType;
+using ResourceType = DeviceObjectArchive::ResourceType;
+
+constexpr DeviceType TestDevice = DeviceType::Vulkan;
+
+SerializedData MakeData(const std::string& Str)
+{
+    SerializedData Data{Str.size(), GetRawAllocator()};
+    std::memcpy(Data.Ptr(), Str.data(), Str.size());
+    return Data;
+}
+
+// Adds a standalone shader with the given byte code to the archive
+void AddShader(DeviceObjectArchive& Archive, const char* Name, const std::string& ByteCode)
+{
+    std::vector<SerializedData>& Shaders = Archive.GetDeviceShaders(TestDevice);
+
+    const Uint32 ShaderIdx = static_cast<Uint32>(Shaders.size());
+    Shaders.emplace_back(MakeData(ByteCode));
+
+    Serializer<SerializerMode::Measure> MeasureSer;
+    MeasureSer(ShaderIdx);
+    SerializedData DeviceData = MeasureSer.AllocateData(GetRawAllocator());
+
+    Serializer<SerializerMode::Write> Ser{DeviceData};
+    Ser(ShaderIdx);
+    ASSERT_TRUE(Ser.IsEnded());
+
+    DeviceObjectArchive::ResourceData& ResData = Archive.GetResourceData(ResourceType::StandaloneShader, Name);
+
+    ResData.Common                                          = MakeData(Name);
+    ResData.DeviceSpecific[static_cast<size_t>(TestDevice)] = std::move(DeviceData);
+}
+
+// Returns the byte code of the standalone shader, or an empty string if the shader is not found
+std::string GetShaderByteCode(const DeviceObjectArchive& Archive, const char* Name)
+{
+    const auto& Resources = Archive.GetNamedResources();
+
+    auto it = Resources.find(DeviceObjectArchive::NamedResourceKey{ResourceType::StandaloneShader, Name});
+    if (it == Resources.end())
+        return {};
+
+    Uint32                           ShaderIdx = ~0u;
+    Serializer<SerializerMode::Read> Ser{it->second.DeviceSpecific[static_cast<size_t>(TestDevice)]};
+    if (!Ser(ShaderIdx))
+        return {};
+
+    const SerializedData& ByteCode = Archive.GetSerializedShader(TestDevice, ShaderIdx);
+    return std::string{static_cast<const char*>(ByteCode.Ptr()), ByteCode.Size()};
+}
+
+size_t GetSerializedSize(const DeviceObjectArchive& Archive)
+{
+    RefCntAutoPtr<IDataBlob> pData;
+    Archive.Serialize(&pData);
+    return pData ? pData->GetSize() : 0;
+}
+
+TEST(DeviceObjectArchiveTest, Merge)
+{
+    DeviceObjectArchive Archive;
+    AddShader(Archive, "VS", "VS byte code");
+    AddShader(Archive, "PS", "PS byte code");
+
+    DeviceObjectArchive UpdateArchive;
+    AddShader(UpdateArchive, "CS", "CS byte code");
+    AddShader(UpdateArchive, "PS", "PS byte code");
+
+    EXPECT_EQ(Archive.RemoveResources("VS"), 1u);
+    EXPECT_EQ(Archive.RemoveResources("VS"), 0u);
+    Archive.Merge(UpdateArchive, /*ReplaceExisting = */ true);
+
+    // The identical pixel shader is deduplicated and the vertex shader is no longer referenced
+    EXPECT_EQ(Archive.GetDeviceShaders(TestDevice).size(), size_t{2});
+    EXPECT_EQ(Archive.GetNamedResources().size(), size_t{2});
+    EXPECT_EQ(GetShaderByteCode(Archive, "VS"), "");
+    EXPECT_EQ(GetShaderByteCode(Archive, "PS"), "PS byte code");
+    EXPECT_EQ(GetShaderByteCode(Archive, "CS"), "CS byte code");
+
+    // The archive now contains exactly the same resources and shaders as the update archive
+    EXPECT_EQ(GetSerializedSize(Archive), GetSerializedSize(UpdateArchive));
+
+    // Merging an archive with identical shaders under new names must not add shaders
+    DeviceObjectArchive AliasArchive;
+    AddShader(AliasArchive, "PS2", "PS byte code");
+    AddShader(AliasArchive, "CS2", "CS byte code");
+    Archive.Merge(AliasArchive);
+    EXPECT_EQ(Archive.GetDeviceShaders(TestDevice).size(), size_t{2});
+    EXPECT_EQ(Archive.GetNamedResources().size(), size_t{4});
+    EXPECT_EQ(GetShaderByteCode(Archive, "PS2"), "PS byte code");
+    EXPECT_EQ(GetShaderByteCode(Archive, "CS2"), "CS byte code");
+}
+
+TEST(DeviceObjectArchiveTest, ReplaceShader)
+{
+    DeviceObjectArchive Archive;
+    AddShader(Archive, "PS", "PS byte code");
+    AddShader(Archive, "CS", "CS byte code");
+
+    DeviceObjectArchive UpdateArchive;
+    AddShader(UpdateArchive, "PS", "New PS byte code");
+
+    Archive.Merge(UpdateArchive, /*ReplaceExisting = */ true);
+
+    // The replaced pixel shader byte code is only referenced by the old resource and must be removed
+    const std::vector<SerializedData>& Shaders = Archive.GetDeviceShaders(TestDevice);
+    ASSERT_EQ(Shaders.size(), size_t{2});
+    for (const SerializedData& Shader : Shaders)
+        EXPECT_NE(std::string(static_cast<const char*>(Shader.Ptr()), Shader.Size()), "PS byte code");
+    EXPECT_EQ(GetShaderByteCode(Archive, "PS"), "New PS byte code");
+    EXPECT_EQ(GetShaderByteCode(Archive, "CS"), "CS byte code");
+
+    // Shader indices must survive serialization
+    RefCntAutoPtr<IDataBlob> pData;
+    Archive.Serialize(&pData);
+    ASSERT_TRUE(pData);
+
+    DeviceObjectArchive::CreateInfo CI;
+    CI.pData = pData;
+    DeviceObjectArchive LoadedArchive{CI};
+    EXPECT_EQ(LoadedArchive.GetDeviceShaders(TestDevice).size(), size_t{2});
+    EXPECT_EQ(GetShaderByteCode(LoadedArchive, "PS"), "New PS byte code");
+    EXPECT_EQ(GetShaderByteCode(LoadedArchive, "CS"), "CS byte code");
+}
+
+TEST(DeviceObjectArchiveTest, RemoveUnusedShaders)
+{
+    DeviceObjectArchive Archive;
+    AddShader(Archive, "VS", "VS byte code");
+    AddShader(Archive, "PS", "PS byte code");
+    AddShader(Archive, "CS", "CS byte code");
+
+    EXPECT_TRUE(Archive.RemoveResource(ResourceType::StandaloneShader, "VS"));
+    EXPECT_FALSE(Archive.RemoveResource(ResourceType::StandaloneShader, "VS"));
+
+    // Removing a resource does not remove its shaders
+    EXPECT_EQ(Archive.GetDeviceShaders(TestDevice).size(), size_t{3});
+
+    Archive.RemoveUnusedShaders();
+    EXPECT_EQ(Archive.GetDeviceShaders(TestDevice).size(), size_t{2});
+    EXPECT_EQ(GetShaderByteCode(Archive, "PS"), "PS byte code");
+    EXPECT_EQ(GetShaderByteCode(Archive, "CS"), "CS byte code");
+}
+
+TEST(DeviceObjectArchiveTest, RemoveUnusedShaders_InvalidIndex)
+{
+    DeviceObjectArchive Archive;
+    AddShader(Archive, "VS", "VS byte code");
+    AddShader(Archive, "PS", "PS byte code");
+    AddShader(Archive, "Invalid", "Invalid byte code");
+    // Make the shader index of the last resource out of range
+    Archive.GetDeviceShaders(TestDevice).pop_back();
+
+    EXPECT_TRUE(Archive.RemoveResource(ResourceType::StandaloneShader, "VS"));
+
+    {
+        TestingEnvironment::ErrorScope ExpectedErrors{"Shader index 2 of resource 'Invalid' is out of range"};
+        EXPECT_THROW(Archive.RemoveUnusedShaders(), std::runtime_error);
+    }
+
+    // The archive must not be modified
+    EXPECT_EQ(Archive.GetDeviceShaders(TestDevice).size(), size_t{2});
+    EXPECT_EQ(GetShaderByteCode(Archive, "PS"), "PS byte code");
+}
+
+} // namespace
@@ -0,0 +1,175 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FrameProfiler.hpp"
+
+#include <thread>
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TEST(FrameProfilerTest, NestedCPUScopes)
+{
+    FrameProfiler Profiler{FrameProfilerCreateInfo{}};
+
+    for (Uint32 frame = 0; frame < 3; ++frame)
+    {
+        Profiler.BeginFrame();
+        {
+            FrameProfiler::CPUScope Scope0{Profiler, "Scope0"};
+            {
+                FrameProfiler::CPUScope Scope1{Profiler, "Scope1"};
+                FrameProfiler::CPUScope Scope2{Profiler, "Scope2"};
+            }
+            FrameProfiler::CPUScope Scope3{Profiler, "Scope3"};
+        }
+        Profiler.EndFrame();
+    }
+
+    // Frames without GPU scopes are resolved immediately
+    EXPECT_EQ(Profiler.GetNumPendingFrames(), size_t{0});
+    ASSERT_EQ(Profiler.GetResolvedFrames().size(), size_t{3});
+
+    const FrameProfiler::FrameData* pFrame = Profiler.GetLastResolvedFrame();
+    ASSERT_NE(pFrame, nullptr);
+    EXPECT_EQ(pFrame->FrameIndex, Uint64{2});
+    EXPECT_LE(pFrame->Begin, pFrame->End);
+
+    const std::vector<FrameProfiler::Scope>& Scopes = pFrame->CPUScopes;
+    ASSERT_EQ(Scopes.size(), size_t{4});
+    EXPECT_EQ(Scopes[0].Name, "Scope0");
+    EXPECT_EQ(Scopes[0].Depth, 0u);
+    EXPECT_EQ(Scopes[0].Parent, FrameProfiler::Scope::InvalidIndex);
+    EXPECT_EQ(Scopes[1].Name, "Scope1");
+    EXPECT_EQ(Scopes[1].Depth, 1u);
+    EXPECT_EQ(Scopes[1].Parent, 0u);
+    EXPECT_EQ(Scopes[2].Name, "Scope2");
+    EXPECT_EQ(Scopes[2].Depth, 2u);
+    EXPECT_EQ(Scopes[2].Parent, 1u);
+    EXPECT_EQ(Scopes[3].Name, "Scope3");
+    EXPECT_EQ(Scopes[3].Depth, 1u);
+    EXPECT_EQ(Scopes[3].Parent, 0u);
+
+    for (const FrameProfiler::Scope& Scope : Scopes)
+    {
+        EXPECT_LE(pFrame->Begin, Scope.Begin);
+        EXPECT_LE(Scope.Begin, Scope.End);
+        EXPECT_LE(Scope.End, pFrame->End);
+        if (Scope.Parent != FrameProfiler::Scope::InvalidIndex)
+        {
+            EXPECT_LE(Scopes[Scope.Parent].Begin, Scope.Begin);
+            EXPECT_LE(Scope.End, Scopes[Scope.Parent].End);
+        }
+    }
+}
+
+TEST(FrameProfilerTest, MultipleThreads)
+{
+    FrameProfiler Profiler{FrameProfilerCreateInfo{}};
+
+    Profiler.BeginFrame();
+    {
+        FrameProfiler::CPUScope MainScope{Profiler, "Main"};
+
+        std::thread Worker{[&Profiler]() {
+            FrameProfiler::CPUScope WorkerScope{Profiler, "Worker"};
+            FrameProfiler::CPUScope NestedScope{Profiler, "Nested"};
+        }};
+        Worker.join();
+    }
+    Profiler.EndFrame();
+
+    const FrameProfiler::FrameData* pFrame = Profiler.GetLastResolvedFrame();
+    ASSERT_NE(pFrame, nullptr);
+    ASSERT_EQ(pFrame->CPUScopes.size(), size_t{3});
+
+    const FrameProfiler::Scope& Main   = pFrame->CPUScopes[0];
+    const FrameProfiler::Scope& Worker = pFrame->CPUScopes[1];
+    const FrameProfiler::Scope& Nested = pFrame->CPUScopes[2];
+    EXPECT_EQ(Main.ThreadIndex, pFrame->ThreadIndex);
+    EXPECT_NE(Worker.ThreadIndex, Main.ThreadIndex);
+    // Scopes on different threads are not nested
+    EXPECT_EQ(Worker.Parent, FrameProfiler::Scope::InvalidIndex);
+    EXPECT_EQ(Worker.Depth, 0u);
+    EXPECT_EQ(Nested.Parent, 1u);
+    EXPECT_EQ(Nested.ThreadIndex, Worker.ThreadIndex);
+}
+
+TEST(FrameProfilerTest, OpenScopes)
+{
+    FrameProfiler Profiler{FrameProfilerCreateInfo{}};
+
+    // Scopes outside of a frame are ignored
+    Profiler.BeginCPUScope("Outside");
+
+    Profiler.BeginFrame();
+    Profiler.BeginCPUScope("Open");
+    Profiler.EndFrame();
+
+    // The scope is closed by EndFrame()
+    Profiler.EndCPUScope();
+    Profiler.EndCPUScope();
+
+    const FrameProfiler::FrameData* pFrame = Profiler.GetLastResolvedFrame();
+    ASSERT_NE(pFrame, nullptr);
+    ASSERT_EQ(pFrame->CPUScopes.size(), size_t{1});
+    EXPECT_EQ(pFrame->CPUScopes[0].Name, "Open");
+    EXPECT_EQ(pFrame->CPUScopes[0].End, pFrame->End);
+}
+
+TEST(FrameProfilerTest, ChromeTrace)
+{
+    FrameProfilerCreateInfo CI;
+    CI.MaxFrameHistory = 2;
+    FrameProfiler Profiler{CI};
+
+    for (Uint32 frame = 0; frame < 4; ++frame)
+    {
+        Profiler.BeginFrame();
+        {
+            FrameProfiler::CPUScope Scope{Profiler, "Update \"scene\""};
+        }
+        Profiler.EndFrame();
+    }
+    EXPECT_EQ(Profiler.GetResolvedFrames().size(), size_t{2});
+    EXPECT_EQ(Profiler.GetResolvedFrames().front().FrameIndex, Uint64{2});
+
+    const std::string Trace = Profiler.ExportChromeTrace();
+    EXPECT_EQ(Trace.find("{\"traceEvents\":["), size_t{0});
+    EXPECT_NE(Trace.find("\"name\":\"Update \\\"scene\\\"\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"name\":\"Frame 3\""), std::string::npos);
+    EXPECT_EQ(Trace.find("\"name\":\"Frame 1\""), std::string::npos);
+    EXPECT_NE(Trace.find("\"ph\":\"X\""), std::string::npos);
+
+    Profiler.ClearHistory();
+    EXPECT_EQ(Profiler.GetLastResolvedFrame(), nullptr);
+}
+
+} // namespace
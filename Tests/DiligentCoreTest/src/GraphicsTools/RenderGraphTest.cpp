@@ -0,0 +1,251 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "RenderGraph.hpp"
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+TextureDesc GetRTDesc(const char* Name, TEXTURE_FORMAT Format = TEX_FORMAT_RGBA8_UNORM)
+{
+    TextureDesc Desc;
+    Desc.Name      = Name;
+    Desc.Type      = RESOURCE_DIM_TEX_2D;
+    Desc.Width     = 256;
+    Desc.Height    = 256;
+    Desc.Format    = Format;
+    Desc.BindFlags = BIND_RENDER_TARGET | BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS;
+    return Desc;
+}
+
+TEST(RenderGraphTest, Culling)
+{
+    RenderGraph Graph;
+
+    auto GBuffer = Graph.CreateTexture(GetRTDesc("GBuffer"));
+    auto Unused  = Graph.CreateTexture(GetRTDesc("Unused"));
+    auto Output  = Graph.CreateTexture(GetRTDesc("Output"));
+    Graph.MarkOutput(Output);
+
+    const Uint32 GBufferPass = Graph.AddPass("GBuffer", nullptr).Write(GBuffer, RESOURCE_STATE_RENDER_TARGET).GetPassIndex();
+    const Uint32 UnusedPass  = Graph.AddPass("Unused", nullptr).Read(GBuffer, RESOURCE_STATE_SHADER_RESOURCE).Write(Unused, RESOURCE_STATE_RENDER_TARGET).GetPassIndex();
+    const Uint32 SideEffects = Graph.AddPass("Side effects", nullptr).Read(Unused, RESOURCE_STATE_SHADER_RESOURCE).SetNeverCull().GetPassIndex();
+    const Uint32 LightPass   = Graph.AddPass("Lighting", nullptr).Read(GBuffer, RESOURCE_STATE_SHADER_RESOURCE).Write(Output, RESOURCE_STATE_RENDER_TARGET).GetPassIndex();
+    const Uint32 DebugPass   = Graph.AddPass("Debug", nullptr).Read(Output, RESOURCE_STATE_SHADER_RESOURCE).GetPassIndex();
+    Graph.Compile();
+
+    EXPECT_FALSE(Graph.IsPassCulled(GBufferPass));
+    // The pass is kept because the never-culled pass reads its output
+    EXPECT_FALSE(Graph.IsPassCulled(UnusedPass));
+    EXPECT_FALSE(Graph.IsPassCulled(SideEffects));
+    EXPECT_FALSE(Graph.IsPassCulled(LightPass));
+    EXPECT_TRUE(Graph.IsPassCulled(DebugPass));
+    EXPECT_EQ(Graph.GetStatistics().NumPasses, 5u);
+    EXPECT_EQ(Graph.GetStatistics().NumCulledPasses, 1u);
+
+    Graph.AddPass("Side effects 2", nullptr).Read(Unused, RESOURCE_STATE_SHADER_RESOURCE);
+    Graph.Compile();
+    EXPECT_EQ(Graph.GetStatistics().NumCulledPasses, 2u);
+
+    Graph.Reset();
+    EXPECT_EQ(Graph.GetStatistics().NumPasses, 0u);
+}
+
+TEST(RenderGraphTest, CullUnusedChain)
+{
+    RenderGraph Graph;
+
+    auto Tex0   = Graph.CreateTexture(GetRTDesc("Tex0"));
+    auto Tex1   = Graph.CreateTexture(GetRTDesc("Tex1"));
+    auto Output = Graph.CreateTexture(GetRTDesc("Output"));
+    Graph.MarkOutput(Output);
+
+    const Uint32 Pass0 = Graph.AddPass("Pass0", nullptr).Write(Tex0, RESOURCE_STATE_RENDER_TARGET).GetPassIndex();
+    const Uint32 Pass1 = Graph.AddPass("Pass1", nullptr).Read(Tex0, RESOURCE_STATE_SHADER_RESOURCE).Write(Tex1, RESOURCE_STATE_RENDER_TARGET).GetPassIndex();
+    const Uint32 Pass2 = Graph.AddPass("Pass2", nullptr).Write(Output, RESOURCE_STATE_RENDER_TARGET).GetPassIndex();
+    Graph.Compile();
+
+    EXPECT_TRUE(Graph.IsPassCulled(Pass0));
+    EXPECT_TRUE(Graph.IsPassCulled(Pass1));
+    EXPECT_FALSE(Graph.IsPassCulled(Pass2));
+    EXPECT_EQ(Graph.GetPhysicalResourceIndex(Tex0), RenderGraphResource::InvalidIndex);
+    EXPECT_EQ(Graph.GetPhysicalResourceIndex(Tex1), RenderGraphResource::InvalidIndex);
+    EXPECT_EQ(Graph.GetStatistics().NumTransientResources, 1u);
+}
+
+TEST(RenderGraphTest, Transitions)
+{
+    RenderGraph Graph;
+
+    auto Tex    = Graph.CreateTexture(GetRTDesc("Tex"));
+    auto Output = Graph.CreateTexture(GetRTDesc("Output"));
+    Graph.MarkOutput(Output);
+
+    const Uint32 Pass0 = Graph.AddPass("Write", nullptr).Write(Tex, RESOURCE_STATE_RENDER_TARGET).GetPassIndex();
+    const Uint32 Pass1 = Graph.AddPass("Read 1", nullptr).Read(Tex, RESOURCE_STATE_SHADER_RESOURCE).Write(Output, RESOURCE_STATE_UNORDERED_ACCESS).GetPassIndex();
+    const Uint32 Pass2 = Graph.AddPass("Read 2", nullptr).Read(Tex, RESOURCE_STATE_SHADER_RESOURCE).ReadWrite(Output, RESOURCE_STATE_UNORDERED_ACCESS).GetPassIndex();
+    const Uint32 Pass3 = Graph.AddPass("Blend", nullptr).ReadWrite(Tex, RESOURCE_STATE_RENDER_TARGET).Read(Output, RESOURCE_STATE_UNORDERED_ACCESS).GetPassIndex();
+    const Uint32 Pass4 = Graph.AddPass("Read UAV", nullptr).Read(Output, RESOURCE_STATE_UNORDERED_ACCESS).SetNeverCull().GetPassIndex();
+    Graph.AddPass("Copy", nullptr).Read(Tex, RESOURCE_STATE_SHADER_RESOURCE).Write(Output, RESOURCE_STATE_COPY_DEST);
+    Graph.Compile();
+
+    {
+        const auto& Transitions = Graph.GetPassTransitions(Pass0);
+        ASSERT_EQ(Transitions.size(), 1u);
+        EXPECT_EQ(Transitions[0].Resource, Tex);
+        EXPECT_EQ(Transitions[0].NewState, RESOURCE_STATE_RENDER_TARGET);
+        EXPECT_TRUE(Transitions[0].DiscardContent);
+    }
+    {
+        const auto& Transitions = Graph.GetPassTransitions(Pass1);
+        ASSERT_EQ(Transitions.size(), 2u);
+        EXPECT_EQ(Transitions[0].Resource, Tex);
+        EXPECT_EQ(Transitions[0].OldState, RESOURCE_STATE_RENDER_TARGET);
+        EXPECT_EQ(Transitions[0].NewState, RESOURCE_STATE_SHADER_RESOURCE);
+        EXPECT_FALSE(Transitions[0].DiscardContent);
+        EXPECT_EQ(Transitions[1].Resource, Output);
+        EXPECT_TRUE(Transitions[1].DiscardContent);
+    }
+    {
+        // Tex is already in the shader resource state; Output requires a UAV barrier
+        const auto& Transitions = Graph.GetPassTransitions(Pass2);
+        ASSERT_EQ(Transitions.size(), 1u);
+        EXPECT_EQ(Transitions[0].Resource, Output);
+        EXPECT_EQ(Transitions[0].OldState, RESOURCE_STATE_UNORDERED_ACCESS);
+        EXPECT_EQ(Transitions[0].NewState, RESOURCE_STATE_UNORDERED_ACCESS);
+    }
+    {
+        // Read after UAV write requires a barrier
+        const auto& Transitions = Graph.GetPassTransitions(Pass3);
+        ASSERT_EQ(Transitions.size(), 2u);
+        EXPECT_EQ(Transitions[0].Resource, Tex);
+        EXPECT_EQ(Transitions[0].NewState, RESOURCE_STATE_RENDER_TARGET);
+        EXPECT_EQ(Transitions[1].Resource, Output);
+    }
+    // Read after read through UAV does not require a barrier
+    EXPECT_TRUE(Graph.GetPassTransitions(Pass4).empty());
+
+    const auto& Stats = Graph.GetStatistics();
+    EXPECT_EQ(Stats.NumTransitions, 8u);
+    EXPECT_EQ(Stats.NumTransitionBatches, 5u);
+}
+
+TEST(RenderGraphTest, BufferReadStates)
+{
+    RenderGraph Graph;
+
+    BufferDesc BuffDesc;
+    BuffDesc.Name      = "Vertices";
+    BuffDesc.Size      = 1024;
+    BuffDesc.BindFlags = BIND_VERTEX_BUFFER | BIND_SHADER_RESOURCE | BIND_UNORDERED_ACCESS;
+    BuffDesc.Mode      = BUFFER_MODE_RAW;
+
+    auto Buff   = Graph.CreateBuffer(BuffDesc);
+    auto Output = Graph.CreateTexture(GetRTDesc("Output"));
+    Graph.MarkOutput(Output);
+
+    Graph.AddPass("Generate", nullptr).Write(Buff, RESOURCE_STATE_UNORDERED_ACCESS);
+    const Uint32 Pass1 = Graph.AddPass("Draw", nullptr).Read(Buff, RESOURCE_STATE_VERTEX_BUFFER).Write(Output, RESOURCE_STATE_RENDER_TARGET).GetPassIndex();
+    const Uint32 Pass2 = Graph.AddPass("Sample", nullptr).Read(Buff, RESOURCE_STATE_SHADER_RESOURCE).ReadWrite(Output, RESOURCE_STATE_RENDER_TARGET).GetPassIndex();
+    const Uint32 Pass3 = Graph.AddPass("Update", nullptr).Write(Buff, RESOURCE_STATE_UNORDERED_ACCESS).ReadWrite(Output, RESOURCE_STATE_RENDER_TARGET).GetPassIndex();
+    Graph.Compile();
+
+    {
+        // Both read states are merged into a single transition
+        const auto& Transitions = Graph.GetPassTransitions(Pass1);
+        ASSERT_EQ(Transitions.size(), 2u);
+        EXPECT_EQ(Transitions[0].Resource, Buff);
+        EXPECT_EQ(Transitions[0].NewState, RESOURCE_STATE_VERTEX_BUFFER | RESOURCE_STATE_SHADER_RESOURCE);
+    }
+    EXPECT_TRUE(Graph.GetPassTransitions(Pass2).empty());
+    {
+        const auto& Transitions = Graph.GetPassTransitions(Pass3);
+        ASSERT_EQ(Transitions.size(), 1u);
+        EXPECT_EQ(Transitions[0].OldState, RESOURCE_STATE_VERTEX_BUFFER | RESOURCE_STATE_SHADER_RESOURCE);
+        EXPECT_EQ(Transitions[0].NewState, RESOURCE_STATE_UNORDERED_ACCESS);
+    }
+}
+
+TEST(RenderGraphTest, Aliasing)
+{
+    RenderGraph Graph;
+
+    auto Tex0   = Graph.CreateTexture(GetRTDesc("Tex0"));
+    auto Tex1   = Graph.CreateTexture(GetRTDesc("Tex1"));
+    auto Tex2   = Graph.CreateTexture(GetRTDesc("Tex2"));
+    auto Tex3   = Graph.CreateTexture(GetRTDesc("Tex3", TEX_FORMAT_RGBA16_FLOAT));
+    auto Output = Graph.CreateTexture(GetRTDesc("Output"));
+    Graph.MarkOutput(Output);
+
+    Graph.AddPass("Pass0", nullptr).Write(Tex0, RESOURCE_STATE_RENDER_TARGET);
+    Graph.AddPass("Pass1", nullptr).Read(Tex0, RESOURCE_STATE_SHADER_RESOURCE).Write(Tex1, RESOURCE_STATE_RENDER_TARGET);
+    // Tex0 is not used after Pass1, so Tex2 may reuse its memory
+    Graph.AddPass("Pass2", nullptr).Read(Tex1, RESOURCE_STATE_SHADER_RESOURCE).Write(Tex2, RESOURCE_STATE_RENDER_TARGET);
+    Graph.AddPass("Pass3", nullptr).Read(Tex2, RESOURCE_STATE_SHADER_RESOURCE).Write(Tex3, RESOURCE_STATE_RENDER_TARGET);
+    Graph.AddPass("Pass4", nullptr).Read(Tex3, RESOURCE_STATE_SHADER_RESOURCE).Write(Output, RESOURCE_STATE_RENDER_TARGET);
+    Graph.Compile();
+
+    EXPECT_EQ(Graph.GetPhysicalResourceIndex(Tex0), Graph.GetPhysicalResourceIndex(Tex2));
+    EXPECT_NE(Graph.GetPhysicalResourceIndex(Tex0), Graph.GetPhysicalResourceIndex(Tex1));
+    // Different format
+    EXPECT_NE(Graph.GetPhysicalResourceIndex(Tex3), Graph.GetPhysicalResourceIndex(Tex0));
+    EXPECT_NE(Graph.GetPhysicalResourceIndex(Tex3), Graph.GetPhysicalResourceIndex(Tex1));
+    // Tex2 is not used after Pass3, so the output may reuse its memory
+    EXPECT_EQ(Graph.GetPhysicalResourceIndex(Output), Graph.GetPhysicalResourceIndex(Tex2));
+
+    // The second user of the physical resource discards its contents
+    const auto& Transitions = Graph.GetPassTransitions(2);
+    ASSERT_EQ(Transitions.size(), 2u);
+    EXPECT_EQ(Transitions[1].Resource, Tex2);
+    EXPECT_TRUE(Transitions[1].DiscardContent);
+
+    const auto& Stats = Graph.GetStatistics();
+    EXPECT_EQ(Stats.NumTransientResources, 5u);
+    EXPECT_EQ(Stats.NumPhysicalResources, 3u);
+    EXPECT_EQ(Stats.TransientMemorySize, Uint64{256 * 256 * 4} * 4 + Uint64{256 * 256 * 8});
+    EXPECT_EQ(Stats.PhysicalMemorySize, Uint64{256 * 256 * 4} * 2 + Uint64{256 * 256 * 8});
+}
+
+TEST(RenderGraphTest, OutputIsNotAliased)
+{
+    RenderGraph Graph;
+
+    auto Tex0 = Graph.CreateTexture(GetRTDesc("Tex0"));
+    auto Tex1 = Graph.CreateTexture(GetRTDesc("Tex1"));
+    Graph.MarkOutput(Tex0);
+    Graph.MarkOutput(Tex1);
+
+    Graph.AddPass("Pass0", nullptr).Write(Tex0, RESOURCE_STATE_RENDER_TARGET);
+    Graph.AddPass("Pass1", nullptr).Write(Tex1, RESOURCE_STATE_RENDER_TARGET);
+    Graph.Compile();
+
+    EXPECT_NE(Graph.GetPhysicalResourceIndex(Tex0), Graph.GetPhysicalResourceIndex(Tex1));
+}
+
+} // namespace
@@ -36,6 +36,8 @@
 #include "FileWrapper.hpp"
 #include "FastRand.hpp"
 #include "DataBlobImpl.hpp"
+#include "FileMappedDataBlob.hpp"
+#include "BasicFileStream.hpp"
 
 using namespace Diligent;
 using namespace Diligent::Testing;
@@ -467,6 +469,71 @@ TEST(Platforms_FileSystem, File)
     EXPECT_FALSE(FileSystem::FileExists(FilePath.c_str()));
 }
 
+TEST(Platforms_FileSystem, FileMappedDataBlob)
+{
+    TempDirectory TmpDir;
+    const auto&   TmpDirPath = TmpDir.Get();
+    ASSERT_TRUE(FileSystem::PathExists(TmpDirPath.c_str()));
+
+    std::vector<Int32> Data(16384);
+
+    FastRandInt rnd{0, 0, static_cast<Int32>(FastRand::Max - 1)};
+    for (auto& Elem : Data)
+        Elem = rnd();
+    const size_t DataSize = Data.size() * sizeof(Data[0]);
+    const auto   FilePath = TmpDirPath + FileSystem::SlashSymbol + "TestFile2.ext";
+    ASSERT_TRUE(FileWrapper::WriteFile(FilePath.c_str(), Data.data(), DataSize));
+
+    {
+        RefCntAutoPtr<IDataBlob> pData;
+        ASSERT_TRUE(FileWrapper::MapWholeFile(FilePath.c_str(), &pData));
+        ASSERT_EQ(pData->GetSize(), DataSize);
+        EXPECT_EQ(memcmp(pData->GetConstDataPtr(), Data.data(), DataSize), 0);
+    }
+
+    if (FileMappedDataBlob::IsSupported())
+    {
+        // Unaligned range that spans multiple pages
+        const size_t Offset = 4097;
+        const size_t Size   = 3 * 4096 + 5;
+
+        RefCntAutoPtr<FileMappedDataBlob> pData = FileMappedDataBlob::Create(FilePath.c_str(), Offset, Size, FileMappedDataBlob::AccessHint::Sequential);
+        ASSERT_TRUE(pData);
+        ASSERT_EQ(pData->GetSize(), Size);
+        EXPECT_EQ(memcmp(pData->GetConstDataPtr(), reinterpret_cast<const Uint8*>(Data.data()) + Offset, Size), 0);
+
+        // Writes must not affect the file
+        static_cast<Uint8*>(pData->GetDataPtr(1))[0] ^= 0xFF;
+        std::vector<Uint8> FileData;
+        ASSERT_TRUE(FileWrapper::ReadWholeFile(FilePath.c_str(), FileData));
+        EXPECT_EQ(memcmp(FileData.data(), Data.data(), DataSize), 0);
+
+        EXPECT_FALSE(FileMappedDataBlob::Create(FilePath.c_str(), DataSize - 4, 8, FileMappedDataBlob::AccessHint::Normal, /*Silent = */ true));
+    }
+
+    {
+        RefCntAutoPtr<BasicFileStream> pStream = BasicFileStream::Create(FilePath.c_str(), EFileAccessMode::Read);
+        ASSERT_TRUE(pStream);
+        EXPECT_TRUE(pStream->SetPos(100, static_cast<int>(FilePosOrigin::Start)));
+
+        RefCntAutoPtr<IDataBlob> pData = pStream->MapBlob(1000);
+        ASSERT_TRUE(pData);
+        ASSERT_EQ(pData->GetSize(), size_t{1000});
+        EXPECT_EQ(memcmp(pData->GetConstDataPtr(), reinterpret_cast<const Uint8*>(Data.data()) + 100, 1000), 0);
+        EXPECT_EQ(pStream->GetPos(), size_t{1100});
+    }
+
+    {
+        RefCntAutoPtr<DataBlobImpl> pData = DataBlobImpl::CreateUninitialized(DataSize);
+        EXPECT_EQ(pData->GetSize(), DataSize);
+        pData->Resize(16);
+        EXPECT_EQ(pData->GetSize(), size_t{16});
+    }
+
+    FileSystem::DeleteFile(FilePath.c_str());
+    EXPECT_FALSE(FileSystem::FileExists(FilePath.c_str()));
+}
+
 TEST(Platforms_FileSystem, Directories)
 {
     TempDirectory TmpDir;
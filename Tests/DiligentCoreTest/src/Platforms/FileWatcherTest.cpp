@@ -0,0 +1,85 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "FileWatcher.hpp"
+
+#include <algorithm>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "FileSystem.hpp"
+#include "TempDirectory.hpp"
+#include "FileWrapper.hpp"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+TEST(Platforms_FileWatcher, GetChangedFiles)
+{
+    TempDirectory TmpDir;
+    const std::string& TmpDirPath = TmpDir.Get();
+    ASSERT_TRUE(FileSystem::PathExists(TmpDirPath.c_str()));
+
+    const std::string SubDirPath = TmpDirPath + FileSystem::SlashSymbol + "SubDir";
+    ASSERT_TRUE(FileSystem::CreateDirectory(SubDirPath.c_str()));
+
+    FileWatcher Watcher{TmpDirPath.c_str()};
+    if (!Watcher.IsValid())
+        GTEST_SKIP() << "File change notifications are not supported on this platform";
+
+    EXPECT_TRUE(Watcher.GetChangedFiles().empty());
+
+    const char Data[] = "data";
+    ASSERT_TRUE(FileWrapper::WriteFile((TmpDirPath + FileSystem::SlashSymbol + "File0.txt").c_str(), Data, sizeof(Data)));
+    ASSERT_TRUE(FileWrapper::WriteFile((SubDirPath + FileSystem::SlashSymbol + "File1.txt").c_str(), Data, sizeof(Data)));
+    // Multiple writes to the same file are reported once
+    ASSERT_TRUE(FileWrapper::WriteFile((TmpDirPath + FileSystem::SlashSymbol + "File0.txt").c_str(), Data, sizeof(Data)));
+
+    std::vector<std::string> ChangedFiles = Watcher.GetChangedFiles();
+    std::sort(ChangedFiles.begin(), ChangedFiles.end());
+    ASSERT_EQ(ChangedFiles.size(), size_t{2});
+    EXPECT_EQ(ChangedFiles[0], "File0.txt");
+    EXPECT_EQ(ChangedFiles[1], "SubDir/File1.txt");
+
+    // Changes are only reported once
+    EXPECT_TRUE(Watcher.GetChangedFiles().empty());
+
+    // Subdirectories created after the watcher are watched as well
+    const std::string NewDirPath = TmpDirPath + FileSystem::SlashSymbol + "NewDir";
+    ASSERT_TRUE(FileSystem::CreateDirectory(NewDirPath.c_str()));
+    EXPECT_TRUE(Watcher.GetChangedFiles().empty());
+    ASSERT_TRUE(FileWrapper::WriteFile((NewDirPath + FileSystem::SlashSymbol + "File2.txt").c_str(), Data, sizeof(Data)));
+
+    ChangedFiles = Watcher.GetChangedFiles();
+    ASSERT_EQ(ChangedFiles.size(), size_t{1});
+    EXPECT_EQ(ChangedFiles[0], "NewDir/File2.txt");
+}
+
+} // namespace
@@ -63,4 +63,38 @@ TEST(GLSLUtilsTest, GetGLSLExtensions)
          {{"ABC", "enable"}, {"XYZ", "require"}});
 }
 
+#if !DILIGENT_NO_HLSL
+TEST(GLSLUtilsTest, BuildGLSLSourceString_PruneUnusedDefinitions)
+{
+    static constexpr char HLSLSource[] = R"(
+float4 main(in float4 Pos : SV_Position) : SV_Target
+{
+    return saturate(Pos);
+}
+)";
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.Source                          = HLSLSource;
+    ShaderCI.SourceLanguage                  = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.EntryPoint                      = "main";
+    ShaderCI.Desc.ShaderType                 = SHADER_TYPE_PIXEL;
+    ShaderCI.Desc.UseCombinedTextureSamplers = true;
+
+    const GraphicsAdapterInfo    AdapterInfo;
+    const DeviceFeatures         Features;
+    BuildGLSLSourceStringAttribs Attribs{ShaderCI, AdapterInfo, Features};
+    Attribs.DeviceType = RENDER_DEVICE_TYPE_GL;
+
+    // Definitions are not pruned by default
+    const String Full = BuildGLSLSourceString(Attribs);
+    EXPECT_NE(Full.find("f16tof32"), String::npos);
+
+    ShaderCI.CompileFlags = SHADER_COMPILE_FLAG_PRUNE_UNUSED_GLSL_DEFINITIONS;
+    const String Pruned   = BuildGLSLSourceString(Attribs);
+    EXPECT_LT(Pruned.length(), Full.length());
+    EXPECT_EQ(Pruned.find("f16tof32"), String::npos);
+    EXPECT_NE(Pruned.find("saturate"), String::npos);
+}
+#endif
+
 } // namespace
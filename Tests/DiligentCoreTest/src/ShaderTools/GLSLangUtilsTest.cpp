@@ -0,0 +1,177 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "GLSLangUtils.hpp"
+#include "DefaultShaderSourceStreamFactory.h"
+#include "RefCntAutoPtr.hpp"
+#include "ThreadPool.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+
+namespace
+{
+
+class GLSLangUtilsTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GLSLangUtils::InitializeGlslang();
+    }
+
+    static void TearDownTestSuite()
+    {
+        GLSLangUtils::FinalizeGlslang();
+    }
+};
+
+struct PermutationMacros
+{
+    std::vector<ShaderMacro> Macros;
+    ShaderMacroArray         Array;
+};
+
+std::vector<PermutationMacros> GetPermutations()
+{
+    std::vector<PermutationMacros> Permutations(4);
+    Permutations[0].Macros = {};
+    Permutations[1].Macros = {{"USE_TEXTURE", "1"}};
+    Permutations[2].Macros = {{"SCALE", "2.0"}};
+    Permutations[3].Macros = {{"USE_TEXTURE", "1"}, {"SCALE", "0.5"}};
+    for (PermutationMacros& Permutation : Permutations)
+        Permutation.Array = {Permutation.Macros.data(), static_cast<Uint32>(Permutation.Macros.size())};
+    return Permutations;
+}
+
+TEST_F(GLSLangUtilsTest, HLSLtoSPIRVPermutations)
+{
+    RefCntAutoPtr<IShaderSourceInputStreamFactory> pShaderSourceStreamFactory;
+    CreateDefaultShaderSourceStreamFactory("shaders/GLSLang", &pShaderSourceStreamFactory);
+    ASSERT_NE(pShaderSourceStreamFactory, nullptr);
+
+    ShaderCreateInfo ShaderCI;
+    ShaderCI.SourceLanguage             = SHADER_SOURCE_LANGUAGE_HLSL;
+    ShaderCI.FilePath                   = "Permutations.psh";
+    ShaderCI.Desc                       = {"GLSLang permutations test", SHADER_TYPE_PIXEL};
+    ShaderCI.EntryPoint                 = "main";
+    ShaderCI.pShaderSourceStreamFactory = pShaderSourceStreamFactory;
+
+    const std::vector<PermutationMacros> Permutations = GetPermutations();
+
+    std::vector<ShaderMacroArray> MacroArrays;
+    for (const PermutationMacros& Permutation : Permutations)
+        MacroArrays.push_back(Permutation.Array);
+
+    std::vector<std::vector<unsigned int>> RefSPIRVs;
+    for (const ShaderMacroArray& Macros : MacroArrays)
+    {
+        ShaderCI.Macros = Macros;
+        RefSPIRVs.emplace_back(GLSLangUtils::HLSLtoSPIRV(ShaderCI, GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr));
+        ASSERT_FALSE(RefSPIRVs.back().empty());
+    }
+    ShaderCI.Macros = {};
+
+    // Permutations with different macros must produce different byte code
+    EXPECT_NE(RefSPIRVs[0], RefSPIRVs[1]);
+    EXPECT_NE(RefSPIRVs[0], RefSPIRVs[2]);
+
+    {
+        const auto SPIRVs = GLSLangUtils::HLSLtoSPIRVPermutations(ShaderCI, MacroArrays.data(), MacroArrays.size(), GLSLangUtils::SpirvVersion::Vk100, nullptr, nullptr);
+        EXPECT_EQ(SPIRVs, RefSPIRVs);
+    }
+
+    {
+        RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+        ASSERT_NE(pThreadPool, nullptr);
+
+        std::vector<IDataBlob*> CompilerOutputs(MacroArrays.size());
+
+        const auto SPIRVs = GLSLangUtils::HLSLtoSPIRVPermutations(ShaderCI, MacroArrays.data(), MacroArrays.size(), GLSLangUtils::SpirvVersion::Vk100, nullptr, pThreadPool, CompilerOutputs.data());
+        EXPECT_EQ(SPIRVs, RefSPIRVs);
+        for (IDataBlob* pOutput : CompilerOutputs)
+        {
+            // Compiler output is only produced for failed permutations
+            EXPECT_EQ(pOutput, nullptr);
+            if (pOutput != nullptr)
+                pOutput->Release();
+        }
+    }
+}
+
+TEST_F(GLSLangUtilsTest, GLSLtoSPIRVPermutations)
+{
+    static constexpr char GLSLSource[] = R"(
+#version 450
+
+#ifndef SCALE
+#    define SCALE 1.0
+#endif
+
+layout(location = 0) in vec2 in_UV;
+layout(location = 0) out vec4 out_Color;
+
+layout(binding = 0) uniform sampler2D g_Texture;
+
+void main()
+{
+    out_Color = vec4(SCALE);
+#if USE_TEXTURE
+    out_Color *= texture(g_Texture, in_UV);
+#endif
+}
+)";
+
+    GLSLangUtils::GLSLtoSPIRVAttribs Attribs;
+    Attribs.ShaderType    = SHADER_TYPE_PIXEL;
+    Attribs.ShaderSource  = GLSLSource;
+    Attribs.SourceCodeLen = static_cast<int>(sizeof(GLSLSource) - 1);
+    Attribs.Version       = GLSLangUtils::SpirvVersion::Vk100;
+
+    const std::vector<PermutationMacros> Permutations = GetPermutations();
+
+    std::vector<ShaderMacroArray> MacroArrays;
+    for (const PermutationMacros& Permutation : Permutations)
+        MacroArrays.push_back(Permutation.Array);
+
+    std::vector<std::vector<unsigned int>> RefSPIRVs;
+    for (const ShaderMacroArray& Macros : MacroArrays)
+    {
+        Attribs.Macros = Macros;
+        RefSPIRVs.emplace_back(GLSLangUtils::GLSLtoSPIRV(Attribs));
+        ASSERT_FALSE(RefSPIRVs.back().empty());
+    }
+    Attribs.Macros = {};
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    const auto SPIRVs = GLSLangUtils::GLSLtoSPIRVPermutations(Attribs, MacroArrays.data(), MacroArrays.size(), pThreadPool);
+    EXPECT_EQ(SPIRVs, RefSPIRVs);
+}
+
+} // namespace
@@ -0,0 +1,357 @@
+/*
+ *  Copyright 2019-2025 Diligent Graphics LLC
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  In no event and under no legal theory, whether in tort (including negligence),
+ *  contract, or otherwise, unless required by applicable law (such as deliberate
+ *  and grossly negligent acts) or agreed to in writing, shall any Contributor be
+ *  liable for any damages, including any direct, indirect, special, incidental,
+ *  or consequential damages of any character arising as a result of this License or
+ *  out of the use or inability to use the software (including but not limited to damages
+ *  for loss of goodwill, work stoppage, computer failure or malfunction, or any and
+ *  all other commercial damages or losses), even if such Contributor has been advised
+ *  of the possibility of such damages.
+ */
+
+#include "SPIRVTools.hpp"
+#include "GLSLangUtils.hpp"
+#include "DataBlobImpl.hpp"
+#include "RefCntAutoPtr.hpp"
+#include "ThreadPool.hpp"
+#include "TestingEnvironment.hpp"
+
+#include "gtest/gtest.h"
+
+using namespace Diligent;
+using namespace Diligent::Testing;
+
+namespace
+{
+
+class SPIRVToolsTest : public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        GLSLangUtils::InitializeGlslang();
+    }
+
+    static void TearDownTestSuite()
+    {
+        GLSLangUtils::FinalizeGlslang();
+    }
+
+    // Compiles a compute shader whose byte code depends on the value
+    static std::vector<uint32_t> CompileModule(const char* Value)
+    {
+        static constexpr char GLSLSource[] = R"(
+#version 450
+
+layout(local_size_x = 1) in;
+
+layout(std430, binding = 0) buffer OutputBuffer
+{
+    uint g_Output[];
+};
+
+void main()
+{
+    uint Value = VALUE;
+    for (int i = 0; i < 4; ++i)
+        Value = Value * 3u + uint(i);
+    g_Output[gl_GlobalInvocationID.x] = Value;
+}
+)";
+
+        const ShaderMacro Macros[] = {{"VALUE", Value}};
+
+        GLSLangUtils::GLSLtoSPIRVAttribs Attribs;
+        Attribs.ShaderType    = SHADER_TYPE_COMPUTE;
+        Attribs.ShaderSource  = GLSLSource;
+        Attribs.SourceCodeLen = static_cast<int>(sizeof(GLSLSource) - 1);
+        Attribs.Macros        = {Macros, _countof(Macros)};
+        Attribs.Version       = GLSLangUtils::SpirvVersion::Vk100;
+
+        const std::vector<unsigned int> SPIRV = GLSLangUtils::GLSLtoSPIRV(Attribs);
+        return {SPIRV.begin(), SPIRV.end()};
+    }
+
+    static constexpr spv_target_env           TargetEnv = SPV_ENV_VULKAN_1_0;
+    static constexpr SPIRV_OPTIMIZATION_FLAGS Passes    = SPIRV_OPTIMIZATION_FLAG_PERFORMANCE;
+};
+
+TEST_F(SPIRVToolsTest, Optimizer)
+{
+    const std::vector<uint32_t> SrcA = CompileModule("1u");
+    const std::vector<uint32_t> SrcB = CompileModule("2u");
+    ASSERT_FALSE(SrcA.empty());
+    ASSERT_FALSE(SrcB.empty());
+
+    const std::vector<uint32_t> RefA = OptimizeSPIRV(SrcA, TargetEnv, Passes);
+    const std::vector<uint32_t> RefB = OptimizeSPIRV(SrcB, TargetEnv, Passes);
+    ASSERT_FALSE(RefA.empty());
+    ASSERT_FALSE(RefB.empty());
+    EXPECT_NE(RefA, SrcA);
+    EXPECT_NE(RefA, RefB);
+
+    // The same optimizer instance must produce the same results as a new one for every module
+    SPIRVOptimizer Optimizer{TargetEnv, Passes};
+    EXPECT_EQ(Optimizer.GetTargetEnv(), TargetEnv);
+    EXPECT_EQ(Optimizer.GetPasses(), Passes);
+    EXPECT_EQ(Optimizer.Run(SrcA), RefA);
+    EXPECT_EQ(Optimizer.Run(SrcB), RefB);
+    EXPECT_EQ(Optimizer.Run(SrcA), RefA);
+    EXPECT_EQ(Optimizer.GetRunCount(), 3u);
+    EXPECT_GE(Optimizer.GetTotalRunTime(), 0.0);
+
+    // Target environment derived from the byte code version
+    EXPECT_EQ(OptimizeSPIRV(SrcA, SPV_ENV_MAX, Passes), RefA);
+}
+
+TEST_F(SPIRVToolsTest, OptimizationCache)
+{
+    const std::vector<uint32_t> SrcA = CompileModule("1u");
+    const std::vector<uint32_t> SrcB = CompileModule("2u");
+    ASSERT_FALSE(SrcA.empty());
+    ASSERT_FALSE(SrcB.empty());
+
+    const std::vector<uint32_t> RefA = OptimizeSPIRV(SrcA, TargetEnv, Passes);
+    const std::vector<uint32_t> RefB = OptimizeSPIRV(SrcB, TargetEnv, Passes);
+
+    const SPIRVOptimizationCache::Key KeyA = SPIRVOptimizationCache::ComputeKey(SrcA, TargetEnv, Passes);
+    EXPECT_EQ(KeyA, SPIRVOptimizationCache::ComputeKey(SrcA, TargetEnv, Passes));
+    EXPECT_FALSE(KeyA == SPIRVOptimizationCache::ComputeKey(SrcB, TargetEnv, Passes));
+    EXPECT_FALSE(KeyA == SPIRVOptimizationCache::ComputeKey(SrcA, SPV_ENV_VULKAN_1_1, Passes));
+    EXPECT_FALSE(KeyA == SPIRVOptimizationCache::ComputeKey(SrcA, TargetEnv, SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION));
+
+    SPIRVOptimizationCache Cache;
+
+    EXPECT_EQ(OptimizeSPIRV(SrcA, TargetEnv, Passes, &Cache), RefA);
+    {
+        const SPIRVOptimizationCache::Statistics Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumEntries, 1u);
+        EXPECT_EQ(Stats.DataSize, RefA.size() * sizeof(uint32_t));
+        EXPECT_EQ(Stats.NumHits, 0u);
+        EXPECT_EQ(Stats.NumMisses, 1u);
+    }
+
+    EXPECT_EQ(OptimizeSPIRV(SrcA, TargetEnv, Passes, &Cache), RefA);
+    EXPECT_EQ(OptimizeSPIRV(SrcB, TargetEnv, Passes, &Cache), RefB);
+    EXPECT_EQ(OptimizeSPIRV(SrcB, TargetEnv, Passes, &Cache), RefB);
+    {
+        const SPIRVOptimizationCache::Statistics Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumEntries, 2u);
+        EXPECT_EQ(Stats.NumHits, 2u);
+        EXPECT_EQ(Stats.NumMisses, 2u);
+    }
+
+    // Different passes must not hit the entries
+    EXPECT_EQ(OptimizeSPIRV(SrcA, TargetEnv, SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION, &Cache), OptimizeSPIRV(SrcA, TargetEnv, SPIRV_OPTIMIZATION_FLAG_STRIP_REFLECTION));
+    EXPECT_EQ(Cache.GetStatistics().NumMisses, 3u);
+
+    Cache.Clear();
+    {
+        const SPIRVOptimizationCache::Statistics Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumEntries, 0u);
+        EXPECT_EQ(Stats.DataSize, 0u);
+        EXPECT_EQ(Stats.NumHits, 0u);
+        EXPECT_EQ(Stats.NumMisses, 0u);
+    }
+}
+
+TEST_F(SPIRVToolsTest, OptimizationCacheSizeLimit)
+{
+    const std::vector<uint32_t> Data(4, 0xCDu);
+
+    SPIRVOptimizationCache::Key Keys[4];
+    for (Uint64 i = 0; i < _countof(Keys); ++i)
+        Keys[i].Low = i + 1;
+
+    SPIRVOptimizationCache Cache{2 * Data.size() * sizeof(uint32_t)};
+
+    Cache.Add(Keys[0], Data);
+    Cache.Add(Keys[1], Data);
+    // Duplicate keys are ignored
+    Cache.Add(Keys[1], Data);
+    EXPECT_EQ(Cache.GetStatistics().NumEntries, 2u);
+    EXPECT_EQ(Cache.GetStatistics().DataSize, 2 * Data.size() * sizeof(uint32_t));
+
+    // The oldest entry must be evicted
+    Cache.Add(Keys[2], Data);
+    {
+        const SPIRVOptimizationCache::Statistics Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumEntries, 2u);
+        EXPECT_EQ(Stats.DataSize, 2 * Data.size() * sizeof(uint32_t));
+        EXPECT_EQ(Stats.NumEvictions, 1u);
+    }
+
+    std::vector<uint32_t> FoundData;
+    EXPECT_FALSE(Cache.Find(Keys[0], FoundData));
+    EXPECT_TRUE(Cache.Find(Keys[1], FoundData));
+    EXPECT_EQ(FoundData, Data);
+    EXPECT_TRUE(Cache.Find(Keys[2], FoundData));
+
+    // An entry that exceeds the limit on its own is not added
+    Cache.Add(Keys[3], std::vector<uint32_t>(3 * Data.size()));
+    EXPECT_FALSE(Cache.Find(Keys[3], FoundData));
+    EXPECT_TRUE(Cache.Find(Keys[1], FoundData));
+    EXPECT_TRUE(Cache.Find(Keys[2], FoundData));
+    EXPECT_EQ(Cache.GetStatistics().NumEvictions, 1u);
+}
+
+TEST_F(SPIRVToolsTest, OptimizationCacheStoreLoad)
+{
+    const std::vector<uint32_t> SrcA = CompileModule("1u");
+    const std::vector<uint32_t> SrcB = CompileModule("2u");
+    const std::vector<uint32_t> SrcC = CompileModule("3u");
+    ASSERT_FALSE(SrcA.empty());
+    ASSERT_FALSE(SrcB.empty());
+    ASSERT_FALSE(SrcC.empty());
+
+    RefCntAutoPtr<IDataBlob> pData;
+    std::vector<uint32_t>    RefA, RefB, RefC;
+    {
+        SPIRVOptimizationCache Cache;
+        RefA = OptimizeSPIRV(SrcA, TargetEnv, Passes, &Cache);
+        RefB = OptimizeSPIRV(SrcB, TargetEnv, Passes, &Cache);
+        RefC = OptimizeSPIRV(SrcC, TargetEnv, Passes, &Cache);
+        Cache.Store(&pData);
+        ASSERT_NE(pData, nullptr);
+    }
+
+    {
+        SPIRVOptimizationCache Cache;
+        ASSERT_TRUE(Cache.Load(pData));
+        EXPECT_EQ(Cache.GetStatistics().NumEntries, 3u);
+
+        EXPECT_EQ(OptimizeSPIRV(SrcA, TargetEnv, Passes, &Cache), RefA);
+        EXPECT_EQ(OptimizeSPIRV(SrcB, TargetEnv, Passes, &Cache), RefB);
+        EXPECT_EQ(OptimizeSPIRV(SrcC, TargetEnv, Passes, &Cache), RefC);
+
+        const SPIRVOptimizationCache::Statistics Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumHits, 3u);
+        EXPECT_EQ(Stats.NumMisses, 0u);
+
+        // Storing the loaded cache must produce the same data
+        RefCntAutoPtr<IDataBlob> pData2;
+        Cache.Store(&pData2);
+        ASSERT_NE(pData2, nullptr);
+        ASSERT_EQ(pData2->GetSize(), pData->GetSize());
+        EXPECT_EQ(memcmp(pData2->GetConstDataPtr(), pData->GetConstDataPtr(), pData->GetSize()), 0);
+    }
+
+    {
+        // Entries are loaded from the oldest to the newest, so the oldest one is evicted
+        SPIRVOptimizationCache Cache{(RefB.size() + RefC.size()) * sizeof(uint32_t)};
+        ASSERT_TRUE(Cache.Load(pData));
+        EXPECT_EQ(Cache.GetStatistics().NumEntries, 2u);
+
+        std::vector<uint32_t> FoundData;
+        EXPECT_FALSE(Cache.Find(SPIRVOptimizationCache::ComputeKey(SrcA, TargetEnv, Passes), FoundData));
+        EXPECT_TRUE(Cache.Find(SPIRVOptimizationCache::ComputeKey(SrcB, TargetEnv, Passes), FoundData));
+        EXPECT_TRUE(Cache.Find(SPIRVOptimizationCache::ComputeKey(SrcC, TargetEnv, Passes), FoundData));
+    }
+
+    {
+        SPIRVOptimizationCache Cache;
+
+        const char               Garbage[] = "Not an optimization cache";
+        RefCntAutoPtr<IDataBlob> pGarbage  = DataBlobImpl::Create(sizeof(Garbage), Garbage);
+
+        TestingEnvironment::ErrorScope ExpectedErrors{"Data blob does not contain a valid SPIR-V optimization cache"};
+        EXPECT_FALSE(Cache.Load(pGarbage));
+        EXPECT_EQ(Cache.GetStatistics().NumEntries, 0u);
+    }
+}
+
+TEST_F(SPIRVToolsTest, OptimizerPool)
+{
+    SPIRVOptimizerPool Pool{Passes};
+
+    std::unique_ptr<SPIRVOptimizer> pOptimizer0 = Pool.Acquire(TargetEnv);
+    std::unique_ptr<SPIRVOptimizer> pOptimizer1 = Pool.Acquire(TargetEnv);
+    ASSERT_TRUE(pOptimizer0);
+    ASSERT_TRUE(pOptimizer1);
+    EXPECT_NE(pOptimizer0.get(), pOptimizer1.get());
+    EXPECT_EQ(pOptimizer0->GetTargetEnv(), TargetEnv);
+    EXPECT_EQ(pOptimizer0->GetPasses(), Passes);
+    EXPECT_EQ(Pool.GetNumOptimizers(), 2u);
+
+    SPIRVOptimizer* pRawOptimizer0 = pOptimizer0.get();
+    Pool.Release(std::move(pOptimizer0));
+
+    // Released optimizer must be reused
+    pOptimizer0 = Pool.Acquire(TargetEnv);
+    EXPECT_EQ(pOptimizer0.get(), pRawOptimizer0);
+    EXPECT_EQ(Pool.GetNumOptimizers(), 2u);
+
+    // Optimizers for a different environment must not be reused
+    Pool.Release(std::move(pOptimizer1));
+    std::unique_ptr<SPIRVOptimizer> pOptimizer2 = Pool.Acquire(SPV_ENV_VULKAN_1_1);
+    ASSERT_TRUE(pOptimizer2);
+    EXPECT_EQ(pOptimizer2->GetTargetEnv(), SPV_ENV_VULKAN_1_1);
+    EXPECT_EQ(Pool.GetNumOptimizers(), 3u);
+
+    Pool.Release(std::move(pOptimizer0));
+    Pool.Release(std::move(pOptimizer2));
+}
+
+TEST_F(SPIRVToolsTest, OptimizeBatch)
+{
+    std::vector<std::vector<uint32_t>> SrcSPIRVs = {
+        CompileModule("1u"),
+        CompileModule("2u"),
+        CompileModule("1u"),
+        CompileModule("3u"),
+        CompileModule("2u"),
+    };
+    std::vector<std::vector<uint32_t>> RefSPIRVs;
+    for (const std::vector<uint32_t>& SrcSPIRV : SrcSPIRVs)
+    {
+        ASSERT_FALSE(SrcSPIRV.empty());
+        RefSPIRVs.emplace_back(OptimizeSPIRV(SrcSPIRV, TargetEnv, Passes));
+        ASSERT_FALSE(RefSPIRVs.back().empty());
+    }
+
+    EXPECT_TRUE(OptimizeSPIRVBatch(nullptr, 0, TargetEnv, Passes).empty());
+
+    EXPECT_EQ(OptimizeSPIRVBatch(SrcSPIRVs.data(), SrcSPIRVs.size(), TargetEnv, Passes), RefSPIRVs);
+
+    RefCntAutoPtr<IThreadPool> pThreadPool = CreateThreadPool(ThreadPoolCreateInfo{4});
+    ASSERT_NE(pThreadPool, nullptr);
+
+    // The time report is only produced when SPIRV-Tools are built with SPIRV_TIMER_ENABLED
+    std::string TimeReport;
+    EXPECT_EQ(OptimizeSPIRVBatch(SrcSPIRVs.data(), SrcSPIRVs.size(), TargetEnv, Passes, pThreadPool, nullptr, &TimeReport), RefSPIRVs);
+
+    SPIRVOptimizationCache Cache;
+    EXPECT_EQ(OptimizeSPIRVBatch(SrcSPIRVs.data(), SrcSPIRVs.size(), TargetEnv, Passes, pThreadPool, &Cache), RefSPIRVs);
+    {
+        // Identical modules are optimized once
+        const SPIRVOptimizationCache::Statistics Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumEntries, 3u);
+        EXPECT_EQ(Stats.NumHits, 0u);
+        EXPECT_EQ(Stats.NumMisses, 3u);
+    }
+
+    EXPECT_EQ(OptimizeSPIRVBatch(SrcSPIRVs.data(), SrcSPIRVs.size(), TargetEnv, Passes, nullptr, &Cache), RefSPIRVs);
+    {
+        const SPIRVOptimizationCache::Statistics Stats = Cache.GetStatistics();
+        EXPECT_EQ(Stats.NumEntries, 3u);
+        EXPECT_EQ(Stats.NumHits, 3u);
+        EXPECT_EQ(Stats.NumMisses, 3u);
+    }
+}
+
+} // namespace
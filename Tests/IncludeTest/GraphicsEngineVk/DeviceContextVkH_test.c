@@ -32,4 +32,11 @@ void TestDeviceContextVk_CInterface(IDeviceContextVk* pCtx)
 {
     IDeviceContextVk_TransitionImageLayout(pCtx, (ITexture*)NULL, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
     IDeviceContextVk_BufferMemoryBarrier(pCtx, (IBuffer*)NULL, VK_ACCESS_HOST_READ_BIT);
+    IDeviceContextVk_SetCullMode(pCtx, CULL_MODE_BACK);
+    IDeviceContextVk_SetFrontFace(pCtx, true);
+    IDeviceContextVk_SetPrimitiveTopology(pCtx, PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP);
+    IDeviceContextVk_SetDepthTestEnable(pCtx, true);
+    IDeviceContextVk_SetDepthWriteEnable(pCtx, false);
+    IDeviceContextVk_SetDepthFunc(pCtx, COMPARISON_FUNC_LESS);
+    IDeviceContextVk_SetStencilOp(pCtx, (const StencilOpDesc*)NULL, (const StencilOpDesc*)NULL);
 }